@@ -0,0 +1,282 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file aifw_invoke_main.cpp
+
+/// @brief Measure the latency of AIModel invokes, from pushed data to result.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <errno.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <memory>
+
+#include "aifw/aifw.h"
+#include "aifw/AIModel.h"
+
+using namespace aifw;
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define DEFAULT_INVOKES  1000
+#define MAX_VALUES       1024	/* Values of a row pushed at once, and of a result */
+
+#ifdef CONFIG_AIFW_USE_ONERT_MICRO
+#define ENGINE_NAME      "ONERTM"
+#elif defined(CONFIG_AIFW_USE_TFMICRO)
+#define ENGINE_NAME      "TFLM"
+#else
+#define ENGINE_NAME      "unknown"
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct aifwbench_result_s {
+	uint32_t min_us;
+	uint32_t avg_us;
+	uint32_t worst_us;
+	int heap_change;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char g_version[] = "aifwbench";
+static float g_input[MAX_VALUES];
+static float g_output[MAX_VALUES];
+static uint32_t g_seed = 0x2545f491;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t aifwbench_rand(void)
+{
+	/* xorshift32 */
+
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+static uint64_t aifwbench_now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static unsigned char *aifwbench_read_model(const char *path)
+{
+	unsigned char *model;
+	FILE *fp;
+	long size;
+
+	fp = fopen(path, "r");
+	if (!fp) {
+		printf("Failed to open %s, errno %d\n", path, errno);
+		return NULL;
+	}
+
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	if (size <= 0) {
+		printf("Invalid size %ld of %s\n", size, path);
+		fclose(fp);
+		return NULL;
+	}
+
+	model = (unsigned char *)malloc(size);
+	if (!model) {
+		printf("Failed to allocate %ld bytes for the model\n", size);
+		fclose(fp);
+		return NULL;
+	}
+
+	if (fread(model, 1, size, fp) != (size_t)size) {
+		printf("Failed to read %s, errno %d\n", path, errno);
+		free(model);
+		model = NULL;
+	}
+
+	fclose(fp);
+	return model;
+}
+
+/* Push 'invokes' rows of random values, each one is written to the data
+ * buffer, invoked and its result written back before pushData() returns.
+ */
+
+static int aifwbench_measure(AIModel &model, uint16_t inputs, uint16_t outputs, int invokes, struct aifwbench_result_s *res)
+{
+	uint64_t total_us = 0;
+	uint64_t start;
+	uint32_t elapsed;
+	struct mallinfo before;
+	struct mallinfo after;
+	AIFW_RESULT ret;
+	int i;
+	int j;
+
+	res->min_us = UINT32_MAX;
+	res->worst_us = 0;
+
+	before = mallinfo();
+	for (i = 0; i < invokes; i++) {
+		for (j = 0; j < inputs; j++) {
+			g_input[j] = (float)(aifwbench_rand() & 0xffff) / 65536.0f;
+		}
+
+		start = aifwbench_now_us();
+		ret = model.pushData(g_input, inputs);
+		if (ret < AIFW_OK) {
+			printf("pushData failed at %d, ret %d\n", i, ret);
+			return -1;
+		}
+		ret = model.getResultData(g_output, outputs);
+		elapsed = (uint32_t)(aifwbench_now_us() - start);
+		if (ret != AIFW_OK) {
+			printf("getResultData failed at %d, ret %d\n", i, ret);
+			return -1;
+		}
+
+		if (elapsed < res->min_us) {
+			res->min_us = elapsed;
+		}
+		if (elapsed > res->worst_us) {
+			res->worst_us = elapsed;
+		}
+		total_us += elapsed;
+	}
+	after = mallinfo();
+
+	res->avg_us = (uint32_t)(total_us / invokes);
+	res->heap_change = after.uordblks - before.uordblks;
+	return 0;
+}
+
+static int aifw_invoke_test(int argc, char *argv[])
+{
+	struct aifwbench_result_s res;
+	struct mallinfo before;
+	struct mallinfo after;
+	AIModelAttribute attr;
+	unsigned char *buf;
+	uint16_t inputs;
+	uint16_t outputs;
+	int invokes = DEFAULT_INVOKES;
+
+	if (argc < 4) {
+		printf("Usage: aifwbench <model file> <input count> <output count> [invokes]\n");
+		return 0;
+	}
+
+	inputs = (uint16_t)atoi(argv[2]);
+	outputs = (uint16_t)atoi(argv[3]);
+	if (argc > 4) {
+		invokes = atoi(argv[4]);
+	}
+	if (inputs == 0 || inputs > MAX_VALUES || outputs == 0 || outputs > MAX_VALUES || invokes <= 0) {
+		printf("Input and output counts should be 1 to %d, invokes more than 0\n", MAX_VALUES);
+		return 0;
+	}
+
+	buf = aifwbench_read_model(argv[1]);
+	if (!buf) {
+		return 0;
+	}
+
+	/* No data processor, rows hold the input values followed by the result */
+
+	memset(&attr, 0, sizeof(attr));
+	attr.version = g_version;
+	attr.model = buf;
+	attr.maxRowsDataBuffer = 1;
+	attr.rawDataCount = inputs;
+	attr.windowSize = 1;
+	attr.invokeInputCount = inputs;
+	attr.invokeOutputCount = outputs;
+	attr.postProcessResultCount = outputs;
+	attr.inferenceResultCount = outputs;
+
+	{
+		AIModel model;
+
+		/* With CONFIG_ONERT_MICRO_ARENA, the tensors are planned at load */
+
+		before = mallinfo();
+		if (model.loadModel(attr) != AIFW_OK) {
+			printf("Failed to load %s\n", argv[1]);
+			free(buf);
+			return 0;
+		}
+		after = mallinfo();
+
+		/* The engine may set up its tensors at the first invoke */
+
+		if (aifwbench_measure(model, inputs, outputs, 1, &res) == 0) {
+			printf("\n%s, %d invokes of %u inputs and %u outputs, engine %s\n", argv[1], invokes, inputs, outputs, ENGINE_NAME);
+			printf("Heap used by the load %d bytes\n", after.uordblks - before.uordblks);
+			printf(" first us | min us | avg us | worst us | heap change\n");
+			printf("----------|--------|--------|----------|------------\n");
+			printf(" %8u |", res.avg_us);
+
+			if (aifwbench_measure(model, inputs, outputs, invokes, &res) == 0) {
+				printf(" %6u | %6u | %8u | %d bytes\n", res.min_us, res.avg_us, res.worst_us, res.heap_change);
+			} else {
+				printf(" failed\n");
+			}
+		}
+	}
+
+	free(buf);
+	return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+extern "C" {
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int aifwbench_main(int argc, char *argv[])
+#endif
+{
+	printf("AIFW Invoke Test!!\n");
+	task_create("AIFW invoke test", 100, 8192, aifw_invoke_test, &argv[1]);
+
+	return 0;
+}
+}
@@ -0,0 +1,243 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file arastorage_batch_main.c
+
+/// @brief Measure the tuples per second inserted one by one and in batches.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <arastorage/arastorage.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define DEFAULT_ROWS     512
+#define QUERY_LEN        64
+#define KEY_RANGE        100000
+
+#ifdef CONFIG_DB_TUPLES_LIMIT
+#define MAX_ROWS         CONFIG_DB_TUPLES_LIMIT
+#else
+#define MAX_ROWS         1000
+#endif
+
+#define RELATION         "batch"
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const int g_batch_sizes[] = { 0, 1, 16, 256 };	/* 0 for no batch */
+static char g_query[QUERY_LEN];
+static uint32_t g_seed;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t arabatch_rand(void)
+{
+	/* xorshift32 */
+
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+static uint64_t arabatch_now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static db_result_t arabatch_exec(const char *format)
+{
+	db_result_t res;
+
+	snprintf(g_query, QUERY_LEN, format, RELATION);
+	res = db_exec(g_query);
+	if (DB_ERROR(res)) {
+		printf("Failed to run \"%s\", %s\n", g_query, db_get_result_message(res));
+	}
+	return res;
+}
+
+static db_result_t arabatch_create(void)
+{
+	if (DB_ERROR(arabatch_exec("CREATE RELATION %s;"))) {
+		return DB_RELATIONAL_ERROR;
+	}
+	if (DB_ERROR(arabatch_exec("CREATE ATTRIBUTE id DOMAIN int IN %s;"))) {
+		return DB_RELATIONAL_ERROR;
+	}
+	if (DB_ERROR(arabatch_exec("CREATE ATTRIBUTE val DOMAIN long IN %s;"))) {
+		return DB_RELATIONAL_ERROR;
+	}
+	if (DB_ERROR(arabatch_exec("CREATE INDEX %s.val TYPE bplustree;"))) {
+		return DB_RELATIONAL_ERROR;
+	}
+	return DB_OK;
+}
+
+static int arabatch_count(void)
+{
+	db_cursor_t *cursor;
+	int count;
+
+	snprintf(g_query, QUERY_LEN, "SELECT id FROM %s WHERE id >= 0;", RELATION);
+	cursor = db_query(g_query);
+	if (cursor == NULL) {
+		return 0;
+	}
+	count = cursor_get_count(cursor);
+	db_cursor_free(cursor);
+	return count < 0 ? 0 : count;
+}
+
+/* Insert rows of random keys in batches of batch_size rows, or one by one
+ * if it is 0. Finalizing the statement releases the relation, which writes
+ * what is left of the index.
+ */
+
+static int arabatch_insert(int rows, int batch_size)
+{
+	db_stmt_t *stmt;
+	db_result_t res = DB_OK;
+	long val;
+	int i;
+
+	snprintf(g_query, QUERY_LEN, "INSERT (?, ?) INTO %s;", RELATION);
+	stmt = db_prepare(g_query);
+	if (stmt == NULL) {
+		printf("Failed to prepare \"%s\"\n", g_query);
+		return -1;
+	}
+
+	for (i = 0; i < rows && DB_SUCCESS(res); i++) {
+		if (batch_size > 0 && i % batch_size == 0) {
+			res = db_begin(stmt, batch_size);
+			if (DB_ERROR(res)) {
+				break;
+			}
+		}
+		val = arabatch_rand() % KEY_RANGE;
+		if (DB_ERROR(db_bind(stmt, 0, DOMAIN_INT, &i)) || DB_ERROR(db_bind(stmt, 1, DOMAIN_LONG, &val))) {
+			res = DB_ARGUMENT_ERROR;
+			break;
+		}
+		res = db_step(stmt, NULL);
+		if (DB_SUCCESS(res) && batch_size > 0 && (i % batch_size == batch_size - 1 || i == rows - 1)) {
+			res = db_commit(stmt);
+		}
+	}
+	if (DB_ERROR(res)) {
+		printf("Failed to insert row %d, %s\n", i, db_get_result_message(res));
+	}
+
+	db_finalize(stmt);
+	return DB_ERROR(res) ? -1 : 0;
+}
+
+static int arastorage_batch_test(int argc, char *argv[])
+{
+	uint64_t start;
+	uint64_t elapsed_us;
+	char name[8];
+	int rows = DEFAULT_ROWS;
+	int count;
+	int i;
+
+	if (argc > 1) {
+		rows = atoi(argv[1]);
+	}
+	if (rows <= 0 || rows > MAX_ROWS) {
+		printf("Usage: arabatch [rows, 1 to %d]\n", MAX_ROWS);
+		return 0;
+	}
+
+	if (DB_ERROR(db_init())) {
+		printf("Failed to init the database\n");
+		return 0;
+	}
+
+	printf("\n%d rows with random keys in a bplus-tree index\n", rows);
+	printf(" batch  | us per row |  rows per s | rows found\n");
+	printf("--------|------------|-------------|-----------\n");
+
+	for (i = 0; i < sizeof(g_batch_sizes) / sizeof(g_batch_sizes[0]); i++) {
+		if (DB_ERROR(arabatch_create())) {
+			break;
+		}
+
+		/* Each mode inserts the same keys */
+
+		g_seed = 0x2545f491;
+		start = arabatch_now_us();
+		if (arabatch_insert(rows, g_batch_sizes[i]) != 0) {
+			(void)arabatch_exec("REMOVE RELATION %s;");
+			break;
+		}
+		elapsed_us = arabatch_now_us() - start;
+		if (elapsed_us == 0) {
+			elapsed_us = 1;
+		}
+		count = arabatch_count();
+
+		if (g_batch_sizes[i] == 0) {
+			snprintf(name, sizeof(name), "step");
+		} else {
+			snprintf(name, sizeof(name), "%d", g_batch_sizes[i]);
+		}
+		printf(" %-6s | %10u | %11u | %10d\n", name, (uint32_t)(elapsed_us / rows), (uint32_t)((uint64_t)rows * 1000000ULL / elapsed_us), count);
+
+		(void)arabatch_exec("REMOVE RELATION %s;");
+	}
+
+	db_deinit();
+
+	return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int arabatch_main(int argc, char *argv[])
+#endif
+{
+	printf("Arastorage Batch Insert Test!!\n");
+	task_create("arabatch_test", 100, 8192, arastorage_batch_test, &argv[1]);
+
+	return 0;
+}
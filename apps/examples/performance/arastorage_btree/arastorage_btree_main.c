@@ -0,0 +1,301 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file arastorage_btree_main.c
+
+/// @brief Measure the lookups and range scans of a relation by kind of index.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <arastorage/arastorage.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define DEFAULT_QUERIES  100
+#define QUERY_LEN        80
+#define KEY_RANGE        1000000
+#define RANGE_SPAN       (KEY_RANGE / 1000)
+#define BATCH_SIZE       256
+
+#ifdef CONFIG_DB_TUPLES_LIMIT
+#define MAX_ROWS         CONFIG_DB_TUPLES_LIMIT
+#else
+#define MAX_ROWS         1000
+#endif
+
+#define RELATION         "scan"
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const int g_rows[] = { 1000, 10000, 100000 };
+static const char *g_index_types[] = { "none", "bplustree", "btree" };
+static char g_query[QUERY_LEN];
+static uint32_t g_seed;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t arabtree_rand(void)
+{
+	/* xorshift32 */
+
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+static uint64_t arabtree_now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static db_result_t arabtree_exec(const char *format, const char *arg)
+{
+	db_result_t res;
+
+	snprintf(g_query, QUERY_LEN, format, RELATION, arg);
+	res = db_exec(g_query);
+	if (DB_ERROR(res)) {
+		printf("Failed to run \"%s\", %s\n", g_query, db_get_result_message(res));
+	}
+	return res;
+}
+
+static db_result_t arabtree_create(const char *index_type)
+{
+	if (DB_ERROR(arabtree_exec("CREATE RELATION %s;", NULL))) {
+		return DB_RELATIONAL_ERROR;
+	}
+	if (DB_ERROR(arabtree_exec("CREATE ATTRIBUTE id DOMAIN long IN %s;", NULL))) {
+		return DB_RELATIONAL_ERROR;
+	}
+	if (DB_ERROR(arabtree_exec("CREATE ATTRIBUTE val DOMAIN long IN %s;", NULL))) {
+		return DB_RELATIONAL_ERROR;
+	}
+	if (strcmp(index_type, "none") != 0 && DB_ERROR(arabtree_exec("CREATE INDEX %s.val TYPE %s;", index_type))) {
+		return DB_RELATIONAL_ERROR;
+	}
+	return DB_OK;
+}
+
+/* Insert rows of random keys in batches. Finalizing the statement releases
+ * the relation, which writes what is left of the index.
+ */
+
+static int arabtree_insert(int rows)
+{
+	db_stmt_t *stmt;
+	db_result_t res = DB_OK;
+	long id;
+	long val;
+	int i;
+
+	snprintf(g_query, QUERY_LEN, "INSERT (?, ?) INTO %s;", RELATION);
+	stmt = db_prepare(g_query);
+	if (stmt == NULL) {
+		printf("Failed to prepare \"%s\"\n", g_query);
+		return -1;
+	}
+
+	for (i = 0; i < rows && DB_SUCCESS(res); i++) {
+		if (i % BATCH_SIZE == 0) {
+			res = db_begin(stmt, BATCH_SIZE);
+			if (DB_ERROR(res)) {
+				break;
+			}
+		}
+		id = i;
+		val = arabtree_rand() % KEY_RANGE;
+		if (DB_ERROR(db_bind(stmt, 0, DOMAIN_LONG, &id)) || DB_ERROR(db_bind(stmt, 1, DOMAIN_LONG, &val))) {
+			res = DB_ARGUMENT_ERROR;
+			break;
+		}
+		res = db_step(stmt, NULL);
+		if (DB_SUCCESS(res) && (i % BATCH_SIZE == BATCH_SIZE - 1 || i == rows - 1)) {
+			res = db_commit(stmt);
+		}
+	}
+	if (DB_ERROR(res)) {
+		printf("Failed to insert row %d, %s\n", i, db_get_result_message(res));
+	}
+
+	db_finalize(stmt);
+	return DB_ERROR(res) ? -1 : 0;
+}
+
+/* Run queries of keys from min to min + span, and return the elapsed time.
+ * The keys of lookups are drawn again from the seed of the insertions, so
+ * that each of them is found.
+ */
+
+static uint64_t arabtree_query(int rows, int queries, long span, uint32_t seed, int *found)
+{
+	db_stmt_t *stmt;
+	db_cursor_t *cursor;
+	db_result_t res;
+	uint64_t start;
+	long min;
+	long max;
+	int count;
+	int i;
+
+	snprintf(g_query, QUERY_LEN, "SELECT val FROM %s WHERE val >= ? AND val <= ?;", RELATION);
+	stmt = db_prepare(g_query);
+	if (stmt == NULL) {
+		printf("Failed to prepare \"%s\"\n", g_query);
+		return 0;
+	}
+
+	g_seed = seed;
+	*found = 0;
+	start = arabtree_now_us();
+	for (i = 0; i < queries; i++) {
+		min = arabtree_rand() % KEY_RANGE;
+		max = min + span;
+		cursor = NULL;
+		if (DB_ERROR(db_bind(stmt, 0, DOMAIN_LONG, &min)) || DB_ERROR(db_bind(stmt, 1, DOMAIN_LONG, &max))) {
+			printf("Failed to bind keys from %ld to %ld\n", min, max);
+			break;
+		}
+
+		/* No cursor is made when an index finds no row */
+
+		res = db_step(stmt, &cursor);
+		if (DB_ERROR(res) && res != DB_CURSOR_ERROR) {
+			printf("Failed to query keys from %ld to %ld, %s\n", min, max, db_get_result_message(res));
+			break;
+		}
+		if (cursor != NULL) {
+			count = cursor_get_count(cursor);
+			if (count > 0) {
+				*found += count;
+			}
+			db_cursor_free(cursor);
+		}
+		if (span == 0 && (i + 1) % rows == 0) {
+			g_seed = seed;
+		}
+	}
+	start = arabtree_now_us() - start;
+
+	db_finalize(stmt);
+	return start;
+}
+
+static void arabtree_run(int rows, const char *index_type, int queries)
+{
+	uint64_t insert_us;
+	uint64_t lookup_us;
+	uint64_t range_us;
+	uint32_t seed;
+	int lookups;
+	int found;
+
+	if (DB_ERROR(arabtree_create(index_type))) {
+		(void)arabtree_exec("REMOVE RELATION %s;", NULL);
+		return;
+	}
+
+	seed = 0x2545f491 + rows;
+	g_seed = seed;
+	insert_us = arabtree_now_us();
+	if (arabtree_insert(rows) != 0) {
+		printf(" %6d | %-9s | insertion failed\n", rows, index_type);
+		(void)arabtree_exec("REMOVE RELATION %s;", NULL);
+		return;
+	}
+	insert_us = arabtree_now_us() - insert_us;
+
+	lookup_us = arabtree_query(rows, queries, 0, seed, &lookups);
+	range_us = arabtree_query(rows, queries, RANGE_SPAN, ~seed, &found);
+
+	printf(" %6d | %-9s | %9u | %9u | %9u | %5d | %5d\n", rows, index_type, (uint32_t)(insert_us / rows), (uint32_t)(lookup_us / queries), (uint32_t)(range_us / queries), lookups, found);
+
+	(void)arabtree_exec("REMOVE RELATION %s;", NULL);
+}
+
+static int arastorage_btree_test(int argc, char *argv[])
+{
+	int queries = DEFAULT_QUERIES;
+	int i;
+	int j;
+
+	if (argc > 1) {
+		queries = atoi(argv[1]);
+	}
+	if (queries <= 0) {
+		printf("Usage: arabtree [queries]\n");
+		return 0;
+	}
+
+	if (DB_ERROR(db_init())) {
+		printf("Failed to init the database\n");
+		return 0;
+	}
+
+	printf("\n%d lookups and range scans of %d keys, keys in 0 to %d\n", queries, RANGE_SPAN, KEY_RANGE - 1);
+	printf("  rows  |   index   | insert us | lookup us |  range us | found | in ranges\n");
+	printf("--------|-----------|-----------|-----------|-----------|-------|----------\n");
+
+	for (i = 0; i < sizeof(g_rows) / sizeof(g_rows[0]); i++) {
+		if (g_rows[i] > MAX_ROWS) {
+			printf(" %6d | skipped, CONFIG_DB_TUPLES_LIMIT is %d\n", g_rows[i], MAX_ROWS);
+			continue;
+		}
+		for (j = 0; j < sizeof(g_index_types) / sizeof(g_index_types[0]); j++) {
+			arabtree_run(g_rows[i], g_index_types[j], queries);
+		}
+	}
+
+	db_deinit();
+
+	return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int arabtree_main(int argc, char *argv[])
+#endif
+{
+	printf("Arastorage Btree Index Test!!\n");
+	task_create("arabtree_test", 100, 8192, arastorage_btree_test, &argv[1]);
+
+	return 0;
+}
@@ -0,0 +1,288 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file arastorage_stmt_main.c
+
+/// @brief Measure repeated arastorage queries, parsed at each call or prepared.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <arastorage/arastorage.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define DEFAULT_ROWS     100
+#define DEFAULT_SELECTS  200
+#define QUERY_LEN        128
+
+#ifdef CONFIG_DB_TUPLES_LIMIT
+#define MAX_ROWS         CONFIG_DB_TUPLES_LIMIT
+#else
+#define MAX_ROWS         1000
+#endif
+
+#define TEXT_RELATION    "bench1"
+#define STMT_RELATION    "bench2"
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static char g_query[QUERY_LEN];
+static uint32_t g_seed = 0x2545f491;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t arabench_rand(void)
+{
+	/* xorshift32 */
+
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+static uint64_t arabench_now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static void arabench_print(const char *name, int ops, uint64_t elapsed_us)
+{
+	if (elapsed_us == 0) {
+		elapsed_us = 1;
+	}
+	printf(" %-6s | %8d | %9u | %10u\n", name, ops, (uint32_t)(elapsed_us / ops), (uint32_t)((uint64_t)ops * 1000000ULL / elapsed_us));
+}
+
+static db_result_t arabench_exec(const char *format, const char *relation)
+{
+	db_result_t res;
+
+	snprintf(g_query, QUERY_LEN, format, relation);
+	res = db_exec(g_query);
+	if (DB_ERROR(res)) {
+		printf("Failed to run \"%s\", %s\n", g_query, db_get_result_message(res));
+	}
+	return res;
+}
+
+static db_result_t arabench_create(const char *relation)
+{
+	if (DB_ERROR(arabench_exec("CREATE RELATION %s;", relation))) {
+		return DB_RELATIONAL_ERROR;
+	}
+	if (DB_ERROR(arabench_exec("CREATE ATTRIBUTE id DOMAIN int IN %s;", relation))) {
+		return DB_RELATIONAL_ERROR;
+	}
+	if (DB_ERROR(arabench_exec("CREATE ATTRIBUTE val DOMAIN long IN %s;", relation))) {
+		return DB_RELATIONAL_ERROR;
+	}
+	return DB_OK;
+}
+
+/* Both selects read the rows of the result, as an application would */
+
+static bool arabench_read(db_cursor_t *cursor, int id)
+{
+	bool found;
+
+	if (cursor == NULL) {
+		return false;
+	}
+	found = cursor_get_count(cursor) == 1 && DB_SUCCESS(cursor_move_first(cursor)) && cursor_get_int_value(cursor, 0) == id;
+	db_cursor_free(cursor);
+	return found;
+}
+
+static int arabench_insert_text(int rows)
+{
+	int i;
+
+	for (i = 0; i < rows; i++) {
+		snprintf(g_query, QUERY_LEN, "INSERT (%d, %d) INTO %s;", i, i * 10, TEXT_RELATION);
+		if (DB_ERROR(db_exec(g_query))) {
+			printf("Failed to insert row %d\n", i);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static int arabench_insert_stmt(int rows)
+{
+	db_stmt_t *stmt;
+	long val;
+	int ret = 0;
+	int i;
+
+	snprintf(g_query, QUERY_LEN, "INSERT (?, ?) INTO %s;", STMT_RELATION);
+	stmt = db_prepare(g_query);
+	if (stmt == NULL) {
+		printf("Failed to prepare \"%s\"\n", g_query);
+		return -1;
+	}
+	for (i = 0; i < rows; i++) {
+		val = i * 10;
+		if (DB_ERROR(db_bind(stmt, 0, DOMAIN_INT, &i)) || DB_ERROR(db_bind(stmt, 1, DOMAIN_LONG, &val)) || DB_ERROR(db_step(stmt, NULL))) {
+			printf("Failed to insert row %d\n", i);
+			ret = -1;
+			break;
+		}
+	}
+	db_finalize(stmt);
+	return ret;
+}
+
+static int arabench_select_text(int rows, int selects)
+{
+	int id;
+	int i;
+
+	for (i = 0; i < selects; i++) {
+		id = arabench_rand() % rows;
+		snprintf(g_query, QUERY_LEN, "SELECT id, val FROM %s WHERE id = %d;", TEXT_RELATION, id);
+		if (!arabench_read(db_query(g_query), id)) {
+			printf("Failed to select id %d\n", id);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static int arabench_select_stmt(int rows, int selects)
+{
+	db_cursor_t *cursor;
+	db_stmt_t *stmt;
+	int ret = 0;
+	int id;
+	int i;
+
+	snprintf(g_query, QUERY_LEN, "SELECT id, val FROM %s WHERE id = ?;", TEXT_RELATION);
+	stmt = db_prepare(g_query);
+	if (stmt == NULL) {
+		printf("Failed to prepare \"%s\"\n", g_query);
+		return -1;
+	}
+	for (i = 0; i < selects; i++) {
+		id = arabench_rand() % rows;
+		cursor = NULL;
+		if (DB_ERROR(db_bind(stmt, 0, DOMAIN_INT, &id)) || DB_ERROR(db_step(stmt, &cursor)) || !arabench_read(cursor, id)) {
+			printf("Failed to select id %d\n", id);
+			ret = -1;
+			break;
+		}
+	}
+	db_finalize(stmt);
+	return ret;
+}
+
+static int arastorage_stmt_test(int argc, char *argv[])
+{
+	uint64_t start;
+	int rows = DEFAULT_ROWS;
+	int selects = DEFAULT_SELECTS;
+
+	if (argc > 1) {
+		rows = atoi(argv[1]);
+	}
+	if (argc > 2) {
+		selects = atoi(argv[2]);
+	}
+	if (rows <= 0 || rows > MAX_ROWS || selects <= 0) {
+		printf("Usage: arabench [rows, 1 to %d] [selects]\n", MAX_ROWS);
+		return 0;
+	}
+
+	if (DB_ERROR(db_init())) {
+		printf("Failed to init the database\n");
+		return 0;
+	}
+	if (DB_ERROR(arabench_create(TEXT_RELATION)) || DB_ERROR(arabench_create(STMT_RELATION))) {
+		goto out;
+	}
+
+	printf("\n%d rows, %d selects by id\n", rows, selects);
+	printf(" op     |      ops | us per op |  ops per s\n");
+	printf("--------|----------|-----------|-----------\n");
+
+	/* Lower case runs the text queries, upper case the prepared ones */
+
+	start = arabench_now_us();
+	if (arabench_insert_text(rows) != 0) {
+		goto out;
+	}
+	arabench_print("insert", rows, arabench_now_us() - start);
+
+	start = arabench_now_us();
+	if (arabench_insert_stmt(rows) != 0) {
+		goto out;
+	}
+	arabench_print("INSERT", rows, arabench_now_us() - start);
+
+	start = arabench_now_us();
+	if (arabench_select_text(rows, selects) != 0) {
+		goto out;
+	}
+	arabench_print("select", selects, arabench_now_us() - start);
+
+	start = arabench_now_us();
+	if (arabench_select_stmt(rows, selects) != 0) {
+		goto out;
+	}
+	arabench_print("SELECT", selects, arabench_now_us() - start);
+
+out:
+	(void)arabench_exec("REMOVE RELATION %s;", TEXT_RELATION);
+	(void)arabench_exec("REMOVE RELATION %s;", STMT_RELATION);
+	db_deinit();
+
+	return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int arabench_main(int argc, char *argv[])
+#endif
+{
+	printf("Arastorage Prepared Statement Test!!\n");
+	task_create("arabench_test", 100, 8192, arastorage_stmt_test, &argv[1]);
+
+	return 0;
+}
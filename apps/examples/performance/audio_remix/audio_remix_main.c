@@ -0,0 +1,420 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file audio_remix_main.c
+
+/// @brief Check and measure the audio remix kernels of the media framework.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#ifndef AUDREMIX_HOST
+#include <tinyara/config.h>
+#include <sched.h>
+#endif
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "utils/remix_kernels.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define MAX_CHANNELS     6
+#define MAX_FRAMES       256	/* Frames per call, like an audio period */
+#define GUARD_SAMPLES    8	/* Checked after the output for overruns */
+#define GUARD_VALUE      0x5a5a
+#define NUM_ROUNDS       20	/* Random inputs per length when checking */
+#define BENCH_CALLS      2000	/* Calls of MAX_FRAMES frames when measuring */
+
+#define BUF_SAMPLES      (MAX_FRAMES * MAX_CHANNELS + GUARD_SAMPLES)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Every kernel is called as a rechannel, volume and mix work on stereo */
+
+typedef void (*remix_fn_t)(const int16_t *in, int16_t *out, uint32_t frames);
+
+struct remix_kernel_s {
+	const char *name;
+	uint32_t in_ch;
+	uint32_t out_ch;
+	remix_fn_t fast;
+	remix_fn_t ref;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static int16_t g_src[BUF_SAMPLES];
+static int16_t g_duck[BUF_SAMPLES];
+static int16_t g_out_ref[BUF_SAMPLES];
+static int16_t g_out_fast[BUF_SAMPLES];
+static uint16_t g_gain;
+static uint32_t g_seed = 0x2545f491;
+
+static const uint16_t g_gains[] = {0, 1, 0x0b50, PCM_GAIN_UNITY, 0x1800, 0x7fff};
+static const uint32_t g_lengths[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 100, MAX_FRAMES - 1, MAX_FRAMES};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void mono_to_stereo(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_mono_to_stereo(in, out, frames);
+}
+
+static void mono_to_stereo_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_mono_to_stereo_ref(in, out, frames);
+}
+
+static void stereo_to_mono(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_stereo_to_mono(in, out, frames);
+}
+
+static void stereo_to_mono_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_stereo_to_mono_ref(in, out, frames);
+}
+
+static void front_2_1(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_downmix_front(in, 3, out, frames);
+}
+
+static void front_2_1_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_downmix_front_ref(in, 3, out, frames);
+}
+
+static void surround(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_downmix_surround(in, 3, out, frames);
+}
+
+static void surround_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_downmix_surround_ref(in, 3, out, frames);
+}
+
+static void surround_3_1(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_downmix_surround(in, 4, out, frames);
+}
+
+static void surround_3_1_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_downmix_surround_ref(in, 4, out, frames);
+}
+
+static void quad(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_downmix_quad(in, out, frames);
+}
+
+static void quad_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_downmix_quad_ref(in, out, frames);
+}
+
+static void five_0(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_downmix_5ch(in, 5, out, frames);
+}
+
+static void five_0_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_downmix_5ch_ref(in, 5, out, frames);
+}
+
+static void five_1(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_downmix_5ch(in, 6, out, frames);
+}
+
+static void five_1_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	remix_downmix_5ch_ref(in, 6, out, frames);
+}
+
+/* The volume works in place, the input is copied unless it already is the output */
+
+static void volume(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	if (in != out) {
+		memcpy(out, in, frames * 2 * sizeof(int16_t));
+	}
+	pcm_scale_volume(out, frames * 2, g_gain);
+}
+
+static void volume_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	if (in != out) {
+		memcpy(out, in, frames * 2 * sizeof(int16_t));
+	}
+	pcm_scale_volume_ref(out, frames * 2, g_gain);
+}
+
+static void ducking(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	pcm_mix_ducked(in, g_duck, out, frames * 2, g_gain);
+}
+
+static void ducking_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	pcm_mix_ducked_ref(in, g_duck, out, frames * 2, g_gain);
+}
+
+static const struct remix_kernel_s g_kernels[] = {
+	{"mono -> stereo  ", 1, 2, mono_to_stereo, mono_to_stereo_ref},
+	{"stereo -> mono  ", 2, 1, stereo_to_mono, stereo_to_mono_ref},
+	{"2.1 -> stereo   ", 3, 2, front_2_1, front_2_1_ref},
+	{"3.0 -> stereo   ", 3, 2, surround, surround_ref},
+	{"3.1 -> stereo   ", 4, 2, surround_3_1, surround_3_1_ref},
+	{"quad -> stereo  ", 4, 2, quad, quad_ref},
+	{"5.0 -> stereo   ", 5, 2, five_0, five_0_ref},
+	{"5.1 -> stereo   ", 6, 2, five_1, five_1_ref},
+	{"volume          ", 2, 2, volume, volume_ref},
+	{"ducking mix     ", 2, 2, ducking, ducking_ref},
+};
+
+#define NUM_KERNELS      (sizeof(g_kernels) / sizeof(g_kernels[0]))
+
+static uint32_t audremix_rand(void)
+{
+	/* xorshift32 */
+
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+/* Random samples, one in four at full scale to hit the saturation */
+
+static void audremix_fill(int16_t *buf, uint32_t samples)
+{
+	uint32_t i;
+	uint32_t r;
+
+	for (i = 0; i < samples; i++) {
+		r = audremix_rand();
+		switch (r & 7) {
+		case 0:
+			buf[i] = INT16_MIN;
+			break;
+		case 1:
+			buf[i] = INT16_MAX;
+			break;
+		default:
+			buf[i] = (int16_t)(r >> 16);
+			break;
+		}
+	}
+}
+
+static void audremix_guard(int16_t *buf, uint32_t samples)
+{
+	uint32_t i;
+
+	for (i = 0; i < BUF_SAMPLES; i++) {
+		buf[i] = (i < samples) ? 0 : GUARD_VALUE;
+	}
+}
+
+static int audremix_compare(const struct remix_kernel_s *k, const int16_t *fast, uint32_t frames, const char *how)
+{
+	uint32_t samples = frames * k->out_ch;
+	uint32_t i;
+
+	for (i = 0; i < samples; i++) {
+		if (fast[i] != g_out_ref[i]) {
+			printf(" %s: %s, %u frames, gain 0x%04x: sample %u is %d, expected %d\n", k->name, how, frames, g_gain, i, fast[i], g_out_ref[i]);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+/* Compare the kernel with its reference on random input of every length,
+ * both out of place and in place, and check nothing is written past the
+ * output in the first case.
+ */
+
+static int audremix_check(const struct remix_kernel_s *k)
+{
+	static int16_t work[BUF_SAMPLES];
+	uint32_t frames;
+	uint32_t samples;
+	int l;
+	int g;
+	int n;
+	int i;
+
+	for (g = 0; g < sizeof(g_gains) / sizeof(g_gains[0]); g++) {
+		g_gain = g_gains[g];
+		for (l = 0; l < sizeof(g_lengths) / sizeof(g_lengths[0]); l++) {
+			frames = g_lengths[l];
+			samples = frames * k->out_ch;
+			for (n = 0; n < NUM_ROUNDS; n++) {
+				audremix_fill(g_src, frames * k->in_ch);
+				audremix_fill(g_duck, frames * 2);
+
+				audremix_guard(g_out_ref, samples);
+				audremix_guard(g_out_fast, samples);
+				k->ref(g_src, g_out_ref, frames);
+				k->fast(g_src, g_out_fast, frames);
+				if (audremix_compare(k, g_out_fast, frames, "out of place") != 0) {
+					return -1;
+				}
+				for (i = samples; i < BUF_SAMPLES; i++) {
+					if (g_out_fast[i] != GUARD_VALUE) {
+						printf(" %s: %u frames, written past the output at %d\n", k->name, frames, i);
+						return -1;
+					}
+				}
+
+				memcpy(work, g_src, frames * k->in_ch * sizeof(int16_t));
+				k->fast(work, work, frames);
+				if (audremix_compare(k, work, frames, "in place") != 0) {
+					return -1;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+static uint64_t audremix_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* Time per frame in tenths of a nanosecond */
+
+static uint32_t audremix_measure(remix_fn_t fn)
+{
+	uint64_t start;
+	uint64_t elapsed;
+	int i;
+
+	fn(g_src, g_out_ref, MAX_FRAMES);
+
+	start = audremix_now_ns();
+	for (i = 0; i < BENCH_CALLS; i++) {
+		fn(g_src, g_out_ref, MAX_FRAMES);
+	}
+	elapsed = audremix_now_ns() - start;
+
+	return (uint32_t)(elapsed * 10 / ((uint64_t)BENCH_CALLS * MAX_FRAMES));
+}
+
+static int audio_remix_test(int argc, char *argv[])
+{
+	const struct remix_kernel_s *k;
+	uint32_t ref_ns;
+	uint32_t fast_ns;
+	uint32_t mhz = 0;
+	int nfail = 0;
+	int i;
+
+	if (argc > 1) {
+		mhz = (uint32_t)atoi(argv[1]);
+	}
+
+	printf("\nKernels : %s\n", REMIX_KERNELS_ARCH);
+
+	printf("\nBit exactness against the scalar reference\n");
+	for (i = 0; i < NUM_KERNELS; i++) {
+		if (audremix_check(&g_kernels[i]) != 0) {
+			nfail++;
+		}
+	}
+	printf(" %d of %d kernels differ\n", nfail, (int)NUM_KERNELS);
+
+	audremix_fill(g_src, MAX_FRAMES * MAX_CHANNELS);
+	audremix_fill(g_duck, MAX_FRAMES * 2);
+	g_gain = 0x0b50;
+
+	printf("\n%d calls of %d frames, time per frame", BENCH_CALLS, MAX_FRAMES);
+	if (mhz > 0) {
+		printf(" and cycles per frame at %u MHz\n", mhz);
+		printf(" Kernel           | ref ns | fast ns | speedup | ref cyc | fast cyc\n");
+		printf("------------------|--------|---------|---------|---------|---------\n");
+	} else {
+		printf("\n Kernel           | ref ns | fast ns | speedup\n");
+		printf("------------------|--------|---------|--------\n");
+	}
+
+	for (i = 0; i < NUM_KERNELS; i++) {
+		k = &g_kernels[i];
+		ref_ns = audremix_measure(k->ref);
+		fast_ns = audremix_measure(k->fast);
+		if (fast_ns == 0) {
+			fast_ns = 1;
+		}
+
+		printf(" %s | %4u.%u | %5u.%u | %4u.%02u", k->name, ref_ns / 10, ref_ns % 10, fast_ns / 10, fast_ns % 10, ref_ns / fast_ns, ref_ns * 100 / fast_ns % 100);
+		if (mhz > 0) {
+			/* ns * MHz / 1000, from tenths of ns */
+
+			printf(" | %7u | %8u", ref_ns * mhz / 10000, fast_ns * mhz / 10000);
+		}
+		printf("\n");
+	}
+
+	return nfail == 0 ? 0 : 1;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#if defined(AUDREMIX_HOST)
+int main(int argc, char *argv[])
+{
+	return audio_remix_test(argc, argv);
+}
+#else
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int audremix_main(int argc, char *argv[])
+#endif
+{
+	printf("Audio Remix Test!!\n");
+	task_create("Audio remix test", 100, 4096, audio_remix_test, &argv[1]);
+
+	return 0;
+}
+#endif
@@ -0,0 +1,260 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file heap_latency_main.c
+
+/// @brief Measure malloc() and free() latency on a fragmented heap.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define NUM_FRAG_NODES   256	/* Number of blocks used to fragment the heap */
+#define NUM_BATCH        64	/* Allocations timed together in one batch */
+#define NUM_REPEAT       50	/* Batches per size */
+#define NUM_MIXED_OPS    4096	/* Operations in the random workload */
+
+#ifdef CONFIG_MM_TLSF
+#define ALLOCATOR_NAME "two-level segregated fit (CONFIG_MM_TLSF)"
+#else
+#define ALLOCATOR_NAME "size-sorted free lists"
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct heaplat_result_s {
+	uint32_t avg_ns;
+	uint32_t worst_ns;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static void *g_frag[NUM_FRAG_NODES];
+static void *g_batch[NUM_BATCH];
+static const int g_sizes[] = {16, 64, 256, 1024, 4096};
+static uint32_t g_seed = 0x2545f491;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t heaplat_rand(void)
+{
+	/* xorshift32, good enough to spread sizes and keep runs reproducible */
+
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+static uint64_t heaplat_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+	return (uint64_t)(end->tv_sec - start->tv_sec) * 1000000000ULL + end->tv_nsec - start->tv_nsec;
+}
+
+static void heaplat_update(struct heaplat_result_s *res, uint64_t total_ns, uint64_t batch_ns, int nops)
+{
+	uint32_t per_op = (uint32_t)(batch_ns / nops);
+
+	if (per_op > res->worst_ns) {
+		res->worst_ns = per_op;
+	}
+	res->avg_ns = (uint32_t)(total_ns / nops);
+}
+
+/* Allocate blocks of random sizes and free every other one, so the free
+ * lists hold many nodes of different sizes like a long running system.
+ */
+
+static int heaplat_fragment(void)
+{
+	int i;
+
+	for (i = 0; i < NUM_FRAG_NODES; i++) {
+		g_frag[i] = malloc(16 + (heaplat_rand() % 2048));
+		if (!g_frag[i]) {
+			printf("Failed to fragment the heap at %d-th block\n", i);
+			return -1;
+		}
+	}
+
+	for (i = 0; i < NUM_FRAG_NODES; i += 2) {
+		free(g_frag[i]);
+		g_frag[i] = NULL;
+	}
+
+	return 0;
+}
+
+static void heaplat_release(void)
+{
+	int i;
+
+	for (i = 0; i < NUM_FRAG_NODES; i++) {
+		free(g_frag[i]);
+		g_frag[i] = NULL;
+	}
+}
+
+static int heaplat_fixed_size(int size, struct heaplat_result_s *alloc, struct heaplat_result_s *release)
+{
+	struct timespec ts1;
+	struct timespec ts2;
+	uint64_t alloc_total = 0;
+	uint64_t free_total = 0;
+	uint64_t elapsed;
+	int i;
+	int j;
+
+	memset(alloc, 0, sizeof(struct heaplat_result_s));
+	memset(release, 0, sizeof(struct heaplat_result_s));
+
+	for (i = 0; i < NUM_REPEAT; i++) {
+		clock_gettime(CLOCK_MONOTONIC, &ts1);
+		for (j = 0; j < NUM_BATCH; j++) {
+			g_batch[j] = malloc(size);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &ts2);
+
+		elapsed = heaplat_elapsed_ns(&ts1, &ts2);
+		alloc_total += elapsed;
+		heaplat_update(alloc, alloc_total / (i + 1), elapsed, NUM_BATCH);
+
+		for (j = 0; j < NUM_BATCH; j++) {
+			if (!g_batch[j]) {
+				printf("malloc(%d) failed at %d-th allocation\n", size, j);
+				for (j = 0; j < NUM_BATCH; j++) {
+					free(g_batch[j]);
+				}
+				return -1;
+			}
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &ts1);
+		for (j = 0; j < NUM_BATCH; j++) {
+			free(g_batch[j]);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &ts2);
+
+		elapsed = heaplat_elapsed_ns(&ts1, &ts2);
+		free_total += elapsed;
+		heaplat_update(release, free_total / (i + 1), elapsed, NUM_BATCH);
+	}
+
+	return 0;
+}
+
+/* Random allocations and releases over the fragmented heap, timed per
+ * operation pair so that the worst case shows the search cost.
+ */
+
+static void heaplat_mixed(struct heaplat_result_s *res)
+{
+	struct timespec ts1;
+	struct timespec ts2;
+	uint64_t total = 0;
+	uint64_t elapsed;
+	int slot;
+	int i;
+
+	memset(res, 0, sizeof(struct heaplat_result_s));
+
+	for (i = 0; i < NUM_MIXED_OPS; i++) {
+		slot = heaplat_rand() % NUM_FRAG_NODES;
+
+		clock_gettime(CLOCK_MONOTONIC, &ts1);
+		free(g_frag[slot]);
+		g_frag[slot] = malloc(16 + (heaplat_rand() % 4096));
+		clock_gettime(CLOCK_MONOTONIC, &ts2);
+
+		elapsed = heaplat_elapsed_ns(&ts1, &ts2);
+		total += elapsed;
+		heaplat_update(res, total / (i + 1), elapsed, 1);
+	}
+}
+
+static int heap_latency_test(int argc, char *argv[])
+{
+	struct heaplat_result_s alloc;
+	struct heaplat_result_s release;
+	struct heaplat_result_s mixed;
+	int k;
+
+	printf("\nAllocator : %s\n", ALLOCATOR_NAME);
+#ifdef CONFIG_MM_SMALL_CACHE
+	printf("Cache     : per-CPU magazines up to %d bytes, see /proc/mmcache\n", CONFIG_MM_SMALL_CACHE_MAXSIZE);
+#else
+	printf("Cache     : none\n");
+#endif
+	printf("Fragmenting the heap with %d blocks...\n", NUM_FRAG_NODES);
+
+	if (heaplat_fragment() != 0) {
+		heaplat_release();
+		return 0;
+	}
+
+	printf("\n%d x %d malloc()/free() per size, nanoseconds per operation\n", NUM_REPEAT, NUM_BATCH);
+	printf(" Size  | malloc avg | malloc worst | free avg | free worst\n");
+	printf("-------|------------|--------------|----------|-----------\n");
+
+	for (k = 0; k < sizeof(g_sizes) / sizeof(g_sizes[0]); k++) {
+		if (heaplat_fixed_size(g_sizes[k], &alloc, &release) != 0) {
+			break;
+		}
+		printf(" %5d | %10u | %12u | %8u | %10u\n", g_sizes[k], alloc.avg_ns, alloc.worst_ns, release.avg_ns, release.worst_ns);
+	}
+
+	heaplat_mixed(&mixed);
+	printf("\nRandom free()+malloc() pairs : avg %u ns, worst %u ns over %d pairs\n", mixed.avg_ns, mixed.worst_ns, NUM_MIXED_OPS);
+
+	heaplat_release();
+
+	return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int heaplat_main(int argc, char *argv[])
+#endif
+{
+	printf("Heap Latency Test!!\n");
+	task_create("Heap latency test", 100, 4096, heap_latency_test, argv);
+
+	return 0;
+}
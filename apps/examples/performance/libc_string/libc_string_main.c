@@ -0,0 +1,580 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file libc_string_main.c
+
+/// @brief Check and measure the string and memory functions of libc.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#ifdef STRBENCH_HOST
+#include <sys/mman.h>
+#include <unistd.h>
+#else
+#include <tinyara/config.h>
+#include <sched.h>
+#endif
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define AREA_SIZE        8192	/* Bytes of each test area */
+#define WINDOW           32	/* Bytes checked around each destination */
+#define FUZZ_MAX_LEN     512	/* Usual length of a fuzz case */
+#define FUZZ_ITERATIONS  20000	/* Cases per function */
+#define BENCH_BYTES      (256 * 1024)	/* Bytes processed per measurement */
+
+/* The host build (see README.txt) tests the libc sources compiled with a
+ * lib_ prefix, next to the C library of the host. Each test area is then
+ * followed by an inaccessible page, so a read past the end faults.
+ */
+
+#ifdef STRBENCH_HOST
+#define STR(name)        lib_##name
+void *lib_memcpy(void *dest, const void *src, size_t n);
+void *lib_memmove(void *dest, const void *src, size_t n);
+void *lib_memset(void *s, int c, size_t n);
+int lib_memcmp(const void *s1, const void *s2, size_t n);
+void *lib_memchr(const void *s, int c, size_t n);
+size_t lib_strlen(const char *s);
+int lib_strcmp(const char *s1, const char *s2);
+char *lib_strchr(const char *s, int c);
+#else
+#define STR(name)        name
+#endif
+
+/* Keep the compiler from turning the references back into libc calls */
+
+#if defined(__GNUC__) && !defined(__clang__)
+#define BYTEWISE         __attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+#else
+#define BYTEWISE         __attribute__((noinline))
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum strbench_func_e {
+	FUNC_MEMCPY,
+	FUNC_MEMMOVE,
+	FUNC_MEMSET,
+	FUNC_MEMCMP,
+	FUNC_MEMCHR,
+	FUNC_STRLEN,
+	FUNC_STRCMP,
+	FUNC_STRCHR,
+	FUNC_MAX
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char *g_names[FUNC_MAX] = {
+	"memcpy", "memmove", "memset", "memcmp", "memchr", "strlen", "strcmp", "strchr"
+};
+
+static const int g_sizes[] = {16, 64, 256, 1024, 4096};
+
+/* Destination and source offsets from a word aligned address */
+
+static const int g_aligns[][2] = {{0, 0}, {0, 1}, {3, 0}};
+
+static uint8_t *g_area1;
+static uint8_t *g_area2;
+static uint8_t *g_ref;
+static uint32_t g_seed = 0x2545f491;
+static volatile uintptr_t g_sink;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t strbench_rand(void)
+{
+	/* xorshift32, good enough to spread sizes and keep runs reproducible */
+
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+static void strbench_fill(uint8_t *p, size_t n, int nonzero)
+{
+	while (n-- > 0) {
+		*p = (uint8_t)strbench_rand();
+		if (nonzero && *p == 0) {
+			*p = 1;
+		}
+		p++;
+	}
+}
+
+static uint64_t strbench_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+	return (uint64_t)(end->tv_sec - start->tv_sec) * 1000000000ULL + end->tv_nsec - start->tv_nsec;
+}
+
+/* Bytewise references, with the semantics of the bytewise libc versions */
+
+static BYTEWISE void *ref_memcpy(void *dest, const void *src, size_t n)
+{
+	uint8_t *d = dest;
+	const uint8_t *s = src;
+
+	while (n-- > 0) {
+		*d++ = *s++;
+	}
+	return dest;
+}
+
+static BYTEWISE void *ref_memmove(void *dest, const void *src, size_t n)
+{
+	uint8_t *d = dest;
+	const uint8_t *s = src;
+
+	if (d <= s) {
+		while (n-- > 0) {
+			*d++ = *s++;
+		}
+	} else {
+		while (n-- > 0) {
+			d[n] = s[n];
+		}
+	}
+	return dest;
+}
+
+static BYTEWISE void *ref_memset(void *s, int c, size_t n)
+{
+	uint8_t *p = s;
+
+	while (n-- > 0) {
+		*p++ = (uint8_t)c;
+	}
+	return s;
+}
+
+static BYTEWISE int ref_memcmp(const void *s1, const void *s2, size_t n)
+{
+	const uint8_t *p1 = s1;
+	const uint8_t *p2 = s2;
+
+	for (; n > 0; n--, p1++, p2++) {
+		if (*p1 != *p2) {
+			return *p1 < *p2 ? -1 : 1;
+		}
+	}
+	return 0;
+}
+
+static BYTEWISE void *ref_memchr(const void *s, int c, size_t n)
+{
+	const uint8_t *p = s;
+
+	for (; n > 0; n--, p++) {
+		if (*p == (uint8_t)c) {
+			return (void *)p;
+		}
+	}
+	return NULL;
+}
+
+static BYTEWISE size_t ref_strlen(const char *s)
+{
+	const char *p = s;
+
+	while (*p != '\0') {
+		p++;
+	}
+	return p - s;
+}
+
+static BYTEWISE int ref_strcmp(const char *cs, const char *ct)
+{
+	signed char result;
+
+	for (;;) {
+		if ((result = *cs - *ct++) != 0 || !*cs++) {
+			break;
+		}
+	}
+	return result;
+}
+
+static BYTEWISE char *ref_strchr(const char *s, int c)
+{
+	for (;; s++) {
+		if (*s == c) {
+			return (char *)s;
+		}
+		if (!*s) {
+			return NULL;
+		}
+	}
+}
+
+/* Run one function of libc, or its reference, once */
+
+static uintptr_t strbench_call(int func, int ref, uint8_t *dst, uint8_t *src, size_t n)
+{
+	switch (func) {
+	case FUNC_MEMCPY:
+		return (uintptr_t)(ref ? ref_memcpy(dst, src, n) : STR(memcpy)(dst, src, n));
+	case FUNC_MEMMOVE:
+		return (uintptr_t)(ref ? ref_memmove(dst, src, n) : STR(memmove)(dst, src, n));
+	case FUNC_MEMSET:
+		return (uintptr_t)(ref ? ref_memset(dst, 0x5a, n) : STR(memset)(dst, 0x5a, n));
+	case FUNC_MEMCMP:
+		return (uintptr_t)(ref ? ref_memcmp(dst, src, n) : STR(memcmp)(dst, src, n));
+	case FUNC_MEMCHR:
+		return (uintptr_t)(ref ? ref_memchr(src, 0, n) : STR(memchr)(src, 0, n));
+	case FUNC_STRLEN:
+		return ref ? ref_strlen((char *)src) : STR(strlen)((char *)src);
+	case FUNC_STRCMP:
+		return (uintptr_t)(ref ? ref_strcmp((char *)dst, (char *)src) : STR(strcmp)((char *)dst, (char *)src));
+	case FUNC_STRCHR:
+		return (uintptr_t)(ref ? ref_strchr((char *)src, 0x01) : STR(strchr)((char *)src, 0x01));
+	default:
+		return 0;
+	}
+}
+
+/* Pick where a case of 'len' bytes lives in an area: at a random offset
+ * from the start, or ending right at the end of the area.
+ */
+
+static uint8_t *strbench_place(uint8_t *area, size_t len)
+{
+	if (strbench_rand() & 1) {
+		return area + WINDOW + strbench_rand() % 16;
+	}
+	return area + AREA_SIZE - len;
+}
+
+static int strbench_sign(int v)
+{
+	return (v > 0) - (v < 0);
+}
+
+static int strbench_fuzz_one(int func)
+{
+	uint8_t *dst;
+	uint8_t *src;
+	uint8_t *lo;
+	size_t len;
+	size_t pos;
+	int c;
+
+	len = strbench_rand() % FUZZ_MAX_LEN;
+	if ((strbench_rand() & 15) == 0) {
+		len = strbench_rand() % (AREA_SIZE / 2);
+	}
+
+	switch (func) {
+	case FUNC_MEMCPY:
+	case FUNC_MEMSET:
+		src = strbench_place(g_area2, len);
+		dst = strbench_place(g_area1, len);
+		lo = dst - WINDOW < g_area1 ? g_area1 : dst - WINDOW;
+		strbench_fill(src, len, 0);
+		strbench_fill(lo, dst + len - lo, 0);
+		memcpy(g_ref, g_area1, AREA_SIZE);
+		c = strbench_rand();
+		if (func == FUNC_MEMCPY) {
+			ref_memcpy(g_ref + (dst - g_area1), src, len);
+			STR(memcpy)(dst, src, len);
+		} else {
+			ref_memset(g_ref + (dst - g_area1), c, len);
+			STR(memset)(dst, c, len);
+		}
+		return memcmp(g_ref, g_area1, AREA_SIZE) != 0;
+
+	case FUNC_MEMMOVE:
+		src = g_area1 + strbench_rand() % (AREA_SIZE - len);
+		dst = g_area1 + strbench_rand() % (AREA_SIZE - len);
+		if (strbench_rand() & 1) {
+			/* Overlap by a few bytes to a few words */
+
+			pos = strbench_rand() % 40;
+			dst = src + pos + len <= g_area1 + AREA_SIZE ? src + pos : src;
+			if (strbench_rand() & 1 && src >= g_area1 + pos) {
+				dst = src - pos;
+			}
+		}
+		strbench_fill(g_area1, AREA_SIZE, 0);
+		memcpy(g_ref, g_area1, AREA_SIZE);
+		ref_memmove(g_ref + (dst - g_area1), g_ref + (src - g_area1), len);
+		STR(memmove)(dst, src, len);
+		return memcmp(g_ref, g_area1, AREA_SIZE) != 0;
+
+	case FUNC_MEMCMP:
+		src = strbench_place(g_area2, len);
+		dst = strbench_place(g_area1, len);
+		strbench_fill(src, len, 0);
+		memcpy(dst, src, len);
+		if (len > 0 && (strbench_rand() & 3) != 0) {
+			dst[strbench_rand() % len] = (uint8_t)strbench_rand();
+		}
+		return strbench_sign(STR(memcmp)(dst, src, len)) != strbench_sign(ref_memcmp(dst, src, len));
+
+	case FUNC_MEMCHR:
+		src = strbench_place(g_area2, len);
+		strbench_fill(src, len, 0);
+		c = strbench_rand() & 0xff;
+		if (len > 0 && (strbench_rand() & 1)) {
+			src[strbench_rand() % len] = (uint8_t)c;
+		}
+		if (strbench_rand() & 1) {
+			c |= 0x100;	/* Only the low byte counts */
+		}
+		return STR(memchr)(src, c, len) != ref_memchr(src, c, len);
+
+	case FUNC_STRLEN:
+		src = strbench_place(g_area2, len + 1);
+		strbench_fill(src, len, 1);
+		src[len] = '\0';
+		return STR(strlen)((char *)src) != ref_strlen((char *)src);
+
+	case FUNC_STRCMP:
+		src = strbench_place(g_area2, len + 1);
+		dst = strbench_place(g_area1, len + 1);
+		strbench_fill(src, len, 1);
+		src[len] = '\0';
+		memcpy(dst, src, len + 1);
+		if (len > 0 && (strbench_rand() & 3) != 0) {
+			/* A different byte, or a shorter string */
+
+			dst[strbench_rand() % len] = (strbench_rand() & 3) ? (uint8_t)strbench_rand() : 0;
+		}
+		return STR(strcmp)((char *)dst, (char *)src) != ref_strcmp((char *)dst, (char *)src);
+
+	case FUNC_STRCHR:
+		src = strbench_place(g_area2, len + 1);
+		strbench_fill(src, len, 1);
+		src[len] = '\0';
+		c = strbench_rand() & 0xff;
+		if (len > 0 && (strbench_rand() & 1)) {
+			src[strbench_rand() % len] = c ? (uint8_t)c : 1;
+		}
+		if (strbench_rand() & 1) {
+			c = (signed char)c;
+		}
+		return STR(strchr)((char *)src, c) != ref_strchr((char *)src, c);
+
+	default:
+		return 0;
+	}
+}
+
+static int strbench_fuzz(void)
+{
+	int failed = 0;
+	int errors;
+	int func;
+	int i;
+
+	printf("\nFuzz: %d random cases per function, lengths below %d, random alignments\n", FUZZ_ITERATIONS, FUZZ_MAX_LEN);
+	for (func = 0; func < FUNC_MAX; func++) {
+		errors = 0;
+		for (i = 0; i < FUZZ_ITERATIONS; i++) {
+			errors += strbench_fuzz_one(func);
+		}
+		printf(" %-7s : %s (%d mismatches)\n", g_names[func], errors ? "FAIL" : "pass", errors);
+		failed += errors;
+	}
+
+	return failed;
+}
+
+/* Prepare the areas so that the string functions scan 'n' bytes */
+
+static void strbench_prepare(int func, uint8_t *dst, uint8_t *src, size_t n)
+{
+	memset(src, 'a', n);
+	memset(dst, 'a', n);
+	if (func == FUNC_MEMCHR) {
+		memset(src, 0xff, n);
+	} else if (func >= FUNC_STRLEN) {
+		src[n - 1] = '\0';
+		dst[n - 1] = '\0';
+	}
+}
+
+static uint32_t strbench_measure(int func, int ref, uint8_t *dst, uint8_t *src, size_t n)
+{
+	struct timespec ts1;
+	struct timespec ts2;
+	uint64_t elapsed;
+	uintptr_t sink = 0;
+	int loops = BENCH_BYTES / n;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts1);
+	for (i = 0; i < loops; i++) {
+		sink += strbench_call(func, ref, dst, src, n);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &ts2);
+	g_sink = sink;
+
+	elapsed = strbench_elapsed_ns(&ts1, &ts2);
+	if (elapsed == 0) {
+		elapsed = 1;
+	}
+
+	/* Bytes per microsecond are megabytes per second */
+
+	return (uint32_t)((uint64_t)loops * n * 1000 / elapsed);
+}
+
+static void strbench_bench(void)
+{
+	uint8_t *dst;
+	uint8_t *src;
+	uint32_t libc_mbps;
+	uint32_t ref_mbps;
+	int func;
+	int k;
+	int a;
+
+	printf("\nThroughput over %d KB per case, MB/s\n", BENCH_BYTES / 1024);
+	printf(" Function | Size | dst/src | libc   | bytewise | ratio\n");
+	printf("----------|------|---------|--------|----------|------\n");
+
+	for (func = 0; func < FUNC_MAX; func++) {
+		for (k = 0; k < sizeof(g_sizes) / sizeof(g_sizes[0]); k++) {
+			for (a = 0; a < sizeof(g_aligns) / sizeof(g_aligns[0]); a++) {
+				dst = g_area1 + 64 + g_aligns[a][0];
+				src = (func == FUNC_MEMMOVE ? g_area1 + 64 + 32 : g_area2 + 64) + g_aligns[a][1];
+				strbench_prepare(func, dst, src, g_sizes[k]);
+				libc_mbps = strbench_measure(func, 0, dst, src, g_sizes[k]);
+				strbench_prepare(func, dst, src, g_sizes[k]);
+				ref_mbps = strbench_measure(func, 1, dst, src, g_sizes[k]);
+				printf(" %-8s | %4d |   %d/%d   | %6u | %8u | %2u.%u\n", g_names[func], g_sizes[k], g_aligns[a][0], g_aligns[a][1], libc_mbps, ref_mbps,
+					   libc_mbps / (ref_mbps ? ref_mbps : 1), libc_mbps * 10 / (ref_mbps ? ref_mbps : 1) % 10);
+			}
+		}
+	}
+}
+
+static int strbench_alloc(void)
+{
+#ifdef STRBENCH_HOST
+	size_t page = sysconf(_SC_PAGESIZE);
+	size_t span = (AREA_SIZE + page - 1) / page * page;
+	uint8_t *map;
+	int i;
+
+	for (i = 0; i < 2; i++) {
+		map = mmap(NULL, span + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (map == MAP_FAILED) {
+			return -1;
+		}
+		mprotect(map + span, page, PROT_NONE);
+		if (i == 0) {
+			g_area1 = map + span - AREA_SIZE;
+		} else {
+			g_area2 = map + span - AREA_SIZE;
+		}
+	}
+#else
+	g_area1 = malloc(AREA_SIZE);
+	g_area2 = malloc(AREA_SIZE);
+#endif
+	g_ref = malloc(AREA_SIZE);
+
+	return g_area1 && g_area2 && g_ref ? 0 : -1;
+}
+
+static int libc_string_test(int argc, char *argv[])
+{
+	int fuzz = 1;
+	int bench = 1;
+	int failed = 0;
+
+	if (argc > 1) {
+		fuzz = strcmp(argv[1], "bench") != 0;
+		bench = strcmp(argv[1], "fuzz") != 0;
+	}
+
+	if (strbench_alloc() != 0) {
+		printf("Failed to allocate the test areas\n");
+		return -1;
+	}
+
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	printf("\nlibc : word-at-a-time (CONFIG_LIBC_STRING_OPTSPEED)%s\n",
+#ifdef CONFIG_LIBC_STRING_VECTOR
+		   ", vectors (CONFIG_LIBC_STRING_VECTOR)"
+#else
+		   ""
+#endif
+		  );
+#elif defined(STRBENCH_HOST)
+	printf("\nlibc : host build of the libc sources\n");
+#else
+	printf("\nlibc : bytewise\n");
+#endif
+
+	if (fuzz) {
+		failed = strbench_fuzz();
+	}
+	if (bench) {
+		strbench_bench();
+	}
+
+#ifndef STRBENCH_HOST
+	free(g_area1);
+	free(g_area2);
+#endif
+	free(g_ref);
+
+	return failed ? -1 : 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef STRBENCH_HOST
+int main(int argc, char *argv[])
+{
+	return libc_string_test(argc, argv);
+}
+#else
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int strbench_main(int argc, char *argv[])
+#endif
+{
+	printf("String and Memory Functions Test!!\n");
+	task_create("String test", 100, 4096, libc_string_test, &argv[1]);
+
+	return 0;
+}
+#endif
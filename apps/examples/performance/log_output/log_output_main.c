@@ -0,0 +1,266 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file log_output_main.c
+
+/// @brief Measure formatted log output through bulk and per-character puts.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <tinyara/streams.h>
+#if defined(CONFIG_LOGM) && defined(CONFIG_BUILD_FLAT)
+#include <tinyara/logm.h>
+#define LOGBENCH_LOGM
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define LINE_SIZE        160	/* Big enough for every test line */
+#define NUM_LINES        2000	/* Lines formatted per measurement */
+#define LOGM_ROUNDS      8	/* Batches written to logm */
+#define LOGM_LINE_BYTES  80	/* Upper bound of a logm test line */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum logbench_line_e {
+	LINE_TEXT,
+	LINE_WIFI,
+	LINE_PING,
+	LINE_TABLE,
+	LINE_MAX
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char *g_line_names[LINE_MAX] = {
+	"plain text", "wifi event", "ping reply", "table row"
+};
+
+static char g_line[LINE_SIZE];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t logbench_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int logbench_format(FAR struct lib_outstream_s *stream, FAR const char *fmt, ...)
+{
+	va_list ap;
+	int ret;
+
+	va_start(ap, fmt);
+	ret = lib_vsprintf(stream, fmt, ap);
+	va_end(ap);
+
+	return ret;
+}
+
+/* Format one of the test lines, which look like the usual log output */
+
+static int logbench_line(FAR struct lib_outstream_s *stream, int line, int i)
+{
+	switch (line) {
+	case LINE_TEXT:
+		return logbench_format(stream, "mm_heap: region added, the heap is ready for allocations\n");
+	case LINE_WIFI:
+		return logbench_format(stream, "[%6d.%06d] wifi: connected to %s, rssi %d dBm, channel %u\n", i / 1000, i * 997 % 1000000, "home-network", -42 - i % 30, 1 + i % 13);
+	case LINE_PING:
+		return logbench_format(stream, "%s: %d bytes from %d.%d.%d.%d: icmp_seq=%u time=%u ms\n", "ping", 56, 192, 168, i % 256, 1, i, i % 97);
+	case LINE_TABLE:
+		return logbench_format(stream, "%-16s %08x %5u %c %s\n", "logbench", 0x20001000 + i * 16, i % 1000, 'R', "running");
+	default:
+		return 0;
+	}
+}
+
+/* Time per line in tenths of ns, into a memory stream with or without puts */
+
+static uint32_t logbench_measure(int line, int bulk)
+{
+	struct lib_memoutstream_s memoutstream;
+	uint64_t start;
+	uint64_t elapsed;
+	int i;
+
+	start = logbench_now_ns();
+	for (i = 0; i < NUM_LINES; i++) {
+		lib_memoutstream(&memoutstream, g_line, LINE_SIZE);
+		if (!bulk) {
+			memoutstream.public.puts = NULL;
+		}
+		logbench_line(&memoutstream.public, line, i);
+	}
+	elapsed = logbench_now_ns() - start;
+
+	return (uint32_t)(elapsed * 10 / NUM_LINES);
+}
+
+/* Both ways must give the same text */
+
+static int logbench_check(int line)
+{
+	char expected[LINE_SIZE];
+	struct lib_memoutstream_s memoutstream;
+	int nchar;
+	int nbulk;
+
+	lib_memoutstream(&memoutstream, expected, LINE_SIZE);
+	memoutstream.public.puts = NULL;
+	nchar = logbench_line(&memoutstream.public, line, 12345);
+
+	lib_memoutstream(&memoutstream, g_line, LINE_SIZE);
+	nbulk = logbench_line(&memoutstream.public, line, 12345);
+
+	return nchar != nbulk || strcmp(expected, g_line) != 0;
+}
+
+#ifdef LOGBENCH_LOGM
+/* logm formats each line into its ring with the interrupts disabled, so
+ * the time of a logm() call is the interrupt-off time of that line. Write
+ * batches that fit in the ring and let the logm task drain it in between.
+ */
+
+static uint32_t logbench_logm(uint32_t *nlines)
+{
+	uint64_t elapsed = 0;
+	uint64_t start;
+	int bufsize;
+	int interval;
+	int batch;
+	int round;
+	int i;
+
+	logm_get_values(LOGM_BUFSIZE, &bufsize);
+	logm_get_values(LOGM_INTERVAL, &interval);
+	batch = bufsize / 2 / LOGM_LINE_BYTES;
+	if (batch < 1) {
+		batch = 1;
+	}
+
+	for (round = 0; round < LOGM_ROUNDS; round++) {
+		usleep((interval + 100) * 1000);
+		start = logbench_now_ns();
+		for (i = 0; i < batch; i++) {
+			logm(LOGM_NORMAL, LOGM_UNKNOWN, LOGM_INF, "logbench: round %d line %d, rssi %d dBm, channel %u\n", round, i, -42 - i % 30, 1 + i % 13);
+		}
+		elapsed += logbench_now_ns() - start;
+	}
+
+	*nlines = (uint32_t)batch * LOGM_ROUNDS;
+	return (uint32_t)(elapsed * 10 / *nlines);
+}
+#endif
+
+static int log_output_test(int argc, char *argv[])
+{
+	uint32_t char_ns;
+	uint32_t bulk_ns;
+	uint32_t mhz = 0;
+	int nfail = 0;
+	int line;
+#ifdef LOGBENCH_LOGM
+	uint32_t logm_ns;
+	uint32_t nlines;
+#endif
+
+	if (argc > 1) {
+		mhz = (uint32_t)atoi(argv[1]);
+	}
+
+	for (line = 0; line < LINE_MAX; line++) {
+		nfail += logbench_check(line);
+	}
+	printf("\nBulk and per-character output differ on %d of %d lines\n", nfail, LINE_MAX);
+
+	printf("\n%d lines into a memory stream, time per line", NUM_LINES);
+	if (mhz > 0) {
+		printf(" and cycles per line at %u MHz\n", mhz);
+		printf(" Line       | putc ns  | puts ns  | speedup | putc cyc | puts cyc\n");
+		printf("------------|----------|----------|---------|----------|---------\n");
+	} else {
+		printf("\n Line       | putc ns  | puts ns  | speedup\n");
+		printf("------------|----------|----------|--------\n");
+	}
+
+	for (line = 0; line < LINE_MAX; line++) {
+		char_ns = logbench_measure(line, 0);
+		bulk_ns = logbench_measure(line, 1);
+		if (bulk_ns == 0) {
+			bulk_ns = 1;
+		}
+
+		printf(" %-10s | %6u.%u | %6u.%u | %4u.%02u", g_line_names[line], char_ns / 10, char_ns % 10, bulk_ns / 10, bulk_ns % 10, char_ns / bulk_ns, char_ns * 100 / bulk_ns % 100);
+		if (mhz > 0) {
+			/* ns * MHz / 1000, from tenths of ns */
+
+			printf(" | %8u | %8u", char_ns * mhz / 10000, bulk_ns * mhz / 10000);
+		}
+		printf("\n");
+	}
+
+#ifdef LOGBENCH_LOGM
+	printf("\nInterrupt-off time of logm, the lines below come back from the logm task\n");
+	logm_ns = logbench_logm(&nlines);
+	printf("\n logm : %u lines, %u.%u us per line with the interrupts disabled", nlines, logm_ns / 10000, logm_ns / 1000 % 10);
+	if (mhz > 0) {
+		printf(" (%u cycles)", logm_ns * mhz / 10000);
+	}
+	printf("\n");
+#endif
+
+	return nfail == 0 ? 0 : 1;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int logbench_main(int argc, char *argv[])
+#endif
+{
+	printf("Log Output Test!!\n");
+	task_create("Log output test", 100, 4096, log_output_test, &argv[1]);
+
+	return 0;
+}
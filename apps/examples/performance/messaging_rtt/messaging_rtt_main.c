@@ -0,0 +1,349 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file messaging_rtt_main.c
+
+/// @brief Measure the round trip latency of the messaging framework.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <errno.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <messaging/messaging.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define UNICAST_PORT     "msgbench_port"
+#define MULTICAST_PORT   "msgbench_mcast"
+
+#define DEFAULT_TRIPS    1000
+#define DEFAULT_MSGLEN   16
+#define MAX_MSGLEN       1024
+#define NUM_MCAST_RECV   3
+
+#define MSG_PRIO         10
+#define TASK_PRIO        100
+#define STACKSIZE        2048
+
+/* The receivers are ready once registered, they wait a while to be sure */
+
+#define RECV_READY_US    100000
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct msgbench_result_s {
+	uint32_t min_us;
+	uint32_t avg_us;
+	uint32_t worst_us;
+	int fails;
+};
+
+struct msgbench_recv_s {
+	const char *port;
+	msg_recv_buf_t buf;
+	char data[MAX_MSGLEN];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct msgbench_recv_s g_recv[1 + NUM_MCAST_RECV];
+static char g_msg[MAX_MSGLEN];
+static char g_reply[MAX_MSGLEN];
+static int g_msglen;
+
+static sem_t g_ready;		/* Posted by each receiver once registered */
+static sem_t g_stop;		/* Posted to each receiver to stop */
+static sem_t g_done;		/* Posted by each receiver after its cleanup */
+static sem_t g_arrived;		/* Posted by async reply or multicast message */
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t msgbench_now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+/* Callbacks run in the signal handler of the waiting task, which can be
+ * in sem_wait(), so waits retry on EINTR.
+ */
+
+static void msgbench_wait(sem_t *sem)
+{
+	while (sem_wait(sem) != OK && errno == EINTR) {
+	}
+}
+
+static void msgbench_recv_callback(msg_reply_type_t msg_type, msg_recv_buf_t *recv_data, void *cb_data)
+{
+	struct msgbench_recv_s *recv = (struct msgbench_recv_s *)cb_data;
+	msg_send_data_t reply;
+
+	if (msg_type == MSG_REPLY_REQUIRED) {
+		reply.msg = g_reply;
+		reply.msglen = g_msglen;
+		reply.priority = MSG_PRIO;
+		if (messaging_reply(recv->port, recv_data->sender_pid, &reply) != OK) {
+			printf("Fail to reply on %s.\n", recv->port);
+		}
+	} else {
+		sem_post(&g_arrived);
+	}
+}
+
+static void msgbench_reply_callback(msg_reply_type_t msg_type, msg_recv_buf_t *recv_data, void *cb_data)
+{
+	sem_post(&g_arrived);
+}
+
+/* Each receiver keeps its port registered with a non-block receive, so that
+ * the senders never wait for it to come back as with a block receive.
+ */
+
+static int msgbench_receiver(int argc, char *argv[])
+{
+	struct msgbench_recv_s *recv = &g_recv[atoi(argv[1])];
+	msg_callback_info_t cb_info;
+
+	recv->buf.buf = recv->data;
+	recv->buf.buflen = g_msglen;
+	cb_info.cb_func = msgbench_recv_callback;
+	cb_info.cb_data = recv;
+
+	if (messaging_recv_nonblock(recv->port, &recv->buf, &cb_info) != OK) {
+		printf("Fail to receive on %s.\n", recv->port);
+		sem_post(&g_ready);
+		sem_post(&g_done);
+		return ERROR;
+	}
+	sem_post(&g_ready);
+
+	msgbench_wait(&g_stop);
+
+	(void)messaging_cleanup(recv->port);
+	sem_post(&g_done);
+	return OK;
+}
+
+static void msgbench_account(struct msgbench_result_s *res, uint64_t start)
+{
+	uint32_t elapsed = (uint32_t)(msgbench_now_us() - start);
+
+	if (elapsed < res->min_us) {
+		res->min_us = elapsed;
+	}
+	if (elapsed > res->worst_us) {
+		res->worst_us = elapsed;
+	}
+	res->avg_us += elapsed;
+}
+
+static void msgbench_sync(struct msgbench_result_s *res, int trips)
+{
+	msg_send_data_t send_data;
+	msg_recv_buf_t reply_buf;
+	char reply[MAX_MSGLEN];
+	uint64_t start;
+	int i;
+
+	send_data.msg = g_msg;
+	send_data.msglen = g_msglen;
+	send_data.priority = MSG_PRIO;
+	reply_buf.buf = reply;
+	reply_buf.buflen = g_msglen;
+
+	for (i = 0; i < trips; i++) {
+		start = msgbench_now_us();
+		if (messaging_send_sync(UNICAST_PORT, &send_data, &reply_buf) != OK) {
+			res->fails++;
+			continue;
+		}
+		msgbench_account(res, start);
+	}
+}
+
+static void msgbench_async(struct msgbench_result_s *res, int trips)
+{
+	msg_send_data_t send_data;
+	msg_callback_info_t cb_info;
+	static msg_recv_buf_t reply_buf;
+	static char reply[MAX_MSGLEN];
+	uint64_t start;
+	int i;
+
+	send_data.msg = g_msg;
+	send_data.msglen = g_msglen;
+	send_data.priority = MSG_PRIO;
+	reply_buf.buf = reply;
+	reply_buf.buflen = g_msglen;
+	cb_info.cb_func = msgbench_reply_callback;
+	cb_info.cb_data = NULL;
+
+	for (i = 0; i < trips; i++) {
+		start = msgbench_now_us();
+		if (messaging_send_async(UNICAST_PORT, &send_data, &reply_buf, &cb_info) != OK) {
+			res->fails++;
+			continue;
+		}
+		msgbench_wait(&g_arrived);
+		msgbench_account(res, start);
+	}
+}
+
+static void msgbench_multicast(struct msgbench_result_s *res, int trips)
+{
+	msg_send_data_t send_data;
+	uint64_t start;
+	int nrecv;
+	int i;
+
+	send_data.msg = g_msg;
+	send_data.msglen = g_msglen;
+	send_data.priority = MSG_PRIO;
+
+	for (i = 0; i < trips; i++) {
+		start = msgbench_now_us();
+		nrecv = messaging_multicast(MULTICAST_PORT, &send_data);
+		if (nrecv <= 0) {
+			res->fails++;
+			continue;
+		}
+		while (nrecv-- > 0) {
+			msgbench_wait(&g_arrived);
+		}
+		msgbench_account(res, start);
+	}
+}
+
+static void msgbench_run(const char *name, void (*bench)(struct msgbench_result_s *, int), int trips)
+{
+	struct msgbench_result_s res;
+
+	memset(&res, 0, sizeof(res));
+	res.min_us = UINT32_MAX;
+
+	bench(&res, trips);
+
+	if (res.fails == trips) {
+		printf(" %-9s |    all trips failed\n", name);
+		return;
+	}
+	res.avg_us /= (trips - res.fails);
+	printf(" %-9s | %6u | %6u | %8u | %5d\n", name, res.min_us, res.avg_us, res.worst_us, res.fails);
+}
+
+static int messaging_rtt_test(int argc, char *argv[])
+{
+	char *recv_argv[2];
+	char index[4];
+	int trips = DEFAULT_TRIPS;
+	int nrecv = 0;
+	int i;
+
+	g_msglen = DEFAULT_MSGLEN;
+	if (argc > 1) {
+		trips = atoi(argv[1]);
+	}
+	if (argc > 2) {
+		g_msglen = atoi(argv[2]);
+	}
+	if (trips <= 0 || g_msglen <= 0 || g_msglen > MAX_MSGLEN) {
+		printf("Usage: msgbench [round trips] [message size, 1 to %d]\n", MAX_MSGLEN);
+		return 0;
+	}
+	memset(g_msg, 'm', g_msglen);
+	memset(g_reply, 'r', g_msglen);
+
+	sem_init(&g_ready, 0, 0);
+	sem_init(&g_stop, 0, 0);
+	sem_init(&g_done, 0, 0);
+	sem_init(&g_arrived, 0, 0);
+
+	/* One unicast receiver which replies, then the multicast receivers */
+
+	recv_argv[0] = index;
+	recv_argv[1] = NULL;
+	for (i = 0; i < 1 + NUM_MCAST_RECV; i++) {
+		g_recv[i].port = (i == 0) ? UNICAST_PORT : MULTICAST_PORT;
+		snprintf(index, sizeof(index), "%d", i);
+		if (task_create("msgbench_recv", TASK_PRIO, STACKSIZE, msgbench_receiver, recv_argv) < 0) {
+			printf("Fail to create receiver %d, errno %d\n", i, errno);
+			break;
+		}
+		msgbench_wait(&g_ready);
+		nrecv++;
+	}
+	usleep(RECV_READY_US);
+
+	if (nrecv == 1 + NUM_MCAST_RECV) {
+		printf("\n%d round trips of %d bytes, %d multicast receivers\n", trips, g_msglen, NUM_MCAST_RECV);
+		printf(" mode      | min us | avg us | worst us | fails\n");
+		printf("-----------|--------|--------|----------|------\n");
+		msgbench_run("sync", msgbench_sync, trips);
+		msgbench_run("async", msgbench_async, trips);
+		msgbench_run("multicast", msgbench_multicast, trips);
+	}
+
+	for (i = 0; i < nrecv; i++) {
+		sem_post(&g_stop);
+	}
+	for (i = 0; i < nrecv; i++) {
+		msgbench_wait(&g_done);
+	}
+
+	sem_destroy(&g_ready);
+	sem_destroy(&g_stop);
+	sem_destroy(&g_done);
+	sem_destroy(&g_arrived);
+	return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int msgbench_main(int argc, char *argv[])
+#endif
+{
+	printf("Messaging Round Trip Test!!\n");
+	task_create("Messaging rtt test", TASK_PRIO, 4096, messaging_rtt_test, &argv[1]);
+
+	return 0;
+}
@@ -0,0 +1,290 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file note_overhead_main.c
+
+/// @brief Measure the cost of recording scheduler notes.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <tinyara/sched_note.h>
+#include <tinyara/note.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define DEFAULT_ITERS    10000
+
+/* The notes are cleared every NOTEPERF_BATCH iterations, so that the buffer
+ * never fills and each note is really recorded, not dropped. A ping-pong
+ * round records about 120 bytes of notes.
+ */
+
+#define NOTEPERF_BATCH   16
+
+#define TASK_PRIO        100
+#define STACKSIZE        2048
+
+#define DUMP_BUFLEN      256
+#define DUMP_LINELEN     16
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static sem_t g_ping;
+static sem_t g_pong;
+static volatile bool g_stop;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t noteperf_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* Record every kind of notes built in, except the syscall arguments */
+
+static unsigned int noteperf_mode(void)
+{
+	unsigned int mode = NOTE_FILTER_MODE_FLAG_ENABLE;
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SWITCH
+	mode |= NOTE_FILTER_MODE_FLAG_SWITCH;
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SYSCALL
+	mode |= NOTE_FILTER_MODE_FLAG_SYSCALL;
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_IRQHANDLER
+	mode |= NOTE_FILTER_MODE_FLAG_IRQ;
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+	mode |= NOTE_FILTER_MODE_FLAG_SEMAPHORE;
+#endif
+
+	return mode;
+}
+
+/* Higher priority partner of the ping-pong: each sem_post() of the main
+ * task switches to it and each of its sem_post() switches back.
+ */
+
+static int noteperf_partner(int argc, char *argv[])
+{
+	while (!g_stop) {
+		sem_wait(&g_ping);
+		sem_post(&g_pong);
+	}
+
+	return OK;
+}
+
+static void noteperf_pingpong(int iters, int fd)
+{
+	int i;
+
+	for (i = 0; i < iters; i++) {
+		if (i % NOTEPERF_BATCH == 0) {
+			ioctl(fd, NOTEIOC_CLEAR, 0);
+		}
+		sem_post(&g_ping);
+		sem_wait(&g_pong);
+	}
+}
+
+static void noteperf_syscall(int iters, int fd)
+{
+	int i;
+
+	for (i = 0; i < iters; i++) {
+		if (i % NOTEPERF_BATCH == 0) {
+			ioctl(fd, NOTEIOC_CLEAR, 0);
+		}
+		(void)getpid();
+	}
+}
+
+/* Run a workload with recording off and then on, both clear the notes at
+ * the same pace so that only the recording makes the difference.
+ */
+
+static void noteperf_run(const char *name, void (*bench)(int, int), int iters, int fd, unsigned int mode)
+{
+	struct note_status_s status;
+	uint64_t start;
+	uint32_t off_ns;
+	uint32_t on_ns;
+	uint32_t dropped = 0;
+	int i;
+
+	ioctl(fd, NOTEIOC_SETMODE, 0);
+	start = noteperf_now_ns();
+	bench(iters, fd);
+	off_ns = (uint32_t)((noteperf_now_ns() - start) / iters);
+
+	ioctl(fd, NOTEIOC_SETMODE, mode);
+	start = noteperf_now_ns();
+	bench(iters, fd);
+	on_ns = (uint32_t)((noteperf_now_ns() - start) / iters);
+	ioctl(fd, NOTEIOC_SETMODE, 0);
+
+	if (ioctl(fd, NOTEIOC_GETSTATUS, (unsigned long)&status) == OK) {
+		for (i = 0; i < CONFIG_SMP_NCPUS; i++) {
+			dropped += status.dropped[i];
+		}
+	}
+
+	printf(" %-9s | %8u | %8u | %+7d%% | %7u\n", name, off_ns, on_ns, off_ns ? (int)(((int64_t)on_ns - off_ns) * 100 / off_ns) : 0, dropped);
+}
+
+static int noteperf_overhead(int fd, int iters)
+{
+	unsigned int mode = noteperf_mode();
+	unsigned int saved;
+	char *partner_argv[1] = { NULL };
+	pid_t partner;
+
+	if (ioctl(fd, NOTEIOC_GETMODE, (unsigned long)&saved) != OK) {
+		printf("Fail to get the note mode, errno %d\n", errno);
+		return ERROR;
+	}
+
+	sem_init(&g_ping, 0, 0);
+	sem_init(&g_pong, 0, 0);
+	g_stop = false;
+
+	partner = task_create("noteperf_partner", TASK_PRIO + 1, STACKSIZE, noteperf_partner, partner_argv);
+	if (partner < 0) {
+		printf("Fail to create the partner, errno %d\n", errno);
+		sem_destroy(&g_ping);
+		sem_destroy(&g_pong);
+		return ERROR;
+	}
+
+	printf("\n%d iterations, notes cleared every %d, mode 0x%x\n", iters, NOTEPERF_BATCH, mode);
+	printf(" workload  |  off ns  |  on ns   | overhead | dropped\n");
+	printf("-----------|----------|----------|----------|--------\n");
+	noteperf_run("pingpong", noteperf_pingpong, iters, fd, mode);
+	noteperf_run("syscall", noteperf_syscall, iters, fd, mode);
+
+	/* Let the partner see g_stop */
+
+	g_stop = true;
+	sem_post(&g_ping);
+	sem_wait(&g_pong);
+
+	sem_destroy(&g_ping);
+	sem_destroy(&g_pong);
+
+	ioctl(fd, NOTEIOC_CLEAR, 0);
+	ioctl(fd, NOTEIOC_SETMODE, saved);
+	return OK;
+}
+
+/* Print the recorded notes in hex, DUMP_LINELEN bytes a line, as taken by
+ * tools/note/note2perfetto.py --hex. Recording stops first so that the dump
+ * does not record itself.
+ */
+
+static int noteperf_dump(int fd)
+{
+	uint8_t buf[DUMP_BUFLEN];
+	ssize_t nread;
+	ssize_t i;
+
+	ioctl(fd, NOTEIOC_SETMODE, 0);
+
+	while ((nread = read(fd, buf, DUMP_BUFLEN)) > 0) {
+		for (i = 0; i < nread; i++) {
+			printf("%02x%c", buf[i], ((i + 1) % DUMP_LINELEN == 0 || i + 1 == nread) ? '\n' : ' ');
+		}
+	}
+
+	if (nread < 0) {
+		printf("Fail to read the notes, errno %d\n", errno);
+		return ERROR;
+	}
+
+	return OK;
+}
+
+static int note_overhead_test(int argc, char *argv[])
+{
+	int iters = DEFAULT_ITERS;
+	int ret;
+	int fd;
+
+	fd = open(NOTE_DRVPATH, O_RDONLY);
+	if (fd < 0) {
+		printf("Fail to open %s, errno %d\n", NOTE_DRVPATH, errno);
+		return ERROR;
+	}
+
+	if (argc > 1 && strcmp(argv[1], "start") == 0) {
+		ioctl(fd, NOTEIOC_CLEAR, 0);
+		ret = ioctl(fd, NOTEIOC_SETMODE, noteperf_mode());
+	} else if (argc > 1 && strcmp(argv[1], "dump") == 0) {
+		ret = noteperf_dump(fd);
+	} else {
+		if (argc > 1) {
+			iters = atoi(argv[1]);
+		}
+		if (iters <= 0) {
+			printf("Usage: noteperf [iterations | start | dump]\n");
+			close(fd);
+			return 0;
+		}
+		ret = noteperf_overhead(fd, iters);
+	}
+
+	close(fd);
+	return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int noteperf_main(int argc, char *argv[])
+#endif
+{
+	return note_overhead_test(argc, argv);
+}
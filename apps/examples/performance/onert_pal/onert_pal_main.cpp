@@ -0,0 +1,431 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file onert_pal_main.cpp
+
+/// @brief Measure the onert-micro PAL kernels one by one on random data.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <cmath>
+#include <limits>
+
+#include "luci_interpreter/core/Tensor.h"
+#include "PALConcatenation.h"
+#include "PALDepthwiseConv2D.h"
+#include "PALFullyConnected.h"
+#include "PALLogistic.h"
+#include "PALMean.h"
+#include "PALTanh.h"
+
+using namespace luci_interpreter_pal;
+using luci_interpreter::RuntimeShape;
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define NUM_RUNS         20	/* Timed runs of each kernel */
+
+/* Layer sizes like the ones of the keyword spotting models */
+
+#define FC_INPUTS        128
+#define FC_OUTPUTS       64
+#define MAP_SIZE         12	/* Height and width of the feature maps */
+#define MAP_DEPTH        32
+#define MAP_ELEMENTS     (MAP_SIZE * MAP_SIZE * MAP_DEPTH)
+#define DW_FILTER        3
+#define MAX_WEIGHTS      (FC_INPUTS * FC_OUTPUTS)
+
+#ifdef CONFIG_EXTERNAL_CMSIS_NN
+#define PAL_NAME         "cmsisnn"
+#elif defined(CONFIG_ONERT_MICRO_PAL_NEON)
+#define PAL_NAME         "neon"
+#else
+#define PAL_NAME         "mcu"
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct palbench_kernel_s {
+	const char *name;
+	const char *shape;
+	void (*run)(void);
+	uint32_t (*checksum)(void);
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static float *g_input;
+static float *g_output;
+static float *g_filter;
+static float *g_bias;
+static int8_t *g_input8;
+static int8_t *g_output8;
+static int8_t *g_filter8;
+static int32_t *g_bias8;
+static uint32_t g_seed;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t palbench_rand(void)
+{
+	/* xorshift32 */
+
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+/* Random value in [-range, range) */
+
+static float palbench_randf(float range)
+{
+	return ((float)(palbench_rand() & 0xffff) / 32768.0f - 1.0f) * range;
+}
+
+static uint64_t palbench_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void palbench_fill(void)
+{
+	int i;
+
+	g_seed = 0x2545f491;
+	for (i = 0; i < MAP_ELEMENTS; i++) {
+		g_input[i] = palbench_randf(4.0f);
+		g_input8[i] = (int8_t)palbench_rand();
+	}
+	for (i = 0; i < MAX_WEIGHTS; i++) {
+		g_filter[i] = palbench_randf(0.5f);
+		g_filter8[i] = (int8_t)palbench_rand();
+	}
+	for (i = 0; i < FC_OUTPUTS; i++) {
+		g_bias[i] = palbench_randf(1.0f);
+		g_bias8[i] = (int32_t)(palbench_rand() & 0xfff) - 0x800;
+	}
+}
+
+static void palbench_fc_f32(void)
+{
+	const int32_t input_shape[2] = { 1, FC_INPUTS };
+	const int32_t filter_shape[2] = { FC_OUTPUTS, FC_INPUTS };
+	const int32_t output_shape[2] = { 1, FC_OUTPUTS };
+	FullyConnectedParams params{};
+
+	params.float_activation_min = std::numeric_limits<float>::lowest();
+	params.float_activation_max = std::numeric_limits<float>::max();
+	FullyConnected(params, input_shape, g_input, filter_shape, g_filter, g_bias, output_shape, g_output, 2, 2);
+}
+
+static void palbench_fc_s8(void)
+{
+	const int32_t input_shape[2] = { 1, FC_INPUTS };
+	const int32_t filter_shape[2] = { FC_OUTPUTS, FC_INPUTS };
+	const int32_t output_shape[2] = { 1, FC_OUTPUTS };
+	FullyConnectedParams params{};
+
+	params.input_offset = 3;
+	params.output_offset = -5;
+	params.output_multiplier = 1 << 30;
+	params.output_shift = -8;
+	params.quantized_activation_min = std::numeric_limits<int8_t>::min();
+	params.quantized_activation_max = std::numeric_limits<int8_t>::max();
+	FullyConnected<int8_t>(params, input_shape, g_input8, filter_shape, g_filter8, g_bias8, output_shape, g_output8, 2, 2);
+}
+
+/* Stride 1 with same padding, one filter per channel */
+
+static void palbench_dw_params(ConvParams &params)
+{
+	params.padding_values.height = DW_FILTER / 2;
+	params.padding_values.width = DW_FILTER / 2;
+	params.stride_height = 1;
+	params.stride_width = 1;
+	params.dilation_height_factor = 1;
+	params.dilation_width_factor = 1;
+	params.depth_multiplier = 1;
+}
+
+static void palbench_dw_f32(void)
+{
+	const int32_t map_shape[4] = { 1, MAP_SIZE, MAP_SIZE, MAP_DEPTH };
+	const int32_t filter_shape[4] = { 1, DW_FILTER, DW_FILTER, MAP_DEPTH };
+	ConvParams params{};
+
+	palbench_dw_params(params);
+	params.float_activation_min = std::numeric_limits<float>::lowest();
+	params.float_activation_max = std::numeric_limits<float>::max();
+	DepthwiseConv2D(params, map_shape, g_input, filter_shape, g_filter, g_bias, map_shape, g_output);
+}
+
+static void palbench_dw_s8(void)
+{
+	const int32_t map_shape[4] = { 1, MAP_SIZE, MAP_SIZE, MAP_DEPTH };
+	const int32_t filter_shape[4] = { 1, DW_FILTER, DW_FILTER, MAP_DEPTH };
+	ConvParams params{};
+
+	palbench_dw_params(params);
+	params.input_offset = 3;
+	params.output_offset = -5;
+	params.quantized_activation_min = std::numeric_limits<int8_t>::min();
+	params.quantized_activation_max = std::numeric_limits<int8_t>::max();
+	params.per_channel_output_multiplier.assign(MAP_DEPTH, 1 << 30);
+	params.per_channel_output_shift.assign(MAP_DEPTH, -7);
+	QuantizedDepthwiseConvPerChannel(params, map_shape, g_input8, filter_shape, g_filter8, g_bias8, map_shape, g_output8);
+}
+
+static void palbench_logistic_f32(void)
+{
+	Logistic(MAP_ELEMENTS, g_input, g_output);
+}
+
+static void palbench_logistic_s8(void)
+{
+	Logistic(MAP_ELEMENTS, g_input8, 0.05f, 0, g_output8, 1.0f / 256, -128);
+}
+
+static void palbench_tanh_f32(void)
+{
+	Tanh(MAP_ELEMENTS, g_input, g_output);
+}
+
+static void palbench_tanh_s8(void)
+{
+	Tanh(0, 0.05f, 0, 1.0f / 128, MAP_ELEMENTS, g_input8, g_output8);
+}
+
+static void palbench_mean_f32(void)
+{
+	const int32_t input_dims[4] = { 1, MAP_SIZE, MAP_SIZE, MAP_DEPTH };
+	const int32_t output_dims[4] = { 1, 1, 1, MAP_DEPTH };
+	const RuntimeShape input_shape(4, input_dims);
+	const RuntimeShape output_shape(4, output_dims);
+	MeanParams params{};
+
+	params.axis_count = 2;
+	params.axis[0] = 1;
+	params.axis[1] = 2;
+	Mean(params, input_shape, g_input, output_shape, g_output);
+}
+
+/* Two maps of half the depth along the channels */
+
+static void palbench_concat_f32(void)
+{
+	const int32_t half_dims[4] = { 1, MAP_SIZE, MAP_SIZE, MAP_DEPTH / 2 };
+	const int32_t output_dims[4] = { 1, MAP_SIZE, MAP_SIZE, MAP_DEPTH };
+	const RuntimeShape half_shape(4, half_dims);
+	const RuntimeShape output_shape(4, output_dims);
+	const RuntimeShape *input_shapes[2] = { &half_shape, &half_shape };
+	const float *input_data[2] = { g_input, g_input + MAP_ELEMENTS / 2 };
+	ConcatenationParams params{};
+
+	params.axis = 3;
+	params.inputs_count = 2;
+	Concatenation(params, input_shapes, input_data, output_shape, g_output);
+}
+
+/* The float sums are rounded, the order of the additions may change them
+ * in the last bits between the PALs.
+ */
+
+static uint32_t palbench_sum_f32(int count)
+{
+	float sum = 0;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		sum += g_output[i];
+	}
+	return (uint32_t)(int32_t)(sum * 1000);
+}
+
+static uint32_t palbench_sum_s8(int count)
+{
+	uint32_t hash = 2166136261u;
+	int i;
+
+	/* FNV-1a */
+
+	for (i = 0; i < count; i++) {
+		hash = (hash ^ (uint8_t)g_output8[i]) * 16777619u;
+	}
+	return hash;
+}
+
+static uint32_t palbench_check_fc_f32(void)
+{
+	return palbench_sum_f32(FC_OUTPUTS);
+}
+
+static uint32_t palbench_check_fc_s8(void)
+{
+	return palbench_sum_s8(FC_OUTPUTS);
+}
+
+static uint32_t palbench_check_map_f32(void)
+{
+	return palbench_sum_f32(MAP_ELEMENTS);
+}
+
+static uint32_t palbench_check_map_s8(void)
+{
+	return palbench_sum_s8(MAP_ELEMENTS);
+}
+
+static uint32_t palbench_check_mean_f32(void)
+{
+	return palbench_sum_f32(MAP_DEPTH);
+}
+
+static const struct palbench_kernel_s g_kernels[] = {
+	{ "FC f32", "128 -> 64", palbench_fc_f32, palbench_check_fc_f32 },
+	{ "FC s8", "128 -> 64", palbench_fc_s8, palbench_check_fc_s8 },
+	{ "DWConv f32", "12x12x32 3x3", palbench_dw_f32, palbench_check_map_f32 },
+	{ "DWConv s8", "12x12x32 3x3", palbench_dw_s8, palbench_check_map_s8 },
+	{ "Logistic f32", "4608", palbench_logistic_f32, palbench_check_map_f32 },
+	{ "Logistic s8", "4608", palbench_logistic_s8, palbench_check_map_s8 },
+	{ "Tanh f32", "4608", palbench_tanh_f32, palbench_check_map_f32 },
+	{ "Tanh s8", "4608", palbench_tanh_s8, palbench_check_map_s8 },
+	{ "Mean f32", "12x12x32 HW", palbench_mean_f32, palbench_check_mean_f32 },
+	{ "Concat f32", "2x 12x12x16", palbench_concat_f32, palbench_check_map_f32 },
+};
+
+#define NUM_KERNELS (sizeof(g_kernels) / sizeof(g_kernels[0]))
+
+static int palbench_alloc(void)
+{
+	g_input = (float *)malloc(MAP_ELEMENTS * sizeof(float));
+	g_output = (float *)malloc(MAP_ELEMENTS * sizeof(float));
+	g_filter = (float *)malloc(MAX_WEIGHTS * sizeof(float));
+	g_bias = (float *)malloc(FC_OUTPUTS * sizeof(float));
+	g_input8 = (int8_t *)malloc(MAP_ELEMENTS);
+	g_output8 = (int8_t *)malloc(MAP_ELEMENTS);
+	g_filter8 = (int8_t *)malloc(MAX_WEIGHTS);
+	g_bias8 = (int32_t *)malloc(FC_OUTPUTS * sizeof(int32_t));
+
+	return g_input && g_output && g_filter && g_bias && g_input8 && g_output8 && g_filter8 && g_bias8 ? 0 : -1;
+}
+
+static void palbench_free(void)
+{
+	free(g_input);
+	free(g_output);
+	free(g_filter);
+	free(g_bias);
+	free(g_input8);
+	free(g_output8);
+	free(g_filter8);
+	free(g_bias8);
+}
+
+static int onert_pal_test(int argc, char *argv[])
+{
+	const struct palbench_kernel_s *kernel;
+	uint64_t start;
+	uint32_t run_ns;
+	uint32_t mhz = 0;
+	unsigned int k;
+	int i;
+
+	if (argc > 1) {
+		mhz = (uint32_t)atoi(argv[1]);
+	}
+
+	if (palbench_alloc() < 0) {
+		printf("Failed to allocate the buffers\n");
+		palbench_free();
+		return 0;
+	}
+	palbench_fill();
+
+	printf("\nPAL %s, %d runs of each kernel, time per run", PAL_NAME, NUM_RUNS);
+	if (mhz > 0) {
+		printf(" and cycles per run at %u MHz", mhz);
+	}
+	printf("\n Kernel       | Shape        |      us | checksum");
+	if (mhz > 0) {
+		printf(" |   cycles");
+	}
+	printf("\n--------------|--------------|---------|---------");
+	if (mhz > 0) {
+		printf("-|---------");
+	}
+	printf("\n");
+
+	for (k = 0; k < NUM_KERNELS; k++) {
+		kernel = &g_kernels[k];
+
+		/* Warm up the caches and the tables before timing */
+
+		kernel->run();
+		start = palbench_now_ns();
+		for (i = 0; i < NUM_RUNS; i++) {
+			kernel->run();
+		}
+		run_ns = (uint32_t)((palbench_now_ns() - start) / NUM_RUNS);
+
+		printf(" %-12s | %-12s | %5u.%u | %08x", kernel->name, kernel->shape, run_ns / 1000, run_ns / 100 % 10, kernel->checksum());
+		if (mhz > 0) {
+			printf(" | %8u", (uint32_t)((uint64_t)run_ns * mhz / 1000));
+		}
+		printf("\n");
+	}
+
+	palbench_free();
+	return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+extern "C" {
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int palbench_main(int argc, char *argv[])
+#endif
+{
+	printf("onert-micro PAL Test!!\n");
+	task_create("onert-micro PAL test", 100, 8192, onert_pal_test, &argv[1]);
+
+	return 0;
+}
+}
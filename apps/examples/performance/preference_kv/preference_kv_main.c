@@ -0,0 +1,241 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file preference_kv_main.c
+
+/// @brief Measure get and set operations per second of the preference store.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <errno.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <preference/preference.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define DEFAULT_KEYS     32
+#define DEFAULT_ROUNDS   10
+#define MAX_KEYS         1000
+#define KEY_LEN          16
+
+#ifdef CONFIG_PREFERENCE_BACKEND_LOG
+#define BACKEND_NAME     "append-only log"
+#else
+#define BACKEND_NAME     "one file per key"
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Counters of /proc/fs/smartfs/<device>/status */
+
+struct prefbench_sectors_s {
+	int free;
+	int gcblocks;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static uint32_t g_seed = 0x2545f491;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t prefbench_rand(void)
+{
+	/* xorshift32 */
+
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+static uint64_t prefbench_now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static void prefbench_key(char *key, int index)
+{
+	snprintf(key, KEY_LEN, "bench%d", index);
+}
+
+static bool prefbench_read_sectors(const char *status, struct prefbench_sectors_s *sectors)
+{
+	char line[64];
+	FILE *fp;
+	int found = 0;
+
+	fp = fopen(status, "r");
+	if (!fp) {
+		return false;
+	}
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		if (sscanf(line, "Free Sectors %d", &sectors->free) == 1 || sscanf(line, "GC Blocks %d", &sectors->gcblocks) == 1) {
+			found++;
+		}
+	}
+	fclose(fp);
+
+	return found == 2;
+}
+
+static void prefbench_print(const char *name, int ops, uint64_t elapsed_us)
+{
+	if (elapsed_us == 0) {
+		elapsed_us = 1;
+	}
+	printf(" %-6s | %8d | %9u | %10u\n", name, ops, (uint32_t)(elapsed_us / ops), (uint32_t)((uint64_t)ops * 1000000ULL / elapsed_us));
+}
+
+static int preference_kv_test(int argc, char *argv[])
+{
+	struct prefbench_sectors_s before;
+	struct prefbench_sectors_s after;
+	const char *status = NULL;
+	char key[KEY_LEN];
+	uint64_t start;
+	int keys = DEFAULT_KEYS;
+	int rounds = DEFAULT_ROUNDS;
+	int updates;
+	int value;
+	int ret;
+	int i;
+
+	if (argc > 1) {
+		keys = atoi(argv[1]);
+	}
+	if (argc > 2) {
+		rounds = atoi(argv[2]);
+	}
+	if (argc > 3) {
+		status = argv[3];
+	}
+	if (keys <= 0 || keys > MAX_KEYS || rounds <= 0) {
+		printf("Usage: prefbench [keys, 1 to %d] [update rounds] [smartfs status, e.g. /proc/fs/smartfs/smart0p8/status]\n", MAX_KEYS);
+		return 0;
+	}
+
+	printf("\n%d keys, %d update rounds, backend %s\n", keys, rounds, BACKEND_NAME);
+	printf(" op     |      ops | us per op |  ops per s\n");
+	printf("--------|----------|-----------|-----------\n");
+
+	/* Create the keys */
+
+	start = prefbench_now_us();
+	for (i = 0; i < keys; i++) {
+		prefbench_key(key, i);
+		ret = preference_set_int(key, i);
+		if (ret != OK) {
+			printf("Failed to create %s, ret %d\n", key, ret);
+			goto out;
+		}
+	}
+	prefbench_print("create", keys, prefbench_now_us() - start);
+
+	/* Update random keys, counting the sectors written meanwhile */
+
+	if (status && !prefbench_read_sectors(status, &before)) {
+		printf("Failed to read %s, errno %d\n", status, errno);
+		status = NULL;
+	}
+	updates = keys * rounds;
+	start = prefbench_now_us();
+	for (i = 0; i < updates; i++) {
+		prefbench_key(key, prefbench_rand() % keys);
+		ret = preference_set_int(key, i);
+		if (ret != OK) {
+			printf("Failed to update %s, ret %d\n", key, ret);
+			goto out;
+		}
+	}
+	prefbench_print("update", updates, prefbench_now_us() - start);
+	if (status && !prefbench_read_sectors(status, &after)) {
+		status = NULL;
+	}
+
+	/* Get random keys */
+
+	start = prefbench_now_us();
+	for (i = 0; i < updates; i++) {
+		prefbench_key(key, prefbench_rand() % keys);
+		ret = preference_get_int(key, &value);
+		if (ret != OK) {
+			printf("Failed to get %s, ret %d\n", key, ret);
+			goto out;
+		}
+	}
+	prefbench_print("get", updates, prefbench_now_us() - start);
+
+	/* Sectors are written to free ones, garbage collection frees them again.
+	 * If it ran meanwhile, the count misses the sectors it freed.
+	 */
+
+	if (status) {
+		printf("\nflash sectors written per update : %d.%02d", (before.free - after.free) / updates, ((before.free - after.free) % updates) * 100 / updates);
+		if (after.gcblocks != before.gcblocks) {
+			printf(" or more, %d blocks were garbage collected", after.gcblocks - before.gcblocks);
+		}
+		printf("\n");
+	}
+
+out:
+	for (i = 0; i < keys; i++) {
+		prefbench_key(key, i);
+		(void)preference_remove(key);
+	}
+
+	return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int prefbench_main(int argc, char *argv[])
+#endif
+{
+	printf("Preference Get and Set Test!!\n");
+
+	/* Private keys are stored under the task name, which has no spaces */
+
+	task_create("prefbench_test", 100, 4096, preference_kv_test, &argv[1]);
+
+	return 0;
+}
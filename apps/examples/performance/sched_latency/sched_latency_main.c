@@ -0,0 +1,300 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file sched_latency_main.c
+
+/// @brief Measure the context switch and wakeup latency with many ready tasks.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <errno.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define DEFAULT_ITERS    10000
+
+/* The main task runs above all the others. The filler tasks are ready, but
+ * never run before the end of a case, at priorities spread below it. The
+ * sleeper is woken below all the fillers, so that the ready-to-run list is
+ * searched past all of them to place it.
+ */
+
+#define MAIN_PRIO        200
+#define PARTNER_PRIO     (MAIN_PRIO + 1)
+#define FILLER_PRIO_BASE 60
+#define FILLER_NPRIO     100
+#define SLEEPER_PRIO     (FILLER_PRIO_BASE - 10)
+
+#define STACKSIZE        2048
+#define FILLER_STACKSIZE 1024
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const int g_nfillers[] = { 0, 8, 64, 128 };
+
+static sem_t g_ping;
+static sem_t g_pong;
+static sem_t g_wake;
+static sem_t g_exit;
+static volatile bool g_stop;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t schedlat_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void schedlat_setprio(pid_t pid, int prio)
+{
+	struct sched_param param;
+
+	param.sched_priority = prio;
+	sched_setparam(pid, &param);
+}
+
+static void schedlat_seminit(sem_t *sem)
+{
+	sem_init(sem, 0, 0);
+#ifdef CONFIG_PRIORITY_INHERITANCE
+	sem_setprotocol(sem, SEM_PRIO_NONE);
+#endif
+}
+
+/* Stay in the ready-to-run list until the end of the case */
+
+static int schedlat_filler(int argc, char *argv[])
+{
+	while (!g_stop) {
+		sched_yield();
+	}
+
+	sem_post(&g_exit);
+	return OK;
+}
+
+/* Higher priority partner: each sem_post() of the main task switches to it
+ * and its sem_wait() switches back.
+ */
+
+static int schedlat_partner(int argc, char *argv[])
+{
+	while (!g_stop) {
+		sem_wait(&g_ping);
+		sem_post(&g_pong);
+	}
+
+	sem_post(&g_exit);
+	return OK;
+}
+
+/* Woken below all fillers, it only runs when the main task raises it above
+ * itself, to wait again.
+ */
+
+static int schedlat_sleeper(int argc, char *argv[])
+{
+	while (!g_stop) {
+		sem_wait(&g_wake);
+	}
+
+	sem_post(&g_exit);
+	return OK;
+}
+
+/* Two switches per iteration, both to or from the head of the list */
+
+static uint32_t schedlat_switch(int iters)
+{
+	uint64_t start;
+	int i;
+
+	start = schedlat_now_ns();
+	for (i = 0; i < iters; i++) {
+		sem_post(&g_ping);
+		sem_wait(&g_pong);
+	}
+
+	return (uint32_t)((schedlat_now_ns() - start) / iters / 2);
+}
+
+/* The sem_post() adds the sleeper to the ready-to-run list behind all the
+ * fillers, without a switch. Raising it above the main task lets it wait
+ * again and it is lowered back while waiting, so each iteration also holds
+ * two switches and two priority changes which do not depend on the fillers.
+ */
+
+static uint32_t schedlat_wakeup(int iters, pid_t sleeper)
+{
+	uint64_t start;
+	int i;
+
+	start = schedlat_now_ns();
+	for (i = 0; i < iters; i++) {
+		sem_post(&g_wake);
+		schedlat_setprio(sleeper, PARTNER_PRIO);
+		schedlat_setprio(sleeper, SLEEPER_PRIO);
+	}
+
+	return (uint32_t)((schedlat_now_ns() - start) / iters);
+}
+
+static int schedlat_run(int nfillers, int iters)
+{
+	char *task_argv[1] = { NULL };
+	uint32_t switch_ns;
+	uint32_t wakeup_ns;
+	pid_t partner;
+	pid_t sleeper = ERROR;
+	int ntasks = 0;
+	int ret = OK;
+	int i;
+
+	/* Each case starts from fresh semaphores, the stop posts may be left */
+
+	schedlat_seminit(&g_ping);
+	schedlat_seminit(&g_pong);
+	schedlat_seminit(&g_wake);
+	schedlat_seminit(&g_exit);
+	g_stop = false;
+
+	partner = task_create("schedlat_partner", PARTNER_PRIO, STACKSIZE, schedlat_partner, task_argv);
+	if (partner < 0) {
+		printf("Fail to create the partner, errno %d\n", errno);
+		ret = ERROR;
+		goto out;
+	}
+	ntasks++;
+
+	sleeper = task_create("schedlat_sleeper", SLEEPER_PRIO, STACKSIZE, schedlat_sleeper, task_argv);
+	if (sleeper < 0) {
+		printf("Fail to create the sleeper, errno %d\n", errno);
+		ret = ERROR;
+		goto out;
+	}
+	ntasks++;
+
+	/* Let the sleeper wait on g_wake before the first iteration */
+
+	schedlat_setprio(sleeper, PARTNER_PRIO);
+	schedlat_setprio(sleeper, SLEEPER_PRIO);
+
+	for (i = 0; i < nfillers; i++) {
+		if (task_create("schedlat_filler", FILLER_PRIO_BASE + (i % FILLER_NPRIO), FILLER_STACKSIZE, schedlat_filler, task_argv) < 0) {
+			printf("Fail to create the filler %d, errno %d\n", i, errno);
+			ret = ERROR;
+			goto out;
+		}
+		ntasks++;
+	}
+
+	switch_ns = schedlat_switch(iters);
+	wakeup_ns = schedlat_wakeup(iters, sleeper);
+
+	printf(" %7d | %9u | %9u\n", nfillers, switch_ns, wakeup_ns);
+
+out:
+	/* Stop all the tasks of the case and let them run to their end */
+
+	g_stop = true;
+	if (partner >= 0) {
+		sem_post(&g_ping);
+	}
+	if (sleeper >= 0) {
+		sem_post(&g_wake);
+	}
+
+	schedlat_setprio(0, SLEEPER_PRIO - 1);
+	for (i = 0; i < ntasks; i++) {
+		sem_wait(&g_exit);
+	}
+	schedlat_setprio(0, MAIN_PRIO);
+
+	sem_destroy(&g_ping);
+	sem_destroy(&g_pong);
+	sem_destroy(&g_wake);
+	sem_destroy(&g_exit);
+	return ret;
+}
+
+static int sched_latency_test(int argc, char *argv[])
+{
+	struct sched_param saved;
+	int iters = DEFAULT_ITERS;
+	int i;
+
+	if (argc > 1) {
+		iters = atoi(argv[1]);
+	}
+
+	if (iters <= 0) {
+		printf("Usage: schedlat [iterations]\n");
+		return 0;
+	}
+
+	sched_getparam(0, &saved);
+	schedlat_setprio(0, MAIN_PRIO);
+
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+	printf("\n%d iterations, ready-to-run bitmap\n", iters);
+#else
+	printf("\n%d iterations, ready-to-run list\n", iters);
+#endif
+	printf(" fillers | switch ns | wakeup ns\n");
+	printf("---------|-----------|----------\n");
+
+	for (i = 0; i < sizeof(g_nfillers) / sizeof(g_nfillers[0]); i++) {
+		if (schedlat_run(g_nfillers[i], iters) != OK) {
+			break;
+		}
+	}
+
+	sched_setparam(0, &saved);
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int schedlat_main(int argc, char *argv[])
+#endif
+{
+	return sched_latency_test(argc, argv);
+}
@@ -0,0 +1,226 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file smartfs_write_main.c
+
+/// @brief Measure the throughput of sequential file writes on SmartFS.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/statfs.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_MOUNT_POINT
+#define CONFIG_MOUNT_POINT "/mnt/"
+#endif
+
+#define TEST_FILE        CONFIG_MOUNT_POINT"sfswrite"
+#define CHUNK_SIZE       4096	/* Bytes passed to one write() */
+#define NUM_REPEAT       3	/* Files written per size */
+
+#define STRINGIFY(x)     STRINGIFY2(x)
+#define STRINGIFY2(x)    #x
+
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+#define WRITE_PATH_NAME "runs of up to " STRINGIFY(CONFIG_MTD_SMART_WRITE_BATCH_SECTORS) " sectors (CONFIG_MTD_SMART_WRITE_BATCH)"
+#else
+#define WRITE_PATH_NAME "one sector at a time"
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct sfswrite_result_s {
+	uint32_t avg_kbps;
+	uint32_t worst_kbps;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static uint8_t g_chunk[CHUNK_SIZE];
+static const int g_sizes[] = {4 * 1024, 16 * 1024, 64 * 1024, 256 * 1024, 1024 * 1024};
+static uint32_t g_seed = 0x2545f491;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t sfswrite_rand(void)
+{
+	/* xorshift32, the data does not matter but should not be erased state */
+
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+static uint64_t sfswrite_elapsed_us(struct timespec *start, struct timespec *end)
+{
+	return (uint64_t)(end->tv_sec - start->tv_sec) * 1000000ULL + (end->tv_nsec - start->tv_nsec) / 1000;
+}
+
+static uint32_t sfswrite_kbps(int size, uint64_t elapsed_us)
+{
+	if (elapsed_us == 0) {
+		elapsed_us = 1;
+	}
+
+	return (uint32_t)(((uint64_t)size * 1000000ULL / 1024) / elapsed_us);
+}
+
+/* Create the file, write 'size' bytes in CHUNK_SIZE pieces and close it.
+ * The time includes close(), which writes the last partial sector.
+ */
+
+static int sfswrite_file(int size, uint64_t *elapsed_us)
+{
+	struct timespec ts1;
+	struct timespec ts2;
+	int remain;
+	int len;
+	int fd;
+	int ret;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts1);
+
+	fd = open(TEST_FILE, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	if (fd < 0) {
+		printf("Failed to open %s, errno %d\n", TEST_FILE, errno);
+		return -1;
+	}
+
+	for (remain = size; remain > 0; remain -= len) {
+		len = remain < CHUNK_SIZE ? remain : CHUNK_SIZE;
+		ret = write(fd, g_chunk, len);
+		if (ret != len) {
+			printf("Failed to write %d bytes at %d, ret %d errno %d\n", len, size - remain, ret, errno);
+			close(fd);
+			unlink(TEST_FILE);
+			return -1;
+		}
+	}
+
+	close(fd);
+	clock_gettime(CLOCK_MONOTONIC, &ts2);
+
+	*elapsed_us = sfswrite_elapsed_us(&ts1, &ts2);
+
+	unlink(TEST_FILE);
+	return 0;
+}
+
+static int sfswrite_measure(int size, struct sfswrite_result_s *res)
+{
+	uint64_t total_us = 0;
+	uint64_t elapsed_us;
+	uint32_t kbps;
+	int i;
+
+	res->worst_kbps = UINT32_MAX;
+	for (i = 0; i < NUM_REPEAT; i++) {
+		if (sfswrite_file(size, &elapsed_us) != 0) {
+			return -1;
+		}
+
+		kbps = sfswrite_kbps(size, elapsed_us);
+		if (kbps < res->worst_kbps) {
+			res->worst_kbps = kbps;
+		}
+		total_us += elapsed_us;
+	}
+
+	res->avg_kbps = sfswrite_kbps(size * NUM_REPEAT, total_us);
+	return 0;
+}
+
+static int smartfs_write_test(int argc, char *argv[])
+{
+	struct sfswrite_result_s res;
+	struct statfs fsinfo;
+	off_t avail;
+	int k;
+	int i;
+
+	printf("\nSectors written : %s\n", WRITE_PATH_NAME);
+
+	if (statfs(CONFIG_MOUNT_POINT, &fsinfo) != 0) {
+		printf("Failed to get the free space of %s, errno %d\n", CONFIG_MOUNT_POINT, errno);
+		return 0;
+	}
+
+	avail = fsinfo.f_bavail * fsinfo.f_bsize;
+	printf("Free space of %s : %d bytes\n", CONFIG_MOUNT_POINT, (int)avail);
+
+	for (i = 0; i < CHUNK_SIZE; i++) {
+		g_chunk[i] = (uint8_t)sfswrite_rand();
+	}
+
+	printf("\n%d files per size written with %d byte write() calls, KB/s\n", NUM_REPEAT, CHUNK_SIZE);
+	printf(" Size    | average | worst\n");
+	printf("---------|---------|-------\n");
+
+	for (k = 0; k < sizeof(g_sizes) / sizeof(g_sizes[0]); k++) {
+		/* Leave room for garbage collection to work without stalling */
+
+		if (g_sizes[k] > avail / 2) {
+			printf(" %5dKB | skipped, not enough free space\n", g_sizes[k] / 1024);
+			continue;
+		}
+
+		if (sfswrite_measure(g_sizes[k], &res) != 0) {
+			break;
+		}
+		printf(" %5dKB | %7u | %5u\n", g_sizes[k] / 1024, res.avg_kbps, res.worst_kbps);
+	}
+
+	return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int sfswrite_main(int argc, char *argv[])
+#endif
+{
+	printf("SmartFS Write Test!!\n");
+	task_create("SmartFS write test", 100, 4096, smartfs_write_test, argv);
+
+	return 0;
+}
@@ -0,0 +1,263 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file smp_scaling_main.c
+
+/// @brief Measure how the throughput of parallel workers scales with the CPUs.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define DEFAULT_ROUNDS   2000
+
+/* Each round of a worker updates its own buffer WORK_PASSES times, so that
+ * the buffer stays in the cache of a CPU as long as the worker does not
+ * migrate, then yields to the workers of the same priority.
+ */
+
+#define WORK_BUFLEN      4096
+#define WORK_PASSES      4
+
+#define MAIN_PRIO        110
+#define WORKER_PRIO      100
+#define STACKSIZE        2048
+
+#define MAX_WORKERS      (2 * CONFIG_SMP_NCPUS)
+
+#define RUNQUEUE_PATH    "/proc/runqueue"
+#define RUNQUEUE_BUFLEN  64
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static sem_t g_start;
+static sem_t g_done;
+static int g_rounds;
+static volatile uint32_t g_sink;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t smpscale_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void smpscale_setprio(int prio)
+{
+	struct sched_param param;
+
+	param.sched_priority = prio;
+	sched_setparam(0, &param);
+}
+
+static int smpscale_worker(int argc, char *argv[])
+{
+	uint32_t buf[WORK_BUFLEN / sizeof(uint32_t)];
+	uint32_t x = 1;
+	int round;
+	int pass;
+	int i;
+
+	memset(buf, 0, sizeof(buf));
+	sem_wait(&g_start);
+
+	for (round = 0; round < g_rounds; round++) {
+		for (pass = 0; pass < WORK_PASSES; pass++) {
+			for (i = 0; i < WORK_BUFLEN / sizeof(uint32_t); i++) {
+				x ^= x << 13;
+				x ^= x >> 17;
+				x ^= x << 5;
+				buf[i] += x;
+			}
+		}
+		sched_yield();
+	}
+
+	g_sink += buf[x % (WORK_BUFLEN / sizeof(uint32_t))];
+	sem_post(&g_done);
+	return OK;
+}
+
+/* Run nworkers workers from a common start, each pinned to one CPU if pin
+ * is set, and return the time until the last one ends in microseconds.
+ */
+
+static int smpscale_run(int nworkers, bool pin, uint32_t *elapsed_us)
+{
+	char *worker_argv[1] = { NULL };
+	cpu_set_t affinity;
+	uint64_t start;
+	pid_t pid;
+	int ncreated;
+	int ret = OK;
+	int i;
+
+	sem_init(&g_start, 0, 0);
+	sem_init(&g_done, 0, 0);
+#ifdef CONFIG_PRIORITY_INHERITANCE
+	sem_setprotocol(&g_start, SEM_PRIO_NONE);
+	sem_setprotocol(&g_done, SEM_PRIO_NONE);
+#endif
+
+	for (ncreated = 0; ncreated < nworkers; ncreated++) {
+		pid = task_create("smpscale_worker", WORKER_PRIO, STACKSIZE, smpscale_worker, worker_argv);
+		if (pid < 0) {
+			printf("Fail to create the worker %d, errno %d\n", ncreated, errno);
+			ret = ERROR;
+			break;
+		}
+
+		if (pin) {
+			CPU_ZERO(&affinity);
+			CPU_SET(ncreated % CONFIG_SMP_NCPUS, &affinity);
+			sched_setaffinity(pid, sizeof(cpu_set_t), &affinity);
+		}
+	}
+
+	/* The workers of a failed case still run to their end */
+
+	start = smpscale_now_ns();
+	for (i = 0; i < ncreated; i++) {
+		sem_post(&g_start);
+	}
+	for (i = 0; i < ncreated; i++) {
+		sem_wait(&g_done);
+	}
+	*elapsed_us = (uint32_t)((smpscale_now_ns() - start) / 1000);
+
+	sem_destroy(&g_start);
+	sem_destroy(&g_done);
+	return ret;
+}
+
+static void smpscale_runqueue(void)
+{
+#if defined(CONFIG_SCHED_CPU_RUNQUEUE) && defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_RUNQUEUE)
+	char buf[RUNQUEUE_BUFLEN];
+	ssize_t nread;
+	int fd;
+
+	fd = open(RUNQUEUE_PATH, O_RDONLY);
+	if (fd < 0) {
+		printf("Fail to open %s, errno %d\n", RUNQUEUE_PATH, errno);
+		return;
+	}
+
+	printf("\n%s:\n", RUNQUEUE_PATH);
+	while ((nread = read(fd, buf, RUNQUEUE_BUFLEN - 1)) > 0) {
+		buf[nread] = '\0';
+		printf("%s", buf);
+	}
+
+	close(fd);
+#endif
+}
+
+static int smp_scaling_test(int argc, char *argv[])
+{
+	struct sched_param saved;
+	uint32_t base_us = 0;
+	uint32_t elapsed_us;
+	uint32_t speedup;
+	bool pin = false;
+	int nworkers;
+	int i;
+
+	g_rounds = DEFAULT_ROUNDS;
+	for (i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "pin") == 0) {
+			pin = true;
+		} else {
+			g_rounds = atoi(argv[i]);
+		}
+	}
+
+	if (g_rounds <= 0) {
+		printf("Usage: smpscale [rounds] [pin]\n");
+		return 0;
+	}
+
+	/* Stay above the workers to start and time them */
+
+	sched_getparam(0, &saved);
+	smpscale_setprio(MAIN_PRIO);
+
+	printf("\n%d CPUs, %d rounds of %d bytes x %d per worker, %s\n", CONFIG_SMP_NCPUS, g_rounds, WORK_BUFLEN, WORK_PASSES, pin ? "pinned" : "free");
+	printf(" workers |    ms    | rounds/s | speedup\n");
+	printf("---------|----------|----------|--------\n");
+
+	for (nworkers = 1; nworkers <= MAX_WORKERS; nworkers = (nworkers < CONFIG_SMP_NCPUS) ? nworkers + 1 : nworkers * 2) {
+		if (smpscale_run(nworkers, pin, &elapsed_us) != OK) {
+			break;
+		}
+
+		if (elapsed_us == 0) {
+			elapsed_us = 1;
+		}
+
+		/* The speedup is the throughput relative to one worker, in 1/100 */
+
+		if (base_us == 0) {
+			base_us = elapsed_us;
+		}
+		speedup = (uint32_t)((uint64_t)nworkers * base_us * 100 / elapsed_us);
+
+		printf(" %7d | %8u | %8u | %3u.%02u\n", nworkers, elapsed_us / 1000, (uint32_t)((uint64_t)nworkers * g_rounds * 1000000 / elapsed_us), speedup / 100, speedup % 100);
+	}
+
+	smpscale_runqueue();
+
+	sched_setparam(0, &saved);
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int smpscale_main(int argc, char *argv[])
+#endif
+{
+	return smp_scaling_test(argc, argv);
+}
@@ -0,0 +1,345 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file stream_buffer_main.cpp
+
+/// @brief Measure throughput and latency of the media stream buffer.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <memory>
+
+#include "StreamBuffer.h"
+#include "StreamBufferReader.h"
+#include "StreamBufferWriter.h"
+
+using namespace media::stream;
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define BUFFER_SIZE      (16 * 1024)	/* Stream buffer between the tasks */
+#define FRAME_SIZE       (2 * 1024)	/* Bytes produced at once, like a decoded frame */
+#define PERIOD_SIZE      (4 * 1024)	/* Bytes consumed at once, like an audio period */
+#define TOTAL_SIZE       (4 * 1024 * 1024)
+#define STAMP_SIZE       sizeof(uint64_t)
+
+#define SBUF_MIN(a, b)   ((a) < (b) ? (a) : (b))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+enum sbuf_mode_e {
+	SBUF_COPY_COPY,				/* write() / read() */
+	SBUF_INPLACE_COPY,			/* acquireWrite() / read() */
+	SBUF_INPLACE_INPLACE,		/* acquireWrite() / peekRead() */
+	SBUF_MODE_MAX
+};
+
+/* Position in the stream and the time stamp of the current frame */
+
+struct sbuf_stream_s {
+	size_t offset;
+	uint8_t stamp[STAMP_SIZE];
+};
+
+struct sbuf_result_s {
+	uint32_t kbps;
+	uint32_t avg_us;
+	uint32_t worst_us;
+	uint32_t nframes;
+	uint32_t nerrors;
+};
+
+struct sbuf_test_s {
+	std::shared_ptr<StreamBuffer> stream;
+	enum sbuf_mode_e mode;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const char *g_mode_names[SBUF_MODE_MAX] = {
+	"copy / copy        ",
+	"in place / copy    ",
+	"in place / in place",
+};
+
+static uint8_t g_source[FRAME_SIZE];	/* Payload of every frame */
+static uint8_t g_frame[FRAME_SIZE];	/* Decoder output for write() */
+static uint8_t g_period[PERIOD_SIZE];	/* Player buffer for read() */
+static uint32_t g_seed = 0x2545f491;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t sbuf_rand(void)
+{
+	/* xorshift32 */
+
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+static uint64_t sbuf_now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+/* Generate 'len' bytes of the stream into 'buf'. Every frame starts with
+ * the time it was produced and is followed by the payload.
+ */
+
+static void sbuf_produce(struct sbuf_stream_s *st, uint8_t *buf, size_t len)
+{
+	size_t pos;
+	size_t n;
+
+	while (len > 0) {
+		pos = st->offset % FRAME_SIZE;
+		if (pos == 0) {
+			uint64_t now = sbuf_now_us();
+			memcpy(st->stamp, &now, STAMP_SIZE);
+		}
+
+		if (pos < STAMP_SIZE) {
+			n = SBUF_MIN(len, STAMP_SIZE - pos);
+			memcpy(buf, st->stamp + pos, n);
+		} else {
+			n = SBUF_MIN(len, FRAME_SIZE - pos);
+			memcpy(buf, g_source + pos, n);
+		}
+
+		buf += n;
+		len -= n;
+		st->offset += n;
+	}
+}
+
+/* Check 'len' bytes of the stream in 'buf', the frames may be split at any
+ * byte. The latency of a frame is taken when its time stamp is complete.
+ */
+
+static void sbuf_consume(struct sbuf_stream_s *st, struct sbuf_result_s *res, uint64_t *total_us, const uint8_t *buf, size_t len)
+{
+	uint64_t then;
+	uint32_t latency;
+	size_t pos;
+	size_t n;
+
+	while (len > 0) {
+		pos = st->offset % FRAME_SIZE;
+		if (pos < STAMP_SIZE) {
+			n = SBUF_MIN(len, STAMP_SIZE - pos);
+			memcpy(st->stamp + pos, buf, n);
+			if (pos + n == STAMP_SIZE) {
+				memcpy(&then, st->stamp, STAMP_SIZE);
+				latency = (uint32_t)(sbuf_now_us() - then);
+				if (latency > res->worst_us) {
+					res->worst_us = latency;
+				}
+				*total_us += latency;
+				res->nframes++;
+			}
+		} else {
+			n = SBUF_MIN(len, FRAME_SIZE - pos);
+			if (memcmp(buf, g_source + pos, n) != 0) {
+				res->nerrors++;
+			}
+		}
+
+		buf += n;
+		len -= n;
+		st->offset += n;
+	}
+}
+
+static void *sbuf_producer(void *arg)
+{
+	struct sbuf_test_s *test = (struct sbuf_test_s *)arg;
+	StreamBufferWriter writer(test->stream);
+	struct sbuf_stream_s st;
+	unsigned char *buf;
+	size_t len;
+
+	memset(&st, 0, sizeof(st));
+
+	while (st.offset < TOTAL_SIZE) {
+		if (test->mode == SBUF_COPY_COPY) {
+			/* Produce a frame aside, then copy it into the stream buffer */
+
+			sbuf_produce(&st, g_frame, FRAME_SIZE);
+			if (writer.write(g_frame, FRAME_SIZE) != FRAME_SIZE) {
+				break;
+			}
+		} else {
+			/* Produce at most the rest of a frame right in the stream buffer */
+
+			len = writer.acquireWrite(&buf);
+			if (len == 0) {
+				break;
+			}
+			len = SBUF_MIN(len, FRAME_SIZE - st.offset % FRAME_SIZE);
+			sbuf_produce(&st, buf, len);
+			writer.commitWrite(len);
+		}
+	}
+
+	writer.setEndOfStream();
+	return NULL;
+}
+
+static size_t sbuf_consumer(struct sbuf_test_s *test, struct sbuf_result_s *res, uint64_t *total_us)
+{
+	StreamBufferReader reader(test->stream);
+	struct sbuf_stream_s st;
+	const unsigned char *buf;
+	size_t len;
+
+	memset(&st, 0, sizeof(st));
+
+	while (true) {
+		if (test->mode != SBUF_INPLACE_INPLACE) {
+			/* Copy a period into the player buffer, then use it */
+
+			len = reader.read(g_period, PERIOD_SIZE);
+			sbuf_consume(&st, res, total_us, g_period, len);
+			if (len < PERIOD_SIZE) {
+				break;
+			}
+		} else {
+			/* Use at most a period right from the stream buffer */
+
+			len = reader.peekRead(&buf);
+			if (len == 0) {
+				break;
+			}
+			len = SBUF_MIN(len, PERIOD_SIZE);
+			sbuf_consume(&st, res, total_us, buf, len);
+			reader.consumeRead(len);
+		}
+	}
+
+	return st.offset;
+}
+
+static int sbuf_measure(enum sbuf_mode_e mode, struct sbuf_result_s *res)
+{
+	struct sbuf_test_s test;
+	pthread_attr_t attr;
+	pthread_t producer;
+	uint64_t total_us = 0;
+	uint64_t start;
+	uint64_t elapsed;
+	size_t received;
+
+	memset(res, 0, sizeof(*res));
+
+	test.stream = StreamBuffer::Builder().setBufferSize(BUFFER_SIZE).setThreshold(BUFFER_SIZE).build();
+	if (!test.stream) {
+		printf("Failed to create a stream buffer of %d bytes\n", BUFFER_SIZE);
+		return -1;
+	}
+	test.mode = mode;
+
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, 4096);
+
+	start = sbuf_now_us();
+	if (pthread_create(&producer, &attr, sbuf_producer, &test) != 0) {
+		printf("Failed to create the producer\n");
+		return -1;
+	}
+
+	received = sbuf_consumer(&test, res, &total_us);
+	pthread_join(producer, NULL);
+	elapsed = sbuf_now_us() - start;
+
+	if (received != TOTAL_SIZE) {
+		printf("Received %u of %u bytes\n", (unsigned int)received, TOTAL_SIZE);
+		return -1;
+	}
+
+	if (elapsed == 0) {
+		elapsed = 1;
+	}
+	res->kbps = (uint32_t)(((uint64_t)TOTAL_SIZE * 1000000ULL / 1024) / elapsed);
+	if (res->nframes > 0) {
+		res->avg_us = (uint32_t)(total_us / res->nframes);
+	}
+
+	return 0;
+}
+
+static int stream_buffer_test(int argc, char *argv[])
+{
+	struct sbuf_result_s res;
+	int i;
+
+	for (i = 0; i < FRAME_SIZE; i++) {
+		g_source[i] = (uint8_t)sbuf_rand();
+	}
+
+	printf("\n%d KB through a %d byte stream buffer, %d byte frames in, %d byte periods out\n", TOTAL_SIZE / 1024, BUFFER_SIZE, FRAME_SIZE, PERIOD_SIZE);
+	printf(" write / read        |  KB/s   | avg us | worst us | errors\n");
+	printf("---------------------|---------|--------|----------|-------\n");
+
+	for (i = 0; i < SBUF_MODE_MAX; i++) {
+		if (sbuf_measure((enum sbuf_mode_e)i, &res) != 0) {
+			break;
+		}
+		printf(" %s | %7u | %6u | %8u | %5u\n", g_mode_names[i], res.kbps, res.avg_us, res.worst_us, res.nerrors);
+	}
+
+	return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+extern "C" {
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int sbufbench_main(int argc, char *argv[])
+#endif
+{
+	printf("Stream Buffer Test!!\n");
+	task_create("Stream buffer test", 100, 4096, stream_buffer_test, argv);
+
+	return 0;
+}
+}
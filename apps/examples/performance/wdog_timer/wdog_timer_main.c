@@ -0,0 +1,239 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file wdog_timer_main.c
+
+/// @brief Measure wd_start(), wd_cancel() and expiration cost against the number of active watchdogs.
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <tinyara/wdog.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define NUM_PROBE        16		/* Watchdogs timed together in one batch */
+#define NUM_REPEAT       50		/* Batches per number of active watchdogs */
+#define MAX_ACTIVE       1000	/* Largest number of background watchdogs */
+
+/* Background watchdogs expire between one and two minutes from now, so
+ * none of them runs during the test.  Probes are spread over the first
+ * 30 seconds to land anywhere between them.
+ */
+
+#define BG_DELAY_MIN     (60 * CLK_TCK)
+#define PROBE_DELAY_MAX  (30 * CLK_TCK)
+#define EXPIRE_DELAY     2
+
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+#define WDOG_QUEUE_NAME "timing wheel (CONFIG_WDOG_TIMING_WHEEL)"
+#else
+#define WDOG_QUEUE_NAME "sorted active list"
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct wdtimer_result_s {
+	uint32_t arm_ns;
+	uint32_t cancel_ns;
+	uint32_t expire_ns;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static WDOG_ID g_background[MAX_ACTIVE];
+static WDOG_ID g_probe[NUM_PROBE];
+static struct timespec g_stamp[NUM_PROBE];
+static volatile int g_nexpired;
+static sem_t g_done;
+static const int g_nactive[] = {10, 100, 1000};
+static uint32_t g_seed = 0x2545f491;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint32_t wdtimer_rand(void)
+{
+	/* xorshift32, good enough to spread delays and keep runs reproducible */
+
+	g_seed ^= g_seed << 13;
+	g_seed ^= g_seed >> 17;
+	g_seed ^= g_seed << 5;
+	return g_seed;
+}
+
+static uint64_t wdtimer_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+	return (uint64_t)(end->tv_sec - start->tv_sec) * 1000000000ULL + end->tv_nsec - start->tv_nsec;
+}
+
+static void wdtimer_nop(int argc, uint32_t arg)
+{
+}
+
+/* Runs in the timer interrupt.  The first and the last stamp of a batch
+ * bound the time spent on running the watchdogs of one tick.
+ */
+
+static void wdtimer_expired(int argc, uint32_t arg)
+{
+	clock_gettime(CLOCK_MONOTONIC, &g_stamp[g_nexpired]);
+	if (++g_nexpired == NUM_PROBE) {
+		sem_post(&g_done);
+	}
+}
+
+static int wdtimer_create(WDOG_ID *wdogs, int count)
+{
+	int i;
+
+	for (i = 0; i < count; i++) {
+		wdogs[i] = wd_create();
+		if (!wdogs[i]) {
+			printf("Failed to create %d-th watchdog\n", i);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static void wdtimer_delete(WDOG_ID *wdogs, int count)
+{
+	int i;
+
+	for (i = 0; i < count; i++) {
+		if (wdogs[i]) {
+			wd_delete(wdogs[i]);
+			wdogs[i] = NULL;
+		}
+	}
+}
+
+static void wdtimer_measure(struct wdtimer_result_s *res)
+{
+	struct timespec ts1;
+	struct timespec ts2;
+	uint64_t arm_total = 0;
+	uint64_t cancel_total = 0;
+	uint64_t expire_total = 0;
+	int nexpire = 0;
+	int i;
+	int j;
+
+	for (i = 0; i < NUM_REPEAT; i++) {
+		clock_gettime(CLOCK_MONOTONIC, &ts1);
+		for (j = 0; j < NUM_PROBE; j++) {
+			wd_start(g_probe[j], 1 + wdtimer_rand() % PROBE_DELAY_MAX, (wdentry_t)wdtimer_nop, 1, j);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &ts2);
+		arm_total += wdtimer_elapsed_ns(&ts1, &ts2);
+
+		clock_gettime(CLOCK_MONOTONIC, &ts1);
+		for (j = 0; j < NUM_PROBE; j++) {
+			wd_cancel(g_probe[j]);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &ts2);
+		cancel_total += wdtimer_elapsed_ns(&ts1, &ts2);
+
+		/* Let a whole batch expire on the same tick */
+
+		g_nexpired = 0;
+		for (j = 0; j < NUM_PROBE; j++) {
+			wd_start(g_probe[j], EXPIRE_DELAY, (wdentry_t)wdtimer_expired, 1, j);
+		}
+
+		sem_wait(&g_done);
+		expire_total += wdtimer_elapsed_ns(&g_stamp[0], &g_stamp[NUM_PROBE - 1]);
+		nexpire += NUM_PROBE - 1;
+	}
+
+	res->arm_ns = (uint32_t)(arm_total / (NUM_REPEAT * NUM_PROBE));
+	res->cancel_ns = (uint32_t)(cancel_total / (NUM_REPEAT * NUM_PROBE));
+	res->expire_ns = (uint32_t)(expire_total / nexpire);
+}
+
+static int wdog_timer_test(int argc, char *argv[])
+{
+	struct wdtimer_result_s res;
+	int k;
+	int i;
+
+	printf("\nActive watchdogs kept in : %s\n", WDOG_QUEUE_NAME);
+
+	sem_init(&g_done, 0, 0);
+
+	if (wdtimer_create(g_probe, NUM_PROBE) != 0 || wdtimer_create(g_background, MAX_ACTIVE) != 0) {
+		goto errout;
+	}
+
+	printf("\n%d x %d operations per count, nanoseconds per operation\n", NUM_REPEAT, NUM_PROBE);
+	printf(" Active | wd_start | wd_cancel | expire\n");
+	printf("--------|----------|-----------|-------\n");
+
+	for (k = 0; k < sizeof(g_nactive) / sizeof(g_nactive[0]); k++) {
+		for (i = 0; i < g_nactive[k]; i++) {
+			wd_start(g_background[i], BG_DELAY_MIN + wdtimer_rand() % BG_DELAY_MIN, (wdentry_t)wdtimer_nop, 1, i);
+		}
+
+		wdtimer_measure(&res);
+		printf(" %6d | %8u | %9u | %6u\n", g_nactive[k], res.arm_ns, res.cancel_ns, res.expire_ns);
+
+		for (i = 0; i < g_nactive[k]; i++) {
+			wd_cancel(g_background[i]);
+		}
+	}
+
+errout:
+	wdtimer_delete(g_probe, NUM_PROBE);
+	wdtimer_delete(g_background, MAX_ACTIVE);
+	sem_destroy(&g_done);
+
+	return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int wdtimer_main(int argc, char *argv[])
+#endif
+{
+	printf("Watchdog Timer Test!!\n");
+	task_create("Watchdog timer test", 100, 4096, wdog_timer_test, argv);
+
+	return 0;
+}
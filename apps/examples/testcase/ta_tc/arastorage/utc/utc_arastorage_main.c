@@ -37,8 +37,10 @@
 
 #define RELATION_NAME1  "rel1"
 #define RELATION_NAME2  "rel2"
+#define RELATION_NAME3  "rel3"
 #define INDEX_BPLUS     "bplustree"
 #define INDEX_INLINE    "inline"
+#define INDEX_BTREE     "btree"
 #define QUERY_LENGTH    128
 
 #define DATA_SET_NUM    10
@@ -464,6 +466,275 @@ static void utc_arastorage_db_query_n(void)
 	TC_SUCCESS_RESULT();
 }
 
+/**
+* @testcase         utc_arastorage_db_prepare_p
+* @brief            Run prepared statements
+* @scenario         Insert rows and select them with values bound to parameters
+* @apicovered       db_prepare, db_bind, db_step, db_finalize
+* @precondition     utc_arastorage_db_exec_p should be passed
+* @postcondition    none
+*/
+static void utc_arastorage_db_prepare_p(void)
+{
+	db_result_t res;
+	db_stmt_t *stmt;
+	db_cursor_t *cursor;
+	char query[QUERY_LENGTH];
+	long date;
+	int low;
+	int id;
+
+	snprintf(query, QUERY_LENGTH, "INSERT (?, ?) INTO %s;", RELATION_NAME2);
+	stmt = db_prepare(query);
+	TC_ASSERT_NEQ("db_prepare", stmt, NULL);
+
+	for (id = DATA_SET_NUM * 10; id < DATA_SET_NUM * 11; id++) {
+		date = id;
+		res = db_bind(stmt, 0, DOMAIN_INT, &id);
+		TC_ASSERT_EQ_CLEANUP("db_bind", DB_SUCCESS(res), true, db_finalize(stmt));
+		res = db_bind(stmt, 1, DOMAIN_LONG, &date);
+		TC_ASSERT_EQ_CLEANUP("db_bind", DB_SUCCESS(res), true, db_finalize(stmt));
+		res = db_step(stmt, NULL);
+		TC_ASSERT_EQ_CLEANUP("db_step", DB_SUCCESS(res), true, db_finalize(stmt));
+	}
+	res = db_finalize(stmt);
+	TC_ASSERT_EQ("db_finalize", DB_SUCCESS(res), true);
+
+	snprintf(query, QUERY_LENGTH, "SELECT id, date FROM %s WHERE id > ? AND id < ?;", RELATION_NAME2);
+	stmt = db_prepare(query);
+	TC_ASSERT_NEQ("db_prepare", stmt, NULL);
+
+	/* Each step selects one of the inserted rows */
+	for (id = DATA_SET_NUM * 10; id < DATA_SET_NUM * 11; id++) {
+		low = id - 1;
+		res = db_bind(stmt, 0, DOMAIN_INT, &low);
+		TC_ASSERT_EQ_CLEANUP("db_bind", DB_SUCCESS(res), true, db_finalize(stmt));
+		date = id + 1;
+		res = db_bind(stmt, 1, DOMAIN_LONG, &date);
+		TC_ASSERT_EQ_CLEANUP("db_bind", DB_SUCCESS(res), true, db_finalize(stmt));
+		cursor = NULL;
+		res = db_step(stmt, &cursor);
+		TC_ASSERT_EQ_CLEANUP("db_step", DB_SUCCESS(res), true, db_finalize(stmt));
+		TC_ASSERT_EQ_CLEANUP("cursor_get_count", cursor_get_count(cursor), 1, db_cursor_free(cursor); db_finalize(stmt));
+		res = db_cursor_free(cursor);
+		TC_ASSERT_EQ_CLEANUP("db_cursor_free", DB_SUCCESS(res), true, db_finalize(stmt));
+	}
+	res = db_finalize(stmt);
+	TC_ASSERT_EQ("db_finalize", DB_SUCCESS(res), true);
+
+	TC_SUCCESS_RESULT();
+}
+
+/**
+* @testcase         utc_arastorage_db_begin_p
+* @brief            Insert rows of a prepared statement in a batch
+* @scenario         Commit a batch of rows, roll back another one and select the committed rows
+* @apicovered       db_begin, db_commit, db_rollback
+* @precondition     utc_arastorage_db_prepare_p should be passed
+* @postcondition    none
+*/
+static void utc_arastorage_db_begin_p(void)
+{
+	db_result_t res;
+	db_stmt_t *stmt;
+	char query[QUERY_LENGTH];
+#ifndef CONFIG_ARASTORAGE_ENABLE_FLUSHING
+	db_cursor_t *cursor;
+	long date;
+	int id;
+#endif
+
+	snprintf(query, QUERY_LENGTH, "INSERT (?, ?) INTO %s;", RELATION_NAME2);
+	stmt = db_prepare(query);
+	TC_ASSERT_NEQ("db_prepare", stmt, NULL);
+
+#ifdef CONFIG_ARASTORAGE_ENABLE_FLUSHING
+	/* A flush in the middle of a commit would drop rows, so there is no batch */
+	res = db_begin(stmt, DATA_SET_NUM);
+	TC_ASSERT_EQ_CLEANUP("db_begin", res, DB_IMPLEMENTATION_ERROR, db_finalize(stmt));
+	res = db_commit(stmt);
+	TC_ASSERT_EQ_CLEANUP("db_commit", DB_ERROR(res), true, db_finalize(stmt));
+	res = db_finalize(stmt);
+	TC_ASSERT_EQ("db_finalize", DB_SUCCESS(res), true);
+#else
+	res = db_begin(stmt, DATA_SET_NUM);
+	TC_ASSERT_EQ_CLEANUP("db_begin", DB_SUCCESS(res), true, db_finalize(stmt));
+	for (id = DATA_SET_NUM * 11; id < DATA_SET_NUM * 12; id++) {
+		date = id;
+		res = db_bind(stmt, 0, DOMAIN_INT, &id);
+		TC_ASSERT_EQ_CLEANUP("db_bind", DB_SUCCESS(res), true, db_finalize(stmt));
+		res = db_bind(stmt, 1, DOMAIN_LONG, &date);
+		TC_ASSERT_EQ_CLEANUP("db_bind", DB_SUCCESS(res), true, db_finalize(stmt));
+		res = db_step(stmt, NULL);
+		TC_ASSERT_EQ_CLEANUP("db_step", DB_SUCCESS(res), true, db_finalize(stmt));
+	}
+	res = db_commit(stmt);
+	TC_ASSERT_EQ_CLEANUP("db_commit", DB_SUCCESS(res), true, db_finalize(stmt));
+
+	/* The rolled back row is not inserted */
+	res = db_begin(stmt, 1);
+	TC_ASSERT_EQ_CLEANUP("db_begin", DB_SUCCESS(res), true, db_finalize(stmt));
+	res = db_step(stmt, NULL);
+	TC_ASSERT_EQ_CLEANUP("db_step", DB_SUCCESS(res), true, db_finalize(stmt));
+	res = db_rollback(stmt);
+	TC_ASSERT_EQ_CLEANUP("db_rollback", DB_SUCCESS(res), true, db_finalize(stmt));
+	res = db_finalize(stmt);
+	TC_ASSERT_EQ("db_finalize", DB_SUCCESS(res), true);
+
+	snprintf(query, QUERY_LENGTH, "SELECT id, date FROM %s WHERE id > %d AND id < %d;", RELATION_NAME2, DATA_SET_NUM * 11 - 1, DATA_SET_NUM * 12);
+	cursor = db_query(query);
+	TC_ASSERT_NEQ("db_query", cursor, NULL);
+	TC_ASSERT_EQ_CLEANUP("cursor_get_count", cursor_get_count(cursor), DATA_SET_NUM, db_cursor_free(cursor));
+	res = db_cursor_free(cursor);
+	TC_ASSERT_EQ("db_cursor_free", DB_SUCCESS(res), true);
+#endif
+
+	TC_SUCCESS_RESULT();
+}
+
+/**
+* @testcase         utc_arastorage_db_btree_p
+* @brief            Index long and string attributes with a btree
+* @scenario         Insert more rows than a btree leaf holds, select a range of the long keys
+*                   and remove the relation with its indexes
+* @apicovered       db_exec, db_query
+* @precondition     utc_arastorage_db_init_p should be passed
+* @postcondition    none
+*/
+static void utc_arastorage_db_btree_p(void)
+{
+	db_result_t res;
+	db_cursor_t *cursor;
+	char query[QUERY_LENGTH];
+	int i;
+
+	snprintf(query, QUERY_LENGTH, "CREATE RELATION %s;", RELATION_NAME3);
+	res = db_exec(query);
+	TC_ASSERT_EQ("db_exec", DB_SUCCESS(res), true);
+	snprintf(query, QUERY_LENGTH, "CREATE ATTRIBUTE %s DOMAIN long IN %s;", g_attribute_set[1], RELATION_NAME3);
+	res = db_exec(query);
+	TC_ASSERT_EQ("db_exec", DB_SUCCESS(res), true);
+	snprintf(query, QUERY_LENGTH, "CREATE ATTRIBUTE %s DOMAIN string(32) IN %s;", g_attribute_set[2], RELATION_NAME3);
+	res = db_exec(query);
+	TC_ASSERT_EQ("db_exec", DB_SUCCESS(res), true);
+	snprintf(query, QUERY_LENGTH, "CREATE INDEX %s.%s TYPE %s;", RELATION_NAME3, g_attribute_set[1], INDEX_BTREE);
+	res = db_exec(query);
+	TC_ASSERT_EQ("db_exec", DB_SUCCESS(res), true);
+	snprintf(query, QUERY_LENGTH, "CREATE INDEX %s.%s TYPE %s;", RELATION_NAME3, g_attribute_set[2], INDEX_BTREE);
+	res = db_exec(query);
+	TC_ASSERT_EQ("db_exec", DB_SUCCESS(res), true);
+
+	/* Keys in descending order, so that leaves split on the left */
+	for (i = DATA_SET_NUM * 20 - 1; i >= 0; i--) {
+		snprintf(query, QUERY_LENGTH, "INSERT (%d, \'%s\') INTO %s;", i, g_arastorage_data_set[i % DATA_SET_NUM].string_value, RELATION_NAME3);
+		res = db_exec(query);
+		TC_ASSERT_EQ("db_exec", DB_SUCCESS(res), true);
+	}
+
+	snprintf(query, QUERY_LENGTH, "SELECT %s FROM %s WHERE %s >= %d AND %s < %d;", g_attribute_set[1], RELATION_NAME3, g_attribute_set[1], DATA_SET_NUM * 5, g_attribute_set[1], DATA_SET_NUM * 15);
+	cursor = db_query(query);
+	TC_ASSERT_NEQ("db_query", cursor, NULL);
+	TC_ASSERT_EQ_CLEANUP("cursor_get_count", cursor_get_count(cursor), DATA_SET_NUM * 10, db_cursor_free(cursor));
+	res = db_cursor_free(cursor);
+	TC_ASSERT_EQ("db_cursor_free", DB_SUCCESS(res), true);
+
+	snprintf(query, QUERY_LENGTH, "REMOVE RELATION %s;", RELATION_NAME3);
+	res = db_exec(query);
+	TC_ASSERT_EQ("db_exec", DB_SUCCESS(res), true);
+
+	TC_SUCCESS_RESULT();
+}
+
+/**
+* @testcase         utc_arastorage_db_begin_n
+* @brief            Insert rows in a batch with invalid arguments
+* @scenario         Begin a batch of no row, on a select statement or twice, commit without a batch
+* @apicovered       db_begin, db_commit, db_rollback
+* @precondition     utc_arastorage_db_exec_p should be passed
+* @postcondition    none
+*/
+static void utc_arastorage_db_begin_n(void)
+{
+	db_result_t res;
+	db_stmt_t *stmt;
+	char query[QUERY_LENGTH];
+
+	res = db_begin(NULL, 1);
+	TC_ASSERT_EQ("db_begin", DB_ERROR(res), true);
+	res = db_commit(NULL);
+	TC_ASSERT_EQ("db_commit", DB_ERROR(res), true);
+	res = db_rollback(NULL);
+	TC_ASSERT_EQ("db_rollback", DB_ERROR(res), true);
+
+	snprintf(query, QUERY_LENGTH, "SELECT id, date FROM %s WHERE id > ?;", RELATION_NAME2);
+	stmt = db_prepare(query);
+	TC_ASSERT_NEQ("db_prepare", stmt, NULL);
+	res = db_begin(stmt, 1);
+	TC_ASSERT_EQ_CLEANUP("db_begin", DB_ERROR(res), true, db_finalize(stmt));
+	db_finalize(stmt);
+
+	snprintf(query, QUERY_LENGTH, "INSERT (?, ?) INTO %s;", RELATION_NAME2);
+	stmt = db_prepare(query);
+	TC_ASSERT_NEQ("db_prepare", stmt, NULL);
+	res = db_begin(stmt, 0);
+	TC_ASSERT_EQ_CLEANUP("db_begin", DB_ERROR(res), true, db_finalize(stmt));
+	res = db_commit(stmt);
+	TC_ASSERT_EQ_CLEANUP("db_commit", DB_ERROR(res), true, db_finalize(stmt));
+#ifndef CONFIG_ARASTORAGE_ENABLE_FLUSHING
+	res = db_begin(stmt, 1);
+	TC_ASSERT_EQ_CLEANUP("db_begin", DB_SUCCESS(res), true, db_finalize(stmt));
+	res = db_begin(stmt, 1);
+	TC_ASSERT_EQ_CLEANUP("db_begin", DB_ERROR(res), true, db_finalize(stmt));
+#endif
+	db_finalize(stmt);
+
+	TC_SUCCESS_RESULT();
+}
+
+/**
+* @testcase         utc_arastorage_db_prepare_n
+* @brief            Prepare and run statements with invalid argument
+* @scenario         Prepare NULL and unsupported queries, run parameters without db_prepare
+*                   and step a statement with a parameter not bound
+* @apicovered       db_prepare, db_bind, db_step, db_exec
+* @precondition     none
+* @postcondition    none
+*/
+static void utc_arastorage_db_prepare_n(void)
+{
+	db_result_t res;
+	db_stmt_t *stmt;
+	char query[QUERY_LENGTH];
+	int id = 0;
+
+	stmt = db_prepare(NULL);
+	TC_ASSERT_EQ("db_prepare", stmt, NULL);
+
+	snprintf(query, QUERY_LENGTH, "REMOVE RELATION %s;", RELATION_NAME2);
+	stmt = db_prepare(query);
+	TC_ASSERT_EQ("db_prepare", stmt, NULL);
+
+	snprintf(query, QUERY_LENGTH, "INSERT (?, ?) INTO %s;", RELATION_NAME2);
+	res = db_exec(query);
+	TC_ASSERT_EQ("db_exec", DB_ERROR(res), true);
+
+	stmt = db_prepare(query);
+	TC_ASSERT_NEQ("db_prepare", stmt, NULL);
+
+	res = db_bind(stmt, 2, DOMAIN_INT, &id);
+	TC_ASSERT_EQ_CLEANUP("db_bind", DB_ERROR(res), true, db_finalize(stmt));
+	res = db_bind(stmt, 0, DOMAIN_INT, &id);
+	TC_ASSERT_EQ_CLEANUP("db_bind", DB_SUCCESS(res), true, db_finalize(stmt));
+	res = db_step(stmt, NULL);
+	TC_ASSERT_EQ_CLEANUP("db_step", DB_ERROR(res), true, db_finalize(stmt));
+	db_finalize(stmt);
+
+	res = db_step(NULL, NULL);
+	TC_ASSERT_EQ("db_step", DB_ERROR(res), true);
+
+	TC_SUCCESS_RESULT();
+}
+
 /**
 * @testcase         utc_arastorage_db_get_result_message_p
 * @brief            Get database result message
@@ -1527,6 +1798,9 @@ int utc_arastorage_main(int argc, char *argv[])
 	utc_arastorage_db_init_p();
 	utc_arastorage_db_exec_p();
 	utc_arastorage_db_query_p();
+	utc_arastorage_db_prepare_p();
+	utc_arastorage_db_begin_p();
+	utc_arastorage_db_btree_p();
 	utc_arastorage_db_get_result_message_p();
 	utc_arastorage_db_print_header_p();
 	utc_arastorage_db_print_tuple_p();
@@ -1557,6 +1831,8 @@ int utc_arastorage_main(int argc, char *argv[])
 	/* Negative TCs */
 	utc_arastorage_db_exec_n();
 	utc_arastorage_db_query_n();
+	utc_arastorage_db_prepare_n();
+	utc_arastorage_db_begin_n();
 	utc_arastorage_db_get_result_message_n();
 	utc_arastorage_db_print_header_n();
 	utc_arastorage_db_print_tuple_n();
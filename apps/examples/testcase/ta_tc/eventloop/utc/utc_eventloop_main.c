@@ -421,6 +421,35 @@ static void utc_eventloop_send_event_p(void)
 	TC_SUCCESS_RESULT();
 }
 
+static void utc_eventloop_get_event_stats_n(void)
+{
+	int ret;
+	el_event_stats_t stats;
+
+	ret = eventloop_get_event_stats(EL_INVALID_EVENT, &stats);
+	TC_ASSERT_EQ("eventloop_get_event_stats", ret, EVENTLOOP_INVALID_PARAM);
+
+	ret = eventloop_get_event_stats(EL_EVENT_WIFI_ON, NULL);
+	TC_ASSERT_EQ("eventloop_get_event_stats", ret, EVENTLOOP_INVALID_PARAM);
+
+	TC_SUCCESS_RESULT();
+}
+
+static void utc_eventloop_get_event_stats_p(void)
+{
+	int ret;
+	el_event_stats_t stats;
+
+	/* Events of utc_eventloop_send_event_p are counted */
+	ret = eventloop_get_event_stats(EL_EVENT_WIFI_ON, &stats);
+	TC_ASSERT_EQ("eventloop_get_event_stats", ret, OK);
+	TC_ASSERT_GEQ("eventloop_get_event_stats", stats.sent, EL_SEND_COUNT);
+	TC_ASSERT_GEQ("eventloop_get_event_stats", stats.delivered + stats.coalesced, EL_WIFI_ON_COUNT);
+	TC_ASSERT_LEQ("eventloop_get_event_stats", stats.avg_latency_us, stats.max_latency_us);
+
+	TC_SUCCESS_RESULT();
+}
+
 static void el_thread_safe_cb(void *data)
 {
 	if (strncmp((char *)data, EL_THREAD_SAFE_DATA, sizeof(EL_THREAD_SAFE_DATA)) == 0) {
@@ -482,6 +511,9 @@ int utc_eventloop_main(int argc, char *argv[])
 	utc_eventloop_send_event_n();
 	utc_eventloop_send_event_p();
 
+	utc_eventloop_get_event_stats_n();
+	utc_eventloop_get_event_stats_p();
+
 	utc_eventloop_thread_safe_function_call_n();
 	utc_eventloop_thread_safe_function_call_p();
 
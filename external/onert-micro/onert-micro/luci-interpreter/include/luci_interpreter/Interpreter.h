@@ -22,6 +22,8 @@
 #ifdef USE_STATIC_ALLOC
 #include "luci_interpreter/InterpreterConfigure.h"
 #include "memory_managers/StaticMemoryManager.h"
+#elif defined(USE_ARENA_ALLOC)
+#include "memory_managers/ArenaMemoryManager.h"
 #else
 #include "memory_managers/SimpleMemoryManager.h"
 #endif // USE_STATIC_ALLOC
@@ -57,6 +59,12 @@ public:
 
   void interpret();
 
+#ifdef USE_ARENA_ALLOC
+  // Bytes of the arenas, and the most bytes of tensors alive at once without them
+  size_t getArenaSize() const { return _memory_manager.arena_size(); }
+  size_t getPeakTensorSize() const { return _memory_manager.peak_tensor_size(); }
+#endif // USE_ARENA_ALLOC
+
 private:
   // _default_memory_manager should be before _runtime_module due to
   // the order of deletion in the destructor
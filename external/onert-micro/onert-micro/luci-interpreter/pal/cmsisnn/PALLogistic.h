@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef LUCI_INTERPRETER_PAL_LOGISTIC_H
+#define LUCI_INTERPRETER_PAL_LOGISTIC_H
+
+#include "PALLogisticCommon.h"
+#include "PALLookupTable.h"
+
+namespace luci_interpreter_pal
+{
+
+// CMSIS-NN has no int8 logistic, the table replaces an exp() per element
+inline void Logistic(const int flat_size, const int8_t *input_data, float input_scale,
+                     int input_zero_point, int8_t *output_data, float output_scale,
+                     int output_zero_point)
+{
+  transformInt8(flat_size, input_data, input_scale, input_zero_point, output_data, output_scale,
+                output_zero_point, quantizedLogistic);
+}
+
+} // namespace luci_interpreter_pal
+
+#endif // LUCI_INTERPRETER_PAL_LOGISTIC_H
@@ -15,8 +15,8 @@
  * limitations under the License.
  */
 
-#ifndef LUCI_INTERPRETER_PAL_LOGISTIC_H
-#define LUCI_INTERPRETER_PAL_LOGISTIC_H
+#ifndef LUCI_INTERPRETER_PAL_LOGISTIC_COMMON_H
+#define LUCI_INTERPRETER_PAL_LOGISTIC_COMMON_H
 
 #include "Params.h"
 #include "PALUtils.h"
@@ -57,37 +57,18 @@ inline void Logistic(const int flat_size, const float *input_data, float *output
   }
 }
 
-inline void Logistic(const int flat_size, const int8_t *input_data, float input_scale,
-                     int input_zero_point, int8_t *output_data, float output_scale,
-                     int output_zero_point)
+// Logistic of a dequantized int8 value. Below the lower cutoff the result
+// quantizes to the output zero point anyway, so it is taken as 0.
+inline float quantizedLogistic(float val)
 {
   const float cutoff_upper = 16.619047164916992188f;
   const float cutoff_lower = -9.f;
-  const int32_t min_val = std::numeric_limits<int8_t>::min();
-  const int32_t max_val = std::numeric_limits<int8_t>::max();
 
-  for (int i = 0; i < flat_size; i++)
-  {
-    // Dequantize.
-    float val = static_cast<float>((input_data[i] - input_zero_point) * input_scale);
-    float result;
-    if (val > cutoff_upper)
-    {
-      result = 1.0f;
-    }
-    else if (val < cutoff_lower)
-    {
-      result = 0.0f; // Для значений меньше cutoff_lower результат близок к 0.
-    }
-    else
-    {
-      result = 1.f / (1.f + std::exp(-val));
-    }
-    // Requantize
-    int32_t unclamped = static_cast<int32_t>(std::round(result / output_scale) + output_zero_point);
-    int32_t clamped = std::min(std::max(unclamped, min_val), max_val);
-    output_data[i] = static_cast<int8_t>(clamped);
-  }
+  if (val > cutoff_upper)
+    return 1.0f;
+  if (val < cutoff_lower)
+    return 0.0f;
+  return 1.f / (1.f + std::exp(-val));
 }
 
 inline void Logistic(int32_t input_multiplier, int32_t input_left_shift, int32_t input_size,
@@ -148,4 +129,4 @@ inline void Logistic(int32_t input_multiplier, int32_t input_left_shift, int32_t
 
 } // namespace luci_interpreter_pal
 
-#endif // LUCI_INTERPRETER_PAL_LOGISTIC_H
+#endif // LUCI_INTERPRETER_PAL_LOGISTIC_COMMON_H
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_PAL_LOOKUP_TABLE_H
+#define LUCI_INTERPRETER_PAL_LOOKUP_TABLE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace luci_interpreter_pal
+{
+
+// An int8 tensor has only 256 distinct values, so an elementwise function of it
+// can be computed once per value and then looked up. Filling the table costs 256
+// evaluations of the function, which pays off from about as many elements.
+constexpr int kInt8LookupTableMinSize = 256;
+
+// Dequantizes value, applies func and requantizes the result, as the reference
+// int8 kernels do element by element
+template <typename Func>
+inline int8_t transformInt8Value(int8_t value, float input_scale, int32_t input_zero_point,
+                                 float output_scale, int32_t output_zero_point, Func func)
+{
+  const int32_t min_val = std::numeric_limits<int8_t>::min();
+  const int32_t max_val = std::numeric_limits<int8_t>::max();
+
+  const float result = func(static_cast<float>(value - input_zero_point) * input_scale);
+  int32_t unclamped = static_cast<int32_t>(std::round(result / output_scale) + output_zero_point);
+  return static_cast<int8_t>(std::min(std::max(unclamped, min_val), max_val));
+}
+
+// Gives the same results as transformInt8Value for every element
+template <typename Func>
+inline void transformInt8(const int flat_size, const int8_t *input_data, float input_scale,
+                          int32_t input_zero_point, int8_t *output_data, float output_scale,
+                          int32_t output_zero_point, Func func)
+{
+  if (flat_size < kInt8LookupTableMinSize)
+  {
+    for (int i = 0; i < flat_size; ++i)
+      output_data[i] = transformInt8Value(input_data[i], input_scale, input_zero_point,
+                                          output_scale, output_zero_point, func);
+    return;
+  }
+
+  // Indexed by the bits of the input value
+  int8_t table[256];
+  for (int32_t value = std::numeric_limits<int8_t>::min();
+       value <= std::numeric_limits<int8_t>::max(); ++value)
+  {
+    table[static_cast<uint8_t>(value)] =
+      transformInt8Value(static_cast<int8_t>(value), input_scale, input_zero_point, output_scale,
+                         output_zero_point, func);
+  }
+
+  for (int i = 0; i < flat_size; ++i)
+    output_data[i] = table[static_cast<uint8_t>(input_data[i])];
+}
+
+} // namespace luci_interpreter_pal
+
+#endif // LUCI_INTERPRETER_PAL_LOOKUP_TABLE_H
@@ -164,42 +164,6 @@ inline bool Mean(const T *input_data, const int *input_dims, const int input_num
   return true;
 }
 
-inline void Mean(const MeanParams &op_params,
-                 const luci_interpreter::RuntimeShape &unextended_input_shape,
-                 const float *input_data,
-                 const luci_interpreter::RuntimeShape &unextended_output_shape, float *output_data)
-{
-  // Current implementation only supports dimension equals 4 and simultaneous
-  // reduction over width and height.
-  const luci_interpreter::RuntimeShape input_shape =
-    luci_interpreter::RuntimeShape::extendedShape(4, unextended_input_shape);
-  const luci_interpreter::RuntimeShape output_shape =
-    luci_interpreter::RuntimeShape::extendedShape(4, unextended_output_shape);
-
-  const int output_batch = output_shape.dims(0);
-  const int output_depth = output_shape.dims(3);
-
-  const int input_height = input_shape.dims(1);
-  const int input_width = input_shape.dims(2);
-
-  for (int out_b = 0; out_b < output_batch; ++out_b)
-  {
-    for (int out_d = 0; out_d < output_depth; ++out_d)
-    {
-      float value = 0;
-      for (int in_h = 0; in_h < input_height; ++in_h)
-      {
-        for (int in_w = 0; in_w < input_width; ++in_w)
-        {
-          value += input_data[offset(input_shape.dimsData(), out_b, in_h, in_w, out_d)];
-        }
-      }
-      output_data[offset(output_shape.dimsData(), out_b, 0, 0, out_d)] =
-        value / (input_width * input_height);
-    }
-  }
-}
-
 } // namespace luci_interpreter_pal
 
 #endif // LUCI_INTERPRETER_PAL_MEAN_COMMON_H
@@ -15,8 +15,8 @@
  * limitations under the License.
  */
 
-#ifndef LUCI_INTERPRETER_PAL_TANH_H
-#define LUCI_INTERPRETER_PAL_TANH_H
+#ifndef LUCI_INTERPRETER_PAL_TANH_COMMON_H
+#define LUCI_INTERPRETER_PAL_TANH_COMMON_H
 
 #include "PALUtils.h"
 
@@ -85,21 +85,6 @@ inline void Tanh(int32_t input_multiplier, int32_t input_left_shift, const int f
   }
 }
 
-inline void Tanh(int32_t input_zero_point, float input_scale,
-                 int32_t output_zero_point, float output_scale,
-                 const int flat_size, const int8_t* input_data, int8_t* output_data) {
-    static constexpr int32_t min_val = std::numeric_limits<int8_t>::min();
-    static constexpr int32_t max_val = std::numeric_limits<int8_t>::max();
-    for (int i = 0; i < flat_size; i++)
-    {
-        float val = static_cast<float>(input_data[i] - input_zero_point) * input_scale;
-        float result = std::tanh(val);
-        int32_t unclamped = static_cast<int32_t>(std::round(result / output_scale) + output_zero_point);
-        int32_t clamped = std::min(std::max(unclamped, min_val), max_val);
-        output_data[i] = static_cast<int8_t>(clamped);
-    }
-}
-
 } // namespace luci_interpreter_pal
 
-#endif // LUCI_INTERPRETER_PAL_TANH_H
+#endif // LUCI_INTERPRETER_PAL_TANH_COMMON_H
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2023 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_PAL_MEAN_H
+#define LUCI_INTERPRETER_PAL_MEAN_H
+
+#include "PALMeanCommon.h"
+
+namespace luci_interpreter_pal
+{
+
+inline void Mean(const MeanParams &op_params,
+                 const luci_interpreter::RuntimeShape &unextended_input_shape,
+                 const float *input_data,
+                 const luci_interpreter::RuntimeShape &unextended_output_shape, float *output_data)
+{
+  // Current implementation only supports dimension equals 4 and simultaneous
+  // reduction over width and height.
+  const luci_interpreter::RuntimeShape input_shape =
+    luci_interpreter::RuntimeShape::extendedShape(4, unextended_input_shape);
+  const luci_interpreter::RuntimeShape output_shape =
+    luci_interpreter::RuntimeShape::extendedShape(4, unextended_output_shape);
+
+  const int output_batch = output_shape.dims(0);
+  const int output_depth = output_shape.dims(3);
+
+  const int input_height = input_shape.dims(1);
+  const int input_width = input_shape.dims(2);
+
+  for (int out_b = 0; out_b < output_batch; ++out_b)
+  {
+    for (int out_d = 0; out_d < output_depth; ++out_d)
+    {
+      float value = 0;
+      for (int in_h = 0; in_h < input_height; ++in_h)
+      {
+        for (int in_w = 0; in_w < input_width; ++in_w)
+        {
+          value += input_data[offset(input_shape.dimsData(), out_b, in_h, in_w, out_d)];
+        }
+      }
+      output_data[offset(output_shape.dimsData(), out_b, 0, 0, out_d)] =
+        value / (input_width * input_height);
+    }
+  }
+}
+
+} // namespace luci_interpreter_pal
+
+#endif // LUCI_INTERPRETER_PAL_MEAN_H
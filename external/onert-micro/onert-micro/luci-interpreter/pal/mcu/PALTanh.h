@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2023 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_PAL_TANH_H
+#define LUCI_INTERPRETER_PAL_TANH_H
+
+#include "PALTanhCommon.h"
+#include "PALLookupTable.h"
+
+namespace luci_interpreter_pal
+{
+
+inline void Tanh(int32_t input_zero_point, float input_scale, int32_t output_zero_point,
+                 float output_scale, const int flat_size, const int8_t *input_data,
+                 int8_t *output_data)
+{
+  for (int i = 0; i < flat_size; i++)
+  {
+    output_data[i] = transformInt8Value(input_data[i], input_scale, input_zero_point, output_scale,
+                                        output_zero_point, [](float val) { return std::tanh(val); });
+  }
+}
+
+} // namespace luci_interpreter_pal
+
+#endif // LUCI_INTERPRETER_PAL_TANH_H
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef LUCI_INTERPRETER_PAL_FULLY_CONNECTED_H
+#define LUCI_INTERPRETER_PAL_FULLY_CONNECTED_H
+
+#include "PALFullyConnectedCommon.h"
+
+#ifdef __ARM_NEON
+
+#include <arm_neon.h>
+
+namespace luci_interpreter_pal
+{
+
+// Dot product of two float vectors, four lanes at a time
+inline float dotProductNeon(const float *a, const float *b, int size)
+{
+  float32x4_t acc = vdupq_n_f32(0.f);
+  int i = 0;
+  for (; i <= size - 4; i += 4)
+    acc = vmlaq_f32(acc, vld1q_f32(a + i), vld1q_f32(b + i));
+
+  float32x2_t acc2 = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+  float total = vget_lane_f32(vpadd_f32(acc2, acc2), 0);
+  for (; i < size; ++i)
+    total += a[i] * b[i];
+  return total;
+}
+
+// Dot product of two int8 vectors, also gives the sums of each vector for
+// the zero point corrections. Each product fits in int16, pairs of them are
+// added into int32 lanes.
+inline int32_t dotProductNeon(const int8_t *a, const int8_t *b, int size, int32_t *sum_a,
+                              int32_t *sum_b)
+{
+  int32x4_t acc = vdupq_n_s32(0);
+  int32x4_t acc_a = vdupq_n_s32(0);
+  int32x4_t acc_b = vdupq_n_s32(0);
+  int i = 0;
+  for (; i <= size - 8; i += 8)
+  {
+    const int8x8_t va = vld1_s8(a + i);
+    const int8x8_t vb = vld1_s8(b + i);
+    acc = vpadalq_s16(acc, vmull_s8(va, vb));
+    acc_a = vpadalq_s16(acc_a, vmovl_s8(va));
+    acc_b = vpadalq_s16(acc_b, vmovl_s8(vb));
+  }
+
+  int32x2_t acc2 = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+  int32x2_t acc_a2 = vadd_s32(vget_low_s32(acc_a), vget_high_s32(acc_a));
+  int32x2_t acc_b2 = vadd_s32(vget_low_s32(acc_b), vget_high_s32(acc_b));
+  int32_t total = vget_lane_s32(vpadd_s32(acc2, acc2), 0);
+  *sum_a = vget_lane_s32(vpadd_s32(acc_a2, acc_a2), 0);
+  *sum_b = vget_lane_s32(vpadd_s32(acc_b2, acc_b2), 0);
+  for (; i < size; ++i)
+  {
+    total += a[i] * b[i];
+    *sum_a += a[i];
+    *sum_b += b[i];
+  }
+  return total;
+}
+
+template <>
+inline void FullyConnected<float>(const FullyConnectedParams &params, const int32_t *,
+                                  const float *input_data, const int32_t *filter_shape,
+                                  const float *filter_data, const float *bias_data,
+                                  const int32_t *output_shape, float *output_data,
+                                  uint32_t output_dims_count, uint32_t weights_dims_count)
+{
+  const float output_activation_min = params.float_activation_min;
+  const float output_activation_max = params.float_activation_max;
+
+  const int batches = flatSizeSkipDim(output_shape, output_dims_count - 1, output_dims_count);
+  const int output_depth = output_shape[output_dims_count - 1];
+  const int accum_depth = filter_shape[weights_dims_count - 1];
+
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int out_c = 0; out_c < output_depth; ++out_c)
+    {
+      float total = dotProductNeon(input_data + b * accum_depth,
+                                   filter_data + out_c * accum_depth, accum_depth);
+      if (bias_data)
+      {
+        total += bias_data[out_c];
+      }
+      output_data[out_c + output_depth * b] =
+        std::min(std::max(total, output_activation_min), output_activation_max);
+    }
+  }
+}
+
+template <>
+inline void FullyConnected<int8_t>(const FullyConnectedParams &params, const int32_t *,
+                                   const int8_t *input_data, const int32_t *filter_shape,
+                                   const int8_t *filter_data, const int32_t *bias_data,
+                                   const int32_t *output_shape, int8_t *output_data,
+                                   uint32_t output_dims_count, uint32_t weights_dims_count)
+{
+  const int32_t input_offset = params.input_offset;
+  const int32_t filter_offset = params.weights_offset;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_multiplier = params.output_multiplier;
+  const int output_shift = params.output_shift;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+
+  const int batches = flatSizeSkipDim(output_shape, output_dims_count - 1, output_dims_count);
+  const int output_depth = output_shape[output_dims_count - 1];
+  const int accum_depth = filter_shape[weights_dims_count - 1];
+
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int out_c = 0; out_c < output_depth; ++out_c)
+    {
+      int32_t input_sum;
+      int32_t filter_sum;
+      // sum((filter + filter_offset) * (input + input_offset)) expanded
+      int32_t acc = dotProductNeon(input_data + b * accum_depth, filter_data + out_c * accum_depth,
+                                   accum_depth, &input_sum, &filter_sum);
+      acc += input_offset * filter_sum + filter_offset * input_sum +
+             accum_depth * filter_offset * input_offset;
+      if (bias_data)
+      {
+        acc += bias_data[out_c];
+      }
+      int32_t acc_scaled = multiplyByQuantizedMultiplier(acc, output_multiplier, output_shift);
+      acc_scaled += output_offset;
+      acc_scaled = std::max(acc_scaled, output_activation_min);
+      acc_scaled = std::min(acc_scaled, output_activation_max);
+      output_data[out_c + output_depth * b] = static_cast<int8_t>(acc_scaled);
+    }
+  }
+}
+
+} // namespace luci_interpreter_pal
+
+#endif // __ARM_NEON
+
+#endif // LUCI_INTERPRETER_PAL_FULLY_CONNECTED_H
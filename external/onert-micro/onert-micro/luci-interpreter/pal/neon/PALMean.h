@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef LUCI_INTERPRETER_PAL_MEAN_H
+#define LUCI_INTERPRETER_PAL_MEAN_H
+
+#include "PALMeanCommon.h"
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+namespace luci_interpreter_pal
+{
+
+// Mean over height and width of a 4D tensor. The input is read once in memory
+// order and summed into the output row, four channels at a time, so each
+// channel gets its sum in the same order as with one channel at a time.
+inline void Mean(const MeanParams &,
+                 const luci_interpreter::RuntimeShape &unextended_input_shape,
+                 const float *input_data,
+                 const luci_interpreter::RuntimeShape &unextended_output_shape, float *output_data)
+{
+  const luci_interpreter::RuntimeShape input_shape =
+    luci_interpreter::RuntimeShape::extendedShape(4, unextended_input_shape);
+  const luci_interpreter::RuntimeShape output_shape =
+    luci_interpreter::RuntimeShape::extendedShape(4, unextended_output_shape);
+
+  const int output_batch = output_shape.dims(0);
+  const int depth = output_shape.dims(3);
+  const int num_pixels = input_shape.dims(1) * input_shape.dims(2);
+
+  for (int b = 0; b < output_batch; ++b)
+  {
+    float *output_row = output_data + b * depth;
+    const float *input_pixel = input_data + b * num_pixels * depth;
+
+    for (int d = 0; d < depth; ++d)
+      output_row[d] = 0;
+
+    for (int p = 0; p < num_pixels; ++p, input_pixel += depth)
+    {
+      int d = 0;
+#ifdef __ARM_NEON
+      for (; d <= depth - 4; d += 4)
+        vst1q_f32(output_row + d, vaddq_f32(vld1q_f32(output_row + d), vld1q_f32(input_pixel + d)));
+#endif // __ARM_NEON
+      for (; d < depth; ++d)
+        output_row[d] += input_pixel[d];
+    }
+
+    for (int d = 0; d < depth; ++d)
+      output_row[d] = output_row[d] / num_pixels;
+  }
+}
+
+} // namespace luci_interpreter_pal
+
+#endif // LUCI_INTERPRETER_PAL_MEAN_H
@@ -0,0 +1,9 @@
+macro(initialize_pal)
+    set(PAL_INITIALIZED TRUE)
+endmacro()
+
+macro(add_pal_to_target TGT)
+    target_include_directories(${TGT} PUBLIC ${LUCI_INTERPRETER_PAL_DIR})
+    # Kernels without a NEON version use the generic ones
+    target_include_directories(${TGT} PUBLIC ${LUCI_INTERPRETER_PAL_DIR}/../mcu)
+endmacro()
@@ -24,10 +24,10 @@ namespace luci_interpreter
 {
 
 // IBaseRuntimeGraph
-RuntimeGraph::RuntimeGraph(SimpleMemoryManager *memory_manager, CircleReader *circle_reader,
+RuntimeGraph::RuntimeGraph(MemoryManager *memory_manager, CircleReader *circle_reader,
                            RuntimeModule *runtime_module, uint32_t subgraph_index)
   : _memory_manager(memory_manager),
-    _tensor_to_data(std::unordered_map<const circle::Tensor *, uint8_t *>{}),
+    _tensor_to_data(TensorDataMap{}),
     _runtime_module(runtime_module), _reader(circle_reader),
     _inplace_op_indexes(std::unordered_set<const circle::Operator *>{}),
     _subgraph_index(subgraph_index)
@@ -49,7 +49,6 @@ void RuntimeGraph::buildAllocDeallocPlan(bool dealloc_input)
 {
   assert(_reader->get_current_subgraph_index() == _subgraph_index);
   invalidate();
-  using Lifetime = std::pair<int32_t, int32_t>;
   std::map<const circle::Tensor *, Lifetime> lifetimes;
   const size_t num_kernels = _reader->operators().size();
 
@@ -121,15 +120,140 @@ void RuntimeGraph::buildAllocDeallocPlan(bool dealloc_input)
     if (item.second.second != -1)
       _dealloc_plan[item.second.second].push_back(item.first);
   }
+
+#ifdef USE_ARENA_ALLOC
+  planArena(lifetimes);
+#endif // USE_ARENA_ALLOC
+
   _is_valid = true;
 }
 
+#ifdef USE_ARENA_ALLOC
+// Gives every planned tensor an offset in one arena of the graph, so that an
+// invoke only looks the data up. Tensors are placed from the largest down, each
+// one at the lowest offset where it does not overlap a placed tensor which is
+// alive at the same time (greedy by size).
+void RuntimeGraph::planArena(const std::map<const circle::Tensor *, Lifetime> &lifetimes)
+{
+  struct ArenaTensor
+  {
+    const circle::Tensor *tensor;
+    Lifetime lifetime;
+    size_t size;
+    size_t offset;
+  };
+
+  const int32_t num_kernels = _reader->operators().size();
+  std::vector<ArenaTensor> tensors;
+  tensors.reserve(lifetimes.size() + _reader->inputs().size());
+
+  for (const auto &item : lifetimes)
+    tensors.push_back({item.first, item.second, 0, 0});
+
+  // Inputs which are not deallocated stay for the whole invoke
+  for (const auto input_ind : _reader->inputs())
+  {
+    const auto raw_tensor = _reader->tensors()[input_ind];
+
+    if (lifetimes.count(raw_tensor) == 0)
+      tensors.push_back({raw_tensor, Lifetime(-1, num_kernels), 0, 0});
+  }
+
+  // Tensors of unknown size keep their heap allocations
+  const auto alignment = ArenaMemoryManager::kAlignment;
+  auto it = tensors.begin();
+  while (it != tensors.end())
+  {
+    const auto num_elements = Tensor::num_elements(it->tensor);
+    if (num_elements <= 0)
+    {
+      it = tensors.erase(it);
+      continue;
+    }
+
+    it->size = num_elements * getDataTypeSize(Tensor::element_type(it->tensor));
+    it->size = (it->size + alignment - 1) / alignment * alignment;
+    ++it;
+  }
+
+  std::sort(tensors.begin(), tensors.end(), [](const ArenaTensor &a, const ArenaTensor &b) {
+    return a.size != b.size ? a.size > b.size : a.lifetime.first < b.lifetime.first;
+  });
+
+  // Placed tensors in the order of their offsets
+  std::vector<const ArenaTensor *> placed;
+  placed.reserve(tensors.size());
+  size_t arena_size = 0;
+
+  for (auto &cur : tensors)
+  {
+    size_t offset = 0;
+    for (const auto *other : placed)
+    {
+      if (other->lifetime.second < cur.lifetime.first ||
+          cur.lifetime.second < other->lifetime.first)
+        continue;
+
+      if (other->offset >= offset + cur.size)
+        break;
+
+      offset = std::max(offset, other->offset + other->size);
+    }
+
+    cur.offset = offset;
+    arena_size = std::max(arena_size, offset + cur.size);
+
+    auto pos = std::upper_bound(
+      placed.begin(), placed.end(), offset,
+      [](size_t value, const ArenaTensor *tensor) { return value < tensor->offset; });
+    placed.insert(pos, &cur);
+  }
+
+  // What the heap would hold at the peak if every tensor was allocated apart
+  size_t peak_tensor_size = 0;
+  for (int32_t index = -1; index <= num_kernels; ++index)
+  {
+    size_t live_size = 0;
+    for (const auto &cur : tensors)
+    {
+      if (cur.lifetime.first <= index && index <= cur.lifetime.second)
+        live_size += cur.size;
+    }
+    peak_tensor_size = std::max(peak_tensor_size, live_size);
+  }
+
+  auto *arena = _memory_manager->allocate_arena(arena_size, peak_tensor_size);
+
+  // Entries of the planned tensors are kept from now on, an invoke only sets them
+  _arena_data.clear();
+  _arena_data.reserve(tensors.size());
+  _tensor_to_data.reserve(_tensor_to_data.size() + tensors.size());
+  for (const auto &cur : tensors)
+  {
+    _arena_data[cur.tensor] = arena + cur.offset;
+    _tensor_to_data.emplace(cur.tensor, nullptr);
+  }
+}
+#endif // USE_ARENA_ALLOC
+
 void RuntimeGraph::allocate(size_t kernel_index)
 {
   assert(_reader->get_current_subgraph_index() == _subgraph_index);
   assert(_is_valid && kernel_index < _alloc_plan.size());
   for (const circle::Tensor *tensor : _alloc_plan[kernel_index])
   {
+#ifdef USE_ARENA_ALLOC
+    const auto arena_it = _arena_data.find(tensor);
+    if (arena_it != _arena_data.end())
+    {
+      auto &data = _tensor_to_data[tensor];
+      // Heap data left by a kernel of dynamic shapes in the last invoke
+      _memory_manager->release_memory(data);
+      data = arena_it->second;
+      continue;
+    }
+#endif // USE_ARENA_ALLOC
+
     if (_tensor_to_data.find(tensor) != _tensor_to_data.end())
     {
       auto *data = _tensor_to_data.at(tensor);
@@ -177,13 +301,22 @@ void RuntimeGraph::deallocate(size_t kernel_index)
     const auto it = _tensor_to_data.find(tensor);
     assert(it != _tensor_to_data.end());
 
-    auto *data = _tensor_to_data.at(tensor);
-    _memory_manager->release_memory(data);
-
-    _tensor_to_data.erase(it);
+    releaseTensorData(it);
   }
 }
 
+void RuntimeGraph::releaseTensorData(TensorDataMap::iterator tensor_it)
+{
+  _memory_manager->release_memory(tensor_it->second);
+
+#ifdef USE_ARENA_ALLOC
+  // Keep the entry, the next invoke sets it without allocating a node
+  tensor_it->second = nullptr;
+#else
+  _tensor_to_data.erase(tensor_it);
+#endif // USE_ARENA_ALLOC
+}
+
 void RuntimeGraph::resetTensorData(uint8_t *new_data, const circle::Tensor *tensor)
 {
   assert(_reader->get_current_subgraph_index() == _subgraph_index);
@@ -214,11 +347,7 @@ void RuntimeGraph::resetOutputTensorsData()
 
     auto tensor_it = _tensor_to_data.find(tensor);
     if (tensor_it != _tensor_to_data.end())
-    {
-      auto *data = _tensor_to_data.at(tensor);
-      _memory_manager->release_memory(data);
-      _tensor_to_data.erase(tensor_it);
-    }
+      releaseTensorData(tensor_it);
   }
 }
 
@@ -231,6 +360,15 @@ uint8_t *RuntimeGraph::configureGraphInput(int32_t input_index)
   const auto tensor = _reader->tensors()[tensor_index];
   assert(tensor != nullptr);
 
+#ifdef USE_ARENA_ALLOC
+  const auto arena_it = _arena_data.find(tensor);
+  if (arena_it != _arena_data.end())
+  {
+    configureGraphInput(input_index, arena_it->second);
+    return arena_it->second;
+  }
+#endif // USE_ARENA_ALLOC
+
   auto *data = _memory_manager->allocate_memory(tensor);
   configureGraphInput(input_index, data);
 
@@ -340,7 +478,15 @@ uint8_t *RuntimeGraph::getDataByTensor(const circle::Tensor *raw_tensor)
   return _tensor_to_data.at(raw_tensor);
 }
 
-void RuntimeGraph::clearTensors() { _tensor_to_data.clear(); }
+void RuntimeGraph::clearTensors()
+{
+#ifdef USE_ARENA_ALLOC
+  for (auto &tensor_to_data : _tensor_to_data)
+    tensor_to_data.second = nullptr;
+#else
+  _tensor_to_data.clear();
+#endif // USE_ARENA_ALLOC
+}
 
 void RuntimeGraph::makeInplaceOperation(const circle::Tensor *removing_tensor,
                                         const circle::Tensor *dst_tensor)
@@ -359,7 +505,7 @@ void RuntimeGraph::makeInplaceOperation(const circle::Tensor *removing_tensor,
 
   if (dst_tensor == nullptr)
   {
-    delete[] data;
+    _memory_manager->release_memory(data);
     return;
   }
 
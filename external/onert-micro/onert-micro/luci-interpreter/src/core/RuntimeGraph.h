@@ -20,12 +20,15 @@
 #include "luci_interpreter/core/Tensor.h"
 #ifdef USE_STATIC_ALLOC
 #include "memory_managers/StaticMemoryManager.h"
+#elif defined(USE_ARENA_ALLOC)
+#include "memory_managers/ArenaMemoryManager.h"
 #else
 #include "memory_managers/SimpleMemoryManager.h"
 #endif // USE_STATIC_ALLOC
 
 #include "luci_interpreter/core/reader/CircleMicroReader.h"
 
+#include <map>
 #include <memory>
 #include <vector>
 #include <unordered_map>
@@ -54,12 +57,18 @@ public:
 #endif
 #else
 
+#ifdef USE_ARENA_ALLOC
+using MemoryManager = ArenaMemoryManager;
+#else
+using MemoryManager = SimpleMemoryManager;
+#endif // USE_ARENA_ALLOC
+
 class RuntimeGraph
 {
 public:
   RuntimeGraph() = delete;
 
-  explicit RuntimeGraph(SimpleMemoryManager *memory_manager, CircleReader *circle_reader,
+  explicit RuntimeGraph(MemoryManager *memory_manager, CircleReader *circle_reader,
                         RuntimeModule *runtime_module, uint32_t subgraph_index);
   ~RuntimeGraph();
 
@@ -119,16 +128,25 @@ public:
 #endif // DIS_DYN_SHAPES
 
 private:
+  // First and last kernel index where a tensor is used, -1 is before the first kernel
+  using Lifetime = std::pair<int32_t, int32_t>;
+  using TensorDataMap = std::unordered_map<const circle::Tensor *, uint8_t *>;
+
   void buildAllocDeallocPlan(bool dealloc_input);
   void allocate(size_t kernel_index);
   void deallocate(size_t kernel_index);
+  void releaseTensorData(TensorDataMap::iterator tensor_it);
+
+#ifdef USE_ARENA_ALLOC
+  void planArena(const std::map<const circle::Tensor *, Lifetime> &lifetimes);
+#endif // USE_ARENA_ALLOC
 
 private:
-  SimpleMemoryManager *_memory_manager;
+  MemoryManager *_memory_manager;
   CircleReader *_reader;
   RuntimeModule *_runtime_module;
 
-  std::unordered_map<const circle::Tensor *, uint8_t *> _tensor_to_data;
+  TensorDataMap _tensor_to_data;
   std::unordered_set<const circle::Operator *> _inplace_op_indexes;
 
   bool _is_valid = false;
@@ -139,6 +157,11 @@ private:
 
   uint32_t _subgraph_index;
 
+#ifdef USE_ARENA_ALLOC
+  // Place of each planned tensor in the arena of this graph
+  TensorDataMap _arena_data;
+#endif // USE_ARENA_ALLOC
+
 #ifndef DIS_DYN_SHAPES
   std::unordered_map<const circle::Tensor *, luci_interpreter::RuntimeShape> _dynamic_tensor_shapes;
 #endif // DIS_DYN_SHAPES
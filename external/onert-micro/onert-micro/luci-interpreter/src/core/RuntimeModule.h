@@ -31,7 +31,6 @@ using BaseRuntimeGraph = StaticRuntimeGraph;
 using MemoryManager = StaticMemoryManager;
 #else
 using BaseRuntimeGraph = RuntimeGraph;
-using MemoryManager = SimpleMemoryManager;
 #endif // USE_STATIC_ALLOC
 
 class RuntimeModule
@@ -73,6 +73,69 @@ void evalFloat(const circle::Tensor *input, const circle::Tensor *filter,
 
 #endif // DIS_FLOAT
 
+#ifndef DIS_QUANT
+
+void evalQuantizedPerChannel(const circle::Tensor *input, const circle::Tensor *filter,
+                             const circle::Tensor *bias, const circle::Tensor *output,
+                             const circle::DepthwiseConv2DOptions *options,
+                             BaseRuntimeGraph *runtime_graph)
+{
+  int32_t activation_min{};
+  int32_t activation_max{};
+  kernels::calculateActivationRangeQuantized(luci_actfunc(options->fused_activation_function()),
+                                             output, &activation_min, &activation_max);
+
+  luci_interpreter_pal::ConvParams params{};
+  params.padding_values.height = computeConvPadding(
+    input, filter, options->padding(), options->stride_h(), options->dilation_h_factor(), 1);
+  params.padding_values.width = computeConvPadding(
+    input, filter, options->padding(), options->stride_w(), options->dilation_w_factor(), 2);
+  params.stride_height = options->stride_h();
+  params.stride_width = options->stride_w();
+  params.dilation_height_factor = options->dilation_h_factor();
+  params.dilation_width_factor = options->dilation_w_factor();
+  params.depth_multiplier = options->depth_multiplier();
+  // The kernel expects the input zero point to be negated.
+  params.input_offset = -Tensor::zero_point(input); // Note the '-'.
+  params.output_offset = Tensor::zero_point(output);
+  params.quantized_activation_min = activation_min;
+  params.quantized_activation_max = activation_max;
+
+  const std::vector<double> effective_output_scale = kernels::getQuantizedConvolutionMultiplers(
+    Tensor::scale(input), Tensor::scales(filter), Tensor::scale(output));
+
+  size_t n = effective_output_scale.size();
+  params.per_channel_output_shift.resize(n);
+  params.per_channel_output_multiplier.resize(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    kernels::quantizeMultiplier(effective_output_scale[i], &params.per_channel_output_multiplier[i],
+                                &params.per_channel_output_shift[i]);
+  }
+
+  auto *input_data = runtime_graph->getDataByTensor(input);
+  auto *output_data = runtime_graph->getDataByTensor(output);
+
+  auto *filter_data = runtime_graph->getConstDataByTensor(filter);
+  auto *bias_data = runtime_graph->getConstDataByTensor(bias);
+
+  int32_t input_shape[kMaxSmallSize];
+  kernels::getTensorDims(input, runtime_graph, input_shape);
+
+  int32_t filter_shape[kMaxSmallSize];
+  kernels::getTensorDims(filter, runtime_graph, filter_shape);
+
+  int32_t output_shape[kMaxSmallSize];
+  kernels::getTensorDims(output, runtime_graph, output_shape);
+
+  luci_interpreter_pal::QuantizedDepthwiseConvPerChannel(
+    params, input_shape, kernels::getTensorData<int8_t>(input_data), filter_shape,
+    kernels::getTensorData<int8_t>(filter_data), kernels::getTensorData<int32_t>(bias_data),
+    output_shape, kernels::getTensorData<int8_t>(output_data));
+}
+
+#endif // DIS_QUANT
+
 } // namespace
 
 void configure_kernel_CircleDepthwiseConv2D(const circle::Operator *cur_op,
@@ -96,6 +159,19 @@ void configure_kernel_CircleDepthwiseConv2D(const circle::Operator *cur_op,
   {
     LUCI_INTERPRETER_CHECK(bias == nullptr || Tensor::element_type(bias) == DataType::FLOAT32);
   }
+#ifndef DIS_QUANT
+  else if (Tensor::element_type(input) == DataType::S8 &&
+           Tensor::element_type(filter) == DataType::S8)
+  {
+    LUCI_INTERPRETER_CHECK(bias == nullptr || Tensor::element_type(bias) == DataType::S32);
+    LUCI_INTERPRETER_CHECK(Tensor::scales(filter).size() ==
+                           static_cast<size_t>(Tensor::dim(filter, 3)));
+    for (auto zerop : Tensor::zero_points(filter))
+    {
+      LUCI_INTERPRETER_CHECK(zerop == 0);
+    }
+  }
+#endif // DIS_QUANT
   else
   {
     assert(false && "Unsupported type.");
@@ -141,6 +217,11 @@ void execute_kernel_CircleDepthwiseConv2D(const circle::Operator *cur_op,
         break;
       }
 #endif // DIS_FLOAT
+#ifndef DIS_QUANT
+    case DataType::S8:
+      evalQuantizedPerChannel(input, weights, bias, output, options, runtime_graph);
+      break;
+#endif // DIS_QUANT
     default:
       assert(false && "Unsupported type.");
   }
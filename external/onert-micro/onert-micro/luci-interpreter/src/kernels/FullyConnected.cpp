@@ -58,7 +58,7 @@ void evalFloat(const circle::Tensor *input, const circle::Tensor *weights,
   // TODO remove code duplication, introduce func
 #ifndef DIS_DYN_SHAPES
   // Dynamic shape case
-  if (output_shape[0] != input_shape[0] or output_shape[1] != weight_shape[1])
+  if (output_shape[0] != input_shape[0] or output_shape[1] != weight_shape[0])
   {
     output_shape[0] = input_shape[0];
     output_shape[1] = weight_shape[0];
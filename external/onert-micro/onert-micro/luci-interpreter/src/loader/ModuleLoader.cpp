@@ -21,7 +21,7 @@
 namespace luci_interpreter
 {
 
-void ModuleLoader::load(RuntimeModule *runtime_module, SimpleMemoryManager *memory_manager,
+void ModuleLoader::load(RuntimeModule *runtime_module, MemoryManager *memory_manager,
                         const char *model_data_raw, bool dealloc_input)
 {
   const circle::Model *model = circle::GetModel(model_data_raw);
@@ -36,11 +36,12 @@ void ModuleLoader::load(RuntimeModule *runtime_module, SimpleMemoryManager *memo
       assert(false && "Error during select subgraph");
     runtime_module->addGraph(memory_manager);
 
-#ifndef USE_STATIC_ALLOC
+#if !defined(USE_STATIC_ALLOC) && !defined(USE_ARENA_ALLOC)
     auto *runtime_graph = runtime_module->getRuntimeGraphAt(i);
     // For Dynamic memory manager we can use inplace optimization
+    // For Arena memory manager the planner shares the memory of tensors instead
     GraphLoader::checkInplaceOps(&reader, runtime_graph);
-#endif // USE_STATIC_ALLOC
+#endif // !USE_STATIC_ALLOC && !USE_ARENA_ALLOC
   }
 
   // For Dynamic Memory manager we build memory allocate/deallocate plan and then configure kernels.
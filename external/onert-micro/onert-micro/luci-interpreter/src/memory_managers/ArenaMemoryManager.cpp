@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef USE_ARENA_ALLOC
+
+#include "ArenaMemoryManager.h"
+
+namespace luci_interpreter
+{
+
+ArenaMemoryManager::~ArenaMemoryManager()
+{
+  for (auto &arena : _arenas)
+    delete[] arena.data;
+}
+
+uint8_t *ArenaMemoryManager::allocate_memory(const circle::Tensor *tensor)
+{
+  const auto element_size = getDataTypeSize(Tensor::element_type(tensor));
+  const auto num_elements = Tensor::num_elements(tensor);
+
+  assert(element_size * num_elements > 0);
+
+  return new uint8_t[num_elements * element_size];
+}
+
+void ArenaMemoryManager::release_memory(uint8_t *data)
+{
+  if (data == nullptr || is_arena_memory(data))
+    return;
+
+  delete[] data;
+}
+
+uint8_t *ArenaMemoryManager::allocate_arena(size_t size, size_t peak_tensor_size)
+{
+  _peak_tensor_size += peak_tensor_size;
+
+  if (size == 0)
+    return nullptr;
+
+  auto *data = new uint8_t[size];
+  _arenas.push_back({data, size});
+  _arena_size += size;
+
+  return data;
+}
+
+bool ArenaMemoryManager::is_arena_memory(const uint8_t *data) const
+{
+  for (const auto &arena : _arenas)
+  {
+    if (data >= arena.data && data < arena.data + arena.size)
+      return true;
+  }
+
+  return false;
+}
+
+} // namespace luci_interpreter
+
+#endif // USE_ARENA_ALLOC
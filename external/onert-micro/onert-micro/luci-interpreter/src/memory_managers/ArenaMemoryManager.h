@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef USE_ARENA_ALLOC
+#ifndef LUCI_INTERPRETER_ARENA_MEMORY_MANAGER_H
+#define LUCI_INTERPRETER_ARENA_MEMORY_MANAGER_H
+
+#include "luci_interpreter/core/DataType.h"
+#include "luci_interpreter/core/Tensor.h"
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace luci_interpreter
+{
+
+// Holds one arena per graph, where the graph places its tensors at the offsets
+// planned at load time. Tensors without a place in an arena, like the outputs
+// of dynamic shapes, are allocated from the heap as SimpleMemoryManager does.
+class ArenaMemoryManager
+{
+public:
+  // Offsets of the tensors in an arena are multiples of this
+  static constexpr size_t kAlignment = 16;
+
+  ArenaMemoryManager() = default;
+  ArenaMemoryManager(const ArenaMemoryManager &) = delete;
+  ArenaMemoryManager &operator=(const ArenaMemoryManager &) = delete;
+  ~ArenaMemoryManager();
+
+  uint8_t *allocate_memory(const circle::Tensor *tensor);
+  // Memory of an arena stays until the manager is destroyed
+  void release_memory(uint8_t *data);
+
+  // peak_tensor_size is the most bytes of tensors alive at once in the graph,
+  // what the heap would hold at the peak without an arena.
+  uint8_t *allocate_arena(size_t size, size_t peak_tensor_size);
+
+  size_t arena_size() const { return _arena_size; }
+  size_t peak_tensor_size() const { return _peak_tensor_size; }
+
+private:
+  bool is_arena_memory(const uint8_t *data) const;
+
+private:
+  struct Arena
+  {
+    uint8_t *data;
+    size_t size;
+  };
+
+  std::vector<Arena> _arenas;
+  size_t _arena_size = 0;
+  size_t _peak_tensor_size = 0;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_ARENA_MEMORY_MANAGER_H
+#endif // USE_ARENA_ALLOC
@@ -27,11 +27,11 @@
 namespace aifw {
 
 class AIModel;
-class AIDataBufferNode;
 
 /**
  * @class AIDataBuffer
- * @brief This class creates a doubly linked list and provides API to perform operations on that list.
+ * @brief This class keeps the latest rows of data in a ring over one contiguous array and provides API to perform operations on those rows.
+ * Row 0 is the latest row. Reading or writing any row takes constant time.
  */
 class AIDataBuffer
 {
@@ -71,13 +71,13 @@ public:
 	uint16_t getRowCount();
 
 	/**
-	 * @brief Marks all nodes empty and sets number of filled nodes to 0 in AIDataBuffer
+	 * @brief Clears all rows and sets number of filled rows to 0 in AIDataBuffer
 	 * @return: AIFW_RESULT enum object.
 	 */
 	AIFW_RESULT clear(void);
 
 	/**
-	 * @brief Marks specific nodes empty, move them to the end of AIDataBuffer, and decrement number of filled nodes in AIDataBuffer
+	 * @brief Clears specific rows, moves older rows up in their place, and decrements number of filled rows in AIDataBuffer
 	 * @param [IN] offset: Offset of row to start clearing.
 	 * @param [IN] count: Count of rows to clear.
 	 * @return: AIFW_RESULT enum object.
@@ -87,16 +87,16 @@ public:
 	friend class AIModel;
 private:
 	/**
-	 * @brief Creates a doubly linked list with node count equal to row and node size equal to size.
-	 * @param [in] row: Number of rows/nodes needed in streaming buffer.
-	 * @param [in] size: Number of values in a single row/node.
+	 * @brief Allocates the storage of row rows with size values each.
+	 * @param [in] row: Number of rows needed in streaming buffer.
+	 * @param [in] size: Number of values in a single row.
 	 * @return: AIFW_RESULT enum object. Before returning any error, it releases all the memory allocated.
 	 */
 	AIFW_RESULT init(uint16_t row, uint16_t size);
 
 	/**
 	 * @brief Modifies the streaming buffer.
-	 * It compares row and size with previous set value of row and size and according to that it modifies the existing nodes or create more nodes or both.
+	 * It compares row and size with previous set value of row and size and according to that it reallocates the storage, keeping the filled rows.
 	 * @param [in] row: Number of rows needed in the streaming buffer.
 	 * @param [in] size: Number of values in a single row.
 	 * @return: AIFW_RESULT enum object. In case of any error, previously allocated memory is not released.
@@ -105,13 +105,13 @@ private:
 
 	/**
 	 * @brief Deinitializes the streaming buffer.
-	 * It clears the memory allocated to doubly linked list and resets class member variables.
+	 * It frees the storage and resets class member variables.
 	 */
 	void deinit(void);
 
 	/**
 	 * @brief Writes a row into streaming buffer.
-	 * Last node is detached and attached at the starting of the linked list. Values are then written in that node.
+	 * The oldest row is reused as the new row 0 once all rows are filled. Values are then written in that row.
 	 * @param [in] buffer: Input buffer from which data values are copied.
 	 * @param [in] size: Number of values in input buffer.
 	 * @return: AIFW_RESULT enum object.
@@ -128,28 +128,28 @@ private:
 	AIFW_RESULT writeData(float *buffer, uint16_t size, uint16_t offset);
 
 	/**
-	 * @brief Deletes a row data, marks that row empty and puts it at the end of the streaming buffer.
+	 * @brief Deletes a row data, moves older rows up in its place and puts it at the end of the streaming buffer.
 	 * @param [in] row: Index of row whose data needs to be deleted, 0 being latest row.
 	 * @return: AIFW_RESULT enum object.
 	 */
 	AIFW_RESULT deleteData(uint16_t row);
 
 	/**
-	 * @brief Clears the memory allocated to the list with head pointer equal to ptr.
-	 * @param [in] ptr: Pointer to the head of list.
+	 * @brief Gives the storage of a row.
+	 * @param [in] row: Index of row, 0 being latest row.
+	 * @return: Pointer to the first value of the row.
 	 */
-	void clearMemory(AIDataBufferNode *ptr);
+	float *getRow(uint16_t row);
 
 	/**
-	 * @brief Insert count number of nodes in a doubly linked list.
-	 * @param [in] count: Number of nodes in the list.
-	 * @param [in] size: Number of values in a single node.
-	 * @return: AIFW_RESULT enum object.
+	 * @brief Clears count rows from offset and moves older rows up in their place. Caller holds mLock and checks the range.
+	 * @param [in] offset: Offset of row to start clearing.
+	 * @param [in] count: Count of rows to clear.
 	 */
-	AIFW_RESULT createList(uint16_t count, uint16_t size);
+	void removeRows(uint16_t offset, uint16_t count);
 
-	AIDataBufferNode *mStart;
-	AIDataBufferNode *mEnd;
+	float *mData;
+	uint16_t mHead;
 	uint16_t mMaxRows;
 	uint16_t mRowSize;
 	uint16_t mRowCount;
@@ -154,6 +154,7 @@ private:
 
 	/**
 	 * @brief It allocates buffers required to store data at different stages of inference.
+	 * Nothing is allocated afterwards, invoke values stay in the engine tensors.
 	 * @return: AIFW_RESULT enum object.
 	 */
 	AIFW_RESULT allocateMemory(void);
@@ -168,13 +169,13 @@ private:
 	AIModelAttribute mModelAttribute;
 	std::shared_ptr<AIDataBuffer> mBuffer;
 	std::shared_ptr<AIEngine> mAIEngine;
+	/* Invoke input and output point to the engine tensors of the current invoke */
 #ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 	float *mInvokeInput;
 	float *mInvokeOutput;
 #else
 	float **mInvokeInput;
 	float **mInvokeOutput;
-	float **mInvokeResult;
 	uint16_t *mInputSizeList;
 	uint16_t *mOutputSizeList;
 	uint16_t mInputSetCount;
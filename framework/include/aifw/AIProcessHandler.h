@@ -62,7 +62,7 @@ public:
 	/**
 	 * @brief Performs preprocessing on data stored in AIDataBuffer before it is sent for invoke. Preprocessed data will not be updated on AIDataBuffer.
 	 * @param [in] buffer: Pointer of AIDataBuffer. One row of AIDataBuffer includes parsed raw data and model invoke output. However, latest row only includes parsed raw data at this point of time.
-	 * @param [out] invokeInput: Pointer of buffer to store preprocessed data. This buffer is later sent for invoke by AIFW.
+	 * @param [out] invokeInput: Pointer of buffer to store preprocessed data. It is the input tensor of the AI engine, every value has to be written since it still holds the previous input.
 	 * @param [in] modelAttribute: Contains AIModelAttribute value of current AI Model.
 	 * @return: AIFW_RESULT enum object. On success, AIFW_OK is returned.
 	 * 			On failure, a negative value is returned.
@@ -73,7 +73,7 @@ public:
 	 * @brief Performs preprocessing on data stored in AIDataBuffer before it is sent for invoke. Preprocessed data will not be updated on AIDataBuffer.
 	 * @param [in] buffer: Pointer of AIDataBuffer. One row of AIDataBuffer includes parsed raw data and model invoke output. However, latest row only includes parsed raw data at this point of time.
 	 * @param [in] countInputSets : Number of inputs to model
-	 * @param [out] invokeInput: Pointer of buffer to store preprocessed data. This buffer is later sent for invoke by AIFW.
+	 * @param [out] invokeInput: Pointer of buffer to store preprocessed data. It is the input tensor of the AI engine, every value has to be written since it still holds the previous input.
 	 * @param [in] modelAttribute: Contains AIModelAttribute value of current AI Model.
 	 * @return: AIFW_RESULT enum object. On success, AIFW_OK is returned.
 	 * 			On failure, a negative value is returned.
@@ -172,6 +172,9 @@ typedef struct _db_handle_s db_handle_t;
 struct _db_cursor_s;
 typedef struct _db_cursor_s db_cursor_t;
 
+struct _db_stmt_s;
+typedef struct _db_stmt_s db_stmt_t;
+
 typedef int db_storage_id_t;
 
 typedef uint32_t cursor_row_t;
@@ -232,6 +235,96 @@ db_result_t db_exec(char *format);
 */
 db_cursor_t *db_query(char *format);
 
+/**
+* @brief parse a query sentence once, to be executed repeatedly with db_step
+*
+* @details @b #include <arastorage/arastorage.h>
+* INSERT and SELECT sentences can be prepared, and each value in them can be
+* replaced with a '?' parameter which is bound with db_bind before db_step.
+* The relation stays loaded until the statement is finalized, so it should not
+* be removed meanwhile.
+* @param[in] format query sentence
+* @return On success, a pointer to db_stmt_t is returned. On failure, a NULL is returned.
+* @since TizenRT v5.0
+*/
+db_stmt_t *db_prepare(char *format);
+
+/**
+* @brief bind a value to a parameter of a prepared statement
+*
+* @details @b #include <arastorage/arastorage.h>
+* The value is kept for the following db_step calls until it is bound again.
+* Parameters in a WHERE condition accept DOMAIN_INT and DOMAIN_LONG only.
+* @param[in] stmt a pointer to statement
+* @param[in] index index of the parameter, from 0 in order of appearance
+* @param[in] domain domain of the value, DOMAIN_INT, DOMAIN_LONG or DOMAIN_STRING
+* @param[in] value a pointer to int, long or a string according to domain
+* @return On success, DB_OK is returned. On failure, a negative value is returned.
+* @since TizenRT v5.0
+*/
+db_result_t db_bind(db_stmt_t *stmt, int index, domain_t domain, void *value);
+
+/**
+* @brief execute a prepared statement with the values bound to it
+*
+* @details @b #include <arastorage/arastorage.h>
+* @param[in] stmt a pointer to statement
+* @param[out] cursor result of a SELECT statement, to be freed with db_cursor_free. It can be NULL for INSERT.
+* @return On success, DB_OK is returned. On failure, a negative value is returned.
+* @since TizenRT v5.0
+*/
+db_result_t db_step(db_stmt_t *stmt, db_cursor_t **cursor);
+
+/**
+* @brief free a prepared statement and release its relation
+*
+* @details @b #include <arastorage/arastorage.h>
+* @param[in] stmt a pointer to statement
+* @return On success, DB_OK is returned. On failure, a negative value is returned.
+* @since TizenRT v5.0
+*/
+db_result_t db_finalize(db_stmt_t *stmt);
+
+/**
+* @brief begin a batch of rows inserted by a prepared INSERT statement
+*
+* @details @b #include <arastorage/arastorage.h>
+* Until db_commit or db_rollback, each db_step adds the row of the bound values
+* to the batch instead of inserting it, and fails with DB_FULL_ERROR when size
+* rows are already added.
+* With CONFIG_ARASTORAGE_ENABLE_FLUSHING, batches are not supported and
+* DB_IMPLEMENTATION_ERROR is returned.
+* @param[in] stmt a pointer to a prepared INSERT statement
+* @param[in] size the maximum number of rows in the batch
+* @return On success, DB_OK is returned. On failure, a negative value is returned.
+* @since TizenRT v5.0
+*/
+db_result_t db_begin(db_stmt_t *stmt, int size);
+
+/**
+* @brief insert the rows of a batch at once and end it
+*
+* @details @b #include <arastorage/arastorage.h>
+* The rows are appended to the relation with a single write, then the keys of
+* each index are inserted in order and the indexes are written once. On failure,
+* none of the rows stays in the relation nor in its indexes.
+* @param[in] stmt a pointer to a prepared INSERT statement in a batch
+* @return On success, DB_OK is returned. On failure, a negative value is returned.
+* @since TizenRT v5.0
+*/
+db_result_t db_commit(db_stmt_t *stmt);
+
+/**
+* @brief discard the rows of a batch and end it
+*
+* @details @b #include <arastorage/arastorage.h>
+* The rows of a batch not committed are discarded by db_finalize as well.
+* @param[in] stmt a pointer to a prepared INSERT statement in a batch
+* @return On success, DB_OK is returned. On failure, a negative value is returned.
+* @since TizenRT v5.0
+*/
+db_result_t db_rollback(db_stmt_t *stmt);
+
 /**
 * @brief free allocated cursor data, it should be called before application terminated
 *
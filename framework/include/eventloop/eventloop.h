@@ -112,6 +112,22 @@ typedef void (*thread_safe_callback)(void *data);
  */
 typedef bool (*event_callback)(void *registered_cb_data, void *received_event_data);
 
+/**
+ * @brief EventLoop Event Statistics
+ * @details Counters of the events of a type since boot. \n
+ * An event sent again before a handler got the previous one replaces it for that handler, \n
+ * it is counted in coalesced instead of delivered. \n
+ * The latency is the time from eventloop_send_event() to the start of the callback function.
+ */
+struct el_event_stats_s {
+	unsigned int sent;
+	unsigned int delivered;
+	unsigned int coalesced;
+	unsigned int avg_latency_us;
+	unsigned int max_latency_us;
+};
+typedef struct el_event_stats_s el_event_stats_t;
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -210,7 +226,9 @@ int eventloop_del_event_handler(el_event_t *handle);
  * @details @b #include <eventloop/eventloop.h> \n
  * This API is almost similar to task_manager_broadcast.\n
  * The event will be sent with some data to tasks which registed handler for this event.\n
- * And then registered callback functions will be executed when they are polling events.
+ * And then registered callback functions will be executed when they are polling events.\n
+ * The data is copied once and shared by all handlers. If a handler has not got the previous event \n
+ * of the same type yet, it only gets the latest one.
  * @param[in] type a value of event type
  * @param[in] event_data data to be passed to registered handler together
  * @param[in] data_size size of data
@@ -219,6 +237,16 @@ int eventloop_del_event_handler(el_event_t *handle);
  */
 int eventloop_send_event(int type, void *event_data, int data_size);
 
+/**
+ * @brief Get the statistics of an event type
+ * @details @b #include <eventloop/eventloop.h>
+ * @param[in] type a value of event type
+ * @param[out] stats the statistics of the events of the type
+ * @return On success, OK is returned. On failure, defined negative value is returned
+ * @since TizenRT v5.0
+ */
+int eventloop_get_event_stats(int type, el_event_stats_t *stats);
+
 /**
  * @brief Run the loop of its own task
  * @details @b #include <eventloop/eventloop.h>
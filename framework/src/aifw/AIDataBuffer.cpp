@@ -18,7 +18,6 @@
 
 #include "aifw/aifw_log.h"
 #include "aifw/AIDataBuffer.h"
-#include "include/AIDataBufferNode.h"
 #define _UNLOCK                                    \
 	{                                              \
 		int status = pthread_mutex_unlock(&mLock); \
@@ -55,7 +54,7 @@
 namespace aifw {
 
 AIDataBuffer::AIDataBuffer() :
-	mStart(NULL), mEnd(NULL), mMaxRows(0), mRowSize(0), mRowCount(0), mLock(PTHREAD_MUTEX_INITIALIZER)
+	mData(NULL), mHead(0), mMaxRows(0), mRowSize(0), mRowCount(0), mLock(PTHREAD_MUTEX_INITIALIZER)
 {
 	AIFW_LOGV("AIDataBuffer Constructor");
 }
@@ -68,14 +67,25 @@ AIDataBuffer::~AIDataBuffer()
 
 AIFW_RESULT AIDataBuffer::init(uint16_t row, uint16_t size)
 {
+	if (row == 0 || size == 0) {
+		AIFW_LOGE("Invalid argument - row %d size %d", row, size);
+		return AIFW_INVALID_ARG;
+	}
 	_LOCK
-	AIFW_RESULT ret = createList(row, size);
-	if (ret == AIFW_OK) {
-		mMaxRows = row;
-		mRowSize = size;
+	float *data = (float *)calloc(row * size, sizeof(float));
+	if (!data) {
+		AIFW_LOGE("buffer creation failed with errno %d, error message: %s", errno, strerror(errno));
+		_UNLOCK
+		return AIFW_NO_MEM;
 	}
+	free(mData);
+	mData = data;
+	mHead = 0;
+	mMaxRows = row;
+	mRowSize = size;
+	mRowCount = 0;
 	_UNLOCK
-	return ret;
+	return AIFW_OK;
 }
 
 AIFW_RESULT AIDataBuffer::reinit(uint16_t row, uint16_t size)
@@ -84,29 +94,22 @@ AIFW_RESULT AIDataBuffer::reinit(uint16_t row, uint16_t size)
 		return AIFW_OK;
 	}
 	_LOCK
-	if (size != mRowSize) {
-		AIDataBufferNode *tempNode = mStart;
-		float *tempPtr = nullptr;
-		while (tempNode) {
-			tempPtr = (float *)realloc(tempNode->mData, size * sizeof(float));
-			if (!tempPtr) {
-				AIFW_LOGE("node creation failed with errno %d, error message: %s", errno, strerror(errno));
-				_UNLOCK
-				return AIFW_NO_MEM;
-			}
-			tempNode->mData = tempPtr;
-			tempNode = tempNode->mNext;
-		}
-	}
-	if (row > mMaxRows) {
-		AIFW_RESULT ret = createList(row - mMaxRows, size);
-		if (ret == AIFW_OK) {
-			mMaxRows = row;
-			mRowSize = size;
-		}
+	/* The number of rows only grows, like it does for filled rows */
+	uint16_t maxRows = (row > mMaxRows) ? row : mMaxRows;
+	float *data = (float *)calloc(maxRows * size, sizeof(float));
+	if (!data) {
+		AIFW_LOGE("buffer creation failed with errno %d, error message: %s", errno, strerror(errno));
 		_UNLOCK
-		return ret;
+		return AIFW_NO_MEM;
 	}
+	uint16_t copySize = (size < mRowSize) ? size : mRowSize;
+	for (uint16_t i = 0; i < mMaxRows; i++) {
+		memcpy(data + i * size, getRow(i), copySize * sizeof(float));
+	}
+	free(mData);
+	mData = data;
+	mHead = 0;
+	mMaxRows = maxRows;
 	mRowSize = size;
 	_UNLOCK
 	return AIFW_OK;
@@ -114,34 +117,47 @@ AIFW_RESULT AIDataBuffer::reinit(uint16_t row, uint16_t size)
 
 void AIDataBuffer::deinit(void)
 {
-	clearMemory(mStart);
-	mStart = NULL;
-	mEnd = NULL;
+	free(mData);
+	mData = NULL;
+	mHead = 0;
 	mRowSize = 0;
 	mMaxRows = 0;
 	mRowCount = 0;
 }
 
-void AIDataBuffer::clearMemory(AIDataBufferNode *ptr)
+float *AIDataBuffer::getRow(uint16_t row)
+{
+	uint32_t index = (uint32_t)mHead + row;
+	if (index >= mMaxRows) {
+		index -= mMaxRows;
+	}
+	return mData + index * mRowSize;
+}
+
+void AIDataBuffer::removeRows(uint16_t offset, uint16_t count)
 {
-	AIDataBufferNode *current = ptr;
-	AIDataBufferNode *temp = ptr;
-	while (current) {
-		temp = current->mNext;
-		delete current;
-		current = temp;
+	uint16_t i;
+	if (offset == 0) {
+		/* Latest rows, older rows become the latest ones by moving the head */
+		for (i = 0; i < count; i++) {
+			memset(getRow(i), '\0', mRowSize * sizeof(float));
+		}
+		mHead = (mHead + count) % mMaxRows;
+	} else {
+		for (i = offset; i + count < mRowCount; i++) {
+			memcpy(getRow(i), getRow(i + count), mRowSize * sizeof(float));
+		}
+		for (i = mRowCount - count; i < mRowCount; i++) {
+			memset(getRow(i), '\0', mRowSize * sizeof(float));
+		}
 	}
+	mRowCount -= count;
 }
 
 AIFW_RESULT AIDataBuffer::clear(void)
 {
 	_LOCK
-	AIDataBufferNode *current = mStart;
-	while (current) {
-		current->mIsEmpty = true;
-		memset(current->mData, '\0', mRowSize * sizeof(float));
-		current = current->mNext;
-	}
+	memset(mData, '\0', mMaxRows * mRowSize * sizeof(float));
 	mRowCount = 0;
 	_UNLOCK
 	return AIFW_OK;
@@ -158,82 +174,11 @@ AIFW_RESULT AIDataBuffer::clear(uint16_t offset, uint16_t count)
 		return AIFW_INVALID_ARG;
 	}
 	_LOCK
-	AIDataBufferNode *current = mStart;
-	uint16_t i = 0;
-	while (i < offset) {
-		current = current->mNext;
-		i++;
-	}
-	AIDataBufferNode *firstNode = current;
-	AIDataBufferNode *prevToFirstNode = firstNode->mPrev;
-
-	i = 0;
-	while (i < count - 1) {
-		current->mIsEmpty = true;
-		memset(current->mData, '\0', mRowSize * sizeof(float));
-		current = current->mNext;
-		i++;
-	}
-	current->mIsEmpty = true;
-	memset(current->mData, '\0', mRowSize * sizeof(float));
-	mRowCount -= count;
-	AIDataBufferNode *lastNode = current;
-	AIDataBufferNode *nextToLastNode = lastNode->mNext;
-
-	if (!nextToLastNode) {
-		_UNLOCK;
-		return AIFW_OK;
-	} else if (!prevToFirstNode) {
-		mStart = nextToLastNode;
-	} else {
-		prevToFirstNode->mNext = nextToLastNode;
-	}
-	nextToLastNode->mPrev = prevToFirstNode;
-	lastNode->mNext = NULL;
-	firstNode->mPrev = mEnd;
-	mEnd->mNext = firstNode;
-	mEnd = lastNode;
+	removeRows(offset, count);
 	_UNLOCK
 	return AIFW_OK;
 }
 
-AIFW_RESULT AIDataBuffer::createList(uint16_t count, uint16_t size)
-{
-	AIDataBufferNode *newNode = nullptr;
-	AIDataBufferNode *firstNode = nullptr;
-	AIDataBufferNode *lastNode = nullptr;
-	for (uint16_t i = 0; i < count; i++) {
-		newNode = new AIDataBufferNode(size);
-		if (!newNode || !newNode->mData) {
-			AIFW_LOGE("node creation failed with errno %d, error message: %s", errno, strerror(errno));
-			if (newNode) {
-				delete newNode;
-			}
-			clearMemory(firstNode);
-			return AIFW_NO_MEM;
-		}
-		if (firstNode == NULL) {
-			firstNode = newNode;
-			lastNode = newNode;
-		} else {
-			lastNode->mNext = newNode;
-			newNode->mPrev = lastNode;
-			lastNode = newNode;
-		}
-	}
-	if (!mStart) {
-		mStart = firstNode;
-		mEnd = lastNode;
-		return AIFW_OK;
-	}
-	mEnd->mNext = firstNode;
-	if (firstNode) {
-		firstNode->mPrev = mEnd;
-		mEnd = lastNode;
-	}
-	return AIFW_OK;
-}
-
 AIFW_RESULT AIDataBuffer::readData(float *buffer, uint16_t row)
 {
 	if (buffer == NULL) {
@@ -245,13 +190,7 @@ AIFW_RESULT AIDataBuffer::readData(float *buffer, uint16_t row)
 		return AIFW_INVALID_ARG;
 	}
 	_LOCK
-	uint16_t temp = 0;
-	AIDataBufferNode *tempNode = mStart;
-	while (temp < row) {
-		tempNode = tempNode->mNext;
-		++temp;
-	}
-	memcpy(buffer, tempNode->mData, mRowSize * sizeof(float));
+	memcpy(buffer, getRow(row), mRowSize * sizeof(float));
 	DUMP_BUFFER("buffer read done, values: ", mRowSize, buffer, 0)
 	_UNLOCK;
 	return AIFW_OK;
@@ -276,13 +215,7 @@ AIFW_RESULT AIDataBuffer::readData(float *buffer, uint16_t startCol, uint16_t en
 		return AIFW_INVALID_ARG;
 	}
 	_LOCK
-	uint16_t temp = 0;
-	AIDataBufferNode *tempNode = mStart;
-	while (temp < row) {
-		tempNode = tempNode->mNext;
-		++temp;
-	}
-	memcpy(buffer, (tempNode->mData + startCol), (endCol - startCol) * sizeof(float));
+	memcpy(buffer, getRow(row) + startCol, (endCol - startCol) * sizeof(float));
 	DUMP_BUFFER("buffer read done, values: ", endCol - startCol, buffer, 0)
 	_UNLOCK;
 	return AIFW_OK;
@@ -300,18 +233,11 @@ AIFW_RESULT AIDataBuffer::writeData(float *buffer, uint16_t size)
 	}
 	DUMP_BUFFER("buffer write operation, values: ", size, buffer, 0)
 	_LOCK
-	if (mStart != mEnd) {
-		AIDataBufferNode *last = mEnd;
-		mEnd = last->mPrev;
-		mEnd->mNext = NULL;
-		last->mPrev = NULL;
-		last->mNext = mStart;
-		mStart->mPrev = last;
-		mStart = last;
-	}
-	memcpy(mStart->mData, buffer, size * sizeof(float));
-	DUMP_BUFFER("buffer write operation done, values: ", size, mStart->mData, 0)
-	mStart->mIsEmpty = false;
+	/* The row before the head is free or the oldest one */
+	mHead = (mHead == 0) ? mMaxRows - 1 : mHead - 1;
+	float *row = getRow(0);
+	memcpy(row, buffer, size * sizeof(float));
+	DUMP_BUFFER("buffer write operation done, values: ", size, row, 0)
 	if (mRowCount < mMaxRows) {
 		++mRowCount;
 	}
@@ -332,8 +258,9 @@ AIFW_RESULT AIDataBuffer::writeData(float *buffer, uint16_t size, uint16_t offse
 	}
 	DUMP_BUFFER("buffer write operation, values: ", size, buffer, 0)
 	_LOCK
-	memcpy((mStart->mData + offset), buffer, size * sizeof(float));
-	DUMP_BUFFER("buffer write operation done, values: ", size, mStart->mData, offset)
+	float *row = getRow(0);
+	memcpy(row + offset, buffer, size * sizeof(float));
+	DUMP_BUFFER("buffer write operation done, values: ", size, row, offset)
 	AIFW_LOGI("resultData Written");
 	_UNLOCK
 	return AIFW_OK;
@@ -346,30 +273,7 @@ AIFW_RESULT AIDataBuffer::deleteData(uint16_t row)
 		return AIFW_INVALID_ARG;
 	}
 	_LOCK
-	AIDataBufferNode *current = mStart;
-	uint16_t i = 0;
-	while (i < row) {
-		current = current->mNext;
-		i++;
-	}
-	memset(current->mData, 0, mRowSize * sizeof(float));
-	current->mIsEmpty = true;
-	mRowCount--;
-	AIDataBufferNode *nextToCurrent = current->mNext;
-	AIDataBufferNode *prevToCurrent = current->mPrev;
-	if (nextToCurrent == NULL) {
-		_UNLOCK
-		return AIFW_OK;
-	} else if (prevToCurrent == NULL) {
-		mStart = nextToCurrent;
-	} else {
-		prevToCurrent->mNext = nextToCurrent;
-	}
-	nextToCurrent->mPrev = prevToCurrent;
-	current->mNext = NULL;
-	current->mPrev = mEnd;
-	mEnd->mNext = current;
-	mEnd = current;
+	removeRows(row, 1);
 	_UNLOCK
 	return AIFW_OK;
 }
@@ -380,4 +284,3 @@ uint16_t AIDataBuffer::getRowCount()
 }
 
 } // namespace aifw
-
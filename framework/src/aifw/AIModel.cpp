@@ -33,7 +33,7 @@ namespace aifw {
 
 AIModel::AIModel(void) :
 #ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
-	mInvokeResult(NULL), mInputSizeList(NULL), mOutputSizeList(NULL), mInputSetCount(0), mOutputSetCount(0),
+	mInputSizeList(NULL), mOutputSizeList(NULL), mInputSetCount(0), mOutputSetCount(0),
 #endif
 	mInvokeInput(NULL), mInvokeOutput(NULL), mParsedData(NULL), mPostProcessedData(NULL), mDataProcessor(nullptr), mBuffer(nullptr)
 {
@@ -52,7 +52,7 @@ AIModel::AIModel(void) :
 
 AIModel::AIModel(std::shared_ptr<AIProcessHandler> dataProcessor) :
 #ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
-	mInvokeResult(NULL), mInputSizeList(NULL), mOutputSizeList(NULL), mInputSetCount(0), mOutputSetCount(0),
+	mInputSizeList(NULL), mOutputSizeList(NULL), mInputSetCount(0), mOutputSetCount(0),
 #endif
 	mInvokeInput(NULL), mInvokeOutput(NULL), mParsedData(NULL), mPostProcessedData(NULL), mDataProcessor(dataProcessor), mBuffer(nullptr)
 {
@@ -92,7 +92,8 @@ void AIModel::clearModelAttribute(void)
 AIModel::~AIModel()
 {
 	clearModelAttribute();
-#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+#ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+	/* Only the lists are owned, the values are in the engine tensors */
 	if (mInvokeInput) {
 		delete[] mInvokeInput;
 		mInvokeInput = NULL;
@@ -102,32 +103,6 @@ AIModel::~AIModel()
 		delete[] mInvokeOutput;
 		mInvokeOutput = NULL;
 	}
-#else
-	if (mInvokeInput) {
-		for (uint16_t i = 0; i < mInputSetCount; i++) {
-			if (mInvokeInput[i]) {
-				delete[] mInvokeInput[i];
-				mInvokeInput[i] = NULL;
-			}
-		}
-		delete[] mInvokeInput;
-		mInvokeInput = NULL;
-	}
-
-	if (mInvokeOutput) {
-		for (uint16_t i = 0; i < mOutputSetCount; i++) {
-			if (mInvokeOutput[i]) {
-				delete[] mInvokeOutput[i];
-				mInvokeOutput[i] = NULL;
-			}
-		}
-		delete[] mInvokeOutput;
-		mInvokeOutput = NULL;
-	}
-	if(mInvokeResult) {
-		delete[] mInvokeResult;
-		mInvokeResult = NULL;
-	}
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 
 	if (mParsedData) {
@@ -164,51 +139,27 @@ AIFW_RESULT AIModel::createDataBuffer(void)
 
 AIFW_RESULT AIModel::allocateMemory(void)
 {
-#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
-	mInvokeOutput = new float[mModelAttribute.invokeOutputCount];
-	if (!mInvokeOutput) {
-		AIFW_LOGE("Memory Allocation failed - model output buffer");
-		return AIFW_NO_MEM;
-	}
-	mInvokeInput = new float[mModelAttribute.invokeInputCount];
-	if (!mInvokeInput) {
-		AIFW_LOGE("Memory Allocation failed - model input buffer");
-		return AIFW_NO_MEM;
-	}
-#else
+#ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+	/* Invoke input and output values stay in the engine tensors, only keep lists of them */
 	mAIEngine->getModelDimensions(&mInputSetCount, &mInputSizeList, &mOutputSetCount, &mOutputSizeList);
 	AIFW_LOGD("Model dimensions extracted");
-	mInvokeResult = new float *[mOutputSetCount];
-	if (!mInvokeResult) {
-		AIFW_LOGE("Memory Allocation failed - inference result buffer");
-		return AIFW_NO_MEM;
-	}
 	mInvokeOutput = new float *[mOutputSetCount];
 	if (!mInvokeOutput) {
-		AIFW_LOGE("Memory Allocation failed - model output buffer");
+		AIFW_LOGE("Memory Allocation failed - model output list");
 		return AIFW_NO_MEM;
 	}
 	for (uint16_t i = 0; i < mOutputSetCount; i++) {
-		mInvokeOutput[i] = new float[mOutputSizeList[i]];
-		if (!mInvokeOutput[i]) {
-			AIFW_LOGE("Memory Allocation failed - model output buffer");
-			return AIFW_NO_MEM;
-		}
+		mInvokeOutput[i] = NULL;
 	}
-	AIFW_LOGD("model output memory allocated");
 	mInvokeInput = new float *[mInputSetCount];
 	if (!mInvokeInput) {
-		AIFW_LOGE("Memory Allocation failed - model input buffer");
+		AIFW_LOGE("Memory Allocation failed - model input list");
 		return AIFW_NO_MEM;
 	}
 	for (uint16_t i = 0; i < mInputSetCount; i++) {
-		mInvokeInput[i] = new float[mInputSizeList[i]];
-		if (!mInvokeInput[i]) {
-			AIFW_LOGE("Memory Allocation failed - model input buffer");
-			return AIFW_NO_MEM;
-		}
+		mInvokeInput[i] = NULL;
 	}
-	AIFW_LOGD("model input memory allocated");
+	AIFW_LOGD("model input and output lists allocated");
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 	if (mDataProcessor) {
 		mParsedData = new float[mModelAttribute.rawDataCount];
@@ -371,12 +322,19 @@ AIFW_RESULT AIModel::invoke(void)
 {
 	AIFW_RESULT res;
 	int outputOffset = 0; /* to write 2d output in 1d buffer. */
-	float **invokeResult = new float *[mOutputSetCount];
-	for (uint16_t i = 0; i < mInputSetCount; i++) {
-		memset(mInvokeInput[i], '\0', mInputSizeList[i] * sizeof(float));
-	}
+	/* Columns of the invoke result in a row of the data buffer */
+	uint16_t resultColumn = mDataProcessor ? mModelAttribute.rawDataCount : mModelAttribute.invokeInputCount;
+
+	/* Input and output values are read and written right in the engine tensors, nothing is copied aside */
 	for (uint16_t i = 0; i < mOutputSetCount; i++) {
-		memset(mInvokeOutput[i], '\0', mOutputSizeList[i] * sizeof(float));
+		mInvokeOutput[i] = NULL;
+	}
+	for (uint16_t i = 0; i < mInputSetCount; i++) {
+		mInvokeInput[i] = mAIEngine->getInputBuffer(i);
+		if (!mInvokeInput[i]) {
+			AIFW_LOGE("Getting model input set %d failed", i);
+			return AIFW_ERROR;
+		}
 	}
 	if (mDataProcessor) {
 		AIFW_LOGV("data processor is set");
@@ -386,51 +344,6 @@ AIFW_RESULT AIModel::invoke(void)
 			AIFW_LOGE("preProcessData failed, error: %d", res);
 			return res;
 		}
-#ifdef CONFIG_AIFW_LOGV
-		printf("invoke Input\n");
-		for (uint16_t i = 0; i < mInputSetCount; i++) {
-			printf("inputset [%d]: ", i);
-			for (uint16_t j = 0; j < mInputSizeList[i]; j++) {
-				printf("%f,", mInvokeInput[i][j]);
-			}
-			printf("\n");
-		}
-#endif
-		res = mAIEngine->invoke(mInvokeInput, invokeResult);
-		if (res != AIFW_OK) {
-			AIFW_LOGE("Engine Invoke failed.");
-			return AIFW_ERROR;
-		}
-		AIFW_LOGV("invoke completed fine");
-		for (uint16_t i = 0; i < mOutputSetCount; i++) {
-			for (uint16_t j = 0; j < mOutputSizeList[i]; j++) {
-				mInvokeOutput[i][j] = invokeResult[i][j];
-			}
-		}
-#ifdef CONFIG_AIFW_LOGV
-		printf("invoke Output\n");
-		for (uint16_t i = 0; i < mOutputSetCount; i++) {
-			printf("outputset [%d]: ", i);
-			for (uint16_t j = 0; j < mOutputSizeList[i]; j++) {
-				printf("%f,", mInvokeOutput[i][j]);
-			}
-			printf("\n");
-		}
-#endif
-		for (uint16_t i = 0; i < mOutputSetCount; i++) {
-			res = mBuffer->writeData(mInvokeOutput[i], mOutputSizeList[i], mModelAttribute.rawDataCount + outputOffset);
-			outputOffset += mOutputSizeList[i];
-			if (res != AIFW_OK) {
-				AIFW_LOGE("model output data write to buffer failed, error: %d", res);
-				return res;
-			}
-		}
-		res = mDataProcessor->postProcessData(mBuffer, mPostProcessedData, &mModelAttribute);
-		if (res < AIFW_OK) {
-			AIFW_LOGE("data post processing failed, error: %d", res);
-		}
-		AIFW_LOGV("pre-process, invoke and post-process completed OK");
-		return res;
 	} else {
 		AIFW_LOGV("No data processor case");
 		int inputOffset = 0;  /* to read 2d input from 1d buffer. */
@@ -442,99 +355,81 @@ AIFW_RESULT AIModel::invoke(void)
 				return res;
 			}
 		}
+	}
 #ifdef CONFIG_AIFW_LOGV
-		printf("invoke Input\n");
-		for (uint16_t i = 0; i < mInputSetCount; i++) {
-			printf("inputset [%d]: ", i);
-			for (uint16_t j = 0; j < mInputSizeList[i]; j++) {
-				printf("%f,", mInvokeInput[i][j]);
-			}
-			printf("\n");
+	printf("invoke Input\n");
+	for (uint16_t i = 0; i < mInputSetCount; i++) {
+		printf("inputset [%d]: ", i);
+		for (uint16_t j = 0; j < mInputSizeList[i]; j++) {
+			printf("%f,", mInvokeInput[i][j]);
 		}
+		printf("\n");
+	}
 #endif
-		res = mAIEngine->invoke(mInvokeInput, invokeResult);
-		if (res != AIFW_OK) {
-			AIFW_LOGE("Engine Invoke failed.");
+	res = mAIEngine->invoke();
+	if (res != AIFW_OK) {
+		AIFW_LOGE("Engine Invoke failed.");
+		return AIFW_ERROR;
+	}
+	AIFW_LOGV("invoke completed fine");
+	for (uint16_t i = 0; i < mOutputSetCount; i++) {
+		mInvokeOutput[i] = mAIEngine->getOutputBuffer(i);
+		if (!mInvokeOutput[i]) {
+			AIFW_LOGE("Getting model output set %d failed", i);
 			return AIFW_ERROR;
 		}
-		AIFW_LOGV("invoke completed fine");
-		for (uint16_t i = 0; i < mOutputSetCount; i++) {
-			for (uint16_t j = 0; j < mOutputSizeList[i]; j++) {
-				mInvokeOutput[i][j] = invokeResult[i][j];
-			}
-		}
+	}
 #ifdef CONFIG_AIFW_LOGV
-		printf("invoke Output\n");
-		for (uint16_t i = 0; i < mOutputSetCount; i++) {
-			printf("outputset [%d]: ", i);
-			for (uint16_t j = 0; j < mOutputSizeList[i]; j++) {
-				printf("%f,", mInvokeOutput[i][j]);
-			}
-			printf("\n");
+	printf("invoke Output\n");
+	for (uint16_t i = 0; i < mOutputSetCount; i++) {
+		printf("outputset [%d]: ", i);
+		for (uint16_t j = 0; j < mOutputSizeList[i]; j++) {
+			printf("%f,", mInvokeOutput[i][j]);
 		}
+		printf("\n");
+	}
 #endif
-		for (uint16_t i = 0; i < mOutputSetCount; i++) {
-			res = mBuffer->writeData(mInvokeOutput[i], mOutputSizeList[i], mModelAttribute.invokeInputCount + outputOffset);
-			outputOffset += mOutputSizeList[i];
-			if (res != AIFW_OK) {
-				AIFW_LOGE("Writing invoke result to the buffer failed, error: %d", res);
-				return res;
-			}
+	for (uint16_t i = 0; i < mOutputSetCount; i++) {
+		res = mBuffer->writeData(mInvokeOutput[i], mOutputSizeList[i], resultColumn + outputOffset);
+		outputOffset += mOutputSizeList[i];
+		if (res != AIFW_OK) {
+			AIFW_LOGE("Writing invoke result to the buffer failed, error: %d", res);
+			return res;
 		}
-		AIFW_LOGV("read data, invoke and write data completed OK");
+	}
+	if (mDataProcessor) {
+		res = mDataProcessor->postProcessData(mBuffer, mPostProcessedData, &mModelAttribute);
+		if (res < AIFW_OK) {
+			AIFW_LOGE("data post processing failed, error: %d", res);
+		}
+		AIFW_LOGV("pre-process, invoke and post-process completed OK");
 		return res;
 	}
+	AIFW_LOGV("read data, invoke and write data completed OK");
+	return res;
 }
 #else
 AIFW_RESULT AIModel::invoke(void)
 {
 	AIFW_RESULT res;
-	float *invokeResult = nullptr;
-	memset(mInvokeInput, '\0', mModelAttribute.invokeInputCount * sizeof(float));
-	memset(mInvokeOutput, '\0', mModelAttribute.invokeOutputCount * sizeof(float));
+	/* Columns of the invoke result in a row of the data buffer */
+	uint16_t resultColumn = mDataProcessor ? mModelAttribute.rawDataCount : mModelAttribute.invokeInputCount;
+
+	/* Input and output values are read and written right in the engine tensors, nothing is copied aside */
+	mInvokeOutput = NULL;
+	mInvokeInput = mAIEngine->getInputBuffer(0);
+	if (!mInvokeInput) {
+		AIFW_LOGE("Getting model input failed");
+		return AIFW_ERROR;
+	}
 	if (mDataProcessor) {
 		AIFW_LOGV("data processor is set");
 		memset(mPostProcessedData, '\0', mModelAttribute.postProcessResultCount * sizeof(float));
-
 		res = mDataProcessor->preProcessData(mBuffer, mInvokeInput, &mModelAttribute);
 		if (res != AIFW_OK) {
 			AIFW_LOGE("preProcessData failed, error: %d", res);
 			return res;
 		}
-#ifdef CONFIG_AIFW_LOGV
-		printf("invoke Input: ");
-		for (uint16_t i = 0; i < mModelAttribute.invokeInputCount; i++) {
-			printf("%f,", mInvokeInput[i]);
-		}
-		printf("\n");
-#endif
-		invokeResult = (float *)mAIEngine->invoke(mInvokeInput);
-		if (!invokeResult) {
-			AIFW_LOGE("Engine Invoke failed.");
-			return AIFW_ERROR;
-		}
-		AIFW_LOGV("invoke completed fine");
-		for (uint16_t i = 0; i < mModelAttribute.invokeOutputCount; i++) {
-			mInvokeOutput[i] = invokeResult[i];
-		}
-#ifdef CONFIG_AIFW_LOGV
-		printf("invoke Output: ");
-		for (uint16_t i = 0; i < mModelAttribute.invokeOutputCount; i++) {
-			printf("%f,", mInvokeOutput[i]);
-		}
-		printf("\n");
-#endif
-		res = mBuffer->writeData(mInvokeOutput, mModelAttribute.invokeOutputCount, mModelAttribute.rawDataCount);
-		if (res != AIFW_OK) {
-			AIFW_LOGE("model output data write to buffer failed, error: %d", res);
-			return res;
-		}
-		res = mDataProcessor->postProcessData(mBuffer, mPostProcessedData, &mModelAttribute);
-		if (res < AIFW_OK) {
-			AIFW_LOGE("data post processing failed, error: %d", res);
-		}
-		AIFW_LOGV("pre-process, invoke and post-process completed OK");
-		return res;
 	} else {
 		AIFW_LOGV("No data processor case");
 		res = mBuffer->readData(mInvokeInput, 0, mModelAttribute.invokeInputCount, 0);
@@ -542,37 +437,47 @@ AIFW_RESULT AIModel::invoke(void)
 			AIFW_LOGE("Reading Data from the buffer failed, error: %d", res);
 			return res;
 		}
+	}
 #ifdef CONFIG_AIFW_LOGV
-		printf("invoke Input: ");
-		for (uint16_t i = 0; i < mModelAttribute.invokeInputCount; i++) {
-			printf("%f,", mInvokeInput[i]);
-		}
-		printf("\n");
+	printf("invoke Input: ");
+	for (uint16_t i = 0; i < mModelAttribute.invokeInputCount; i++) {
+		printf("%f,", mInvokeInput[i]);
+	}
+	printf("\n");
 #endif
-		invokeResult = (float *)mAIEngine->invoke(mInvokeInput);
-		if (!invokeResult) {
-			AIFW_LOGE("Engine Invoke failed.");
-			return AIFW_ERROR;
-		}
-		AIFW_LOGV("invoke completed fine");
-		for (uint16_t i = 0; i < mModelAttribute.invokeOutputCount; i++) {
-			mInvokeOutput[i] = invokeResult[i];
-		}
+	res = mAIEngine->invoke();
+	if (res != AIFW_OK) {
+		AIFW_LOGE("Engine Invoke failed.");
+		return AIFW_ERROR;
+	}
+	AIFW_LOGV("invoke completed fine");
+	mInvokeOutput = mAIEngine->getOutputBuffer(0);
+	if (!mInvokeOutput) {
+		AIFW_LOGE("Getting model output failed");
+		return AIFW_ERROR;
+	}
 #ifdef CONFIG_AIFW_LOGV
-		printf("invoke Output: ");
-		for (uint16_t i = 0; i < mModelAttribute.invokeOutputCount; i++) {
-			printf("%f,", mInvokeOutput[i]);
-		}
-		printf("\n");
+	printf("invoke Output: ");
+	for (uint16_t i = 0; i < mModelAttribute.invokeOutputCount; i++) {
+		printf("%f,", mInvokeOutput[i]);
+	}
+	printf("\n");
 #endif
-		res = mBuffer->writeData(mInvokeOutput, mModelAttribute.invokeOutputCount, mModelAttribute.invokeInputCount);
-		if (res != AIFW_OK) {
-			AIFW_LOGE("Writing invoke result to the buffer failed, error: %d", res);
-			return res;
+	res = mBuffer->writeData(mInvokeOutput, mModelAttribute.invokeOutputCount, resultColumn);
+	if (res != AIFW_OK) {
+		AIFW_LOGE("Writing invoke result to the buffer failed, error: %d", res);
+		return res;
+	}
+	if (mDataProcessor) {
+		res = mDataProcessor->postProcessData(mBuffer, mPostProcessedData, &mModelAttribute);
+		if (res < AIFW_OK) {
+			AIFW_LOGE("data post processing failed, error: %d", res);
 		}
-		AIFW_LOGV("read data, invoke and write data completed OK");
+		AIFW_LOGV("pre-process, invoke and post-process completed OK");
 		return res;
 	}
+	AIFW_LOGV("read data, invoke and write data completed OK");
+	return res;
 }
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 
@@ -668,10 +573,18 @@ AIFW_RESULT AIModel::getResultData(float *data, uint16_t count)
 #ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 	int outputOffset = 0;
 	for (uint16_t i = 0; i < mOutputSetCount; i++) {
+		if (!mInvokeOutput || !mInvokeOutput[i]) {
+			AIFW_LOGE("No invoke result");
+			return AIFW_ERROR;
+		}
 		memcpy(data+outputOffset, mInvokeOutput[i], mOutputSizeList[i] * sizeof(float));
 		outputOffset += mOutputSizeList[i];
 	}
 #else
+	if (!mInvokeOutput) {
+		AIFW_LOGE("No invoke result");
+		return AIFW_ERROR;
+	}
 	memcpy(data, mInvokeOutput, mModelAttribute.postProcessResultCount * sizeof(float));
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 	return AIFW_OK;
@@ -712,6 +625,14 @@ AIFW_RESULT AIModel::clearRawData(uint16_t offset, uint16_t count)
 
 AIFW_RESULT AIModel::resetInferenceState(void)
 {
+	/* The engine may release its output tensors */
+#ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+	for (uint16_t i = 0; mInvokeOutput && i < mOutputSetCount; i++) {
+		mInvokeOutput[i] = NULL;
+	}
+#else
+	mInvokeOutput = NULL;
+#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 	return mAIEngine->resetInferenceState();
 }
 
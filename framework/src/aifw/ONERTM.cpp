@@ -69,6 +69,9 @@ AIFW_RESULT ONERTM::_loadModel(void)
 		this->mBuf,
 		true);
 	AIFW_LOGV("luci_interpreter::Interpreter created\n");
+#ifdef USE_ARENA_ALLOC
+	AIFW_LOGI("Tensor arena %u bytes, peak of live tensors %u bytes", (unsigned int)this->mInterpreter->getArenaSize(), (unsigned int)this->mInterpreter->getPeakTensorSize());
+#endif
 	sleep(2);
 
 #ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
@@ -159,42 +162,47 @@ void ONERTM::getModelDimensions(uint16_t *inputSetCount, uint16_t **inputSizeLis
 }
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 
-#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
-/* Run inference : with input data "features" and return output data ptr(Use output dimension to parse it) */
-void *ONERTM::invoke(void *inputData)
+/* onert-micro hands out input memory per invoke and drops the previous outputs when an input is configured */
+float *ONERTM::getInputBuffer(uint16_t index)
 {
-	float *value = (float *)(inputData);
-	auto *data = this->mInterpreter->allocateInputTensor(0);
-	for (uint32_t i = 0; i < this->mModelInputSize/sizeof(float); ++i) {
-		reinterpret_cast<float *>(data)[i] = value[i];
+#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+	if (index != 0) {
+		AIFW_LOGE("Invalid input set %d", index);
+		return NULL;
 	}
-	AIFW_START_TIMER
-	this->mInterpreter->interpret();
-	AIFW_END_TIMER
-	return this->mInterpreter->readOutputTensor(0);
-}
 #else
-/* Run inference : with input data "features", store output data in outputData parameter and return AIFW_OK on success */
-AIFW_RESULT ONERTM::invoke(void *inputData, void *outputData)
+	if (index >= this->mInputSetCount) {
+		AIFW_LOGE("Invalid input set %d, input set count %d", index, this->mInputSetCount);
+		return NULL;
+	}
+#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
+	return reinterpret_cast<float *>(this->mInterpreter->allocateInputTensor(index));
+}
+
+float *ONERTM::getOutputBuffer(uint16_t index)
 {
-	float **value = (float **)(inputData);
-	float **output = (float **)(outputData);
-	for (uint16_t i = 0; i < this->mInputSetCount; i++) {
-		auto *data = this->mInterpreter->allocateInputTensor(i);
-		for (uint32_t j = 0; j < this->mInputSizeList[i]; j++) {
-			reinterpret_cast<float *>(data)[j] = value[i][j];
-		}
+#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+	if (index != 0) {
+		AIFW_LOGE("Invalid output set %d", index);
+		return NULL;
 	}
+#else
+	if (index >= this->mOutputSetCount) {
+		AIFW_LOGE("Invalid output set %d, output set count %d", index, this->mOutputSetCount);
+		return NULL;
+	}
+#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
+	return reinterpret_cast<float *>(this->mInterpreter->readOutputTensor(index));
+}
 
+/* Run inference : on the input tensors filled through getInputBuffer(), read the result with getOutputBuffer() */
+AIFW_RESULT ONERTM::invoke(void)
+{
 	AIFW_START_TIMER
 	this->mInterpreter->interpret();
 	AIFW_END_TIMER
-	for (uint16_t i = 0; i < this->mOutputSetCount; i++) {
-		output[i] = (float *)this->mInterpreter->readOutputTensor(i);
-	}
 	return AIFW_OK;
 }
 
-#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 } /* namespace aifw */
 
@@ -293,34 +293,44 @@ void TFLM::getModelDimensions(uint16_t *inputSetCount, uint16_t **inputSizeList,
 }
 #endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 
-#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
-/* Run inference : with input data "features" and return output data ptr(Use output dimension to parse it) */
-void *TFLM::invoke(void *inputData)
+/* Input and output tensors stay in the tensor arena, their memory never moves after AllocateTensors() */
+float *TFLM::getInputBuffer(uint16_t index)
 {
-	float *value = (float *)(inputData);
-	for (int i = 0; i < this->mModelInputSize; i++) {
-		this->mInput->data.f[i] = value[i];
+#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+	if (index != 0) {
+		AIFW_LOGE("Invalid input set %d", index);
+		return NULL;
 	}
-	AIFW_START_TIMER
-	TfLiteStatus invokeStatus = this->mInterpreter->Invoke();
-	AIFW_END_TIMER
-	if (invokeStatus != kTfLiteOk) {
-		this->mErrorReporter->Report("Invoke failed");
-		AIFW_LOGE("Invoke failed");
+	return this->mInput->data.f;
+#else
+	if (index >= this->mInputSetCount) {
+		AIFW_LOGE("Invalid input set %d, input set count %d", index, this->mInputSetCount);
 		return NULL;
 	}
-	return this->mOutput->data.data;
+	return this->mInputList[index]->data.f;
+#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 }
-#else
-/* Run inference : with input data "features", store output data in outputData parameter and return AIFW_OK on success */
-AIFW_RESULT TFLM::invoke(void *inputData, void *outputData)
+
+float *TFLM::getOutputBuffer(uint16_t index)
 {
-	float **value = (float **)(inputData);
-	for (uint16_t i = 0; i < this->mInputSetCount; i++) {
-		for (uint16_t j = 0; j < this->mInputSizeList[i]; j++) {
-			this->mInputList[i]->data.f[j] = value[i][j];
-		}
+#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
+	if (index != 0) {
+		AIFW_LOGE("Invalid output set %d", index);
+		return NULL;
 	}
+	return this->mOutput->data.f;
+#else
+	if (index >= this->mOutputSetCount) {
+		AIFW_LOGE("Invalid output set %d, output set count %d", index, this->mOutputSetCount);
+		return NULL;
+	}
+	return this->mOutputList[index]->data.f;
+#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
+}
+
+/* Run inference : on the input tensors filled through getInputBuffer(), read the result with getOutputBuffer() */
+AIFW_RESULT TFLM::invoke(void)
+{
 	AIFW_START_TIMER
 	TfLiteStatus invokeStatus = this->mInterpreter->Invoke();
 	AIFW_END_TIMER
@@ -329,12 +339,7 @@ AIFW_RESULT TFLM::invoke(void *inputData, void *outputData)
 		AIFW_LOGE("Invoke failed");
 		return AIFW_ERROR;
 	}
-	float **outputRef = (float **)(outputData);
-	for (uint16_t i = 0; i < this->mOutputSetCount; i++) {
-		outputRef[i] = (float *)this->mOutputList[i]->data.data;
-	}
 	return AIFW_OK;
 }
-#endif /* CONFIG_AIFW_MULTI_INOUT_SUPPORT */
 } /* namespace aifw */
 
@@ -80,22 +80,30 @@ public:
 	 */
 	virtual AIFW_RESULT loadModel(const unsigned char *model) = 0;
 
-#ifndef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 	/**
-	 * @brief Run the inference with the given inputData.
-	 * @param [in] inputData: Input data for model invoke.
-	 * @return: Void * pointer to output result data.
+	 * @brief Gives the memory of an input tensor, the next invoke() reads the input set from it.
+	 * Callers write input values right there instead of passing a copy to invoke().
+	 * It is called for every input set before each invoke(), the engine may move the tensor in between.
+	 * @param [in] index: Index of input set, 0 if the model has a single input.
+	 * @return: Pointer to the input tensor values, NULL on error.
 	 */
-	virtual void *invoke(void *inputData) = 0;
-#else
+	virtual float *getInputBuffer(uint16_t index) = 0;
+
+	/**
+	 * @brief Gives the memory of an output tensor holding the result of the last invoke().
+	 * It stays valid until getInputBuffer(), invoke() or resetInferenceState() is called again.
+	 * @param [in] index: Index of output set, 0 if the model has a single output.
+	 * @return: Pointer to the output tensor values, NULL on error.
+	 */
+	virtual float *getOutputBuffer(uint16_t index) = 0;
+
 	/**
-	 * @brief Run the inference with the given inputData.
-	 * @param [in] inputData: Input data for model invoke.
-	 * @param [out] outputData: Pointer to Output Data for storing output of invoke.
+	 * @brief Run the inference on the values written in the input tensors.
 	 * @return: AIFW_RESULT enum object.
 	 */
-	virtual AIFW_RESULT invoke(void *inputData, void *outputData) = 0;
+	virtual AIFW_RESULT invoke(void) = 0;
 
+#ifdef CONFIG_AIFW_MULTI_INOUT_SUPPORT
 	/**
 	 * @brief Pass model dimensions to AIModel to allocate memory.
 	 * @param [in] inputSetCount: Number of Input sets for model invoke.
@@ -126,6 +126,7 @@
 #define AQL_SET_CONDITION(adt, cond)    ((adt)->lvm_instance = (cond))
 #define AQL_ADD_VALUE(adt, domain, value)                               \
 	aql_add_value((adt), (domain), (value))
+#define AQL_ADD_PARAMETER(adt)          aql_add_parameter(adt)
 
 /****************************************************************************
 * Public Type Definitions
@@ -193,6 +194,8 @@ enum token_e {
 
 	ATTRIBUTE,
 	BPLUSTREE,					/* 48 */
+	PARAMETER,
+	BTREE,
 
 	INTEGER_VALUE = 251,
 	FLOAT_VALUE = 252,
@@ -242,6 +245,7 @@ struct aql_adt_s {
 	uint8_t relation_count;
 	uint8_t attribute_count;
 	uint8_t value_count;
+	uint8_t param_count;
 	uint32_t optype;
 	uint8_t flags;
 	void *lvm_instance;
@@ -260,5 +264,6 @@ void aql_add_relation(aql_adt_t *adt, char *rel);
 aql_status_t aql_parse(aql_adt_t *adt, char *query_string);
 db_result_t aql_add_attribute(aql_adt_t *adt, char *name, domain_t domain, unsigned element_size, int processed_only);
 db_result_t aql_add_value(aql_adt_t *adt, domain_t domain, void *value);
+db_result_t aql_add_parameter(aql_adt_t *adt);
 
 #endif							/* !AQL_H */
@@ -84,6 +84,7 @@ void aql_clear(aql_adt_t *adt)
 	adt->relation_count = 0;
 	adt->attribute_count = 0;
 	adt->value_count = 0;
+	adt->param_count = 0;
 	adt->flags = 0;
 	memset(adt->aggregators, 0, sizeof(adt->aggregators));
 }
@@ -160,3 +161,20 @@ db_result_t aql_add_value(aql_adt_t *adt, domain_t domain, void *value_ptr)
 
 	return DB_OK;
 }
+
+/* A value given later with db_bind(), its domain is unspecified till then. */
+db_result_t aql_add_parameter(aql_adt_t *adt)
+{
+	attribute_value_t *value;
+
+	if (adt->value_count == AQL_ATTRIBUTE_LIMIT) {
+		return DB_LIMIT_ERROR;
+	}
+
+	value = &adt->values[adt->value_count++];
+	value->domain = DOMAIN_UNSPECIFIED;
+	VALUE_LONG(value) = 0;
+	adt->param_count++;
+
+	return DB_OK;
+}
@@ -59,6 +59,7 @@
  ****************************************************************************/
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <fcntl.h>
 #include <unistd.h>
@@ -67,8 +68,41 @@
 #include "storage.h"
 #include "relation.h"
 #include "result.h"
+#include "lvm.h"
 #include "aql.h"
 
+/****************************************************************************
+* Private Type Definitions
+****************************************************************************/
+struct aql_param_s {
+	lvm_ip_t ip;				/* Operand in the condition, or -1 for a value */
+	uint8_t value;				/* Index of the value to insert */
+	uint8_t bound;
+	char *string;				/* Copy of a bound string */
+};
+typedef struct aql_param_s aql_param_t;
+
+/* A prepared statement keeps its parsed query and loaded relation. A SELECT
+   also keeps its handle, i.e. its result relation, attribute map and the
+   condition compiled for the LVM. An INSERT in a batch keeps the rows made
+   by each step until the batch is committed. */
+struct _db_stmt_s {
+	aql_adt_t adt;
+	relation_t *rel;
+	db_handle_t *handle;
+	char result_name[RELATION_NAME_LENGTH + 1];
+	aql_param_t params[AQL_ATTRIBUTE_LIMIT];
+	unsigned char *batch;		/* Rows of the batch */
+	int batch_capacity;			/* Rows allocated in batch */
+	int batch_size;				/* Rows of the current batch, 0 without batch */
+	int batch_count;			/* Rows added to the current batch */
+};
+
+/****************************************************************************
+* Private Data
+****************************************************************************/
+static unsigned int g_stmt_id;
+
 /****************************************************************************
 * Private Functions
 ****************************************************************************/
@@ -161,23 +195,32 @@ db_result_t db_exec(char *format)
 		return DB_PARSING_ERROR;
 	}
 
+	/* From here, the parse result is released at errout */
+
+	if (adt.param_count > 0) {
+		DB_LOG_E("DB : Parameters need db_prepare\n");
+		res = DB_PARSING_ERROR;
+		goto errout;
+	}
+
 	optype = AQL_GET_OP_TYPE(AQL_GET_TYPE(&adt));
 	if (optype == AQL_OP_TYPE_QUERY) {
 		DB_LOG_E("DB : AQL OP TYPE Error \n");
-		return DB_ARGUMENT_ERROR;
+		res = DB_ARGUMENT_ERROR;
+		goto errout;
 	}
 
+	res = DB_RELATIONAL_ERROR;
+
 	optype = AQL_GET_EXEC_TYPE(AQL_GET_TYPE(&adt));
 	if (optype != AQL_TYPE_CREATE_RELATION) {
 		rel = aql_get_relation(&adt);
 		if (rel == NULL) {
 			DB_LOG_E("DB : get relation Failed\n");
-			return DB_RELATIONAL_ERROR;
+			goto errout;
 		}
 	}
 
-	res = DB_RELATIONAL_ERROR;
-
 	switch (optype) {
 	case AQL_TYPE_CREATE_ATTRIBUTE:
 		attr = &(adt.attributes[0]);
@@ -230,9 +273,14 @@ db_result_t db_exec(char *format)
 	default:
 		break;
 	}
+
+errout:
 	if (rel != NULL) {
 		relation_release(rel);
 	}
+	if (adt.lvm_instance != NULL) {
+		free(adt.lvm_instance);
+	}
 	return res;
 }
 
@@ -252,6 +300,13 @@ db_cursor_t *db_query(char *format)
 		DB_LOG_E("DB : Parsing Error in db_create\n");
 		return NULL;
 	}
+	if (adt.param_count > 0) {
+		DB_LOG_E("DB : Parameters need db_prepare\n");
+		if (adt.lvm_instance != NULL) {
+			free(adt.lvm_instance);
+		}
+		return NULL;
+	}
 	optype = AQL_GET_OP_TYPE(AQL_GET_TYPE(&adt));
 	if (optype != AQL_OP_TYPE_QUERY) {
 		DB_LOG_E("DB : AQL OP TYPE Error \n");
@@ -317,3 +372,320 @@ errout:
 
 	return NULL;
 }
+
+db_stmt_t *db_prepare(char *format)
+{
+	db_stmt_t *stmt;
+	uint32_t optype;
+	int i;
+	int n;
+
+	stmt = (db_stmt_t *)malloc(sizeof(db_stmt_t));
+	if (stmt == NULL) {
+		DB_LOG_E("DB : Failed to malloc statement\n");
+		return NULL;
+	}
+	memset(stmt, 0, sizeof(db_stmt_t));
+
+	if (DB_ERROR(aql_get_parse_result(format, &stmt->adt))) {
+		DB_LOG_E("DB : Parsing Error in db_prepare\n");
+		goto errout;
+	}
+
+	optype = AQL_GET_EXEC_TYPE(AQL_GET_TYPE(&stmt->adt));
+	if ((optype != AQL_TYPE_INSERT && optype != AQL_TYPE_SELECT) || (AQL_GET_FLAGS(&stmt->adt) & AQL_FLAG_ASSIGN)) {
+		DB_LOG_E("DB : Only INSERT and SELECT can be prepared\n");
+		goto errout;
+	}
+
+	/* Parameters of INSERT are values, those of SELECT are operands in
+	   the condition. */
+	if (optype == AQL_TYPE_INSERT) {
+		n = 0;
+		for (i = 0; i < stmt->adt.value_count; i++) {
+			if (stmt->adt.values[i].domain == DOMAIN_UNSPECIFIED) {
+				stmt->params[n].ip = -1;
+				stmt->params[n].value = i;
+				n++;
+			}
+		}
+	} else {
+		for (i = 0; i < stmt->adt.param_count; i++) {
+			stmt->params[i].ip = lvm_find_parameter(stmt->adt.lvm_instance, i);
+			if (stmt->params[i].ip < 0) {
+				DB_LOG_E("DB : Parameter %d is not found\n", i);
+				goto errout;
+			}
+		}
+	}
+
+	stmt->rel = aql_get_relation(&stmt->adt);
+	if (stmt->rel == NULL) {
+		DB_LOG_E("DB : get relation Failed\n");
+		goto errout;
+	}
+
+	if (optype == AQL_TYPE_INSERT) {
+		if (stmt->adt.value_count != stmt->rel->attribute_count) {
+			DB_LOG_E("DB : %d values for %d attributes\n", stmt->adt.value_count, stmt->rel->attribute_count);
+			goto errout;
+		}
+		return stmt;
+	}
+
+	/* The handle takes over the relation and the condition. */
+	if (DB_ERROR(aql_init_handle(&stmt->handle))) {
+		DB_LOG_E("DB: Init handle failed\n");
+		goto errout;
+	}
+	snprintf(stmt->result_name, sizeof(stmt->result_name), "%s%u", STMT_RESULT_RELATION, g_stmt_id++);
+	if (DB_ERROR(relation_prepare_select(&stmt->handle, stmt->rel, &stmt->adt, stmt->result_name))) {
+		DB_LOG_E("DB: Failed relation_select\n");
+		goto errout;
+	}
+
+	return stmt;
+
+errout:
+	db_finalize(stmt);
+	return NULL;
+}
+
+db_result_t db_bind(db_stmt_t *stmt, int index, domain_t domain, void *value)
+{
+	aql_param_t *param;
+	attribute_value_t *av;
+	long l = 0;
+
+	if (stmt == NULL || value == NULL || index < 0 || index >= stmt->adt.param_count) {
+		return DB_ARGUMENT_ERROR;
+	}
+	param = &stmt->params[index];
+
+	switch (domain) {
+	case DOMAIN_INT:
+		l = *(int *)value;
+		break;
+	case DOMAIN_LONG:
+		l = *(long *)value;
+		break;
+	case DOMAIN_STRING:
+		/* The condition compares numbers only. */
+		if (param->ip >= 0) {
+			return DB_TYPE_ERROR;
+		}
+		/* A string attribute is copied with its element size, which can be
+		   longer than the string. */
+		if (param->string == NULL) {
+			param->string = (char *)malloc(DB_MAX_ELEMENT_SIZE);
+			if (param->string == NULL) {
+				return DB_ALLOCATION_ERROR;
+			}
+		}
+		strncpy(param->string, (char *)value, DB_MAX_ELEMENT_SIZE - 1);
+		param->string[DB_MAX_ELEMENT_SIZE - 1] = '\0';
+		break;
+	default:
+		return DB_TYPE_ERROR;
+	}
+
+	if (param->ip >= 0) {
+		if (LVM_ERROR(lvm_bind_long(stmt->adt.lvm_instance, param->ip, l))) {
+			return DB_IMPLEMENTATION_ERROR;
+		}
+	} else {
+		av = &stmt->adt.values[param->value];
+		av->domain = domain;
+		if (domain == DOMAIN_STRING) {
+			VALUE_STRING(av) = (unsigned char *)param->string;
+		} else {
+			VALUE_LONG(av) = l;
+		}
+	}
+	param->bound = 1;
+
+	return DB_OK;
+}
+
+db_result_t db_step(db_stmt_t *stmt, db_cursor_t **cursor)
+{
+	db_result_t res;
+	int i;
+
+	if (stmt == NULL) {
+		return DB_ARGUMENT_ERROR;
+	}
+	if (cursor != NULL) {
+		*cursor = NULL;
+	}
+
+	for (i = 0; i < stmt->adt.param_count; i++) {
+		if (!stmt->params[i].bound) {
+			DB_LOG_E("DB : Parameter %d is not bound\n", i);
+			return DB_ARGUMENT_ERROR;
+		}
+	}
+
+	if (stmt->handle == NULL) {
+		if (relation_cardinality(stmt->rel) + stmt->batch_count >= DB_TUPLE_LIMIT) {
+			return DB_LIMIT_ERROR;
+		}
+		if (stmt->batch_size > 0) {
+			if (stmt->batch_count == stmt->batch_size) {
+				return DB_FULL_ERROR;
+			}
+			res = relation_make_row(stmt->rel, stmt->adt.values, stmt->batch + stmt->batch_count * stmt->rel->row_length);
+			if (DB_ERROR(res)) {
+				return res;
+			}
+			stmt->batch_count++;
+			return DB_OK;
+		}
+		res = relation_insert(stmt->rel, stmt->adt.values);
+		if (DB_SUCCESS(res)) {
+			res = DB_OK;
+		}
+		return res;
+	}
+
+	if (cursor == NULL) {
+		return DB_ARGUMENT_ERROR;
+	}
+#ifdef CONFIG_ARASTORAGE_ENABLE_WRITE_BUFFER
+	if (DB_SUCCESS(storage_flush_insert_buffer())) {
+		DB_LOG_D("DB : flush insert buffer!!\n");
+	}
+#endif
+
+	/* The index range is derived again from the bound values. */
+	relation_restart_select(&stmt->handle, AQL_GET_FLAGS(&stmt->adt));
+	*cursor = relation_process_result(stmt->handle);
+	if (*cursor == NULL) {
+		DB_LOG_E("DB: Failed to process cursor tuples\n");
+		return DB_CURSOR_ERROR;
+	}
+
+	return DB_OK;
+}
+
+db_result_t db_finalize(db_stmt_t *stmt)
+{
+	relation_t *result_rel;
+	db_result_t res;
+	int i;
+
+	if (stmt == NULL) {
+		return DB_ARGUMENT_ERROR;
+	}
+
+	res = DB_OK;
+	if (stmt->handle != NULL) {
+		result_rel = stmt->handle->result_rel;
+		res = aql_deinit_handle(&stmt->handle);
+		if (result_rel != NULL) {
+			relation_remove(result_rel, 1);
+		}
+	} else {
+		if (stmt->rel != NULL) {
+			res = relation_release(stmt->rel);
+		}
+		if (stmt->adt.lvm_instance != NULL) {
+			free(stmt->adt.lvm_instance);
+		}
+	}
+
+	/* Rows of a batch not committed are discarded. */
+	if (stmt->batch != NULL) {
+		free(stmt->batch);
+	}
+
+	/* Free the bound strings, then the ones given in the query. */
+	for (i = 0; i < stmt->adt.param_count; i++) {
+		if (stmt->params[i].string != NULL) {
+			if (stmt->params[i].ip < 0) {
+				stmt->adt.values[stmt->params[i].value].domain = DOMAIN_UNSPECIFIED;
+			}
+			free(stmt->params[i].string);
+		}
+	}
+	for (i = 0; i < stmt->adt.value_count; i++) {
+		if (stmt->adt.values[i].domain == DOMAIN_STRING) {
+			free(VALUE_STRING(&stmt->adt.values[i]));
+		}
+	}
+
+	free(stmt);
+	return res;
+}
+
+
+db_result_t db_begin(db_stmt_t *stmt, int size)
+{
+	unsigned char *batch;
+
+	if (stmt == NULL || stmt->handle != NULL || size <= 0) {
+		return DB_ARGUMENT_ERROR;
+	}
+#ifdef CONFIG_ARASTORAGE_ENABLE_FLUSHING
+	/* A flush of the index in the middle of a commit rebuilds the tuple
+	   file from the indexed rows only, dropping the rest of the batch. */
+	DB_LOG_E("DB : Batch is not supported with flushing\n");
+	return DB_IMPLEMENTATION_ERROR;
+#endif
+	if (stmt->batch_size > 0) {
+		DB_LOG_E("DB : Batch is not committed yet\n");
+		return DB_BUSY_ERROR;
+	}
+	if (size > DB_TUPLE_LIMIT) {
+		return DB_LIMIT_ERROR;
+	}
+
+	/* The rows are kept for the following batches. */
+	if (size > stmt->batch_capacity) {
+		batch = (unsigned char *)realloc(stmt->batch, size * stmt->rel->row_length);
+		if (batch == NULL) {
+			DB_LOG_E("DB : Failed to malloc %d rows\n", size);
+			return DB_ALLOCATION_ERROR;
+		}
+		stmt->batch = batch;
+		stmt->batch_capacity = size;
+	}
+	stmt->batch_size = size;
+	stmt->batch_count = 0;
+
+	return DB_OK;
+}
+
+db_result_t db_commit(db_stmt_t *stmt)
+{
+	db_result_t res;
+
+	if (stmt == NULL || stmt->batch_size == 0) {
+		return DB_ARGUMENT_ERROR;
+	}
+
+	res = DB_OK;
+	if (stmt->batch_count > 0) {
+		if (relation_cardinality(stmt->rel) + stmt->batch_count > DB_TUPLE_LIMIT) {
+			res = DB_LIMIT_ERROR;
+		} else {
+			res = relation_insert_rows(stmt->rel, stmt->batch, stmt->batch_count);
+		}
+	}
+	stmt->batch_size = 0;
+	stmt->batch_count = 0;
+
+	return res;
+}
+
+db_result_t db_rollback(db_stmt_t *stmt)
+{
+	if (stmt == NULL || stmt->batch_size == 0) {
+		return DB_ARGUMENT_ERROR;
+	}
+
+	stmt->batch_size = 0;
+	stmt->batch_count = 0;
+
+	return DB_OK;
+}
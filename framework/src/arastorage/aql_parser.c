@@ -261,6 +261,11 @@ PARSER(values)
 	case INTEGER_VALUE:
 		AQL_ADD_VALUE(adt, DOMAIN_INT, VALUE);
 		break;
+	case PARAMETER:
+		if (DB_ERROR(AQL_ADD_PARAMETER(adt))) {
+			RETURN(SYNTAX_ERROR);
+		}
+		break;
 	default:
 		RETURN(SYNTAX_ERROR);
 	}
@@ -298,6 +303,12 @@ PARSER(operand)
 			RETURN(SYNTAX_ERROR);
 		}
 		break;
+	case PARAMETER:
+		if (adt->param_count == AQL_ATTRIBUTE_LIMIT || LVM_ERROR(lvm_set_parameter(p, adt->param_count))) {
+			RETURN(SYNTAX_ERROR);
+		}
+		adt->param_count++;
+		break;
 	default:
 		RETURN(SYNTAX_ERROR);
 	}
@@ -701,6 +712,7 @@ PARSER_TOKEN(index_type)
 	switch (TOKEN) {
 	case INLINE:
 	case BPLUSTREE:
+	case BTREE:
 		return TOKEN;
 	default:
 		return NONE;
@@ -738,6 +750,9 @@ PARSER(create_index)
 	case BPLUSTREE:
 		type = INDEX_BPLUSTREE;
 		break;
+	case BTREE:
+		type = INDEX_BTREE;
+		break;
 	default:
 		RETURN(SYNTAX_ERROR);
 	}
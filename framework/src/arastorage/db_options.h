@@ -165,7 +165,11 @@
 
 /* The maximum number of tuples in a relation. */
 #ifndef DB_TUPLE_LIMIT
+#ifdef CONFIG_DB_TUPLES_LIMIT
+#define DB_TUPLE_LIMIT          CONFIG_DB_TUPLES_LIMIT
+#else
 #define DB_TUPLE_LIMIT          1000
+#endif
 #endif							/* DB_TUPLE_LIMIT */
 
 /* The number of int array in a cursor. */
@@ -184,6 +188,12 @@
 #define RESULT_RELATION "db-res"
 #endif							/* RESULT_RELATION */
 
+/* The name prefix of the result relations of prepared statements, each
+   statement has its own one so that its selection is kept between steps. */
+#ifndef STMT_RESULT_RELATION
+#define STMT_RESULT_RELATION "db-stmt"
+#endif							/* STMT_RESULT_RELATION */
+
 /* The name of the relation used for processing a REMOVE query. */
 #ifndef REMOVE_RELATION
 #define REMOVE_RELATION "db-rem"
@@ -205,6 +215,10 @@
 
 #define BUCKET_FILE_LENGTH 15
 
+#define BTREE_FILE_NAME "btree"
+
+#define BTREE_FILE_LENGTH 15
+
 #define TEMP_FILE_SUFFIX ".tmp"
 
 #define TEMP_FILE_SUFFIX_LENGTH 4
@@ -226,6 +240,8 @@
 #define DB_HEAP_CACHE_LIMIT             6
 #endif							/* DB_HEAP_CACHE_LIMIT */
 
+/* The number of nodes cached by a bplustree index, and of pages cached by
+   a btree index. */
 #ifndef DB_TREE_CACHE_LIMIT
 #define DB_TREE_CACHE_LIMIT             10
 #endif
@@ -77,7 +77,8 @@ struct index_api_s;
 enum index_e {
 	INDEX_NONE = 0,
 	INDEX_INLINE = 1,
-	INDEX_BPLUSTREE = 2
+	INDEX_BPLUSTREE = 2,
+	INDEX_BTREE = 3
 };
 typedef enum index_e index_type_t;
 
@@ -108,6 +109,8 @@ struct index_iterator_s {
 	attribute_value_t max_value;
 	tuple_id_t next_item_no;
 	tuple_id_t found_items;
+	uint32_t page;				/* The position of the next item in a btree index */
+	uint16_t slot;
 };
 typedef struct index_iterator_s index_iterator_t;
 
@@ -119,8 +122,10 @@ struct index_api_s {
 	db_result_t(*load)(index_t *);
 	db_result_t(*release)(index_t *);
 	db_result_t(*insert)(index_t *, attribute_value_t *, tuple_id_t);
-	db_result_t(*delete)(index_t *, attribute_value_t *);
+	db_result_t(*delete)(index_t *, attribute_value_t *, tuple_id_t);
 	tuple_id_t(*get_next)(index_iterator_t *, uint8_t);
+	db_result_t(*flush)(index_t *);
+	db_result_t(*truncate)(index_t *, tuple_id_t);
 };
 
 typedef struct index_api_s index_api_t;
@@ -130,6 +135,7 @@ typedef struct index_api_s index_api_t;
 ****************************************************************************/
 extern index_api_t index_inline;
 extern index_api_t index_bplustree;
+extern index_api_t index_btree;
 
 /****************************************************************************
  * Internal function prototypes
@@ -140,7 +146,9 @@ db_result_t index_destroy(index_t *);
 db_result_t index_load(relation_t *, attribute_t *);
 db_result_t index_release(index_t *);
 db_result_t index_insert(index_t *, attribute_value_t *, tuple_id_t);
-db_result_t index_delete(index_t *, attribute_value_t *);
+db_result_t index_delete(index_t *, attribute_value_t *, tuple_id_t);
+db_result_t index_flush(index_t *);
+db_result_t index_truncate(index_t *, tuple_id_t);
 db_result_t index_get_iterator(index_iterator_t *, index_t *, attribute_value_t *, attribute_value_t *);
 tuple_id_t index_get_next(index_iterator_t *, uint8_t);
 int index_exists(attribute_t *);
@@ -280,8 +280,10 @@ static db_result_t destroy(index_t *);
 static db_result_t load(index_t *);
 static db_result_t release(index_t *);
 static db_result_t insert(index_t *, attribute_value_t *, tuple_id_t);
-static db_result_t delete(index_t *, attribute_value_t *);
+static db_result_t delete(index_t *, attribute_value_t *, tuple_id_t);
 static tuple_id_t get_next(index_iterator_t *, uint8_t);
+static db_result_t flush(index_t *);
+static db_result_t truncate_index(index_t *, tuple_id_t);
 
 #ifdef DB_WIP
 static db_result_t vacuum(tree_t *, relation_t *);
@@ -302,7 +304,9 @@ index_api_t index_bplustree = {
 	release,
 	insert,
 	delete,
-	get_next
+	get_next,
+	flush,
+	truncate_index
 };
 
 /****************************************************************************
@@ -782,7 +786,114 @@ static db_result_t insert(index_t *index, attribute_value_t *key, tuple_id_t val
 	return DB_OK;
 }
 
-static db_result_t delete(index_t *index, attribute_value_t *value)
+/****************************************************************************
+ * Name: flush
+ *
+ * Description: Writes the tree metadata and the dirty entries of both caches
+ *              to storage. The entries stay in the caches, e.g. to flush
+ *              once after a batch of insertions.
+ *
+ ****************************************************************************/
+static db_result_t flush(index_t *index)
+{
+	tree_t *tree;
+	qnode_t *tmp_node;
+	db_result_t res = DB_OK;
+
+	tree = (tree_t *)index->opaque_data;
+	if (tree == NULL || tree->node_cache == NULL || tree->buck_cache == NULL) {
+		return DB_ALLOCATION_ERROR;
+	}
+	if (DB_ERROR(storage_write_to(tree->tree_storage, tree, 0, sizeof(tree_t)))) {
+		res = DB_STORAGE_ERROR;
+	}
+
+	pthread_mutex_lock(&(tree->buck_cache_lock));
+	tmp_node = tree->buck_cache->in_cache.head->next;
+	while (tmp_node != tree->buck_cache->in_cache.tail) {
+		if ((tmp_node->node_state & NODE_STATE_DIRTY) && (tmp_node->node_state & NODE_STATE_VALID)) {
+			if (bucket_write(tree, tmp_node->id, &(tree->buck_cache->cache_t[tmp_node->pos].bucket))) {
+				UNSET_NODE_STATE(tmp_node, NODE_STATE_DIRTY);
+			} else {
+				res = DB_STORAGE_ERROR;
+			}
+		}
+		tmp_node = tmp_node->next;
+	}
+	pthread_mutex_unlock(&(tree->buck_cache_lock));
+
+	pthread_mutex_lock(&(tree->node_cache_lock));
+	tmp_node = tree->node_cache->in_cache.head->next;
+	while (tmp_node != tree->node_cache->in_cache.tail) {
+		if ((tmp_node->node_state & NODE_STATE_DIRTY) && (tmp_node->node_state & NODE_STATE_VALID)) {
+			if (tree_write(tree, tmp_node->id, &(tree->node_cache->cache_t[tmp_node->pos].node))) {
+				UNSET_NODE_STATE(tmp_node, NODE_STATE_DIRTY);
+			} else {
+				res = DB_STORAGE_ERROR;
+			}
+		}
+		tmp_node = tmp_node->next;
+	}
+	pthread_mutex_unlock(&(tree->node_cache_lock));
+
+	return res;
+}
+
+/****************************************************************************
+ * Name: truncate_index
+ *
+ * Description: Removes the entries of tuples from tuple_id on, i.e. those of
+ *              a batch of insertions being rolled back. As db_flush does,
+ *              the pairs are filtered in each bucket and the key ranges of
+ *              the tree are kept.
+ *
+ ****************************************************************************/
+static db_result_t truncate_index(index_t *index, tuple_id_t tuple_id)
+{
+	tree_t *tree;
+	bucket_t *bucket;
+	int id;
+	int num;
+	int ind;
+
+	tree = (tree_t *)index->opaque_data;
+	if (tree == NULL) {
+		return DB_ALLOCATION_ERROR;
+	}
+
+	for (id = 0; id < tree->off_buckets; id++) {
+		bucket = bucket_read(tree, id);
+		if (bucket == NULL) {
+			return DB_INDEX_ERROR;
+		}
+		for (num = 0, ind = 0; num < bucket->next_free_slot; num++) {
+			if (bucket->pairs[num].value < tuple_id) {
+				bucket->pairs[ind++] = bucket->pairs[num];
+			}
+		}
+		if (ind == bucket->next_free_slot) {
+			modify_cache(tree, id, BUCKET, UNLOCK);
+			continue;
+		}
+
+		tree->inserted -= min(tree->inserted, (uint16_t)(bucket->next_free_slot - ind));
+		bucket->next_free_slot = ind;
+		if (ind > 0) {
+			bucket->info[1] = bucket->pairs[0].key;
+			bucket->info[2] = bucket->pairs[0].key;
+			for (num = 1; num < ind; num++) {
+				bucket->info[1] = min(bucket->pairs[num].key, bucket->info[1]);
+				bucket->info[2] = max(bucket->pairs[num].key, bucket->info[2]);
+			}
+		}
+		modify_cache(tree, id, BUCKET, DIRTY);
+		modify_cache(tree, id, BUCKET, UNLOCK);
+	}
+
+	return DB_OK;
+}
+
+static db_result_t delete(index_t *index, attribute_value_t *value, tuple_id_t tuple_id)
 {
 	int i_key;
 
@@ -0,0 +1,985 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/types.h>
+
+#include "result.h"
+#include "db_options.h"
+#include "db_debug.h"
+#include "storage.h"
+#include "random.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+#ifdef CONFIG_ARASTORAGE_BTREE_PAGE_SIZE
+#define BTREE_PAGE_SIZE CONFIG_ARASTORAGE_BTREE_PAGE_SIZE
+#else
+#define BTREE_PAGE_SIZE 512
+#endif
+
+#define BTREE_MAGIC 0x65657274	/* "tree" */
+
+/* Page 0 holds the header, so it is never a node */
+#define BTREE_NO_PAGE 0
+
+/* Nodes are at least half full, so the depth stays below log2 of the
+ * number of entries.
+ */
+#define BTREE_MAX_DEPTH 32
+
+/* An inner node holds at least this number of entries, which limits the
+ * length of a key.
+ */
+#define BTREE_MIN_ENTRIES 4
+#define BTREE_MAX_RECORD ((BTREE_PAGE_SIZE - sizeof(struct btree_node_s)) / BTREE_MIN_ENTRIES)
+
+#define CACHE_STATE_VALID 1
+#define CACHE_STATE_DIRTY 2
+
+/* A split keeps the node and its new sibling in the cache */
+#if DB_TREE_CACHE_LIMIT < 2
+#error "DB_TREE_CACHE_LIMIT should be 2 or more for the btree index"
+#endif
+
+/* The page size and the key length are stored in 16 bits */
+#if BTREE_PAGE_SIZE < 128 || BTREE_PAGE_SIZE > 4096
+#error "ARASTORAGE_BTREE_PAGE_SIZE should be from 128 to 4096"
+#endif
+
+#define NODE(data) ((struct btree_node_s *)(data))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Stored in page 0 */
+struct btree_header_s {
+	uint32_t magic;
+	uint32_t root;				/* The page of the root node */
+	uint32_t pages;				/* The number of pages in the file, including page 0 */
+	uint32_t count;				/* The number of entries */
+	uint16_t page_size;
+	uint16_t key_len;
+	uint8_t domain;
+	uint8_t levels;				/* 1 when the root is a leaf */
+	uint8_t reserved[2];
+};
+
+/* Each node page starts with this header, followed by the entries.
+ * A record is a key followed by its tuple id, records are sorted by both
+ * so that the entries of duplicate keys are told apart. A leaf entry is a
+ * record. An inner entry is a record followed by the page of the child
+ * holding the records from it on, link holds the smaller records.
+ */
+struct btree_node_s {
+	uint8_t is_leaf;
+	uint8_t reserved;
+	uint16_t count;
+	uint32_t link;				/* The next leaf, or the first child of an inner node */
+};
+
+/* A page in the cache. The entries are kept in least recently used order,
+ * a pinned entry is in use and is not evicted.
+ */
+struct btree_cache_s {
+	struct btree_cache_s *next;
+	struct btree_cache_s *prev;
+	uint32_t page;
+	uint8_t state;
+	uint8_t pins;
+	uint8_t *data;
+};
+
+struct btree_s {
+	struct btree_header_s header;
+	db_storage_id_t storage;	/* The fd to the file of pages */
+	uint16_t rec_len;			/* The length of a key and its tuple id */
+	uint16_t leaf_max;			/* The maximum number of entries of a leaf */
+	uint16_t inner_max;			/* The maximum number of entries of an inner node */
+	struct btree_cache_s cache[DB_TREE_CACHE_LIMIT];
+	struct btree_cache_s lru;	/* The head of the cache entries, least recently used first */
+	uint8_t *pages;				/* The data of the cache entries */
+	pthread_mutex_t lock;
+};
+typedef struct btree_s btree_t;
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+static db_result_t create(index_t *);
+static db_result_t destroy(index_t *);
+static db_result_t load(index_t *);
+static db_result_t release(index_t *);
+static db_result_t insert(index_t *, attribute_value_t *, tuple_id_t);
+static db_result_t delete(index_t *, attribute_value_t *, tuple_id_t);
+static tuple_id_t get_next(index_iterator_t *, uint8_t);
+static db_result_t flush(index_t *);
+static db_result_t truncate_index(index_t *, tuple_id_t);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+index_api_t index_btree = {
+	INDEX_BTREE,
+	INDEX_API_EXTERNAL | INDEX_API_RANGE_QUERIES,
+	create,
+	destroy,
+	load,
+	release,
+	insert,
+	delete,
+	get_next,
+	flush,
+	truncate_index
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+static uint8_t *node_entry(btree_t *tree, uint8_t *data, int i)
+{
+	size_t len = tree->rec_len + (NODE(data)->is_leaf ? 0 : sizeof(uint32_t));
+
+	return data + sizeof(struct btree_node_s) + i * len;
+}
+
+static uint32_t node_child(btree_t *tree, uint8_t *data, int i)
+{
+	uint32_t child;
+
+	if (i == 0) {
+		return NODE(data)->link;
+	}
+	memcpy(&child, node_entry(tree, data, i - 1) + tree->rec_len, sizeof(child));
+	return child;
+}
+
+static tuple_id_t record_tuple_id(btree_t *tree, const uint8_t *rec)
+{
+	tuple_id_t tuple_id;
+
+	memcpy(&tuple_id, rec + tree->header.key_len, sizeof(tuple_id));
+	return tuple_id;
+}
+
+static int compare_key(btree_t *tree, const uint8_t *k1, const uint8_t *k2)
+{
+	long l1;
+	long l2;
+
+	if (tree->header.domain == DOMAIN_STRING) {
+		return memcmp(k1, k2, tree->header.key_len);
+	}
+
+	memcpy(&l1, k1, sizeof(long));
+	memcpy(&l2, k2, sizeof(long));
+	return l1 < l2 ? -1 : (l1 > l2);
+}
+
+static int compare_record(btree_t *tree, const uint8_t *r1, const uint8_t *r2)
+{
+	tuple_id_t t1;
+	tuple_id_t t2;
+	int res;
+
+	res = compare_key(tree, r1, r2);
+	if (res != 0) {
+		return res;
+	}
+	t1 = record_tuple_id(tree, r1);
+	t2 = record_tuple_id(tree, r2);
+	return t1 < t2 ? -1 : (t1 > t2);
+}
+
+/****************************************************************************
+ * Name: make_record
+ *
+ * Description: Builds the record of a key and a tuple id. Strings are
+ *              padded with zeros so that they are compared as stored in rows.
+ *
+ ****************************************************************************/
+static db_result_t make_record(btree_t *tree, attribute_value_t *value, tuple_id_t tuple_id, uint8_t *rec)
+{
+	long key;
+
+	if (tree->header.domain == DOMAIN_STRING) {
+		if (value->domain != DOMAIN_STRING || VALUE_STRING(value) == NULL) {
+			return DB_TYPE_ERROR;
+		}
+		strncpy((char *)rec, (char *)VALUE_STRING(value), tree->header.key_len);
+		rec[tree->header.key_len - 1] = '\0';
+	} else {
+		if (value->domain != DOMAIN_INT && value->domain != DOMAIN_LONG) {
+			return DB_TYPE_ERROR;
+		}
+		key = db_value_to_long(value);
+		memcpy(rec, &key, sizeof(key));
+	}
+	memcpy(rec + tree->header.key_len, &tuple_id, sizeof(tuple_id));
+
+	return DB_OK;
+}
+
+/****************************************************************************
+ * Name: node_search
+ *
+ * Description: Returns the first entry of the node greater than rec, or
+ *              greater than or equal to rec for a lower bound.
+ *
+ ****************************************************************************/
+static int node_search(btree_t *tree, uint8_t *data, const uint8_t *rec, bool lower)
+{
+	int low = 0;
+	int high = NODE(data)->count;
+	int mid;
+	int res;
+
+	while (low < high) {
+		mid = (low + high) / 2;
+		res = compare_record(tree, node_entry(tree, data, mid), rec);
+		if (res < 0 || (res == 0 && !lower)) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+	return low;
+}
+
+static void node_insert(btree_t *tree, uint8_t *data, int i, const uint8_t *rec, uint32_t child)
+{
+	struct btree_node_s *node = NODE(data);
+	uint8_t *entry = node_entry(tree, data, i);
+
+	memmove(node_entry(tree, data, i + 1), entry, node_entry(tree, data, node->count) - entry);
+	memcpy(entry, rec, tree->rec_len);
+	if (!node->is_leaf) {
+		memcpy(entry + tree->rec_len, &child, sizeof(child));
+	}
+	node->count++;
+}
+
+static void node_remove(btree_t *tree, uint8_t *data, int i)
+{
+	struct btree_node_s *node = NODE(data);
+	uint8_t *entry = node_entry(tree, data, i);
+
+	memmove(entry, node_entry(tree, data, i + 1), node_entry(tree, data, node->count) - node_entry(tree, data, i + 1));
+	node->count--;
+}
+
+/****************************************************************************
+ * Name: cache_init
+ *
+ * Description: Allocates DB_TREE_CACHE_LIMIT pages at once and puts their
+ *              entries in the LRU list.
+ *
+ ****************************************************************************/
+static db_result_t cache_init(btree_t *tree)
+{
+	struct btree_cache_s *entry;
+	int i;
+
+	tree->pages = (uint8_t *)malloc(DB_TREE_CACHE_LIMIT * BTREE_PAGE_SIZE);
+	if (tree->pages == NULL) {
+		DB_LOG_E("DB: Failed to allocate the page cache of a btree\n");
+		return DB_ALLOCATION_ERROR;
+	}
+
+	tree->lru.next = tree->lru.prev = &tree->lru;
+	for (i = 0; i < DB_TREE_CACHE_LIMIT; i++) {
+		entry = &tree->cache[i];
+		entry->page = BTREE_NO_PAGE;
+		entry->state = 0;
+		entry->pins = 0;
+		entry->data = tree->pages + i * BTREE_PAGE_SIZE;
+		entry->prev = tree->lru.prev;
+		entry->next = &tree->lru;
+		tree->lru.prev->next = entry;
+		tree->lru.prev = entry;
+	}
+	return DB_OK;
+}
+
+static db_result_t cache_write(btree_t *tree, struct btree_cache_s *entry)
+{
+	if (DB_ERROR(storage_write_to(tree->storage, entry->data, (unsigned long)entry->page * BTREE_PAGE_SIZE, BTREE_PAGE_SIZE))) {
+		DB_LOG_E("DB: Failed to write btree page %u\n", (unsigned)entry->page);
+		return DB_STORAGE_ERROR;
+	}
+	entry->state &= ~CACHE_STATE_DIRTY;
+	return DB_OK;
+}
+
+/****************************************************************************
+ * Name: page_get
+ *
+ * Description: Returns the data of a page pinned in the cache, reading it
+ *              from storage unless it is a new page. The least recently
+ *              used page which is not pinned is evicted, and written if it
+ *              is dirty.
+ *
+ ****************************************************************************/
+static uint8_t *page_get(btree_t *tree, uint32_t page, bool read)
+{
+	struct btree_cache_s *entry;
+	int i;
+
+	entry = NULL;
+	for (i = 0; i < DB_TREE_CACHE_LIMIT; i++) {
+		if ((tree->cache[i].state & CACHE_STATE_VALID) && tree->cache[i].page == page) {
+			entry = &tree->cache[i];
+			break;
+		}
+	}
+
+	if (entry == NULL) {
+		for (entry = tree->lru.next; entry != &tree->lru && entry->pins > 0; entry = entry->next) {
+		}
+		if (entry == &tree->lru) {
+			DB_LOG_E("DB: All the pages of the btree cache are pinned\n");
+			return NULL;
+		}
+		if ((entry->state & CACHE_STATE_DIRTY) && DB_ERROR(cache_write(tree, entry))) {
+			return NULL;
+		}
+
+		entry->page = page;
+		entry->state = CACHE_STATE_VALID;
+		if (!read) {
+			memset(entry->data, 0, BTREE_PAGE_SIZE);
+			entry->state |= CACHE_STATE_DIRTY;
+		} else if (DB_ERROR(storage_read_from(tree->storage, entry->data, (unsigned long)page * BTREE_PAGE_SIZE, BTREE_PAGE_SIZE))) {
+			DB_LOG_E("DB: Failed to read btree page %u\n", (unsigned)page);
+			entry->state = 0;
+			return NULL;
+		}
+	}
+
+	/* Move it to the most recently used end */
+	entry->prev->next = entry->next;
+	entry->next->prev = entry->prev;
+	entry->prev = tree->lru.prev;
+	entry->next = &tree->lru;
+	tree->lru.prev->next = entry;
+	tree->lru.prev = entry;
+
+	entry->pins++;
+	return entry->data;
+}
+
+static void page_put(btree_t *tree, uint8_t *data, bool dirty)
+{
+	struct btree_cache_s *entry = &tree->cache[(data - tree->pages) / BTREE_PAGE_SIZE];
+
+	if (dirty) {
+		entry->state |= CACHE_STATE_DIRTY;
+	}
+	entry->pins--;
+}
+
+static uint8_t *page_new(btree_t *tree, uint32_t *page, bool is_leaf)
+{
+	uint8_t *data;
+
+	data = page_get(tree, tree->header.pages, false);
+	if (data == NULL) {
+		return NULL;
+	}
+	*page = tree->header.pages++;
+	NODE(data)->is_leaf = is_leaf;
+	return data;
+}
+
+/****************************************************************************
+ * Name: tree_descend
+ *
+ * Description: Returns the leaf where rec belongs. The inner nodes on the
+ *              way are saved in path, from the root on.
+ *
+ ****************************************************************************/
+static uint32_t tree_descend(btree_t *tree, const uint8_t *rec, uint32_t *path)
+{
+	uint8_t *data;
+	uint32_t page;
+	int level;
+
+	page = tree->header.root;
+	for (level = tree->header.levels; level > 1; level--) {
+		data = page_get(tree, page, true);
+		if (data == NULL) {
+			return BTREE_NO_PAGE;
+		}
+		if (path != NULL) {
+			*path++ = page;
+		}
+		page = node_child(tree, data, node_search(tree, data, rec, false));
+		page_put(tree, data, false);
+	}
+	return page;
+}
+
+/****************************************************************************
+ * Name: node_split
+ *
+ * Description: Moves the upper half of a full node to the new node right,
+ *              then inserts rec and child in the half it belongs to.
+ *              The first record of right is copied to sep, for the parent.
+ *              The record in the middle of an inner node moves up, its
+ *              child becomes the first child of right.
+ *
+ ****************************************************************************/
+static void node_split(btree_t *tree, uint8_t *left, uint8_t *right, uint32_t right_page, const uint8_t *rec, uint32_t child, uint8_t *sep)
+{
+	struct btree_node_s *lnode = NODE(left);
+	struct btree_node_s *rnode = NODE(right);
+	int mid = lnode->count / 2;
+	int first;
+
+	first = lnode->is_leaf ? mid : mid + 1;
+	memcpy(sep, node_entry(tree, left, mid), tree->rec_len);
+	rnode->count = lnode->count - first;
+	memcpy(node_entry(tree, right, 0), node_entry(tree, left, first), node_entry(tree, left, lnode->count) - node_entry(tree, left, first));
+	if (lnode->is_leaf) {
+		rnode->link = lnode->link;
+		lnode->link = right_page;
+	} else {
+		memcpy(&rnode->link, node_entry(tree, left, mid) + tree->rec_len, sizeof(uint32_t));
+	}
+	lnode->count = mid;
+
+	if (compare_record(tree, rec, sep) < 0) {
+		node_insert(tree, left, node_search(tree, left, rec, lnode->is_leaf), rec, child);
+	} else {
+		node_insert(tree, right, node_search(tree, right, rec, rnode->is_leaf), rec, child);
+	}
+}
+
+/****************************************************************************
+ * Name: tree_insert
+ *
+ * Description: Inserts rec in its leaf. A full node is split, and the
+ *              first record of the new node is inserted in the parent,
+ *              up to the root. When the root splits, a new root is added
+ *              and the tree grows by one level.
+ *
+ ****************************************************************************/
+static db_result_t tree_insert(btree_t *tree, const uint8_t *rec)
+{
+	uint32_t path[BTREE_MAX_DEPTH];
+	uint8_t buf[2][BTREE_MAX_RECORD];
+	uint8_t *sep = buf[0];
+	uint8_t *up = buf[1];
+	uint8_t *tmp;
+	uint8_t *data;
+	uint8_t *right;
+	uint32_t page;
+	uint32_t right_page;
+	int level;
+	int i;
+
+	page = tree_descend(tree, rec, path);
+	if (page == BTREE_NO_PAGE) {
+		return DB_INDEX_ERROR;
+	}
+	data = page_get(tree, page, true);
+	if (data == NULL) {
+		return DB_INDEX_ERROR;
+	}
+
+	i = node_search(tree, data, rec, true);
+	if (i < NODE(data)->count && compare_record(tree, node_entry(tree, data, i), rec) == 0) {
+		page_put(tree, data, false);
+		return DB_OK;
+	}
+	tree->header.count++;
+	if (NODE(data)->count < tree->leaf_max) {
+		node_insert(tree, data, i, rec, 0);
+		page_put(tree, data, true);
+		return DB_OK;
+	}
+
+	/* Split the nodes up the path as long as they are full */
+	memcpy(up, rec, tree->rec_len);
+	right_page = BTREE_NO_PAGE;
+	for (level = tree->header.levels - 1; level >= 0; level--) {
+		right = page_new(tree, &right_page, NODE(data)->is_leaf);
+		if (right == NULL) {
+			page_put(tree, data, true);
+			return DB_INDEX_ERROR;
+		}
+		node_split(tree, data, right, right_page, up, page, sep);
+		page_put(tree, right, true);
+		page_put(tree, data, true);
+
+		tmp = up;
+		up = sep;
+		sep = tmp;
+		page = right_page;
+		if (level == 0) {
+			break;
+		}
+
+		data = page_get(tree, path[level - 1], true);
+		if (data == NULL) {
+			return DB_INDEX_ERROR;
+		}
+		if (NODE(data)->count < tree->inner_max) {
+			node_insert(tree, data, node_search(tree, data, up, false), up, page);
+			page_put(tree, data, true);
+			return DB_OK;
+		}
+	}
+
+	/* The root has split */
+	if (tree->header.levels >= BTREE_MAX_DEPTH) {
+		DB_LOG_E("DB: The btree is too deep\n");
+		return DB_INDEX_ERROR;
+	}
+	data = page_new(tree, &page, false);
+	if (data == NULL) {
+		return DB_INDEX_ERROR;
+	}
+	NODE(data)->link = tree->header.root;
+	node_insert(tree, data, 0, up, right_page);
+	page_put(tree, data, true);
+	tree->header.root = page;
+	tree->header.levels++;
+
+	return DB_OK;
+}
+
+static db_result_t tree_open(index_t *index, btree_t *tree)
+{
+	tree->storage = storage_open(index->descriptor_file, O_RDWR);
+	if (tree->storage < 0) {
+		DB_LOG_E("DB: Failed to open btree file %s\n", index->descriptor_file);
+		return DB_STORAGE_ERROR;
+	}
+	if (DB_ERROR(cache_init(tree))) {
+		storage_close(tree->storage);
+		return DB_ALLOCATION_ERROR;
+	}
+
+	tree->rec_len = tree->header.key_len + sizeof(tuple_id_t);
+	tree->leaf_max = (BTREE_PAGE_SIZE - sizeof(struct btree_node_s)) / tree->rec_len;
+	tree->inner_max = (BTREE_PAGE_SIZE - sizeof(struct btree_node_s)) / (tree->rec_len + sizeof(uint32_t));
+	pthread_mutex_init(&tree->lock, NULL);
+	index->opaque_data = tree;
+
+	return DB_OK;
+}
+
+/****************************************************************************
+ * Name: create
+ *
+ * Description: Creates the file of the index, with the header in page 0
+ *              and an empty leaf as the root in page 1. Keys of int and
+ *              long attributes are stored as long, those of string
+ *              attributes with the size of the attribute.
+ *
+ ****************************************************************************/
+static db_result_t create(index_t *index)
+{
+	char filename[DB_MAX_FILENAME_LENGTH];
+	db_storage_id_t fd;
+	btree_t *tree;
+	uint8_t *data;
+	unsigned key_len;
+
+	switch (index->attr->domain) {
+	case DOMAIN_INT:
+	case DOMAIN_LONG:
+		key_len = sizeof(long);
+		break;
+	case DOMAIN_STRING:
+		key_len = index->attr->element_size;
+		break;
+	default:
+		DB_LOG_E("DB: The btree index does not support domain %d\n", index->attr->domain);
+		return DB_INDEX_ERROR;
+	}
+	if (key_len == 0) {
+		DB_LOG_E("DB: A btree key can not be empty\n");
+		return DB_INDEX_ERROR;
+	}
+	if (key_len + sizeof(tuple_id_t) + sizeof(uint32_t) > BTREE_MAX_RECORD) {
+		DB_LOG_E("DB: A key of %u bytes is too long for btree pages of %d bytes\n", key_len, BTREE_PAGE_SIZE);
+		return DB_INDEX_ERROR;
+	}
+
+	tree = (btree_t *)malloc(sizeof(btree_t));
+	if (tree == NULL) {
+		DB_LOG_E("DB: Failed to allocate a btree\n");
+		return DB_ALLOCATION_ERROR;
+	}
+	memset(tree, 0, sizeof(btree_t));
+
+	/* Names are random, the file of another index should not be truncated */
+	random_init(time(NULL));
+	do {
+		snprintf(filename, BTREE_FILE_LENGTH, "%s.%x", BTREE_FILE_NAME, (unsigned)(random_rand() & 0xffff));
+		fd = storage_open(filename, O_RDONLY);
+		if (fd >= 0) {
+			storage_close(fd);
+		}
+	} while (fd >= 0);
+	if (DB_ERROR(storage_generate_file(filename))) {
+		DB_LOG_E("DB: Failed to generate a btree file\n");
+		free(tree);
+		return DB_STORAGE_ERROR;
+	}
+	memcpy(index->descriptor_file, filename, sizeof(index->descriptor_file));
+
+	tree->header.magic = BTREE_MAGIC;
+	tree->header.root = 1;
+	tree->header.pages = 2;
+	tree->header.page_size = BTREE_PAGE_SIZE;
+	tree->header.key_len = key_len;
+	tree->header.domain = index->attr->domain;
+	tree->header.levels = 1;
+
+	if (DB_ERROR(tree_open(index, tree))) {
+		storage_remove(filename);
+		free(tree);
+		return DB_STORAGE_ERROR;
+	}
+
+	data = page_get(tree, tree->header.root, false);
+	NODE(data)->is_leaf = 1;
+	page_put(tree, data, true);
+
+	if (DB_ERROR(flush(index))) {
+		release(index);
+		storage_remove(filename);
+		return DB_STORAGE_ERROR;
+	}
+
+	DB_LOG_D("DB: Created a btree index in %s\n", filename);
+	return DB_OK;
+}
+
+/* The file is removed by index_destroy */
+static db_result_t destroy(index_t *index)
+{
+	return release(index);
+}
+
+static db_result_t load(index_t *index)
+{
+	btree_t *tree;
+	db_storage_id_t fd;
+	db_result_t res;
+
+	tree = (btree_t *)malloc(sizeof(btree_t));
+	if (tree == NULL) {
+		DB_LOG_E("DB: Failed to allocate a btree while loading\n");
+		return DB_ALLOCATION_ERROR;
+	}
+	memset(tree, 0, sizeof(btree_t));
+
+	fd = storage_open(index->descriptor_file, O_RDONLY);
+	if (fd < 0) {
+		DB_LOG_E("DB: Failed to open btree file %s\n", index->descriptor_file);
+		free(tree);
+		return DB_STORAGE_ERROR;
+	}
+	res = storage_read_from(fd, &tree->header, 0, sizeof(tree->header));
+	storage_close(fd);
+	if (DB_ERROR(res) || tree->header.magic != BTREE_MAGIC || tree->header.page_size != BTREE_PAGE_SIZE) {
+		DB_LOG_E("DB: Invalid btree file %s\n", index->descriptor_file);
+		free(tree);
+		return DB_INDEX_ERROR;
+	}
+
+	res = tree_open(index, tree);
+	if (DB_ERROR(res)) {
+		free(tree);
+		return res;
+	}
+
+	DB_LOG_D("DB: Loaded a btree index of %u entries and %u levels\n", (unsigned)tree->header.count, tree->header.levels);
+	return DB_OK;
+}
+
+static db_result_t release(index_t *index)
+{
+	btree_t *tree;
+	db_result_t res;
+
+	tree = (btree_t *)index->opaque_data;
+	if (tree == NULL) {
+		return DB_ALLOCATION_ERROR;
+	}
+
+	res = flush(index);
+	storage_close(tree->storage);
+	pthread_mutex_destroy(&tree->lock);
+	free(tree->pages);
+	free(tree);
+	index->opaque_data = NULL;
+
+	return res;
+}
+
+static db_result_t insert(index_t *index, attribute_value_t *value, tuple_id_t tuple_id)
+{
+	btree_t *tree;
+	uint8_t rec[BTREE_MAX_RECORD];
+	db_result_t res;
+
+	tree = (btree_t *)index->opaque_data;
+	res = make_record(tree, value, tuple_id, rec);
+	if (DB_ERROR(res)) {
+		return res;
+	}
+
+	pthread_mutex_lock(&tree->lock);
+	res = tree_insert(tree, rec);
+	pthread_mutex_unlock(&tree->lock);
+	if (DB_ERROR(res)) {
+		DB_LOG_E("DB: Failed to insert tuple %lu into a btree index\n", (unsigned long)tuple_id);
+	}
+	return res;
+}
+
+/****************************************************************************
+ * Name: delete
+ *
+ * Description: Removes the entry of a key and a tuple id. Nodes are not
+ *              merged, a leaf left empty stays in the tree until its range
+ *              of keys is used again.
+ *
+ ****************************************************************************/
+static db_result_t delete(index_t *index, attribute_value_t *value, tuple_id_t tuple_id)
+{
+	btree_t *tree;
+	uint8_t rec[BTREE_MAX_RECORD];
+	uint8_t *data;
+	uint32_t page;
+	db_result_t res;
+	int i;
+
+	tree = (btree_t *)index->opaque_data;
+	res = make_record(tree, value, tuple_id, rec);
+	if (DB_ERROR(res)) {
+		return res;
+	}
+
+	pthread_mutex_lock(&tree->lock);
+	res = DB_INDEX_ERROR;
+	page = tree_descend(tree, rec, NULL);
+	data = (page == BTREE_NO_PAGE) ? NULL : page_get(tree, page, true);
+	if (data != NULL) {
+		i = node_search(tree, data, rec, true);
+		if (i < NODE(data)->count && compare_record(tree, node_entry(tree, data, i), rec) == 0) {
+			node_remove(tree, data, i);
+			tree->header.count--;
+			res = DB_OK;
+		}
+		page_put(tree, data, res == DB_OK);
+	}
+	pthread_mutex_unlock(&tree->lock);
+
+	if (DB_ERROR(res)) {
+		DB_LOG_D("DB: Tuple %lu is not in the btree index\n", (unsigned long)tuple_id);
+	}
+	return res;
+}
+
+/****************************************************************************
+ * Name: get_next
+ *
+ * Description: Returns the tuple ids of the keys from min_value to
+ *              max_value. The first call finds the first key in its leaf,
+ *              the following ones go on from the saved position and follow
+ *              the links to the next leaves.
+ *
+ ****************************************************************************/
+static tuple_id_t get_next(index_iterator_t *iterator, uint8_t matched_condition)
+{
+	btree_t *tree;
+	uint8_t min[BTREE_MAX_RECORD];
+	uint8_t max[BTREE_MAX_RECORD];
+	uint8_t *data;
+	uint8_t *entry;
+	uint32_t page;
+	tuple_id_t tuple_id;
+
+	tree = (btree_t *)iterator->index->opaque_data;
+	if (DB_ERROR(make_record(tree, &iterator->max_value, 0, max))) {
+		return INVALID_TUPLE;
+	}
+
+	pthread_mutex_lock(&tree->lock);
+	if (iterator->next_item_no == 0) {
+		if (DB_ERROR(make_record(tree, &iterator->min_value, 0, min))) {
+			pthread_mutex_unlock(&tree->lock);
+			return INVALID_TUPLE;
+		}
+		iterator->found_items = 0;
+		iterator->page = tree_descend(tree, min, NULL);
+		iterator->slot = 0;
+		data = (iterator->page == BTREE_NO_PAGE) ? NULL : page_get(tree, iterator->page, true);
+		if (data == NULL) {
+			pthread_mutex_unlock(&tree->lock);
+			return INVALID_TUPLE;
+		}
+		iterator->slot = node_search(tree, data, min, true);
+		page_put(tree, data, false);
+	}
+
+	tuple_id = INVALID_TUPLE;
+	page = iterator->page;
+	while (page != BTREE_NO_PAGE) {
+		data = page_get(tree, page, true);
+		if (data == NULL) {
+			page = BTREE_NO_PAGE;
+			break;
+		}
+		if (iterator->slot >= NODE(data)->count) {
+			page = NODE(data)->link;
+			iterator->slot = 0;
+			page_put(tree, data, false);
+			continue;
+		}
+
+		entry = node_entry(tree, data, iterator->slot);
+		if (compare_key(tree, entry, max) > 0) {
+			page_put(tree, data, false);
+			page = BTREE_NO_PAGE;
+			break;
+		}
+		tuple_id = record_tuple_id(tree, entry);
+
+		/* The condition is false for a removal, then the entry is removed */
+		if (matched_condition == FALSE) {
+			node_remove(tree, data, iterator->slot);
+			tree->header.count--;
+			page_put(tree, data, true);
+		} else {
+			iterator->slot++;
+			page_put(tree, data, false);
+		}
+		iterator->next_item_no = ++iterator->found_items;
+		break;
+	}
+	iterator->page = page;
+	pthread_mutex_unlock(&tree->lock);
+
+	return tuple_id;
+}
+
+/****************************************************************************
+ * Name: flush
+ *
+ * Description: Writes the dirty pages of the cache and the header. The
+ *              pages stay in the cache.
+ *
+ ****************************************************************************/
+static db_result_t flush(index_t *index)
+{
+	btree_t *tree;
+	db_result_t res = DB_OK;
+	int i;
+
+	tree = (btree_t *)index->opaque_data;
+	if (tree == NULL) {
+		return DB_ALLOCATION_ERROR;
+	}
+
+	pthread_mutex_lock(&tree->lock);
+	for (i = 0; i < DB_TREE_CACHE_LIMIT; i++) {
+		if ((tree->cache[i].state & CACHE_STATE_DIRTY) && DB_ERROR(cache_write(tree, &tree->cache[i]))) {
+			res = DB_STORAGE_ERROR;
+		}
+	}
+	if (DB_ERROR(storage_write_to(tree->storage, &tree->header, 0, sizeof(tree->header)))) {
+		res = DB_STORAGE_ERROR;
+	}
+	pthread_mutex_unlock(&tree->lock);
+
+	return res;
+}
+
+/****************************************************************************
+ * Name: truncate_index
+ *
+ * Description: Removes the entries of tuples from tuple_id on, i.e. those of
+ *              a batch of insertions being rolled back. All the leaves are
+ *              visited from the first one.
+ *
+ ****************************************************************************/
+static db_result_t truncate_index(index_t *index, tuple_id_t tuple_id)
+{
+	btree_t *tree;
+	uint8_t *data;
+	uint32_t page;
+	int level;
+	int i;
+	int count;
+	bool dirty;
+
+	tree = (btree_t *)index->opaque_data;
+	if (tree == NULL) {
+		return DB_ALLOCATION_ERROR;
+	}
+
+	pthread_mutex_lock(&tree->lock);
+	page = tree->header.root;
+	for (level = tree->header.levels; level > 1 && page != BTREE_NO_PAGE; level--) {
+		data = page_get(tree, page, true);
+		page = (data == NULL) ? BTREE_NO_PAGE : NODE(data)->link;
+		if (data != NULL) {
+			page_put(tree, data, false);
+		}
+	}
+
+	while (page != BTREE_NO_PAGE) {
+		data = page_get(tree, page, true);
+		if (data == NULL) {
+			pthread_mutex_unlock(&tree->lock);
+			return DB_INDEX_ERROR;
+		}
+		dirty = false;
+		count = NODE(data)->count;
+		for (i = count - 1; i >= 0; i--) {
+			if (record_tuple_id(tree, node_entry(tree, data, i)) >= tuple_id) {
+				node_remove(tree, data, i);
+				tree->header.count--;
+				dirty = true;
+			}
+		}
+		page = NODE(data)->link;
+		page_put(tree, data, dirty);
+	}
+	pthread_mutex_unlock(&tree->lock);
+
+	return DB_OK;
+}
@@ -73,8 +73,9 @@
 ****************************************************************************/
 static db_result_t null_op(index_t *);
 static db_result_t insert(index_t *, attribute_value_t *, tuple_id_t);
-static db_result_t delete(index_t *, attribute_value_t *);
+static db_result_t delete(index_t *, attribute_value_t *, tuple_id_t);
 static tuple_id_t get_next(index_iterator_t *, uint8_t);
+static db_result_t truncate_index(index_t *, tuple_id_t);
 
 /****************************************************************************
 * Private Types
@@ -88,11 +89,11 @@ struct search_handle {
 struct search_handle handle;
 
 /*
- * The create, destroy, load, release, insert, and delete operations
- * of the index API always succeed because the index does not store
- * items separately from the row file. The four former operations share
- * the same signature, and are thus implemented by the null_op function
- * to save space.
+ * The create, destroy, load, release, flush, insert, delete and truncate
+ * operations of the index API always succeed because the index does not
+ * store items separately from the row file. The five former operations
+ * share the same signature, and are thus implemented by the null_op
+ * function to save space.
  */
 index_api_t index_inline = {
 	INDEX_INLINE,
@@ -103,7 +104,9 @@ index_api_t index_inline = {
 	null_op,
 	insert,
 	delete,
-	get_next
+	get_next,
+	null_op,
+	truncate_index
 };
 
 /****************************************************************************
@@ -206,7 +209,12 @@ static db_result_t insert(index_t *index, attribute_value_t *value, tuple_id_t t
 	return DB_OK;
 }
 
-static db_result_t delete(index_t *index, attribute_value_t *value)
+static db_result_t delete(index_t *index, attribute_value_t *value, tuple_id_t tuple_id)
+{
+	return DB_OK;
+}
+
+static db_result_t truncate_index(index_t *index, tuple_id_t tuple_id)
 {
 	return DB_OK;
 }
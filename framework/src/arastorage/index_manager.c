@@ -72,7 +72,8 @@
 * Private Types
 ****************************************************************************/
 static index_api_t *index_components[] = { &index_inline,
-										   &index_bplustree
+										   &index_bplustree,
+										   &index_btree
 										 };
 
 pthread_attr_t g_attr;
@@ -142,7 +143,8 @@ db_result_t index_create(index_type_t index_type, relation_t *rel, attribute_t *
 		return DB_INDEX_ERROR;
 	}
 
-	if (attr->domain != DOMAIN_INT && attr->domain != DOMAIN_LONG) {
+	/* Only the btree index compares strings */
+	if (attr->domain != DOMAIN_INT && attr->domain != DOMAIN_LONG && !(attr->domain == DOMAIN_STRING && index_type == INDEX_BTREE)) {
 		DB_LOG_E("DB: Cannot create an index for a non-number attribute!\n");
 		return DB_INDEX_ERROR;
 	}
@@ -307,13 +309,23 @@ db_result_t index_insert(index_t *index, attribute_value_t *value, tuple_id_t tu
 	return index->api->insert(index, value, tuple_id);
 }
 
-db_result_t index_delete(index_t *index, attribute_value_t *value)
+db_result_t index_delete(index_t *index, attribute_value_t *value, tuple_id_t tuple_id)
 {
 	if (index->state != INDEX_READY) {
 		return DB_INDEX_ERROR;
 	}
 
-	return index->api->delete(index, value);
+	return index->api->delete(index, value, tuple_id);
+}
+
+db_result_t index_flush(index_t *index)
+{
+	return index->api->flush(index);
+}
+
+db_result_t index_truncate(index_t *index, tuple_id_t tuple_id)
+{
+	return index->api->truncate(index, tuple_id);
 }
 
 db_result_t index_get_iterator(index_iterator_t *iterator, index_t *index, attribute_value_t *min_value, attribute_value_t *max_value)
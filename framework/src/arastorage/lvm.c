@@ -453,6 +453,62 @@ lvm_status_t lvm_set_long(lvm_instance_t *p, long l)
 	return lvm_set_operand(p, &op);
 }
 
+/* Placeholder of a value which is bound before each execution. */
+lvm_status_t lvm_set_parameter(lvm_instance_t *p, variable_id_t id)
+{
+	operand_t op;
+
+	op.type = LVM_PARAMETER;
+	op.value.l = 0;
+	op.value.id = id;
+
+	return lvm_set_operand(p, &op);
+}
+
+/* Returns the position of the operand of placeholder id, or -1. */
+lvm_ip_t lvm_find_parameter(lvm_instance_t *p, variable_id_t id)
+{
+	operand_t operand;
+	lvm_ip_t ip;
+
+	for (ip = 0; ip < p->end;) {
+		switch (*(node_type_t *)(p->code + ip)) {
+		case LVM_CMP_OP:
+		case LVM_ARITH_OP:
+			ip += sizeof(node_type_t) + sizeof(operator_t);
+			break;
+		case LVM_OPERAND:
+			ip += sizeof(node_type_t);
+			memcpy(&operand, p->code + ip, sizeof(operand));
+			if (operand.type == LVM_PARAMETER && operand.value.id == id) {
+				return ip;
+			}
+			ip += sizeof(operand);
+			break;
+		default:
+			return -1;
+		}
+	}
+
+	return -1;
+}
+
+/* Replace the operand at ip, as found by lvm_find_parameter(), with l. */
+lvm_status_t lvm_bind_long(lvm_instance_t *p, lvm_ip_t ip, long l)
+{
+	operand_t op;
+
+	if (ip < 0 || ip + sizeof(op) > p->end) {
+		return INVALID_IDENTIFIER;
+	}
+
+	op.type = LVM_LONG;
+	op.value.l = l;
+	memcpy(&p->code[ip], &op, sizeof(op));
+
+	return LVM_TRUE;
+}
+
 lvm_status_t lvm_register_variable(lvm_instance_t *p, char *name, operand_type_t type)
 {
 	variable_id_t id;
@@ -682,6 +738,10 @@ static int derive_relation(lvm_instance_t *p, derivation_t *local_derivations)
 
 lvm_status_t lvm_derive(lvm_instance_t *p)
 {
+	/* The code may be derived again once its parameters are bound. */
+	p->ip = 0;
+	memset(p->derivations, 0, sizeof(p->derivations));
+
 	return derive_relation(p, p->derivations);
 }
 
@@ -756,6 +816,9 @@ static lvm_ip_t print_operand(lvm_instance_t *p, lvm_ip_t index)
 	case LVM_LONG:
 		DB_LOG_D("long:%ld ", operand.value.l);
 		break;
+	case LVM_PARAMETER:
+		DB_LOG_D("param:%d ", operand.value.id);
+		break;
 	default:
 		DB_LOG_D("?? ");
 		break;
@@ -55,6 +55,7 @@
  * Included Files
  ****************************************************************************/
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <limits.h>
 #include <tinyara/config.h>
@@ -508,10 +509,11 @@ db_result_t relation_remove(relation_t *rel, int remove_tuples)
 	return result;
 }
 
-db_result_t relation_insert(relation_t *rel, attribute_value_t *values)
+/* relation_make_row: Convert the values to the physical row of the
+   relation and load the indexes of its attributes. */
+db_result_t relation_make_row(relation_t *rel, attribute_value_t *values, unsigned char *record)
 {
 	attribute_t *attr;
-	unsigned char record[rel->row_length];
 	unsigned char *ptr;
 	attribute_value_t *value;
 	db_result_t result;
@@ -567,20 +569,156 @@ db_result_t relation_insert(relation_t *rel, attribute_value_t *values)
 			index_load(rel, attr);
 		}
 		ptr += attr->element_size;
+		attr = attr->next;
+		value++;
+	}
+
+	DB_LOG_V(")\n");
+
+	return DB_OK;
+}
+
+db_result_t relation_insert(relation_t *rel, attribute_value_t *values)
+{
+	attribute_t *attr;
+	unsigned char record[rel->row_length];
+	attribute_value_t *value;
+	db_result_t result;
+
+	result = relation_make_row(rel, values, record);
+	if (DB_ERROR(result)) {
+		return result;
+	}
+
+	value = values;
+	for (attr = list_head(rel->attributes); attr != NULL; attr = attr->next) {
 		if (attr->index != NULL) {
 			if (DB_ERROR(index_insert(attr->index, value, rel->next_row))) {
 				return DB_INDEX_ERROR;
 			}
 		}
-		attr = attr->next;
 		value++;
 	}
 
-	DB_LOG_V(")\n");
-
 	return storage_put_row(rel, record, FALSE);
 }
 
+struct index_key_s {
+	long key;
+	tuple_id_t tuple_id;
+};
+
+static int compare_index_key(const void *p1, const void *p2)
+{
+	const struct index_key_s *k1 = (const struct index_key_s *)p1;
+	const struct index_key_s *k2 = (const struct index_key_s *)p2;
+
+	if (k1->key != k2->key) {
+		return k1->key < k2->key ? -1 : 1;
+	}
+	return k1->tuple_id < k2->tuple_id ? -1 : (k1->tuple_id > k2->tuple_id);
+}
+
+/* insert_batch_keys: Insert the keys of an attribute in count rows, in the
+   order of the keys. Consecutive keys mostly belong to the same bucket of
+   a bplus-tree, which then stays in its cache. String keys are inserted in
+   the order of the rows. */
+static db_result_t insert_batch_keys(relation_t *rel, attribute_t *attr, unsigned char *rows, tuple_id_t first, tuple_id_t count, struct index_key_s *keys)
+{
+	attribute_value_t value;
+	tuple_id_t i;
+
+	if (attr->domain == DOMAIN_STRING) {
+		for (i = 0; i < count; i++) {
+			if (DB_ERROR(relation_get_value(rel, attr, rows + i * rel->row_length, &value))) {
+				return DB_IMPLEMENTATION_ERROR;
+			}
+			if (DB_ERROR(index_insert(attr->index, &value, first + i))) {
+				return DB_INDEX_ERROR;
+			}
+		}
+		return DB_OK;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (DB_ERROR(relation_get_value(rel, attr, rows + i * rel->row_length, &value))) {
+			return DB_IMPLEMENTATION_ERROR;
+		}
+		keys[i].key = db_value_to_long(&value);
+		keys[i].tuple_id = first + i;
+	}
+	qsort(keys, count, sizeof(struct index_key_s), compare_index_key);
+
+	value.domain = DOMAIN_LONG;
+	for (i = 0; i < count; i++) {
+		VALUE_LONG(&value) = keys[i].key;
+		if (DB_ERROR(index_insert(attr->index, &value, keys[i].tuple_id))) {
+			return DB_INDEX_ERROR;
+		}
+	}
+	return DB_OK;
+}
+
+/* relation_insert_rows: Insert count rows made by relation_make_row, as
+   one transaction. The rows are appended with one write, then the keys of
+   each index are inserted in order and the indexes are flushed. If any
+   step fails, the rows and the index entries of the batch are removed. */
+db_result_t relation_insert_rows(relation_t *rel, unsigned char *rows, tuple_id_t count)
+{
+	attribute_t *attr;
+	attribute_t *failed;
+	struct index_key_s *keys;
+	tuple_id_t first;
+	db_result_t result;
+
+	keys = (struct index_key_s *)malloc(count * sizeof(struct index_key_s));
+	if (keys == NULL) {
+		return DB_ALLOCATION_ERROR;
+	}
+
+	first = rel->next_row;
+	result = storage_put_rows(rel, rows, count);
+	if (DB_ERROR(result)) {
+		free(keys);
+		return result;
+	}
+
+	failed = NULL;
+	for (attr = list_head(rel->attributes); attr != NULL; attr = attr->next) {
+		if (attr->index == NULL) {
+			continue;
+		}
+		result = insert_batch_keys(rel, attr, rows, first, count, keys);
+		if (DB_ERROR(result)) {
+			failed = attr;
+			break;
+		}
+	}
+	free(keys);
+
+	if (failed != NULL) {
+		DB_LOG_E("DB: Failed to index attribute %s, rolling back %u rows\n", failed->name, (unsigned)count);
+		for (attr = list_head(rel->attributes); attr != failed->next; attr = attr->next) {
+			if (attr->index != NULL && DB_ERROR(index_truncate(attr->index, first))) {
+				DB_LOG_E("DB: Failed to remove the batch from the index of %s\n", attr->name);
+			}
+		}
+		if (DB_ERROR(storage_truncate_rows(rel, first))) {
+			DB_LOG_E("DB: Failed to remove the batch from %s\n", rel->name);
+		}
+		return result;
+	}
+
+	/* The batch is inserted. An entry not flushed stays dirty in the cache
+	   and is written again when evicted or released. */
+	for (attr = list_head(rel->attributes); attr != NULL; attr = attr->next) {
+		if (attr->index != NULL && DB_ERROR(index_flush(attr->index))) {
+			DB_LOG_E("DB: Failed to flush the index of %s\n", attr->name);
+		}
+	}
+	return DB_OK;
+}
+
 /*
  * Update aggregation value whenever each tuple is read.
  */
@@ -751,7 +889,7 @@ static void relation_delete_index_item(db_handle_t **handle, unsigned char *row_
 	while (from_attr != NULL) {
 		if (from_attr->index != NULL) {
 			if (relation_get_value((*handle)->rel, from_attr, row_ptr, &index_key) == DB_OK) {
-				index_delete(from_attr->index, &index_key);
+				index_delete(from_attr->index, &index_key, (*handle)->tuple_id);
 				if (update_index) { //update with new tuple_id
 					tuple_id = (*handle)->result_rel->cardinality - 1; //cardinality increased when storage_put_row
 					index_insert(from_attr->index, &index_key, tuple_id);
@@ -792,27 +930,39 @@ static db_result_t generate_selection_result(db_handle_t **handle, relation_t *r
 
 	if (DB_ERROR(generate_attribute_map((*handle)->attr_map, attribute_count, rel, result_rel))) {
 		free((*handle)->attr_map);
+		(*handle)->attr_map = NULL;
 		return DB_IMPLEMENTATION_ERROR;
 	}
 
-	if ((*handle)->lvm_instance != NULL) {
-		/* Try to establish acceptable ranges for the attribute values. */
-		if (!LVM_ERROR(lvm_derive((*handle)->lvm_instance))) {
-			select_index(handle);
-		}
-	}
-
 	(*handle)->tuple = (tuple_t)malloc(sizeof(char) * result_rel->row_length + 1);
 	if ((*handle)->tuple == NULL) {
 		DB_LOG_E("DB: Failed to malloc tuple row\n");
 		free((*handle)->attr_map);
+		(*handle)->attr_map = NULL;
 		return DB_ALLOCATION_ERROR;
 	}
 
+	return DB_OK;
+}
+
+/* The ranges depend on the values bound to a prepared statement, so they
+   are derived again each time the selection starts. */
+static void start_selection(db_handle_t **handle)
+{
+	(*handle)->current_row = 0;
+	(*handle)->tuple_id = -1;
+	(*handle)->flags = DB_HANDLE_FLAG_INVALID;
+	memset(&(*handle)->index_iterator, 0, sizeof(index_iterator_t));
+
+	if ((*handle)->lvm_instance != NULL) {
+		/* Try to establish acceptable ranges for the attribute values. */
+		if (!LVM_ERROR(lvm_derive((*handle)->lvm_instance))) {
+			select_index(handle);
+		}
+	}
+
 	/* Set flag to process tuples which need to be read */
 	(*handle)->flags |= DB_HANDLE_FLAG_PROCESSING;
-
-	return DB_OK;
 }
 
 db_result_t relation_process(db_handle_t **handle, db_cursor_t *cursor)
@@ -1166,31 +1316,19 @@ db_cursor_t *relation_process_result(db_handle_t *handler)
 	return NULL;
 }
 
-db_result_t relation_select(db_handle_t **handle, relation_t *rel, void *adt_ptr)
+static db_result_t create_selection_result(db_handle_t **handle, relation_t *rel, aql_adt_t *adt, char *name, db_direction_t dir)
 {
-	aql_adt_t *adt;
-	char *name;
-	db_direction_t dir;
 	char *attribute_name;
 	attribute_t *attr, *attr_ptr;
 	relation_t * res_rel;
 	int i;
 	int normal_attributes = 0;
-	adt = (aql_adt_t *)adt_ptr;
 	(*handle)->rel = rel;
 	(*handle)->optype = AQL_GET_TYPE(adt);
 	DB_LOG_D("relation_select... optype = %d\n", (*handle)->optype);
 	(*handle)->adt_flags = AQL_GET_FLAGS(adt);
 	(*handle)->lvm_instance = (lvm_instance_t *)adt->lvm_instance;
 
-	if (AQL_GET_FLAGS(adt) & AQL_FLAG_ASSIGN) {
-		name = adt->relations[0];
-		dir = DB_STORAGE;
-	} else {
-		name = RESULT_RELATION;
-		dir = DB_MEMORY;
-	}
-
 	res_rel = relation_load(name);
 	relation_remove(res_rel, 1);
 	relation_create(name, dir);
@@ -1271,6 +1409,64 @@ db_result_t relation_select(db_handle_t **handle, relation_t *rel, void *adt_ptr
 	return generate_selection_result(handle, rel);
 }
 
+db_result_t relation_select(db_handle_t **handle, relation_t *rel, void *adt_ptr)
+{
+	aql_adt_t *adt;
+	char *name;
+	db_direction_t dir;
+	db_result_t result;
+
+	adt = (aql_adt_t *)adt_ptr;
+	if (AQL_GET_FLAGS(adt) & AQL_FLAG_ASSIGN) {
+		name = adt->relations[0];
+		dir = DB_STORAGE;
+	} else {
+		name = RESULT_RELATION;
+		dir = DB_MEMORY;
+	}
+
+	result = create_selection_result(handle, rel, adt, name, dir);
+	if (DB_ERROR(result)) {
+		return result;
+	}
+
+	start_selection(handle);
+	return DB_OK;
+}
+
+/* Set up the selection of a prepared statement into its own result relation,
+   which is kept until the statement is finalized. */
+db_result_t relation_prepare_select(db_handle_t **handle, relation_t *rel, void *adt_ptr, char *name)
+{
+	return create_selection_result(handle, rel, (aql_adt_t *)adt_ptr, name, DB_MEMORY);
+}
+
+/* Start the selection prepared by relation_prepare_select() again. */
+db_result_t relation_restart_select(db_handle_t **handle, uint8_t adt_flags)
+{
+	attribute_t *attr;
+
+	for (attr = list_head((*handle)->result_rel->attributes); attr != NULL; attr = attr->next) {
+		switch (attr->aggregator) {
+		case AQL_NONE:
+			break;
+		case AQL_MAX:
+			attr->aggregation_value = LONG_MIN;
+			break;
+		case AQL_MIN:
+			attr->aggregation_value = LONG_MAX;
+			break;
+		default:
+			attr->aggregation_value = 0;
+			break;
+		}
+	}
+	(*handle)->adt_flags = adt_flags;
+
+	start_selection(handle);
+	return DB_OK;
+}
+
 tuple_id_t relation_cardinality(relation_t *rel)
 {
 	tuple_id_t tuple_id;
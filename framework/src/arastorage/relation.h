@@ -192,7 +192,11 @@ db_result_t relation_attribute_remove(relation_t *, char *);
 db_result_t relation_set_primary_key(relation_t *, char *);
 db_result_t relation_remove(relation_t *, int);
 db_result_t relation_insert(relation_t *, attribute_value_t *);
+db_result_t relation_make_row(relation_t *, attribute_value_t *, unsigned char *);
+db_result_t relation_insert_rows(relation_t *, unsigned char *, tuple_id_t);
 db_result_t relation_select(db_handle_t **, relation_t *, void *);
+db_result_t relation_prepare_select(db_handle_t **, relation_t *, void *, char *);
+db_result_t relation_restart_select(db_handle_t **, uint8_t);
 tuple_id_t relation_cardinality(relation_t *);
 
 #endif              /* RELATION_H */
@@ -110,6 +110,15 @@ off_t storage_seek(db_storage_id_t fd, unsigned long offset, int whence)
 	return lseek(fd, offset, whence);
 }
 
+/* It mapped with ftruncate function in specific file system */
+db_result_t storage_truncate(db_storage_id_t fd, unsigned long length)
+{
+	if (ftruncate(fd, (off_t)length) != OK) {
+		return DB_STORAGE_ERROR;
+	}
+	return DB_OK;
+}
+
 /* It mapped with read function in specific file system */
 ssize_t storage_read(db_storage_id_t fd, void *buffer, unsigned length)
 {
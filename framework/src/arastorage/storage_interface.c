@@ -555,6 +555,62 @@ db_result_t storage_put_row(relation_t *rel, storage_row_t row, uint8_t flag)
 	return result;
 }
 
+/* storage_put_rows: Append count rows with a single write, bypassing the
+   write buffer. On failure, the tuple file is cut back to its old size. */
+db_result_t storage_put_rows(relation_t *rel, storage_row_t rows, tuple_id_t count)
+{
+	unsigned length;
+	off_t offset;
+	ssize_t r;
+
+#ifdef CONFIG_ARASTORAGE_ENABLE_WRITE_BUFFER
+	/* Buffered rows of the relation are older, they are written first. */
+	if (DB_ERROR(storage_flush_insert_buffer())) {
+		return DB_STORAGE_ERROR;
+	}
+#endif
+	offset = storage_seek(rel->tuple_storage, 0, SEEK_END);
+	if (offset == (off_t)-1) {
+		return DB_STORAGE_ERROR;
+	}
+
+	length = (unsigned)count * rel->row_length;
+	r = storage_write(rel->tuple_storage, rows, length);
+	if (r != length) {
+		DB_LOG_E("DB: Failed to store %u rows, %d of %u bytes written\n", (unsigned)count, (int)r, length);
+		if (r > 0) {
+			storage_truncate(rel->tuple_storage, offset);
+		}
+		return DB_STORAGE_ERROR;
+	}
+	DB_LOG_D("DB: Stored %u rows of %u bytes\n", (unsigned)count, length);
+
+	rel->cardinality += count;
+	rel->next_row += count;
+	return DB_OK;
+}
+
+/* storage_truncate_rows: Remove the rows from tuple_id on, i.e. those
+   appended by a batch which is rolled back. */
+db_result_t storage_truncate_rows(relation_t *rel, tuple_id_t tuple_id)
+{
+	tuple_id_t nrows;
+
+	if (DB_ERROR(storage_get_row_amount(rel, &nrows))) {
+		return DB_STORAGE_ERROR;
+	}
+	if (tuple_id >= nrows) {
+		return DB_OK;
+	}
+	if (DB_ERROR(storage_truncate(rel->tuple_storage, (unsigned long)tuple_id * rel->row_length))) {
+		return DB_STORAGE_ERROR;
+	}
+
+	rel->cardinality -= nrows - tuple_id;
+	rel->next_row = tuple_id;
+	return DB_OK;
+}
+
 db_result_t storage_write_row(db_storage_id_t fd, storage_row_t row, unsigned length, char *filename)
 {
 #ifdef CONFIG_ARASTORAGE_ENABLE_WRITE_BUFFER
@@ -18,10 +18,15 @@
  /****************************************************************************
  * Included Files
  ****************************************************************************/
+#include <tinyara/config.h>
 #include <debug.h>
+#include <errno.h>
 #include <signal.h>
 #include <queue.h>
+#include <semaphore.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
 #include <unistd.h>
 #include <string.h>
 #include <sys/types.h>
@@ -46,21 +51,84 @@ struct event_node_s {
 };
 typedef struct event_node_s event_node_t;
 
+/* The structure for an event sent to the handlers of its type.
+ * The event data is copied once and shared, the record is freed when the last handler released it.
+ */
+struct event_record_s {
+	int refs;
+	int type;
+	uint64_t sent_us;
+	void *data;
+};
+typedef struct event_record_s event_record_t;
+
 /* The structure which has information of event handle user registered.
  * The handle of event_node_t has it in data field, and use data values when calling callback function.
+ * pending is the latest event which the handler has not got yet, a newer one replaces it.
  */
 struct event_data_s {
 	int type;
 	int pid;
-	int event_in;
+	bool signal;
 	event_callback func;
 	void *cb_data;
-	void *event_data;
+	event_record_t *pending;
 };
 typedef struct event_data_s event_data_t;
 
+struct event_stats_s {
+	unsigned int sent;
+	unsigned int delivered;
+	unsigned int coalesced;
+	unsigned int max_latency_us;
+	uint64_t total_latency_us;
+};
+
 sq_queue_t g_event_list;  // list node type : event_group_t
 
+/* It protects the event list, the pending events of handlers and the statistics.
+ * Events are sent from any task while the handlers get them in the loops of their tasks.
+ */
+static sem_t g_event_sem = SEM_INITIALIZER(1);
+static struct event_stats_s g_event_stats[EL_EVENT_MAX];
+
+static int event_lock(void)
+{
+	while (sem_wait(&g_event_sem) != OK) {
+		if (errno != EINTR) {
+			eldbg("Failed to take event lock %d\n", errno);
+			return ERROR;
+		}
+	}
+
+	return OK;
+}
+
+static void event_unlock(void)
+{
+	sem_post(&g_event_sem);
+}
+
+static uint64_t event_now_us(void)
+{
+	struct timespec ts;
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+	clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* It should be called with event lock. */
+static void event_record_release(event_record_t *record)
+{
+	if (--record->refs == 0) {
+		EL_FREE(record);
+	}
+}
+
 static event_group_t *get_event_group(int type)
 {
 	event_group_t *ptr;
@@ -169,14 +237,17 @@ void eventloop_unregister_event_cb(el_event_t *handle)
 
 	data = (event_data_t *)handle->data;
 
+	if (event_lock() != OK) {
+		return;
+	}
 	event_group = get_event_group(data->type);
 	if (event_group != NULL) {
 		ptr = (event_node_t *)sq_peek(&event_group->event_list);
 		while (ptr != NULL && ptr->handle != NULL) {
 			if (ptr->handle == handle) {
 				sq_rem((FAR sq_entry_t *)ptr, &event_group->event_list);
-				if (data->event_data != NULL) {
-					EL_FREE(data->event_data);
+				if (data->pending != NULL) {
+					event_record_release(data->pending);
 				}
 				EL_FREE(data);
 				EL_FREE(handle);
@@ -190,12 +261,16 @@ void eventloop_unregister_event_cb(el_event_t *handle)
 			EL_FREE(event_group);
 		}
 	}
+	event_unlock();
 }
 
 static void event_callback_func(el_event_t *event, int signum)
 {
 	int ret;
+	uint32_t latency;
 	event_data_t *data = NULL;
+	event_record_t *record;
+	struct event_stats_s *stats;
 
 	if (event == NULL || event->data == NULL) {
 		eldbg("Invalid event callback\n");
@@ -204,66 +279,137 @@ static void event_callback_func(el_event_t *event, int signum)
 
 	data = (event_data_t *)event->data;
 
-	elvdbg("[%d] Event callback!! type : %d\n", getpid(), data->type);
-	if (data->event_in == data->type && data->func) {
-		ret = data->func(data->cb_data, data->event_data);
-		/* It is true if eventloop_loop_stop is called in callback function. */
-		if (LOOP_IS_STOPPED(event->loop)) {
-			return;
-		}
-		/* If callback function returns EVENTLOOP_CALLBACK_STOP, close and unregister the event handler.  */
-		if (ret == EVENTLOOP_CALLBACK_STOP) {
-			uv_close((uv_handle_t *)event, (uv_close_cb)eventloop_unregister_event_cb);
-			return;
+	/* The signal runs the callbacks of all handlers of this task, only the ones with a pending event get it. */
+	if (event_lock() != OK) {
+		return;
+	}
+	record = data->pending;
+	data->pending = NULL;
+	if (record != NULL) {
+		stats = &g_event_stats[record->type];
+		latency = (uint32_t)(event_now_us() - record->sent_us);
+		stats->delivered++;
+		stats->total_latency_us += latency;
+		if (latency > stats->max_latency_us) {
+			stats->max_latency_us = latency;
 		}
 	}
-	if (data->event_data != NULL) {
-		EL_FREE(data->event_data);
+	event_unlock();
+
+	if (record == NULL) {
+		return;
+	}
+
+	elvdbg("[%d] Event callback!! type : %d\n", getpid(), data->type);
+	ret = data->func(data->cb_data, record->data);
+
+	if (event_lock() == OK) {
+		event_record_release(record);
+		event_unlock();
 	}
-	data->event_data = NULL;
-	data->event_in = -1;
 
-	return;
+	/* It is true if eventloop_loop_stop is called in callback function. */
+	if (LOOP_IS_STOPPED(event->loop)) {
+		return;
+	}
+	/* If callback function returns EVENTLOOP_CALLBACK_STOP, close and unregister the event handler.  */
+	if (ret == EVENTLOOP_CALLBACK_STOP) {
+		uv_close((uv_handle_t *)event, (uv_close_cb)eventloop_unregister_event_cb);
+	}
+}
+
+/* It should be called with event lock.
+ * The signal could not be sent to the task, so its handlers will not get the record.
+ */
+static void eventloop_drop_event(event_group_t *event_group, int pid, event_record_t *record)
+{
+	event_node_t *ptr;
+	event_data_t *data;
+
+	ptr = (event_node_t *)sq_peek(&event_group->event_list);
+	while (ptr != NULL && ptr->handle != NULL) {
+		data = (event_data_t *)ptr->handle->data;
+		if (data->pid == pid && data->pending == record) {
+			data->pending = NULL;
+			event_record_release(record);
+		}
+		ptr = (event_node_t *)sq_next(ptr);
+	}
 }
 
 static int eventloop_send_event_sig(int type, void *event_data, int data_size)
 {
 	event_group_t *event_group;
 	event_node_t *ptr;
+	event_node_t *next;
+	event_data_t *data;
+	event_record_t *record;
 
 	if (type < 0 || type >= EL_EVENT_MAX || data_size < 0) {
 		eldbg("Invalid Parameter\n");
 		return EVENTLOOP_INVALID_PARAM;
 	}
 
+	if (event_lock() != OK) {
+		return EVENTLOOP_OPERATION_FAIL;
+	}
+	g_event_stats[type].sent++;
 	event_group = get_event_group(type);
-	if (event_group != NULL) {
-		ptr = (event_node_t *)sq_peek(&event_group->event_list);
-		while (ptr != NULL && ptr->handle != NULL) {
-			event_data_t *cb_data = (event_data_t *)ptr->handle->data;
-			cb_data->event_in = type;
-			if (data_size == 0) {
-				cb_data->event_data = NULL;
-			} else {
-				cb_data->event_data = EL_ALLOC(data_size);
-				if (cb_data->event_data == NULL) {
-					eldbg("Failed to allocate callback info\n");
-					return EVENTLOOP_OUT_OF_MEMORY;
+	if (event_group == NULL || sq_empty(&event_group->event_list)) {
+		event_unlock();
+		return OK;
+	}
+
+	/* One copy of event data is shared by all handlers */
+	record = (event_record_t *)EL_ALLOC(sizeof(event_record_t) + data_size);
+	if (record == NULL) {
+		event_unlock();
+		eldbg("Failed to allocate event record\n");
+		return EVENTLOOP_OUT_OF_MEMORY;
+	}
+	record->refs = 0;
+	record->type = type;
+	record->data = NULL;
+	if (data_size > 0) {
+		record->data = (void *)(record + 1);
+		memcpy(record->data, event_data, data_size);
+	}
+	record->sent_us = event_now_us();
+
+	/* A handler which has a pending event was signaled already and not run yet.
+	 * The new event replaces the pending one, the handler gets only the latest.
+	 */
+	ptr = (event_node_t *)sq_peek(&event_group->event_list);
+	while (ptr != NULL && ptr->handle != NULL) {
+		data = (event_data_t *)ptr->handle->data;
+		data->signal = (data->pending == NULL);
+		if (data->pending != NULL) {
+			event_record_release(data->pending);
+			g_event_stats[type].coalesced++;
+		}
+		data->pending = record;
+		record->refs++;
+		ptr = (event_node_t *)sq_next(ptr);
+	}
+
+	/* Send signal once to each task which registered event, it runs the callbacks of all its handlers */
+	ptr = (event_node_t *)sq_peek(&event_group->event_list);
+	while (ptr != NULL && ptr->handle != NULL) {
+		data = (event_data_t *)ptr->handle->data;
+		if (data->signal) {
+			for (next = (event_node_t *)sq_next(ptr); next != NULL && next->handle != NULL; next = (event_node_t *)sq_next(next)) {
+				if (((event_data_t *)next->handle->data)->pid == data->pid) {
+					((event_data_t *)next->handle->data)->signal = false;
 				}
-				memcpy(cb_data->event_data, event_data, data_size);
 			}
-			/* Send signal to task which registered event */
-			int ret = kill(cb_data->pid, SIGEL_EVENT);
-			if (ret < 0) {
+			if (kill(data->pid, SIGEL_EVENT) < 0) {
 				eldbg("kill failed %d \n", errno);
-				if (cb_data->event_data != NULL) {
-					EL_FREE(cb_data->event_data);
-					cb_data->event_data = NULL;
-				}
+				eventloop_drop_event(event_group, data->pid, record);
 			}
-			ptr = (event_node_t *)sq_next(ptr);
 		}
+		ptr = (event_node_t *)sq_next(ptr);
 	}
+	event_unlock();
 
 	return OK;
 }
@@ -301,10 +447,10 @@ el_event_t *eventloop_add_event_handler(int type, event_callback func, void *dat
 
 	event_cb->type = type;
 	event_cb->pid = getpid();
-	event_cb->event_in = -1;
+	event_cb->signal = false;
 	event_cb->func = func;
 	event_cb->cb_data = data;
-	event_cb->event_data = NULL;
+	event_cb->pending = NULL;
 	handle->data = (void *)event_cb;
 
 	ret = uv_signal_init(loop, handle);
@@ -320,7 +466,12 @@ el_event_t *eventloop_add_event_handler(int type, event_callback func, void *dat
 	}
 
 	/* Add event handle to a list of handles */
+	if (event_lock() != OK) {
+		uv_close((uv_handle_t *)handle, NULL);
+		goto errout;
+	}
 	ret = eventloop_register_event_cb(handle);
+	event_unlock();
 	if (ret != OK) {
 		eldbg("Failed to register signal for event\n");
 		uv_close((uv_handle_t *)handle, NULL);
@@ -343,9 +494,14 @@ int eventloop_del_event_handler(el_event_t *handle)
 		return EVENTLOOP_INVALID_PARAM;
 	}
 
+	if (event_lock() != OK) {
+		return EVENTLOOP_OPERATION_FAIL;
+	}
 	if (!is_registered_event_cb(handle) || uv__is_closing(handle)) {
+		event_unlock();
 		return EVENTLOOP_INVALID_HANDLE;
 	}
+	event_unlock();
 
 	uv_close((uv_handle_t *)handle, (uv_close_cb)eventloop_unregister_event_cb);
 
@@ -361,3 +517,26 @@ int eventloop_send_event(int type, void *event_data, int data_size)
 
 	return eventloop_send_event_sig(type, event_data, data_size);
 }
+
+int eventloop_get_event_stats(int type, el_event_stats_t *stats)
+{
+	struct event_stats_s *type_stats;
+
+	if (type < 0 || type >= EL_EVENT_MAX || stats == NULL) {
+		eldbg("Invalid Parameter\n");
+		return EVENTLOOP_INVALID_PARAM;
+	}
+
+	if (event_lock() != OK) {
+		return EVENTLOOP_OPERATION_FAIL;
+	}
+	type_stats = &g_event_stats[type];
+	stats->sent = type_stats->sent;
+	stats->delivered = type_stats->delivered;
+	stats->coalesced = type_stats->coalesced;
+	stats->avg_latency_us = type_stats->delivered ? (unsigned int)(type_stats->total_latency_us / type_stats->delivered) : 0;
+	stats->max_latency_us = type_stats->max_latency_us;
+	event_unlock();
+
+	return OK;
+}
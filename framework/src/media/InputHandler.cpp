@@ -130,12 +130,24 @@ void InputHandler::resetWorker()
 
 bool InputHandler::processWorker()
 {
-	size_t size = getAvailSpace();
+	unsigned char *buf = nullptr;
+	size_t size;
+
+	// PCM needs no demuxing or decoding, so read it from source into stream buffer in place.
+	bool inPlace = (!mDemuxer && !mDecoder);
+	if (inPlace) {
+		size = mBufferWriter->acquireWrite(&buf, false);
+	} else {
+		size = getAvailSpace();
+	}
+
 	if (size > 0) {
-		auto buf = new unsigned char[size];
-		if (!buf) {
-			meddbg("run out of memory! size: 0x%x\n", size);
-			return false;
+		if (!inPlace) {
+			buf = new unsigned char[size];
+			if (!buf) {
+				meddbg("run out of memory! size: 0x%x\n", size);
+				return false;
+			}
 		}
 
 		ssize_t readLen = readFromSource(buf, size);
@@ -143,7 +155,9 @@ bool InputHandler::processWorker()
 			// Error occurred, or inputting finished
 			if (!mIsLooping) {
 				mBufferWriter->setEndOfStream();
-				delete[] buf;
+				if (!inPlace) {
+					delete[] buf;
+				}
 				return false;
 
 			}
@@ -160,8 +174,13 @@ bool InputHandler::processWorker()
 			readLen = size;
 		}
 
-		ssize_t writeLen = writeToStreamBuffer(buf, (size_t)readLen);
-		delete[] buf;
+		ssize_t writeLen;
+		if (inPlace) {
+			writeLen = (readLen > 0) ? (ssize_t)mBufferWriter->commitWrite((size_t)readLen) : readLen;
+		} else {
+			writeLen = writeToStreamBuffer(buf, (size_t)readLen);
+			delete[] buf;
+		}
 		if (writeLen <= 0) {
 			meddbg("write to stream buffer failed!\n");
 			mBufferWriter->setEndOfStream();
@@ -187,8 +206,8 @@ void InputHandler::sleepWorker()
 
 void InputHandler::setBufferState(buffer_state_t state)
 {
-	if (mState != state) {
-		mState = state;
+	// Buffer updates come from both writer and reader side without a lock.
+	if (mState.exchange(state) != state) {
 		if (state >= BUFFER_STATE_BUFFERED) {
 			// Notify buffering done
 			std::unique_lock<std::mutex> lock(mMutex);
@@ -235,15 +254,16 @@ void InputHandler::onBufferUpdated(ssize_t change, size_t current)
 	}
 
 	if (change > 0) {
-		mTotalBytes += change;
-		if (mTotalBytes > INT_MAX) {
+		size_t totalBytes = mTotalBytes.fetch_add((size_t)change) + (size_t)change;
+		if (totalBytes > INT_MAX) {
+			meddbg("Too huge value: %u, set 0 to prevent overflow\n", totalBytes);
 			mTotalBytes = 0;
-			meddbg("Too huge value: %u, set 0 to prevent overflow\n", mTotalBytes);
+			totalBytes = 0;
 		}
 
 		auto mp = getPlayer();
 		if (mp) {
-			mp->notifyObserver(PLAYER_OBSERVER_COMMAND_BUFFER_UPDATED, mTotalBytes);
+			mp->notifyObserver(PLAYER_OBSERVER_COMMAND_BUFFER_UPDATED, totalBytes);
 		}
 	}
 }
@@ -87,8 +87,8 @@ private:
 	std::shared_ptr<Demuxer> mDemuxer;
 	std::weak_ptr<MediaPlayerImpl> mPlayer;
 	std::atomic<bool> mIsLooping;
-	buffer_state_t mState;
-	size_t mTotalBytes;
+	std::atomic<buffer_state_t> mState;
+	std::atomic<size_t> mTotalBytes;
 };
 } // namespace stream
 } // namespace media
@@ -134,7 +134,7 @@ void MediaPlayerImpl::destroyPlayer(player_result_t &ret)
 void MediaPlayerImpl::dequeueAndRunObserverCallback()
 {
 	if (!mObserverQueue.isEmpty()) {
-		std::function<void()> run = mObserverQueue.deQueue();
+		MediaTask run = mObserverQueue.deQueue();
 		if (run != nullptr) {
 			run();
 		}
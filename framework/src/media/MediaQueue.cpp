@@ -16,39 +16,134 @@
  *
  ******************************************************************/
 
+#include <time.h>
+#include <string.h>
 #include "MediaQueue.h"
 
 namespace media {
-MediaQueue::MediaQueue()
+
+#ifdef CONFIG_MEDIA_QUEUE_STATS
+static uint64_t getTimeUs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+#endif
+
+MediaQueue::MediaQueue() : mHead(0), mCount(0), mWaiting(false)
 {
+	memset(&mStats, 0, sizeof(mStats));
+#ifdef CONFIG_MEDIA_QUEUE_STATS
+	mTotalLatencyUs = 0;
+	mDequeued = 0;
+#endif
 }
 MediaQueue::~MediaQueue()
 {
 }
 
-std::function<void()> MediaQueue::deQueue()
+void MediaQueue::push(MediaTask &&task)
+{
+	std::unique_lock<std::mutex> lock(mQueueMtx);
+	Slot *slot;
+
+	// Once tasks overflowed, keep appending there until it drains to keep them in order.
+	if (mCount < CONFIG_MEDIA_QUEUE_DEPTH && mOverflow.empty()) {
+		slot = &mSlots[(mHead + mCount) % CONFIG_MEDIA_QUEUE_DEPTH];
+		mCount++;
+	} else {
+		mOverflow.emplace_back();
+		slot = &mOverflow.back();
+		mStats.overflows++;
+	}
+	slot->task = std::move(task);
+#ifdef CONFIG_MEDIA_QUEUE_STATS
+	slot->enqueuedUs = getTimeUs();
+#endif
+
+	mStats.enqueued++;
+	mStats.depth = mCount + mOverflow.size();
+	if (mStats.depth > mStats.maxDepth) {
+		mStats.maxDepth = mStats.depth;
+	}
+
+	// Wake up the consumer only if it sleeps, and only once until it runs again.
+	if (mWaiting) {
+		mWaiting = false;
+		lock.unlock();
+		mQueueCv.notify_one();
+	}
+}
+
+MediaTask MediaQueue::deQueue()
 {
 	std::unique_lock<std::mutex> lock(mQueueMtx);
-	if (mQueueData.empty()) {
+	while (mCount == 0 && mOverflow.empty()) {
+		mWaiting = true;
 		mQueueCv.wait(lock);
 	}
+	mWaiting = false;
+
+	// Overflowed tasks are always younger than the ones in the slots.
+	bool fromOverflow = (mCount == 0);
+	Slot &slot = fromOverflow ? mOverflow.front() : mSlots[mHead];
+	MediaTask task(std::move(slot.task));
+#ifdef CONFIG_MEDIA_QUEUE_STATS
+	uint32_t latency = (uint32_t)(getTimeUs() - slot.enqueuedUs);
+	if (latency > mStats.maxLatencyUs) {
+		mStats.maxLatencyUs = latency;
+	}
+	mTotalLatencyUs += latency;
+	mDequeued++;
+#endif
 
-	auto data = std::move(mQueueData.front());
-	mQueueData.pop();
-	return data;
+	if (fromOverflow) {
+		mOverflow.pop_front();
+	} else {
+		mHead = (mHead + 1) % CONFIG_MEDIA_QUEUE_DEPTH;
+		mCount--;
+	}
+	mStats.depth = mCount + mOverflow.size();
+
+	return task;
 }
 
 bool MediaQueue::isEmpty()
 {
 	std::unique_lock<std::mutex> lock(mQueueMtx);
-	return mQueueData.empty();
+	return mCount == 0 && mOverflow.empty();
+}
+
+void MediaQueue::clear(void)
+{
+	while (mCount > 0) {
+		mSlots[mHead].task.reset();
+		mHead = (mHead + 1) % CONFIG_MEDIA_QUEUE_DEPTH;
+		mCount--;
+	}
+	mOverflow.clear();
+	mHead = 0;
 }
 
 void MediaQueue::clearQueue(void)
 {
 	std::unique_lock<std::mutex> lock(mQueueMtx);
-   	std::queue<std::function<void()>> empty;
-	empty.push(std::move(std::function<void()>())); //push an empty function so, that pop() in dequeue will not crash if called after clearQueue().
-   	std::swap(mQueueData, empty);
+	clear();
+	// Leave an empty task so that deQueue() called after clearQueue() does not block.
+	mCount = 1;
+	mStats.depth = 1;
+#ifdef CONFIG_MEDIA_QUEUE_STATS
+	mSlots[0].enqueuedUs = getTimeUs();
+#endif
+}
+
+void MediaQueue::getStats(MediaQueueStats &stats)
+{
+	std::unique_lock<std::mutex> lock(mQueueMtx);
+	stats = mStats;
+#ifdef CONFIG_MEDIA_QUEUE_STATS
+	stats.avgLatencyUs = mDequeued > 0 ? (uint32_t)(mTotalLatencyUs / mDequeued) : 0;
+#endif
 }
 } // namespace media
@@ -19,14 +19,128 @@
 #ifndef __MEDIA_QUEUE_H
 #define __MEDIA_QUEUE_H
 
+#include <tinyara/config.h>
+#include <stdint.h>
 #include <mutex>
 #include <condition_variable>
-#include <queue>
+#include <deque>
 #include <atomic>
 #include <iostream>
 #include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifndef CONFIG_MEDIA_QUEUE_DEPTH
+#define CONFIG_MEDIA_QUEUE_DEPTH 8
+#endif
+
+#ifndef CONFIG_MEDIA_QUEUE_TASK_WORDS
+#define CONFIG_MEDIA_QUEUE_TASK_WORDS 12
+#endif
 
 namespace media {
+/**
+ * A callable without arguments, stored in place instead of on the heap.
+ * Callables larger than CONFIG_MEDIA_QUEUE_TASK_WORDS words fail to build.
+ */
+class MediaTask
+{
+public:
+	MediaTask() : mOps(nullptr) {}
+	template <typename _Fn, typename _Decayed = typename std::decay<_Fn>::type,
+			  typename = typename std::enable_if<!std::is_same<_Decayed, MediaTask>::value>::type>
+	explicit MediaTask(_Fn &&__fn) : mOps(&Ops<_Decayed>::ops) {
+		static_assert(sizeof(_Decayed) <= sizeof(mStorage), "Task is too large, increase CONFIG_MEDIA_QUEUE_TASK_WORDS");
+		static_assert(alignof(_Decayed) <= alignof(Storage), "Task is overaligned");
+		new (&mStorage) _Decayed(std::forward<_Fn>(__fn));
+	}
+	MediaTask(MediaTask &&other) : mOps(nullptr) {
+		*this = std::move(other);
+	}
+	MediaTask &operator=(MediaTask &&other) {
+		if (this != &other) {
+			reset();
+			if (other.mOps) {
+				other.mOps->move(&mStorage, &other.mStorage);
+				mOps = other.mOps;
+				other.mOps = nullptr;
+			}
+		}
+		return *this;
+	}
+	MediaTask(const MediaTask &) = delete;
+	MediaTask &operator=(const MediaTask &) = delete;
+	~MediaTask() {
+		reset();
+	}
+
+	void reset() {
+		if (mOps) {
+			mOps->destroy(&mStorage);
+			mOps = nullptr;
+		}
+	}
+	void operator()() {
+		mOps->invoke(&mStorage);
+	}
+	bool operator==(std::nullptr_t) const {
+		return mOps == nullptr;
+	}
+	bool operator!=(std::nullptr_t) const {
+		return mOps != nullptr;
+	}
+
+private:
+	typedef typename std::aligned_storage<CONFIG_MEDIA_QUEUE_TASK_WORDS * sizeof(void *)>::type Storage;
+
+	struct TaskOps {
+		void (*invoke)(void *);
+		void (*move)(void *, void *);
+		void (*destroy)(void *);
+	};
+	template <typename _Fn>
+	struct Ops {
+		static void invoke(void *p) {
+			(*static_cast<_Fn *>(p))();
+		}
+		static void move(void *dst, void *src) {
+			new (dst) _Fn(std::move(*static_cast<_Fn *>(src)));
+			static_cast<_Fn *>(src)->~_Fn();
+		}
+		static void destroy(void *p) {
+			static_cast<_Fn *>(p)->~_Fn();
+		}
+		static const TaskOps ops;
+	};
+
+	const TaskOps *mOps;
+	Storage mStorage;
+};
+
+template <typename _Fn>
+const MediaTask::TaskOps MediaTask::Ops<_Fn>::ops = {
+	&MediaTask::Ops<_Fn>::invoke,
+	&MediaTask::Ops<_Fn>::move,
+	&MediaTask::Ops<_Fn>::destroy,
+};
+
+struct MediaQueueStats {
+	size_t depth;				/* Tasks waiting now */
+	size_t maxDepth;			/* Most tasks ever waiting at once */
+	size_t overflows;			/* Tasks which did not fit in the preallocated slots */
+	uint32_t enqueued;			/* Tasks enqueued so far */
+#ifdef CONFIG_MEDIA_QUEUE_STATS
+	uint32_t avgLatencyUs;		/* Average time from enQueue() to deQueue() */
+	uint32_t maxLatencyUs;		/* Worst time from enQueue() to deQueue() */
+#endif
+};
+
+/**
+ * FIFO of tasks for a media worker. Tasks are kept in CONFIG_MEDIA_QUEUE_DEPTH
+ * preallocated slots, so enqueueing allocates nothing unless the slots are all
+ * taken. The consumer is woken up once per wait, not once per task.
+ */
 class MediaQueue
 {
 public:
@@ -34,17 +148,34 @@ public:
 	~MediaQueue();
 	template <typename _Callable, typename... _Args>
 	void enQueue(_Callable &&__f, _Args &&... __args) {
-		std::unique_lock<std::mutex> lock(mQueueMtx);
-		std::function<void()> func = std::bind(std::forward<_Callable>(__f), std::forward<_Args>(__args)...);
-		mQueueData.push(func);
-		mQueueCv.notify_one();
+		push(MediaTask(std::bind(std::forward<_Callable>(__f), std::forward<_Args>(__args)...)));
 	}
-	std::function<void()> deQueue();
+	MediaTask deQueue();
 	bool isEmpty();
 	void clearQueue(void);
+	void getStats(MediaQueueStats &stats);
 
 private:
-	std::queue<std::function<void()>> mQueueData;
+	struct Slot {
+		MediaTask task;
+#ifdef CONFIG_MEDIA_QUEUE_STATS
+		uint64_t enqueuedUs;
+#endif
+	};
+
+	void push(MediaTask &&task);
+	void clear(void);
+
+	Slot mSlots[CONFIG_MEDIA_QUEUE_DEPTH];
+	size_t mHead;
+	size_t mCount;
+	std::deque<Slot> mOverflow;
+	bool mWaiting;
+	MediaQueueStats mStats;
+#ifdef CONFIG_MEDIA_QUEUE_STATS
+	uint64_t mTotalLatencyUs;
+	uint32_t mDequeued;
+#endif
 	std::condition_variable mQueueCv;
 	std::mutex mQueueMtx;
 };
@@ -130,7 +130,7 @@ void MediaRecorderImpl::destroyRecorder(recorder_result_t& ret)
 void MediaRecorderImpl::dequeueAndRunObserverCallback()
 {
 	if (!mObserverQueue.isEmpty()) {
-		std::function<void()> run = mObserverQueue.deQueue();
+		MediaTask run = mObserverQueue.deQueue();
 		if (run != nullptr) {
 			run();
 		}
@@ -99,10 +99,16 @@ void MediaWorker::stopWorker()
 			pthread_join(mWorkerThread, NULL);
 			meddbg("%s::stopWorker() - mWorkerthread exited\n", mThreadName);
 		}
+#ifdef CONFIG_MEDIA_QUEUE_STATS
+		MediaQueueStats stats;
+		mWorkerQueue.getStats(stats);
+		meddbg("%s queue - enqueued: %u max depth: %u overflows: %u latency avg: %uus max: %uus\n", mThreadName,
+			   stats.enqueued, stats.maxDepth, stats.overflows, stats.avgLatencyUs, stats.maxLatencyUs);
+#endif
 	}
 }
 
-std::function<void()> MediaWorker::deQueue()
+MediaTask MediaWorker::deQueue()
 {
 	return mWorkerQueue.deQueue();
 }
@@ -126,7 +132,7 @@ void *MediaWorker::mediaLooper(void *arg)
 			pthread_yield();
 		}
 
-		std::function<void()> run = worker->deQueue();
+		MediaTask run = worker->deQueue();
 		medvdbg("MediaWorker : deQueue\n");
 		if (run != nullptr) {
 			run();
@@ -152,4 +158,9 @@ void MediaWorker::clearQueue(void)
 {
 	mWorkerQueue.clearQueue();
 }
+
+void MediaWorker::getQueueStats(MediaQueueStats &stats)
+{
+	mWorkerQueue.getStats(stats);
+}
 } // namespace media
@@ -37,12 +37,13 @@ public:
 
 	template <typename _Callable, typename... _Args>
 	void enQueue(_Callable &&__f, _Args &&... __args) {
-		mWorkerQueue.enQueue(__f, __args...);
+		mWorkerQueue.enQueue(std::forward<_Callable>(__f), std::forward<_Args>(__args)...);
 	}
-	std::function<void()> deQueue();
+	MediaTask deQueue();
 	bool isAlive();
 	bool isSameThread();
 	void clearQueue(void);
+	void getQueueStats(MediaQueueStats &stats);
 
 protected:
 	long mStacksize;
@@ -46,7 +46,7 @@ namespace media {
 namespace stream {
 
 StreamBuffer::StreamBuffer(size_t bufferSize, size_t threshold)
-	: mObserver(nullptr), mEOS(false), mBufferSize(bufferSize), mThreshold(threshold)
+	: mObserver(nullptr), mEOS(false), mWaiters(0), mBufferSize(bufferSize), mThreshold(threshold)
 {
 	mRingBuf.buf = nullptr;
 	mRingBuf.depth = 0;
@@ -92,6 +92,56 @@ size_t StreamBuffer::write(unsigned char *buf, size_t size)
 	return rb_write(&mRingBuf, buf, size);
 }
 
+size_t StreamBuffer::acquireWrite(unsigned char **buf)
+{
+	return rb_write_ptr(&mRingBuf, (void **)buf);
+}
+
+size_t StreamBuffer::commitWrite(size_t size)
+{
+	return rb_write_commit(&mRingBuf, size);
+}
+
+size_t StreamBuffer::peekRead(const unsigned char **buf)
+{
+	return rb_read_ptr(&mRingBuf, (const void **)buf);
+}
+
+size_t StreamBuffer::consumeRead(size_t size)
+{
+	return rb_read_commit(&mRingBuf, size);
+}
+
+void StreamBuffer::waitForData(std::unique_lock<std::mutex> &lock)
+{
+	// Count as waiter before checking, wakeUp() checks in the reverse order.
+	mWaiters++;
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	while (rb_used(&mRingBuf) == 0 && !mEOS) {
+		mCondv.wait(lock);
+	}
+	mWaiters--;
+}
+
+void StreamBuffer::waitForSpace(std::unique_lock<std::mutex> &lock)
+{
+	mWaiters++;
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	while (rb_avail(&mRingBuf) == 0 && !mEOS) {
+		mCondv.wait(lock);
+	}
+	mWaiters--;
+}
+
+void StreamBuffer::wakeUp()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (mWaiters.load(std::memory_order_relaxed) > 0) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mCondv.notify_all();
+	}
+}
+
 size_t StreamBuffer::sizeOfSpace()
 {
 	return rb_avail(&mRingBuf);
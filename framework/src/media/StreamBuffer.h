@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <mutex>
+#include <atomic>
 #include <condition_variable>
 #include "utils/rb.h"
 
@@ -87,6 +88,38 @@ public:
 	 * Write(push) data into stream buffer.
 	 */
 	size_t write(unsigned char *buf, size_t size);
+	/**
+	 * Get the contiguous free space at the write position, to be filled in
+	 * place and then published by commitWrite().
+	 * The zero-copy APIs below are lock-free for one writer and one reader.
+	 */
+	size_t acquireWrite(unsigned char **buf);
+	/**
+	 * Publish data written in place after acquireWrite().
+	 */
+	size_t commitWrite(size_t size);
+	/**
+	 * Get the contiguous data at the read position, to be used in place and
+	 * then released by consumeRead().
+	 */
+	size_t peekRead(const unsigned char **buf);
+	/**
+	 * Release data used in place after peekRead().
+	 */
+	size_t consumeRead(size_t size);
+	/**
+	 * Block until data is available or end-of-stream, with 'lock' held.
+	 */
+	void waitForData(std::unique_lock<std::mutex> &lock);
+	/**
+	 * Block until space is available or end-of-stream, with 'lock' held.
+	 */
+	void waitForSpace(std::unique_lock<std::mutex> &lock);
+	/**
+	 * Wake up the other side blocked in waitForData() or waitForSpace().
+	 * Mutex is taken only if someone is waiting.
+	 */
+	void wakeUp();
 	/**
 	 * Get bytes of data available in stream buffer.
 	 */
@@ -111,7 +144,8 @@ private:
 	std::condition_variable mCondv;
 	BufferObserverInterface *mObserver;
 	rb_t mRingBuf;
-	bool mEOS;
+	std::atomic<bool> mEOS;
+	std::atomic<int> mWaiters;
 	size_t mBufferSize;
 	size_t mThreshold;
 };
@@ -69,7 +69,7 @@ size_t StreamBufferReader::read(unsigned char *buf, size_t size, bool sync, std:
 				// Writer may be waiting for more spaces, so it's necessary to notify after reading.
 				mStream->getCondv().notify_one();
 				// Then wait notification from writer.
-				mStream->getCondv().wait(lock);
+				mStream->waitForData(lock);
 				/* Below Logic Need to be improved. Should we apply only timeout? */
 #if 0
 				if (timeout == std::chrono::microseconds(0)) {
@@ -97,6 +97,39 @@ size_t StreamBufferReader::read(unsigned char *buf, size_t size, bool sync, std:
 	return rlen;
 }
 
+size_t StreamBufferReader::peekRead(const unsigned char **buf, bool sync)
+{
+	size_t len = mStream->peekRead(buf);
+	if (len == 0 && sync) {
+		if (!mStream->isEndOfStream()) {
+			// Notify observer, shouldn't be blocked.
+			mStream->notifyObserver(StreamBuffer::State::UNDERRUN);
+		}
+
+		// Mutex is only for waiting, reading itself is lock-free.
+		std::unique_lock<std::mutex> lock(mStream->getMutex());
+		mStream->waitForData(lock);
+		lock.unlock();
+
+		len = mStream->peekRead(buf);
+	}
+
+	medvdbg("peek %lu\n", len);
+	return len;
+}
+
+size_t StreamBufferReader::consumeRead(size_t size)
+{
+	size_t len = mStream->consumeRead(size);
+	mStream->notifyObserver(StreamBuffer::State::UPDATED, -((ssize_t) len));
+
+	// Writer may be waiting for more spaces.
+	mStream->wakeUp();
+
+	medvdbg("consumed %lu\n", len);
+	return len;
+}
+
 size_t StreamBufferReader::sizeOfData()
 {
 	std::lock_guard<std::mutex> lock(mStream->getMutex());
@@ -34,6 +34,14 @@ public:
 	virtual size_t copy(unsigned char *buf, size_t size, size_t offset = 0);
 	virtual size_t read(unsigned char *buf, size_t size, bool sync = true, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 	virtual size_t sizeOfData();
+	/**
+	 * Get the contiguous data at the read position to be used in place,
+	 * release it with consumeRead(). The data may be less than sizeOfData()
+	 * when it wraps around the end of the buffer.
+	 * If sync is true, block until data is available or end-of-stream.
+	 */
+	virtual size_t peekRead(const unsigned char **buf, bool sync = true);
+	virtual size_t consumeRead(size_t size);
 
 public:
 	bool isEndOfStream();
@@ -61,7 +61,7 @@ size_t StreamBufferWriter::write(unsigned char *buf, size_t size, bool sync)
 				// Reader may be waiting for more data, so it's necessary to notify after writing.
 				mStream->getCondv().notify_one();
 				// Then wait notification from reader.
-				mStream->getCondv().wait(lock);
+				mStream->waitForSpace(lock);
 			}
 		}
 	} else {
@@ -76,6 +76,47 @@ size_t StreamBufferWriter::write(unsigned char *buf, size_t size, bool sync)
 	return wlen;
 }
 
+size_t StreamBufferWriter::acquireWrite(unsigned char **buf, bool sync)
+{
+	// Streaming may be stopped (EOS was set)
+	if (mStream->isEndOfStream()) {
+		medvdbg("EOS break\n");
+		return 0;
+	}
+
+	size_t len = mStream->acquireWrite(buf);
+	if (len == 0 && sync) {
+		// Notify observer, shouldn't be blocked.
+		mStream->notifyObserver(StreamBuffer::State::OVERRUN);
+
+		// Mutex is only for waiting, writing itself is lock-free.
+		std::unique_lock<std::mutex> lock(mStream->getMutex());
+		mStream->waitForSpace(lock);
+		lock.unlock();
+
+		if (mStream->isEndOfStream()) {
+			medvdbg("EOS break\n");
+			return 0;
+		}
+		len = mStream->acquireWrite(buf);
+	}
+
+	medvdbg("acquired %lu\n", len);
+	return len;
+}
+
+size_t StreamBufferWriter::commitWrite(size_t size)
+{
+	size_t len = mStream->commitWrite(size);
+	mStream->notifyObserver(StreamBuffer::State::UPDATED, (ssize_t) len);
+
+	// Reader may be waiting for more data.
+	mStream->wakeUp();
+
+	medvdbg("committed %lu\n", len);
+	return len;
+}
+
 size_t StreamBufferWriter::sizeOfSpace()
 {
 	std::lock_guard<std::mutex> lock(mStream->getMutex());
@@ -89,8 +130,8 @@ void StreamBufferWriter::setEndOfStream()
 	// Set EOS flag in stream.
 	mStream->setEndOfStream();
 
-	// Reader may be waiting for more data, so it's necessary to notify.
-	mStream->getCondv().notify_one();
+	// Reader (or writer blocked in acquireWrite) may be waiting, so it's necessary to notify.
+	mStream->getCondv().notify_all();
 }
 
 } // namespace stream
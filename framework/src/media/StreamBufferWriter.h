@@ -33,6 +33,14 @@ public:
 public:
 	virtual size_t write(unsigned char *buf, size_t size, bool sync = true);
 	virtual size_t sizeOfSpace();
+	/**
+	 * Get the contiguous free space at the write position to be filled in
+	 * place, publish it with commitWrite(). The space may be less than
+	 * sizeOfSpace() when it wraps around the end of the buffer.
+	 * If sync is true, block until space is available or end-of-stream.
+	 */
+	virtual size_t acquireWrite(unsigned char **buf, bool sync = true);
+	virtual size_t commitWrite(size_t size);
 
 public:
 	void setEndOfStream();
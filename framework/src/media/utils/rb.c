@@ -27,6 +27,13 @@
 #define IS_EMPTY(rbp) (rbp->rd_idx == rbp->wr_idx)
 #define IS_FULL(rbp) ((rbp->rd_idx & IDX_MASK) == (rbp->wr_idx & IDX_MASK) && (rbp->rd_idx & MSB_MASK) != (rbp->wr_idx & MSB_MASK))
 
+/* The producer owns wr_idx and the consumer owns rd_idx. Loading the index
+ * of the other side with acquire, and storing its own with release, orders
+ * the buffer contents against the index, so one producer and one consumer
+ * need no lock.
+ */
+#define LOAD_IDX(idx) __atomic_load_n(&(idx), __ATOMIC_ACQUIRE)
+
 /**
  * @brief  Increase the buffer index while writing or reading the ring-buffer.
  *         This is implemented according to the 'mirroring' solution:
@@ -38,6 +45,15 @@
  */
 static void _incr(rb_p rbp, volatile size_t *p_idx, size_t len);
 
+/**
+ * @brief  Get data bytes between a snapshot of the read and write indexes.
+ *
+ * @param  rbp: Pointer to the ring-buffer
+ * @param  rd_idx: Read index including the 'mirror' flag
+ * @param  wr_idx: Write index including the 'mirror' flag
+ */
+static size_t _used(rb_p rbp, size_t rd_idx, size_t wr_idx);
+
 bool rb_init(rb_p rbp, size_t size)
 {
 	RETURN_VAL_IF_FAIL(rbp != NULL, false);
@@ -64,18 +80,11 @@ size_t rb_used(rb_p rbp)
 {
 	RETURN_VAL_IF_FAIL(rbp != NULL, SIZE_ZERO);
 
-	if (IS_EMPTY(rbp)) {
-		return SIZE_ZERO;
-	}
-
-	size_t wr_idx = (rbp->wr_idx & IDX_MASK);
-	size_t rd_idx = (rbp->rd_idx & IDX_MASK);
-
-	if (wr_idx > rd_idx) {
-		return (wr_idx - rd_idx);
-	}
+	// Take one snapshot of each index, the other side may move it meanwhile.
+	size_t rd_idx = LOAD_IDX(rbp->rd_idx);
+	size_t wr_idx = LOAD_IDX(rbp->wr_idx);
 
-	return (rbp->depth - (rd_idx - wr_idx));
+	return _used(rbp, rd_idx, wr_idx);
 }
 
 size_t rb_avail(rb_p rbp)
@@ -155,6 +164,52 @@ size_t rb_read_ext(rb_p rbp, void *ptr, size_t len, size_t offset)
 	return len;
 }
 
+size_t rb_write_ptr(rb_p rbp, void **ptr)
+{
+	RETURN_VAL_IF_FAIL(rbp != NULL, SIZE_ZERO);
+	RETURN_VAL_IF_FAIL(ptr != NULL, SIZE_ZERO);
+
+	size_t wr_idx = rbp->wr_idx;
+	size_t avail = rbp->depth - _used(rbp, LOAD_IDX(rbp->rd_idx), wr_idx);
+
+	// Free space may wrap around, give only the part up to the end of buffer.
+	wr_idx = (wr_idx & IDX_MASK);
+	*ptr = (void *)((uint8_t *)rbp->buf + wr_idx);
+	return MINIMUM(avail, (rbp->depth - wr_idx));
+}
+
+size_t rb_write_commit(rb_p rbp, size_t len)
+{
+	RETURN_VAL_IF_FAIL(rbp != NULL, SIZE_ZERO);
+
+	len = MINIMUM(len, rb_avail(rbp));
+	_incr(rbp, &rbp->wr_idx, len);
+	return len;
+}
+
+size_t rb_read_ptr(rb_p rbp, const void **ptr)
+{
+	RETURN_VAL_IF_FAIL(rbp != NULL, SIZE_ZERO);
+	RETURN_VAL_IF_FAIL(ptr != NULL, SIZE_ZERO);
+
+	size_t rd_idx = rbp->rd_idx;
+	size_t used = _used(rbp, rd_idx, LOAD_IDX(rbp->wr_idx));
+
+	// Data may wrap around, give only the part up to the end of buffer.
+	rd_idx = (rd_idx & IDX_MASK);
+	*ptr = (const void *)((const uint8_t *)rbp->buf + rd_idx);
+	return MINIMUM(used, (rbp->depth - rd_idx));
+}
+
+size_t rb_read_commit(rb_p rbp, size_t len)
+{
+	RETURN_VAL_IF_FAIL(rbp != NULL, SIZE_ZERO);
+
+	len = MINIMUM(len, rb_used(rbp));
+	_incr(rbp, &rbp->rd_idx, len);
+	return len;
+}
+
 bool rb_reset(rb_p rbp)
 {
 	RETURN_VAL_IF_FAIL(rbp != NULL, false);
@@ -176,5 +231,22 @@ static void _incr(rb_p rbp, volatile size_t *p_idx, size_t len)
 		idx -= rbp->depth;
 	}
 
-	*p_idx = msb | idx;
+	// Publish the new index after the data (or space) it covers.
+	__atomic_store_n(p_idx, msb | idx, __ATOMIC_RELEASE);
+}
+
+static size_t _used(rb_p rbp, size_t rd_idx, size_t wr_idx)
+{
+	if (rd_idx == wr_idx) {
+		return SIZE_ZERO;
+	}
+
+	wr_idx = (wr_idx & IDX_MASK);
+	rd_idx = (rd_idx & IDX_MASK);
+
+	if (wr_idx > rd_idx) {
+		return (wr_idx - rd_idx);
+	}
+
+	return (rbp->depth - (rd_idx - wr_idx));
 }
@@ -102,6 +102,43 @@ size_t rb_read(rb_p rbp, void *ptr, size_t len);
  */
 size_t rb_read_ext(rb_p rbp, void *ptr, size_t len, size_t offset);
 
+/**
+ * @brief  Get the contiguous free space at the write index, so that the
+ *         producer can fill it in place. The space is published to the
+ *         consumer by rb_write_commit().
+ *         rb_write_ptr/rb_write_commit and rb_read_ptr/rb_read_commit are
+ *         lock-free for one producer and one consumer.
+ * @param  rbp: Pointer to the ring-buffer object
+ * @param  ptr: Pointer to save the start address of the free space
+ * @return size of the contiguous free space, 0 if the buffer is full.
+ */
+size_t rb_write_ptr(rb_p rbp, void **ptr);
+
+/**
+ * @brief  Publish data written in place after rb_write_ptr().
+ * @param  rbp: Pointer to the ring-buffer object
+ * @param  len: length of the data written, range[0, size rb_write_ptr() returned]
+ * @return size of data be published, range[0, len]
+ */
+size_t rb_write_commit(rb_p rbp, size_t len);
+
+/**
+ * @brief  Get the contiguous data at the read index, so that the consumer
+ *         can use it in place. The data is released by rb_read_commit().
+ * @param  rbp: Pointer to the ring-buffer object
+ * @param  ptr: Pointer to save the start address of the data
+ * @return size of the contiguous data, 0 if the buffer is empty.
+ */
+size_t rb_read_ptr(rb_p rbp, const void **ptr);
+
+/**
+ * @brief  Release data used in place after rb_read_ptr().
+ * @param  rbp: Pointer to the ring-buffer object
+ * @param  len: length of the data used, range[0, size rb_read_ptr() returned]
+ * @return size of data be released, range[0, len]
+ */
+size_t rb_read_commit(rb_p rbp, size_t len);
+
 /**
  * @brief  Reset ring-buffer, data in ring-buffer will be dropped.
  * @param  rbp: Pointer to the ring-buffer object
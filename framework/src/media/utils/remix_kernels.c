@@ -0,0 +1,380 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/*
+ * This file only depends on the C library, so that it can be built on a
+ * host together with apps/examples/performance/audio_remix.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "remix_kernels.h"
+
+#if defined(REMIX_KERNELS_NEON)
+#include <arm_neon.h>
+#elif defined(REMIX_KERNELS_SIMD32)
+#include <arm_acle.h>
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define MIX_COEFF_MUL 7071
+#define MIX_COEFF_DIV 1000
+
+/* x / 1000 rounded toward zero is (x * 274877907) >> 38, plus one when x is
+ * negative. This holds for every int32_t x.
+ */
+#define MIX_COEFF_DIV_MAGIC 274877907
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+// Clip an integer value (32 bits) to a signed short type value(16 bits)
+static inline int16_t clip16(int32_t x)
+{
+	if (x < INT16_MIN) {
+		return INT16_MIN;
+	} else if (x > INT16_MAX) {
+		return INT16_MAX;
+	}
+
+	return (int16_t)x;
+}
+
+#ifdef REMIX_KERNELS_NEON
+// (a + b) / 2 rounded toward zero, like C integer division
+static inline int16x4_t neon_avg_trunc(int16x4_t a, int16x4_t b)
+{
+	int32x4_t sum = vaddl_s16(a, b);
+	// Add one to negative sums before shifting
+	sum = vreinterpretq_s32_u32(vsraq_n_u32(vreinterpretq_u32_s32(sum), vreinterpretq_u32_s32(sum), 31));
+	return vshrn_n_s32(sum, 1);
+}
+
+// clip(x * gain >> PCM_GAIN_SHIFT) of 8 samples
+static inline int16x8_t neon_scale(int16x8_t x, int16_t gain)
+{
+	int32x4_t lo = vmull_n_s16(vget_low_s16(x), gain);
+	int32x4_t hi = vmull_n_s16(vget_high_s16(x), gain);
+	return vcombine_s16(vqshrn_n_s32(lo, PCM_GAIN_SHIFT), vqshrn_n_s32(hi, PCM_GAIN_SHIFT));
+}
+#endif
+
+#ifdef REMIX_KERNELS_SIMD32
+static inline uint32_t load_pair(const int16_t *p)
+{
+	uint32_t w;
+	memcpy(&w, p, sizeof(w));
+	return w;
+}
+
+static inline void store_pair(int16_t *p, int32_t lo, int32_t hi)
+{
+	uint32_t w = ((uint32_t)lo & 0xffff) | ((uint32_t)hi << 16);
+	memcpy(p, &w, sizeof(w));
+}
+
+// clip(x * gain >> PCM_GAIN_SHIFT) of 2 samples packed in a word
+static inline uint32_t simd32_scale(uint32_t w, int32_t gain)
+{
+	int32_t lo = __ssat(__smulbb(w, gain) >> PCM_GAIN_SHIFT, 16);
+	int32_t hi = __ssat(__smultb(w, gain) >> PCM_GAIN_SHIFT, 16);
+	return ((uint32_t)lo & 0xffff) | ((uint32_t)hi << 16);
+}
+#endif
+
+/****************************************************************************
+ * Public Functions: scalar reference
+ ****************************************************************************/
+
+void remix_mono_to_stereo_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	// Maybe in == out, upmix backward.
+	while (frames > 0) {
+		frames--;
+		int16_t s = in[frames];
+		out[2 * frames] = s;
+		out[2 * frames + 1] = s;
+	}
+}
+
+void remix_stereo_to_mono_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	uint32_t i;
+
+	for (i = 0; i < frames; i++) {
+		out[i] = ((int32_t)in[2 * i] + in[2 * i + 1]) / 2;
+	}
+}
+
+void remix_downmix_front_ref(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t frames)
+{
+	uint32_t i;
+
+	for (i = 0; i < frames; i++) {
+		int16_t fl = in[i * in_ch];
+		int16_t fr = in[i * in_ch + 1];
+		out[2 * i] = fl;
+		out[2 * i + 1] = fr;
+	}
+}
+
+void remix_downmix_surround_ref(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t frames)
+{
+	uint32_t i;
+
+	for (i = 0; i < frames; i++) {
+		int16_t fl = in[i * in_ch];
+		int16_t fr = in[i * in_ch + 1];
+		int16_t fc = in[i * in_ch + 2];
+		out[2 * i] = clip16((int32_t)fl + fc / 2);
+		out[2 * i + 1] = clip16((int32_t)fr + fc / 2);
+	}
+}
+
+void remix_downmix_quad_ref(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	uint32_t i;
+
+	for (i = 0; i < frames; i++) {
+		int16_t fl = in[i * 4];
+		int16_t fr = in[i * 4 + 1];
+		int16_t bl = in[i * 4 + 2];
+		int16_t br = in[i * 4 + 3];
+		out[2 * i] = ((int32_t)fl + bl) / 2;
+		out[2 * i + 1] = ((int32_t)fr + br) / 2;
+	}
+}
+
+void remix_downmix_5ch_ref(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t frames)
+{
+	// 5.1 has LFE before the back channels
+	uint32_t back = (in_ch == 6) ? 4 : 3;
+	uint32_t i;
+
+	for (i = 0; i < frames; i++) {
+		int16_t fl = in[i * in_ch];
+		int16_t fr = in[i * in_ch + 1];
+		int16_t fc = in[i * in_ch + 2];
+		int16_t bl = in[i * in_ch + back];
+		int16_t br = in[i * in_ch + back + 1];
+		out[2 * i] = clip16(fl + ((int32_t)fc + bl) * MIX_COEFF_MUL / MIX_COEFF_DIV);
+		out[2 * i + 1] = clip16(fr + ((int32_t)fc + br) * MIX_COEFF_MUL / MIX_COEFF_DIV);
+	}
+}
+
+void pcm_scale_volume_ref(int16_t *buf, uint32_t samples, uint16_t gain)
+{
+	uint32_t i;
+
+	for (i = 0; i < samples; i++) {
+		buf[i] = clip16(((int32_t)buf[i] * gain) >> PCM_GAIN_SHIFT);
+	}
+}
+
+void pcm_mix_ducked_ref(const int16_t *main, const int16_t *duck, int16_t *out, uint32_t samples, uint16_t duck_gain)
+{
+	uint32_t i;
+
+	for (i = 0; i < samples; i++) {
+		int16_t ducked = clip16(((int32_t)duck[i] * duck_gain) >> PCM_GAIN_SHIFT);
+		out[i] = clip16((int32_t)main[i] + ducked);
+	}
+}
+
+/****************************************************************************
+ * Public Functions: accelerated
+ ****************************************************************************/
+
+void remix_mono_to_stereo(const int16_t *in, int16_t *out, uint32_t frames)
+{
+#if defined(REMIX_KERNELS_NEON)
+	// Backward, each block is loaded before its output overwrites it
+	while (frames >= 8) {
+		frames -= 8;
+		int16x8_t s = vld1q_s16(in + frames);
+		int16x8x2_t lr = { { s, s } };
+		vst2q_s16(out + 2 * frames, lr);
+	}
+#elif defined(REMIX_KERNELS_SIMD32)
+	while (frames >= 2) {
+		frames -= 2;
+		uint32_t w = load_pair(in + frames);
+		store_pair(out + 2 * frames, (int32_t)w, (int32_t)w);
+		store_pair(out + 2 * frames + 2, (int32_t)(w >> 16), (int32_t)(w >> 16));
+	}
+#endif
+	remix_mono_to_stereo_ref(in, out, frames);
+}
+
+void remix_stereo_to_mono(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	uint32_t i = 0;
+
+#if defined(REMIX_KERNELS_NEON)
+	for (; i + 8 <= frames; i += 8) {
+		int16x8x2_t lr = vld2q_s16(in + 2 * i);
+		int16x4_t lo = neon_avg_trunc(vget_low_s16(lr.val[0]), vget_low_s16(lr.val[1]));
+		int16x4_t hi = neon_avg_trunc(vget_high_s16(lr.val[0]), vget_high_s16(lr.val[1]));
+		vst1q_s16(out + i, vcombine_s16(lo, hi));
+	}
+#elif defined(REMIX_KERNELS_SIMD32)
+	for (; i + 2 <= frames; i += 2) {
+		int32_t s0 = __smuad(load_pair(in + 2 * i), 0x00010001);
+		int32_t s1 = __smuad(load_pair(in + 2 * i + 2), 0x00010001);
+		store_pair(out + i, s0 / 2, s1 / 2);
+	}
+#endif
+	remix_stereo_to_mono_ref(in + 2 * i, out + i, frames - i);
+}
+
+void remix_downmix_front(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t frames)
+{
+	uint32_t i = 0;
+
+#if defined(REMIX_KERNELS_NEON)
+	if (in_ch == 3) {
+		for (; i + 8 <= frames; i += 8) {
+			int16x8x3_t v = vld3q_s16(in + 3 * i);
+			int16x8x2_t lr = { { v.val[0], v.val[1] } };
+			vst2q_s16(out + 2 * i, lr);
+		}
+	} else if (in_ch == 4) {
+		for (; i + 8 <= frames; i += 8) {
+			int16x8x4_t v = vld4q_s16(in + 4 * i);
+			int16x8x2_t lr = { { v.val[0], v.val[1] } };
+			vst2q_s16(out + 2 * i, lr);
+		}
+	}
+#endif
+	remix_downmix_front_ref(in + in_ch * i, in_ch, out + 2 * i, frames - i);
+}
+
+void remix_downmix_surround(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t frames)
+{
+	uint32_t i = 0;
+
+#if defined(REMIX_KERNELS_NEON)
+	for (; i + 8 <= frames; i += 8) {
+		int16x8_t fl, fr, fc;
+		if (in_ch == 3) {
+			int16x8x3_t v = vld3q_s16(in + 3 * i);
+			fl = v.val[0];
+			fr = v.val[1];
+			fc = v.val[2];
+		} else {
+			int16x8x4_t v = vld4q_s16(in + 4 * i);
+			fl = v.val[0];
+			fr = v.val[1];
+			fc = v.val[2];
+		}
+		// fc / 2 rounded toward zero, then saturate the sums
+		fc = vreinterpretq_s16_u16(vsraq_n_u16(vreinterpretq_u16_s16(fc), vreinterpretq_u16_s16(fc), 15));
+		fc = vshrq_n_s16(fc, 1);
+		int16x8x2_t lr = { { vqaddq_s16(fl, fc), vqaddq_s16(fr, fc) } };
+		vst2q_s16(out + 2 * i, lr);
+	}
+#endif
+	remix_downmix_surround_ref(in + in_ch * i, in_ch, out + 2 * i, frames - i);
+}
+
+void remix_downmix_quad(const int16_t *in, int16_t *out, uint32_t frames)
+{
+	uint32_t i = 0;
+
+#if defined(REMIX_KERNELS_NEON)
+	for (; i + 8 <= frames; i += 8) {
+		int16x8x4_t v = vld4q_s16(in + 4 * i);
+		int16x8x2_t lr;
+		lr.val[0] = vcombine_s16(neon_avg_trunc(vget_low_s16(v.val[0]), vget_low_s16(v.val[2])),
+								 neon_avg_trunc(vget_high_s16(v.val[0]), vget_high_s16(v.val[2])));
+		lr.val[1] = vcombine_s16(neon_avg_trunc(vget_low_s16(v.val[1]), vget_low_s16(v.val[3])),
+								 neon_avg_trunc(vget_high_s16(v.val[1]), vget_high_s16(v.val[3])));
+		vst2q_s16(out + 2 * i, lr);
+	}
+#endif
+	remix_downmix_quad_ref(in + 4 * i, out + 2 * i, frames - i);
+}
+
+void remix_downmix_5ch(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t frames)
+{
+	uint32_t i = 0;
+
+#if defined(REMIX_KERNELS_NEON)
+	if (in_ch == 6) {
+		int32x4_t magic = vdupq_n_s32(MIX_COEFF_DIV_MAGIC);
+		for (; i + 4 <= frames; i += 4) {
+			// Load 4 frames as pairs of channels: FL|FR, FC|LFE, BL|BR
+			uint32x4x3_t v = vld3q_u32((const uint32_t *)(in + 6 * i));
+			int16x8_t front = vreinterpretq_s16_u32(v.val[0]);
+			int16x8_t center = vreinterpretq_s16_u32(vsliq_n_u32(v.val[1], v.val[1], 16));
+			int16x8_t back = vreinterpretq_s16_u32(v.val[2]);
+
+			int32x4_t lo = vmulq_n_s32(vaddl_s16(vget_low_s16(center), vget_low_s16(back)), MIX_COEFF_MUL);
+			int32x4_t hi = vmulq_n_s32(vaddl_s16(vget_high_s16(center), vget_high_s16(back)), MIX_COEFF_MUL);
+			// Divide by MIX_COEFF_DIV rounding toward zero
+			lo = vsubq_s32(vshrq_n_s32(vqdmulhq_s32(lo, magic), 7), vshrq_n_s32(lo, 31));
+			hi = vsubq_s32(vshrq_n_s32(vqdmulhq_s32(hi, magic), 7), vshrq_n_s32(hi, 31));
+
+			lo = vaddw_s16(lo, vget_low_s16(front));
+			hi = vaddw_s16(hi, vget_high_s16(front));
+			vst1q_s16(out + 2 * i, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+		}
+	}
+#endif
+	remix_downmix_5ch_ref(in + in_ch * i, in_ch, out + 2 * i, frames - i);
+}
+
+void pcm_scale_volume(int16_t *buf, uint32_t samples, uint16_t gain)
+{
+	uint32_t i = 0;
+
+#if defined(REMIX_KERNELS_NEON)
+	for (; i + 8 <= samples; i += 8) {
+		vst1q_s16(buf + i, neon_scale(vld1q_s16(buf + i), (int16_t)gain));
+	}
+#elif defined(REMIX_KERNELS_SIMD32)
+	for (; i + 2 <= samples; i += 2) {
+		uint32_t w = simd32_scale(load_pair(buf + i), gain);
+		memcpy(buf + i, &w, sizeof(w));
+	}
+#endif
+	pcm_scale_volume_ref(buf + i, samples - i, gain);
+}
+
+void pcm_mix_ducked(const int16_t *main, const int16_t *duck, int16_t *out, uint32_t samples, uint16_t duck_gain)
+{
+	uint32_t i = 0;
+
+#if defined(REMIX_KERNELS_NEON)
+	for (; i + 8 <= samples; i += 8) {
+		int16x8_t ducked = neon_scale(vld1q_s16(duck + i), (int16_t)duck_gain);
+		vst1q_s16(out + i, vqaddq_s16(vld1q_s16(main + i), ducked));
+	}
+#elif defined(REMIX_KERNELS_SIMD32)
+	for (; i + 2 <= samples; i += 2) {
+		uint32_t ducked = simd32_scale(load_pair(duck + i), duck_gain);
+		uint32_t w = (uint32_t)__qadd16(load_pair(main + i), ducked);
+		memcpy(out + i, &w, sizeof(w));
+	}
+#endif
+	pcm_mix_ducked_ref(main + i, duck + i, out + i, samples - i, duck_gain);
+}
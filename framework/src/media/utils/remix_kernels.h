@@ -0,0 +1,114 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef REMIX_KERNELS_H
+#define REMIX_KERNELS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Kernels processing interleaved signed 16-bit PCM.
+ *
+ * Each kernel has a scalar reference, named with the '_ref' suffix, and an
+ * implementation selected at compile time for the target: NEON on Cortex-A
+ * (and AArch64), the SIMD32/DSP extension on Cortex-M, or the reference
+ * itself elsewhere. Both give the same output bit by bit.
+ */
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define REMIX_KERNELS_NEON
+#define REMIX_KERNELS_ARCH "neon"
+#elif defined(__ARM_FEATURE_SIMD32) && defined(__ARM_FEATURE_DSP) && defined(__ARM_FEATURE_SAT)
+#define REMIX_KERNELS_SIMD32
+#define REMIX_KERNELS_ARCH "simd32"
+#else
+#define REMIX_KERNELS_ARCH "scalar"
+#endif
+
+/* Gains are unsigned Q12 fixed point, PCM_GAIN_UNITY is 1.0, maximum is 0x7FFF */
+
+#define PCM_GAIN_SHIFT 12
+#define PCM_GAIN_UNITY (1 << PCM_GAIN_SHIFT)
+
+/**
+ * @brief   Mono to stereo, out[2i] = out[2i + 1] = in[i]
+ * @remarks 'out' can be same with 'in'.
+ */
+void remix_mono_to_stereo(const int16_t *in, int16_t *out, uint32_t frames);
+void remix_mono_to_stereo_ref(const int16_t *in, int16_t *out, uint32_t frames);
+
+/**
+ * @brief   Stereo to mono, out[i] = (in[2i] + in[2i + 1]) / 2
+ * @remarks 'out' can be same with 'in'.
+ */
+void remix_stereo_to_mono(const int16_t *in, int16_t *out, uint32_t frames);
+void remix_stereo_to_mono_ref(const int16_t *in, int16_t *out, uint32_t frames);
+
+/**
+ * @brief   Keep the front left and right of 'in_ch' channels, drop the others
+ * @remarks 'out' can be same with 'in'.
+ */
+void remix_downmix_front(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t frames);
+void remix_downmix_front_ref(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t frames);
+
+/**
+ * @brief   Surround (FL FR FC) or 3.1 (FL FR FC LFE) to stereo,
+ *          out = clip(front + center / 2)
+ * @remarks 'out' can be same with 'in'.
+ */
+void remix_downmix_surround(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t frames);
+void remix_downmix_surround_ref(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t frames);
+
+/**
+ * @brief   Quad (FL FR BL BR) to stereo, out = (front + back) / 2
+ * @remarks 'out' can be same with 'in'.
+ */
+void remix_downmix_quad(const int16_t *in, int16_t *out, uint32_t frames);
+void remix_downmix_quad_ref(const int16_t *in, int16_t *out, uint32_t frames);
+
+/**
+ * @brief   5.0 (FL FR FC BL BR) or 5.1 (FL FR FC LFE BL BR) to stereo,
+ *          out = clip(front + (center + back) * 7071 / 1000)
+ * @remarks 'out' can be same with 'in'.
+ */
+void remix_downmix_5ch(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t frames);
+void remix_downmix_5ch_ref(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t frames);
+
+/**
+ * @brief   Scale samples in place, buf[i] = clip(buf[i] * gain >> PCM_GAIN_SHIFT)
+ */
+void pcm_scale_volume(int16_t *buf, uint32_t samples, uint16_t gain);
+void pcm_scale_volume_ref(int16_t *buf, uint32_t samples, uint16_t gain);
+
+/**
+ * @brief   Mix a ducked stream into a main one,
+ *          out[i] = clip(main[i] + clip(duck[i] * gain >> PCM_GAIN_SHIFT))
+ * @remarks 'out' can be same with 'main'.
+ */
+void pcm_mix_ducked(const int16_t *main, const int16_t *duck, int16_t *out, uint32_t samples, uint16_t duck_gain);
+void pcm_mix_ducked_ref(const int16_t *main, const int16_t *duck, int16_t *out, uint32_t samples, uint16_t duck_gain);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* REMIX_KERNELS_H */
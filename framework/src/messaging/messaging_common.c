@@ -112,9 +112,13 @@ int messaging_set_notify_signal(int signo, _sa_sigaction_t func)
  * Name : messaging_parse_packet
  *
  * Description:
- *  Parse the received packet.
+ *  Parse the received packet of packet_len bytes.
+ *
+ * Return Value:
+ *  On success, 0 (OK) is returned.; On failure, -1 (ERROR) is returned.
+ *  If the message does not fit in buf, errno is set to EMSGSIZE.
  ****************************************************************************/
-int messaging_parse_packet(char *packet, char *buf, int buflen, pid_t *sender_pid, int *msg_type)
+int messaging_parse_packet(char *packet, int packet_len, char *buf, int buflen, pid_t *sender_pid, int *msg_type)
 {
 	uint32_t my_version;
 	uint32_t msg_version;
@@ -139,9 +143,15 @@ int messaging_parse_packet(char *packet, char *buf, int buflen, pid_t *sender_pi
 	}
 	switch (parsing_version) {
 	case 1:
+		if (offset > packet_len || packet_len - offset > buflen) {
+			msgdbg("[Messaging] Message of %d bytes does not fit in %d bytes.\n", packet_len - (int)offset, buflen);
+			set_errno(EMSGSIZE);
+			ret = ERROR;
+			break;
+		}
 		*sender_pid = ((messaging_packet_t *)packet)->sender_pid;
 		*msg_type = ((messaging_packet_t *)packet)->msg_type;
-		memcpy(buf, packet + offset, buflen);
+		memcpy(buf, packet + offset, packet_len - offset);
 		ret = OK;
 		break;
 	default:
@@ -223,7 +233,7 @@ void messaging_run_callback(int signo, siginfo_t *data)
 		}
 
 		/* Parsing the received data to user message buffer. */
-		ret = messaging_parse_packet(recv_packet, recv_info->msg->buf, recv_info->msg->buflen, &(recv_info->msg->sender_pid), &msg_type);
+		ret = messaging_parse_packet(recv_packet, size, recv_info->msg->buf, recv_info->msg->buflen, &(recv_info->msg->sender_pid), &msg_type);
 		if (ret != OK) {
 			msgdbg("[Messaging] Not supported version, received version : %d.\n", ret);
 			goto errout_with_recv_packet;
@@ -17,6 +17,7 @@
  ****************************************************************************/
 #include <tinyara/compiler.h>
 #include <mqueue.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <queue.h>
@@ -106,6 +107,22 @@ struct msg_port_info_s {
 };
 typedef struct msg_port_info_s msg_port_info_t;
 
+/**
+ * @brief The internal structure for a thread's reply channel of sync send, reused until the thread exits.
+ */
+struct msg_reply_chan_s {
+	struct msg_reply_chan_s *flink;
+	pid_t pid;
+	pid_t tgid;		/* Main task of the owner's task group */
+	bool cached;		/* Kept in the list, otherwise freed after the reply */
+	mqd_t mqdes;
+	int msgsize;		/* Message size of the queue, 0 when it is closed */
+	char *packet;		/* Buffer receiving a reply with its header */
+	int pktsize;
+	char name[MAX_PORT_NAME_SIZE];
+};
+typedef struct msg_reply_chan_s msg_reply_chan_t;
+
 /**
  * @brief Internal function for setting callback function to the messaging signal.
  */
@@ -137,11 +154,27 @@ void messaging_run_callback(int signo, siginfo_t *data);
 /**
  * @brief Internal function for parsing received packet
  */
-int messaging_parse_packet(char *packet, char *buf, int buflen, pid_t *sender_pid, int *msg_type);
+int messaging_parse_packet(char *packet, int packet_len, char *buf, int buflen, pid_t *sender_pid, int *msg_type);
 /**
  * @brief Internal function for getting g_port_info_list
  */
 sq_queue_t *messaging_get_port_info_list(void);
+/**
+ * @brief Internal function for getting the reply channel of sync send.
+ */
+msg_reply_chan_t *messaging_reply_chan_open(const char *port_name, int msgsize);
+/**
+ * @brief Internal function for receiving the reply of sync send.
+ */
+int messaging_reply_chan_recv(msg_reply_chan_t *chan, msg_recv_buf_t *reply_buf);
+/**
+ * @brief Internal function for putting the reply channel back after sync send.
+ */
+void messaging_reply_chan_put(msg_reply_chan_t *chan);
+/**
+ * @brief Internal function for closing the reply channel before async send uses the same reply port.
+ */
+void messaging_reply_chan_release(const char *port_name);
 /*
  *@endcond
  */
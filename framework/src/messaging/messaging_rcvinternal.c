@@ -68,11 +68,13 @@ static int messaging_rcv_nonblock(mqd_t mqdes, const char *port_name, msg_recv_b
 	msg_recv_info_t *nonblock_data;
 	msg_port_info_t *port_info = NULL;
 	int recv_size;
+	int buflen;
 	char *recv_packet;
 	int msg_type;
 	char *internal_portname;
 
-	recv_size = recv_buf->buflen + MSG_HEADER_SIZE;
+	buflen = recv_buf->buflen;
+	recv_size = buflen + MSG_HEADER_SIZE;
 	recv_packet = (char *)MSG_ALLOC(recv_size);
 	if (recv_packet == NULL) {
 		msgdbg("[Messaging] recv fail : out of memory for packet.\n");
@@ -82,13 +84,16 @@ static int messaging_rcv_nonblock(mqd_t mqdes, const char *port_name, msg_recv_b
 	while (1) {
 		recv_size_chk = mq_receive(mqdes, (char *)recv_packet, recv_size, 0);
 		if (recv_size_chk > 0 && recv_size_chk <= recv_size) {
-			ret = messaging_parse_packet(recv_packet, recv_buf->buf, recv_buf->buflen, &recv_buf->sender_pid, &msg_type);
+			ret = messaging_parse_packet(recv_packet, recv_size_chk, recv_buf->buf, buflen, &recv_buf->sender_pid, &msg_type);
 			if (ret != OK) {
 				MSG_FREE(recv_packet);
 				goto errout_with_mq;
 			}
 			recv_buf->buflen = recv_size_chk;
 			(*cb_info->cb_func)(msg_type, recv_buf, cb_info->cb_data);
+
+			/* The buffer keeps its size for the next messages. */
+			recv_buf->buflen = buflen;
 		} else if (recv_size_chk == ERROR && errno == EAGAIN) {
 			msgdbg("[Messaging] recv : empty queue, but NONBLOCK mode.\n");
 			break;
@@ -188,7 +193,7 @@ static int messaging_rcv_block(mqd_t mqdes, const char *port_name, msg_recv_buf_
 		goto cleanup_return;
 	}
 
-	ret = messaging_parse_packet(recv_packet, recv_buf->buf, recv_buf->buflen, &recv_buf->sender_pid, &msg_type);
+	ret = messaging_parse_packet(recv_packet, ret, recv_buf->buf, recv_buf->buflen, &recv_buf->sender_pid, &msg_type);
 	if (ret != OK) {
 		msg_type = ERROR;
 		goto cleanup_return;
@@ -0,0 +1,446 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <assert.h>
+#include <debug.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <mqueue.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <queue.h>
+#include <sys/prctl.h>
+#include <sys/types.h>
+#include <messaging/messaging.h>
+#include "messaging_internal.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* A channel is kept only if it is torn down with its owner: by the on_exit()
+ * of the task group for a main task, by a pthread key destructor for a
+ * pthread. The main task is known from PR_GET_TGTASK, which needs
+ * SCHED_HAVE_PARENT when there are pthreads.
+ */
+#if defined(CONFIG_DISABLE_PTHREAD) || defined(CONFIG_SCHED_HAVE_PARENT)
+#define MESSAGING_REPLY_CHAN_KEEP
+#endif
+
+#if defined(MESSAGING_REPLY_CHAN_KEEP) && !defined(CONFIG_DISABLE_PTHREAD) && CONFIG_NPTHREAD_KEYS > 0
+#define MESSAGING_REPLY_CHAN_THREAD
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+/* A task group which keeps reply channels */
+struct msg_reply_group_s {
+	struct msg_reply_group_s *flink;
+	pid_t tgid;
+#ifdef MESSAGING_REPLY_CHAN_THREAD
+	bool haskey;
+	pthread_key_t key;	/* Its destructor removes the channels of a pthread */
+#endif
+};
+
+/* Kept reply channels of all threads and the task groups owning them. */
+static sq_queue_t g_reply_chan_list;
+static sq_queue_t g_reply_group_list;
+static sem_t g_reply_chan_sem = SEM_INITIALIZER(1);
+
+/****************************************************************************
+ * private functions
+ ****************************************************************************/
+static void messaging_reply_chan_lock(void)
+{
+	while (sem_wait(&g_reply_chan_sem) != OK) {
+		ASSERT(get_errno() == EINTR);
+	}
+}
+
+static void messaging_reply_chan_unlock(void)
+{
+	sem_post(&g_reply_chan_sem);
+}
+
+static pid_t messaging_reply_chan_tgid(void)
+{
+	int tgid;
+
+	if (prctl(PR_GET_TGTASK, &tgid) != OK) {
+		return ERROR;
+	}
+	return (pid_t)tgid;
+}
+
+static void messaging_reply_chan_close(msg_reply_chan_t *chan)
+{
+	if (chan->msgsize == 0) {
+		return;
+	}
+
+	mq_close(chan->mqdes);
+	if (mq_unlink(chan->name) != OK && errno != ENOENT) {
+		msgdbg("[Messaging] reply channel unlink fail, errno %d.\n", errno);
+	}
+	chan->msgsize = 0;
+}
+
+/* The queue descriptor belongs to the owner's task group, another group
+ * only unlinks the name and the descriptor is released with its group.
+ */
+static void messaging_reply_chan_free(msg_reply_chan_t *chan, bool owner)
+{
+	if (owner) {
+		messaging_reply_chan_close(chan);
+	} else if (chan->msgsize != 0) {
+		(void)mq_unlink(chan->name);
+	}
+	MSG_FREE(chan->packet);
+	MSG_FREE(chan);
+}
+
+/* Should be called with the list locked by the task group tgid. pid 0
+ * removes all the channels of the group.
+ */
+static void messaging_reply_chan_remove(pid_t pid, pid_t tgid)
+{
+	msg_reply_chan_t *chan;
+	msg_reply_chan_t *next;
+
+	for (chan = (msg_reply_chan_t *)sq_peek(&g_reply_chan_list); chan != NULL; chan = next) {
+		next = (msg_reply_chan_t *)sq_next(chan);
+		if (chan->tgid == tgid && (pid == 0 || chan->pid == pid)) {
+			sq_rem((FAR sq_entry_t *)chan, &g_reply_chan_list);
+			messaging_reply_chan_free(chan, true);
+		}
+	}
+}
+
+/* Should be called with the list locked. A channel of the same pid in
+ * another task group is a stale one and it is dropped.
+ */
+static msg_reply_chan_t *messaging_reply_chan_find(pid_t pid, pid_t tgid, const char *name)
+{
+	msg_reply_chan_t *chan;
+	msg_reply_chan_t *next;
+
+	for (chan = (msg_reply_chan_t *)sq_peek(&g_reply_chan_list); chan != NULL; chan = next) {
+		next = (msg_reply_chan_t *)sq_next(chan);
+		if (chan->pid != pid || strncmp(chan->name, name, MAX_PORT_NAME_SIZE) != 0) {
+			continue;
+		}
+		if (chan->tgid == tgid) {
+			return chan;
+		}
+		sq_rem((FAR sq_entry_t *)chan, &g_reply_chan_list);
+		messaging_reply_chan_free(chan, false);
+	}
+	return NULL;
+}
+
+#ifdef MESSAGING_REPLY_CHAN_KEEP
+/****************************************************************************
+ * Name : messaging_reply_group_exit
+ *
+ * Description:
+ *  on_exit() callback which removes all the reply channels of a task group
+ *  when its last member exits.
+ ****************************************************************************/
+static void messaging_reply_group_exit(int status, void *arg)
+{
+	struct msg_reply_group_s *group = (struct msg_reply_group_s *)arg;
+
+	messaging_reply_chan_lock();
+	messaging_reply_chan_remove(0, group->tgid);
+	sq_rem((FAR sq_entry_t *)group, &g_reply_group_list);
+	messaging_reply_chan_unlock();
+
+	MSG_FREE(group);
+}
+
+/* Should be called with the list locked. */
+static struct msg_reply_group_s *messaging_reply_group_get(pid_t tgid)
+{
+	struct msg_reply_group_s *group;
+
+	for (group = (struct msg_reply_group_s *)sq_peek(&g_reply_group_list); group != NULL; group = (struct msg_reply_group_s *)sq_next(group)) {
+		if (group->tgid == tgid) {
+			return group;
+		}
+	}
+
+	group = (struct msg_reply_group_s *)MSG_ALLOC(sizeof(struct msg_reply_group_s));
+	if (group == NULL) {
+		return NULL;
+	}
+	memset(group, 0, sizeof(struct msg_reply_group_s));
+	group->tgid = tgid;
+
+	if (on_exit(messaging_reply_group_exit, group) != OK) {
+		msgdbg("[Messaging] reply channel : on_exit registration fail.\n");
+		MSG_FREE(group);
+		return NULL;
+	}
+	sq_addlast((FAR sq_entry_t *)group, &g_reply_group_list);
+
+	return group;
+}
+#endif
+
+#ifdef MESSAGING_REPLY_CHAN_THREAD
+/****************************************************************************
+ * Name : messaging_reply_chan_thread_exit
+ *
+ * Description:
+ *  Destructor of the pthread key which removes the reply channels of an
+ *  exiting pthread. A pthread canceled from another task group keeps them
+ *  until its group exits.
+ ****************************************************************************/
+static void messaging_reply_chan_thread_exit(void *value)
+{
+	pid_t tgid;
+
+	tgid = messaging_reply_chan_tgid();
+	if (tgid == ERROR) {
+		return;
+	}
+
+	messaging_reply_chan_lock();
+	messaging_reply_chan_remove((pid_t)(uintptr_t)value, tgid);
+	messaging_reply_chan_unlock();
+}
+
+/* Should be called with the list locked, from the pthread pid. */
+static bool messaging_reply_chan_bind(struct msg_reply_group_s *group, pid_t pid)
+{
+	if (!group->haskey) {
+		if (pthread_key_create(&group->key, messaging_reply_chan_thread_exit) != OK) {
+			msgdbg("[Messaging] reply channel : no pthread key.\n");
+			return false;
+		}
+		group->haskey = true;
+	}
+	return pthread_setspecific(group->key, (void *)(uintptr_t)pid) == OK;
+}
+#endif
+
+/* Should be called with the list locked. Keep the new channel if it can be
+ * removed when the calling thread exits.
+ */
+static void messaging_reply_chan_keep(msg_reply_chan_t *chan)
+{
+#ifdef MESSAGING_REPLY_CHAN_KEEP
+	struct msg_reply_group_s *group;
+
+	if (chan->tgid == ERROR) {
+		return;
+	}
+
+	group = messaging_reply_group_get(chan->tgid);
+	if (group == NULL) {
+		return;
+	}
+
+	if (chan->pid == chan->tgid) {
+		chan->cached = true;
+	}
+#ifdef MESSAGING_REPLY_CHAN_THREAD
+	else {
+		chan->cached = messaging_reply_chan_bind(group, chan->pid);
+	}
+#endif
+
+	if (chan->cached) {
+		sq_addlast((FAR sq_entry_t *)chan, &g_reply_chan_list);
+	}
+#endif
+}
+
+/****************************************************************************
+ * public functions
+ ****************************************************************************/
+/****************************************************************************
+ * Name : messaging_reply_chan_open
+ *
+ * Description:
+ *  Get the reply channel of the calling thread for port_name, which can
+ *  receive replies of msgsize bytes including the header. The channel is
+ *  created at the first call and kept until the thread exits, its queue is
+ *  recreated only when a larger reply is expected. A thread whose exit can
+ *  not be tracked gets a new channel, freed by messaging_reply_chan_put().
+ *
+ * Return Value:
+ *  On success, the reply channel is returned.; On failure, NULL is returned.
+ ****************************************************************************/
+msg_reply_chan_t *messaging_reply_chan_open(const char *port_name, int msgsize)
+{
+	msg_reply_chan_t *chan;
+	struct mq_attr internal_attr;
+	char name[MAX_PORT_NAME_SIZE];
+	char *packet;
+	pid_t pid;
+	pid_t tgid;
+
+	/* Sender waits the reply with "port_name + sender_pid + _r". */
+	pid = getpid();
+	if (snprintf(name, MAX_PORT_NAME_SIZE, "%s%d%s", port_name, pid, "_r") >= MAX_PORT_NAME_SIZE) {
+		msgdbg("[Messaging] reply channel fail : too long port name %s.\n", port_name);
+		return NULL;
+	}
+	tgid = messaging_reply_chan_tgid();
+
+	messaging_reply_chan_lock();
+	chan = messaging_reply_chan_find(pid, tgid, name);
+	if (chan == NULL) {
+		chan = (msg_reply_chan_t *)MSG_ALLOC(sizeof(msg_reply_chan_t));
+		if (chan == NULL) {
+			messaging_reply_chan_unlock();
+			msgdbg("[Messaging] reply channel fail : out of memory.\n");
+			return NULL;
+		}
+		memset(chan, 0, sizeof(msg_reply_chan_t));
+		chan->pid = pid;
+		chan->tgid = tgid;
+		strncpy(chan->name, name, MAX_PORT_NAME_SIZE);
+		messaging_reply_chan_keep(chan);
+	}
+	messaging_reply_chan_unlock();
+
+	/* Only the owner thread uses the channel from here. */
+	if (chan->msgsize >= msgsize) {
+		return chan;
+	}
+
+	messaging_reply_chan_close(chan);
+
+	if (chan->pktsize < msgsize) {
+		packet = (char *)realloc(chan->packet, msgsize);
+		if (packet == NULL) {
+			msgdbg("[Messaging] reply channel fail : out of memory for packet.\n");
+			goto errout;
+		}
+		chan->packet = packet;
+		chan->pktsize = msgsize;
+	}
+
+	internal_attr.mq_maxmsg = CONFIG_MESSAGING_MAXMSG;
+	internal_attr.mq_msgsize = msgsize;
+	internal_attr.mq_flags = 0;
+
+	/* A queue left with this name, e.g. a smaller one, is not reused. */
+	(void)mq_unlink(chan->name);
+	chan->mqdes = mq_open(chan->name, O_RDONLY | O_CREAT, 0666, &internal_attr);
+	if (chan->mqdes == (mqd_t)ERROR) {
+		msgdbg("[Messaging] reply channel fail : open fail, errno %d.\n", errno);
+		goto errout;
+	}
+	chan->msgsize = msgsize;
+
+	return chan;
+
+errout:
+	messaging_reply_chan_put(chan);
+	return NULL;
+}
+
+/****************************************************************************
+ * Name : messaging_reply_chan_recv
+ *
+ * Description:
+ *  Wait the reply on the channel and copy its message to reply_buf.
+ *
+ * Return Value:
+ *  On success, 0 (OK) is returned.; On failure, -1 (ERROR) is returned.
+ *  A reply larger than reply_buf fails with errno EMSGSIZE.
+ ****************************************************************************/
+int messaging_reply_chan_recv(msg_reply_chan_t *chan, msg_recv_buf_t *reply_buf)
+{
+	ssize_t size;
+	int msg_type;
+
+	size = mq_receive(chan->mqdes, chan->packet, chan->msgsize, 0);
+	if (size < 0) {
+		msgdbg("[Messaging] reply recv fail : errno %d.\n", errno);
+
+		/* The reply may still come, it should not be taken for the next one. */
+		messaging_reply_chan_close(chan);
+		return ERROR;
+	}
+
+	/* The channel may be larger than reply_buf, a longer reply is an error with EMSGSIZE. */
+	if (messaging_parse_packet(chan->packet, size, reply_buf->buf, reply_buf->buflen, &reply_buf->sender_pid, &msg_type) != OK) {
+		return ERROR;
+	}
+	return OK;
+}
+
+/****************************************************************************
+ * Name : messaging_reply_chan_put
+ *
+ * Description:
+ *  Put the channel back after its reply. A channel which is not kept is
+ *  freed, errno is left as it is.
+ ****************************************************************************/
+void messaging_reply_chan_put(msg_reply_chan_t *chan)
+{
+	int errcode;
+
+	if (chan->cached) {
+		return;
+	}
+
+	errcode = errno;
+	messaging_reply_chan_free(chan, true);
+	errno = errcode;
+}
+
+/****************************************************************************
+ * Name : messaging_reply_chan_release
+ *
+ * Description:
+ *  Close the queue of the calling thread's reply channel for port_name, if
+ *  any, so that the name can be used by an async reply.
+ ****************************************************************************/
+void messaging_reply_chan_release(const char *port_name)
+{
+	msg_reply_chan_t *chan;
+	char name[MAX_PORT_NAME_SIZE];
+	pid_t pid;
+
+	pid = getpid();
+	if (snprintf(name, MAX_PORT_NAME_SIZE, "%s%d%s", port_name, pid, "_r") >= MAX_PORT_NAME_SIZE) {
+		return;
+	}
+
+	messaging_reply_chan_lock();
+	chan = messaging_reply_chan_find(pid, messaging_reply_chan_tgid(), name);
+	messaging_reply_chan_unlock();
+
+	if (chan != NULL) {
+		messaging_reply_chan_close(chan);
+	}
+}
@@ -50,6 +50,9 @@ static int messaging_set_async_callback(const char *port_name, msg_recv_buf_t *r
 		return ERROR;
 	}
 
+	/* The reply port is same with the one of sync send, which can be kept open. */
+	messaging_reply_chan_release(port_name);
+
 	recv_size = MSG_HEADER_SIZE + recv_data->buflen;
 
 	internal_attr.mq_maxmsg = CONFIG_MESSAGING_MAXMSG;
@@ -92,6 +92,11 @@
 
 #define putc(c, stream)	(total_len++, (stream)->put(stream, c))
 
+/* Put a run of n characters, or n times the same character */
+
+#define putbuf(p, n, stream)	(total_len += (n), vsprintf_putbuf(stream, p, n))
+#define putfill(c, n, stream)	(total_len += (n), vsprintf_putfill(stream, c, n))
+
 /* Order is relevant here and matches order in format string */
 
 #define FL_ZFILL           0x0001
@@ -158,6 +163,45 @@ struct arg {
 
 static const char g_nullstring[] = "(null)";
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Streams without a puts method get the run one character at a time */
+
+static void vsprintf_putbuf(FAR struct lib_outstream_s *stream, FAR const char *buf, int len)
+{
+	if (stream->puts != NULL) {
+		if (len > 0) {
+			stream->puts(stream, buf, len);
+		}
+	} else {
+		while (len-- > 0) {
+			stream->put(stream, *buf++);
+		}
+	}
+}
+
+static void vsprintf_putfill(FAR struct lib_outstream_s *stream, int ch, int len)
+{
+	char fill[16];
+	int chunk;
+
+	if (stream->puts == NULL || len < 2) {
+		while (len-- > 0) {
+			stream->put(stream, ch);
+		}
+		return;
+	}
+
+	memset(fill, ch, len < sizeof(fill) ? len : sizeof(fill));
+	while (len > 0) {
+		chunk = len < sizeof(fill) ? len : sizeof(fill);
+		stream->puts(stream, fill, chunk);
+		len -= chunk;
+	}
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -195,6 +239,21 @@ static int vsprintf_internal(FAR struct lib_outstream_s *stream, FAR struct arg
 
 	for (;;) {
 		for (;;) {
+#ifndef CONFIG_ARCH_ROMGETC
+			/* Put the literal text up to the next conversion at once */
+
+			for (pnt = fmt; *fmt != '\0' && *fmt != '%'; fmt++) ;
+
+#ifdef CONFIG_LIBC_NUMBERED_ARGS
+			if (stream != NULL && fmt != pnt) {
+				putbuf(pnt, fmt - pnt, stream);
+			}
+#else
+			if (fmt != pnt) {
+				putbuf(pnt, fmt - pnt, stream);
+			}
+#endif
+#endif
 			c = fmt_char(fmt);
 			if (c == '\0') {
 				goto ret;
@@ -749,21 +808,13 @@ flt_oper:
 			size = strnlen(pnt, (flags & FL_PREC) ? prec : ~0);
 
 str_lpad:
-			if ((flags & FL_LPAD) == 0) {
-				while (size < width) {
-					putc(' ', stream);
-					width--;
-				}
+			if ((flags & FL_LPAD) == 0 && size < width) {
+				putfill(' ', width - size, stream);
+				width = size;
 			}
 
-			while (size) {
-				putc(*pnt++, stream);
-				if (width != 0) {
-					width -= 1;
-				}
-
-				size -= 1;
-			}
+			putbuf(pnt, size, stream);
+			width = size < width ? width - size : 0;
 
 			goto tail;
 		}
@@ -956,9 +1007,9 @@ str_lpad:
 				}
 			}
 
-			while (len < width) {
-				putc(' ', stream);
-				len++;
+			if (len < width) {
+				putfill(' ', width - len, stream);
+				len = width;
 			}
 		}
 
@@ -982,22 +1033,28 @@ str_lpad:
 			putc(z, stream);
 		}
 
-		while (prec > c) {
-			putc('0', stream);
-			prec--;
+		if (prec > c) {
+			putfill('0', prec - c, stream);
 		}
 
-		while (c) {
-			putc(buf[--c], stream);
+		/* The digits are stored least significant first */
+
+		for (len = 0; len < c / 2; len++) {
+			unsigned char digit = buf[len];
+
+			buf[len] = buf[c - 1 - len];
+			buf[c - 1 - len] = digit;
 		}
 
+		putbuf((FAR const char *)buf, c, stream);
+
 tail:
 
 		/* Tail is possible.  */
 
-		while (width) {
-			putc(' ', stream);
-			width--;
+		if (width) {
+			putfill(' ', width, stream);
+			width = 0;
 		}
 	}
 
@@ -55,6 +55,7 @@
  ****************************************************************************/
 
 #include <fcntl.h>
+#include <string.h>
 #include <assert.h>
 #include <errno.h>
 
@@ -92,6 +93,38 @@ static void stdoutstream_putc(FAR struct lib_outstream_s *this, int ch)
 	} while (get_errno() == EINTR);
 }
 
+/****************************************************************************
+ * Name: stdoutstream_puts
+ ****************************************************************************/
+
+static void stdoutstream_puts(FAR struct lib_outstream_s *this, FAR const void *buf, int len)
+{
+	FAR struct lib_stdoutstream_s *sthis = (FAR struct lib_stdoutstream_s *)this;
+	ssize_t result;
+
+	DEBUGASSERT(this && sthis->stream);
+
+	/* Write the run into the stream buffer with one call, retrying only if
+	 * the write was interrupted by a signal.
+	 */
+
+	do {
+		result = lib_fwrite(buf, len, sthis->stream);
+		if (result >= 0) {
+			this->nput += result;
+
+#ifdef CONFIG_STDIO_LINEBUFFER
+			/* Flush if a newline was output, as fputc() does */
+
+			if (result > 0 && memchr(buf, '\n', result) != NULL) {
+				(void)lib_fflush(sthis->stream, true);
+			}
+#endif
+			return;
+		}
+	} while (get_errno() == EINTR);
+}
+
 /****************************************************************************
  * Name: stdoutstream_flush
  ****************************************************************************/
@@ -130,6 +163,7 @@ void lib_stdoutstream(FAR struct lib_stdoutstream_s *outstream, FAR FILE *stream
 	/* Select the put operation */
 
 	outstream->public.put = stdoutstream_putc;
+	outstream->public.puts = stdoutstream_puts;
 
 	/* Select the correct flush operation.  This flush is only called when
 	 * a newline is encountered in the output stream.  However, we do not
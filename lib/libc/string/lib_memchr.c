@@ -58,6 +58,10 @@
 
 #include <string.h>
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+#include "lib_wordops.h"
+#endif
+
 /****************************************************************************
  * Global Functions
  ****************************************************************************/
@@ -79,8 +83,42 @@
 FAR void *memchr(FAR const void *s, int c, size_t n)
 {
 	FAR const unsigned char *p = (FAR const unsigned char *)s;
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	lib_word_t pattern;
+	lib_word_t mask;
+#ifdef LIB_HAVE_VECTOR
+	size_t done;
+#endif
+#endif
 
 	if (s) {
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+		while (n > 0 && !LIB_ALIGNED(p)) {
+			if (*p == (unsigned char)c) {
+				return (FAR void *)p;
+			}
+			p++;
+			n--;
+		}
+
+#ifdef LIB_HAVE_VECTOR
+		done = lib_vector_find(p, (unsigned char)c, n);
+		p += done;
+		n -= done;
+#endif
+
+		/* 'c' is at the zero bytes of a word xor'ed with the pattern */
+
+		pattern = LIB_REPEAT(c);
+		while (n >= LIB_WORDSIZE) {
+			mask = lib_zerobytes(*(FAR const lib_word_t *)p ^ pattern);
+			if (mask != 0) {
+				return (FAR void *)(p + LIB_FIRSTBYTE(mask));
+			}
+			p += LIB_WORDSIZE;
+			n -= LIB_WORDSIZE;
+		}
+#endif
 		while (n--) {
 			if (*p == (unsigned char)c) {
 				return (FAR void *)p;
@@ -62,6 +62,10 @@
 #include <sys/types.h>
 #include <string.h>
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+#include "lib_wordops.h"
+#endif
+
 /************************************************************
  * Global Functions
  ************************************************************/
@@ -71,6 +75,47 @@ int memcmp(FAR const void *s1, FAR const void *s2, size_t n)
 {
 	unsigned char *p1 = (unsigned char *)s1;
 	unsigned char *p2 = (unsigned char *)s2;
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	FAR const lib_word_t *pword;
+	lib_word_t w0;
+	lib_word_t w1;
+	unsigned int k;
+
+	/* Skip the equal words; the bytewise loop below then finds the first
+	 * difference, which is in the next word if any.
+	 */
+
+	while (n > 0 && !LIB_ALIGNED(p1)) {
+		if (*p1 != *p2) {
+			return *p1 < *p2 ? -1 : 1;
+		}
+		p1++;
+		p2++;
+		n--;
+	}
+
+	k = (uintptr_t)p2 & LIB_WORDMASK;
+	if (k == 0) {
+		while (n >= LIB_WORDSIZE && *(FAR const lib_word_t *)p1 == *(FAR const lib_word_t *)p2) {
+			p1 += LIB_WORDSIZE;
+			p2 += LIB_WORDSIZE;
+			n -= LIB_WORDSIZE;
+		}
+	} else if (n >= LIB_WORDSIZE) {
+		pword = (FAR const lib_word_t *)(p2 - k);
+		w0 = *pword++;
+		do {
+			w1 = *pword++;
+			if (*(FAR const lib_word_t *)p1 != LIB_MERGE(w0, w1, k)) {
+				break;
+			}
+			w0 = w1;
+			p1 += LIB_WORDSIZE;
+			p2 += LIB_WORDSIZE;
+			n -= LIB_WORDSIZE;
+		} while (n >= LIB_WORDSIZE);
+	}
+#endif
 
 	while (n-- > 0) {
 		if (*p1 < *p2) {
@@ -62,6 +62,10 @@
 #include <sys/types.h>
 #include <string.h>
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+#include "lib_wordops.h"
+#endif
+
 /****************************************************************************
  * Global Functions
  ****************************************************************************/
@@ -75,6 +79,67 @@ FAR void *memcpy(FAR void *dest, FAR const void *src, size_t n)
 {
 	FAR unsigned char *pout = (FAR unsigned char *)dest;
 	FAR unsigned char *pin = (FAR unsigned char *)src;
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	FAR const lib_word_t *pword;
+	lib_word_t w0;
+	lib_word_t w1;
+	unsigned int k;
+#ifdef LIB_HAVE_VECTOR
+	size_t done;
+#endif
+
+	/* Copy bytewise until the destination is aligned */
+
+	while (n > 0 && !LIB_ALIGNED(pout)) {
+		*pout++ = *pin++;
+		n--;
+	}
+
+#ifdef LIB_HAVE_VECTOR
+	done = lib_vector_copy(pout, pin, n);
+	pout += done;
+	pin += done;
+	n -= done;
+#endif
+
+	k = (uintptr_t)pin & LIB_WORDMASK;
+	if (k == 0) {
+		/* Both are aligned, copy four words and then one word at a time */
+
+		while (n >= 4 * LIB_WORDSIZE) {
+			((FAR lib_word_t *)pout)[0] = ((FAR const lib_word_t *)pin)[0];
+			((FAR lib_word_t *)pout)[1] = ((FAR const lib_word_t *)pin)[1];
+			((FAR lib_word_t *)pout)[2] = ((FAR const lib_word_t *)pin)[2];
+			((FAR lib_word_t *)pout)[3] = ((FAR const lib_word_t *)pin)[3];
+			pout += 4 * LIB_WORDSIZE;
+			pin += 4 * LIB_WORDSIZE;
+			n -= 4 * LIB_WORDSIZE;
+		}
+	} else if (n >= LIB_WORDSIZE) {
+		/* Only the destination is aligned, build each word from the two
+		 * aligned source words it straddles.
+		 */
+
+		pword = (FAR const lib_word_t *)(pin - k);
+		w0 = *pword++;
+		do {
+			w1 = *pword++;
+			*(FAR lib_word_t *)pout = LIB_MERGE(w0, w1, k);
+			w0 = w1;
+			pout += LIB_WORDSIZE;
+			pin += LIB_WORDSIZE;
+			n -= LIB_WORDSIZE;
+		} while (n >= LIB_WORDSIZE);
+	}
+
+	while (n >= LIB_WORDSIZE) {
+		*(FAR lib_word_t *)pout = *(FAR const lib_word_t *)pin;
+		pout += LIB_WORDSIZE;
+		pin += LIB_WORDSIZE;
+		n -= LIB_WORDSIZE;
+	}
+#endif
+
 	while (n-- > 0) {
 		*pout++ = *pin++;
 	}
@@ -62,6 +62,10 @@
 #include <sys/types.h>
 #include <string.h>
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+#include "lib_wordops.h"
+#endif
+
 /************************************************************
  * Global Functions
  ************************************************************/
@@ -70,15 +74,100 @@
 FAR void *memmove(FAR void *dest, FAR const void *src, size_t count)
 {
 	char *tmp, *s;
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	FAR const lib_word_t *pword;
+	lib_word_t w0;
+	lib_word_t w1;
+	unsigned int k;
+#ifdef LIB_HAVE_VECTOR
+	size_t done;
+#endif
+#endif
 	if (dest <= src) {
 		tmp = (char *)dest;
 		s = (char *)src;
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+		/* Each word or vector is loaded before it is stored, so whole words
+		 * can be moved down whatever the overlap. A word built from two
+		 * source words needs them not to be overwritten first, which holds
+		 * once the destination is at least a word below the source.
+		 */
+
+		while (count > 0 && !LIB_ALIGNED(tmp)) {
+			*tmp++ = *s++;
+			count--;
+		}
+
+#ifdef LIB_HAVE_VECTOR
+		done = lib_vector_copy((FAR uint8_t *)tmp, (FAR const uint8_t *)s, count);
+		tmp += done;
+		s += done;
+		count -= done;
+#endif
+
+		k = (uintptr_t)s & LIB_WORDMASK;
+		if (k == 0) {
+			while (count >= LIB_WORDSIZE) {
+				*(FAR lib_word_t *)tmp = *(FAR const lib_word_t *)s;
+				tmp += LIB_WORDSIZE;
+				s += LIB_WORDSIZE;
+				count -= LIB_WORDSIZE;
+			}
+		} else if ((size_t)(s - tmp) >= LIB_WORDSIZE && count >= LIB_WORDSIZE) {
+			pword = (FAR const lib_word_t *)(s - k);
+			w0 = *pword++;
+			do {
+				w1 = *pword++;
+				*(FAR lib_word_t *)tmp = LIB_MERGE(w0, w1, k);
+				w0 = w1;
+				tmp += LIB_WORDSIZE;
+				s += LIB_WORDSIZE;
+				count -= LIB_WORDSIZE;
+			} while (count >= LIB_WORDSIZE);
+		}
+#endif
 		while (count--) {
 			*tmp++ = *s++;
 		}
 	} else {
 		tmp = (char *)dest + count;
 		s = (char *)src + count;
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+		/* The same as above, from the end */
+
+		while (count > 0 && !LIB_ALIGNED(tmp)) {
+			*--tmp = *--s;
+			count--;
+		}
+
+#ifdef LIB_HAVE_VECTOR
+		done = lib_vector_copy_backward((FAR uint8_t *)tmp - count, (FAR const uint8_t *)s - count, count);
+		tmp -= done;
+		s -= done;
+		count -= done;
+#endif
+
+		k = (uintptr_t)s & LIB_WORDMASK;
+		if (k == 0) {
+			while (count >= LIB_WORDSIZE) {
+				tmp -= LIB_WORDSIZE;
+				s -= LIB_WORDSIZE;
+				*(FAR lib_word_t *)tmp = *(FAR const lib_word_t *)s;
+				count -= LIB_WORDSIZE;
+			}
+		} else if ((size_t)(tmp - s) >= LIB_WORDSIZE && count >= LIB_WORDSIZE) {
+			pword = (FAR const lib_word_t *)(s - k);
+			w1 = *pword;
+			do {
+				w0 = *--pword;
+				tmp -= LIB_WORDSIZE;
+				s -= LIB_WORDSIZE;
+				*(FAR lib_word_t *)tmp = LIB_MERGE(w0, w1, k);
+				w1 = w0;
+				count -= LIB_WORDSIZE;
+			} while (count >= LIB_WORDSIZE);
+		}
+#endif
 		while (count--) {
 			*--tmp = *--s;
 		}
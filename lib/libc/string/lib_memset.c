@@ -63,6 +63,10 @@
 #include <string.h>
 #include <assert.h>
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+#include "lib_wordops.h"
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -75,6 +79,12 @@
 #undef CONFIG_MEMSET_64BIT
 #endif
 
+/* The word-at-a-time string functions include the speed version */
+
+#if defined(CONFIG_LIBC_STRING_OPTSPEED) && !defined(CONFIG_MEMSET_OPTSPEED)
+#define CONFIG_MEMSET_OPTSPEED 1
+#endif
+
 /****************************************************************************
  * Global Functions
  ****************************************************************************/
@@ -89,11 +99,14 @@ void *memset(void *s, int c, size_t n)
 	 */
 
 	uintptr_t addr = (uintptr_t)s;
-	uint16_t val16 = ((uint16_t)c << 8) | (uint16_t)c;
+	uint16_t val16 = ((uint16_t)(uint8_t)c << 8) | (uint16_t)(uint8_t)c;
 	uint32_t val32 = ((uint32_t)val16 << 16) | (uint32_t)val16;
 #ifdef CONFIG_MEMSET_64BIT
 	uint64_t val64 = ((uint64_t)val32 << 32) | (uint64_t)val32;
 #endif
+#ifdef LIB_HAVE_VECTOR
+	size_t done;
+#endif
 
 	/* Make sure that there is something to be cleared */
 
@@ -118,6 +131,13 @@ void *memset(void *s, int c, size_t n)
 				addr += 2;
 				n -= 2;
 			}
+#ifdef LIB_HAVE_VECTOR
+			/* Fill 16 bytes at a time while possible */
+
+			done = lib_vector_set((FAR uint8_t *)addr, (uint8_t)c, n);
+			addr += done;
+			n -= done;
+#endif
 #ifndef CONFIG_MEMSET_64BIT
 			/* Loop while there are at least 32-bits left to be written */
 
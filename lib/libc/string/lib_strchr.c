@@ -58,6 +58,10 @@
 
 #include <string.h>
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+#include "lib_wordops.h"
+#endif
+
 /****************************************************************************
  * Global Functions
  ****************************************************************************/
@@ -79,7 +83,34 @@
 #ifndef CONFIG_ARCH_STRCHR
 FAR char *strchr(FAR const char *s, int c)
 {
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	lib_word_t pattern;
+	lib_word_t w;
+#endif
+
 	if (s) {
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+		/* Skip the words which hold neither 'c' nor the terminator */
+
+		for (; !LIB_ALIGNED(s); s++) {
+			if (*s == c) {
+				return (FAR char *)s;
+			}
+
+			if (!*s) {
+				return NULL;
+			}
+		}
+
+		pattern = LIB_REPEAT(c);
+		for (;;) {
+			w = *(FAR const lib_word_t *)s;
+			if ((lib_zerobytes(w) | lib_zerobytes(w ^ pattern)) != 0) {
+				break;
+			}
+			s += LIB_WORDSIZE;
+		}
+#endif
 		for (;; s++) {
 			if (*s == c) {
 				return (FAR char *)s;
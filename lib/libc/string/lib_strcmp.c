@@ -58,6 +58,10 @@
 
 #include <string.h>
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+#include "lib_wordops.h"
+#endif
+
 /****************************************************************************
  * Public Functions
  *****************************************************************************/
@@ -66,6 +70,30 @@
 int strcmp(const char *cs, const char *ct)
 {
 	register signed char result;
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	lib_word_t w;
+
+	/* Skip the equal words without a terminator when both strings have the
+	 * same alignment; the bytewise loop then finishes the comparison.
+	 */
+
+	if ((((uintptr_t)cs ^ (uintptr_t)ct) & LIB_WORDMASK) == 0) {
+		for (; !LIB_ALIGNED(cs); cs++, ct++) {
+			if ((result = *cs - *ct) != 0 || !*cs) {
+				return result;
+			}
+		}
+
+		for (;;) {
+			w = *(FAR const lib_word_t *)cs;
+			if (w != *(FAR const lib_word_t *)ct || lib_zerobytes(w) != 0) {
+				break;
+			}
+			cs += LIB_WORDSIZE;
+			ct += LIB_WORDSIZE;
+		}
+	}
+#endif
 	for (;;) {
 		if ((result = *cs - *ct++) != 0 || !*cs++) {
 			break;
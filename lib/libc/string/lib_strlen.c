@@ -58,6 +58,10 @@
 #include <sys/types.h>
 #include <string.h>
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+#include "lib_wordops.h"
+#endif
+
 /****************************************************************************
  * Global Functions
  ****************************************************************************/
@@ -66,10 +70,28 @@
 size_t strlen(const char *s)
 {
 	const char *sc;
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	lib_word_t mask;
+#endif
 	if (s == NULL) {
 		return 0;
 	}
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	/* An aligned word never spans past the page holding the terminator */
+
+	for (sc = s; !LIB_ALIGNED(sc); ++sc) {
+		if (*sc == '\0') {
+			return sc - s;
+		}
+	}
+
+	while ((mask = lib_zerobytes(*(FAR const lib_word_t *)sc)) == 0) {
+		sc += LIB_WORDSIZE;
+	}
+	return sc - s + LIB_FIRSTBYTE(mask);
+#else
 	for (sc = s; *sc != '\0'; ++sc);
 	return sc - s;
+#endif
 }
 #endif
@@ -0,0 +1,227 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __LIB_LIBC_STRING_LIB_WORDOPS_H
+#define __LIB_LIBC_STRING_LIB_WORDOPS_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef CONFIG_LIBC_STRING_VECTOR
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#define LIB_HAVE_VECTOR 1
+#elif defined(__ARM_FEATURE_MVE)
+#include <arm_mve.h>
+#define LIB_HAVE_VECTOR 1
+#endif
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Helpers for the word-at-a-time string and memory functions, see
+ * CONFIG_LIBC_STRING_OPTSPEED. A word is read only once its address is
+ * aligned, so a read never crosses into a page or region which the
+ * bytewise version would not have touched.
+ */
+
+typedef uintptr_t lib_word_t;
+
+#define LIB_WORDSIZE           sizeof(lib_word_t)
+#define LIB_WORDMASK           (LIB_WORDSIZE - 1)
+#define LIB_ALIGNED(p)         (((uintptr_t)(p) & LIB_WORDMASK) == 0)
+
+/* 0x0101..01 and 0x8080..80 */
+
+#define LIB_ONES               ((lib_word_t)-1 / 0xff)
+#define LIB_HIGHS              (LIB_ONES << 7)
+
+/* The byte 'c' copied into every byte of a word */
+
+#define LIB_REPEAT(c)          (LIB_ONES * (uint8_t)(c))
+
+/* Index, in memory order, of the first byte flagged in a non zero mask
+ * returned by lib_zerobytes(). lib_word_t has the size of a long.
+ */
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define LIB_FIRSTBYTE(mask)    ((unsigned int)__builtin_clzl(mask) / 8)
+#else
+#define LIB_FIRSTBYTE(mask)    ((unsigned int)__builtin_ctzl(mask) / 8)
+#endif
+
+/* The word which starts 'k' bytes, 0 < k < LIB_WORDSIZE, into the aligned
+ * word 'w0' and ends in the aligned word 'w1' which follows it.
+ */
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define LIB_MERGE(w0, w1, k)   (((w0) << (8 * (k))) | ((w1) >> (8 * (LIB_WORDSIZE - (k)))))
+#else
+#define LIB_MERGE(w0, w1, k)   (((w0) >> (8 * (k))) | ((w1) << (8 * (LIB_WORDSIZE - (k)))))
+#endif
+
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: lib_zerobytes
+ *
+ * Description:
+ *   Flag the zero bytes of 'x'
+ *
+ * Returned Value:
+ *   A word whose bytes are zero where the bytes of 'x' are not, and have
+ *   their high bit set where the bytes of 'x' are zero
+ *
+ ****************************************************************************/
+
+static inline lib_word_t lib_zerobytes(lib_word_t x)
+{
+#if defined(__ARM_FEATURE_SIMD32) && !defined(__aarch64__)
+	lib_word_t mask;
+
+	/* UADD8 sets the GE flag of every non zero byte, SEL then takes 0x00
+	 * for those bytes and 0xff for the zero bytes.
+	 */
+
+	__asm__("uadd8 %0, %1, %2\n\tsel %0, %3, %2" : "=&r"(mask) : "r"(x), "r"(0xffffffffu), "r"(0u) : "cc");
+	return mask;
+#else
+	/* Adding 0x7f to the low seven bits of a byte carries into its high bit
+	 * unless they are all zero; the high bit of 'x' itself is or'ed in.
+	 */
+
+	return ~(((x & ~LIB_HIGHS) + ~LIB_HIGHS) | x | ~LIB_HIGHS);
+#endif
+}
+
+#ifdef LIB_HAVE_VECTOR
+/****************************************************************************
+ * Name: lib_vector_copy
+ *
+ * Description:
+ *   Copy the 16-byte blocks of 'n' bytes from 'src' to 'dest', lowest
+ *   block first. Each block is loaded before it is stored.
+ *
+ * Returned Value:
+ *   Number of bytes copied, a multiple of 16
+ *
+ ****************************************************************************/
+
+static inline size_t lib_vector_copy(FAR uint8_t *dest, FAR const uint8_t *src, size_t n)
+{
+	size_t done;
+
+	for (done = 0; n - done >= 16; done += 16) {
+		vst1q_u8(dest + done, vld1q_u8(src + done));
+	}
+
+	return done;
+}
+
+/****************************************************************************
+ * Name: lib_vector_copy_backward
+ *
+ * Description:
+ *   Copy the 16-byte blocks at the end of the 'n' bytes from 'src' to
+ *   'dest', highest block first, for memmove() with 'dest' above 'src'.
+ *
+ * Returned Value:
+ *   Number of bytes copied, a multiple of 16
+ *
+ ****************************************************************************/
+
+static inline size_t lib_vector_copy_backward(FAR uint8_t *dest, FAR const uint8_t *src, size_t n)
+{
+	size_t done;
+
+	for (done = 0; n - done >= 16; done += 16) {
+		vst1q_u8(dest + n - done - 16, vld1q_u8(src + n - done - 16));
+	}
+
+	return done;
+}
+
+/****************************************************************************
+ * Name: lib_vector_set
+ *
+ * Description:
+ *   Fill the 16-byte blocks of 'n' bytes at 'dest' with 'c'
+ *
+ * Returned Value:
+ *   Number of bytes filled, a multiple of 16
+ *
+ ****************************************************************************/
+
+static inline size_t lib_vector_set(FAR uint8_t *dest, uint8_t c, size_t n)
+{
+	uint8x16_t v = vdupq_n_u8(c);
+	size_t done;
+
+	for (done = 0; n - done >= 16; done += 16) {
+		vst1q_u8(dest + done, v);
+	}
+
+	return done;
+}
+
+/****************************************************************************
+ * Name: lib_vector_find
+ *
+ * Description:
+ *   Skip the 16-byte blocks of 'n' bytes at 's' which do not contain 'c'
+ *
+ * Returned Value:
+ *   Number of bytes skipped, a multiple of 16. The block which follows, if
+ *   complete, contains 'c'.
+ *
+ ****************************************************************************/
+
+static inline size_t lib_vector_find(FAR const uint8_t *s, uint8_t c, size_t n)
+{
+	size_t done;
+
+	for (done = 0; n - done >= 16; done += 16) {
+#if defined(__ARM_NEON)
+		uint8x16_t eq = vceqq_u8(vld1q_u8(s + done), vdupq_n_u8(c));
+		uint8x8_t any = vorr_u8(vget_low_u8(eq), vget_high_u8(eq));
+
+		if (vget_lane_u64(vreinterpret_u64_u8(any), 0) != 0) {
+			break;
+		}
+#else
+		if (vcmpeqq_n_u8(vld1q_u8(s + done), c) != 0) {
+			break;
+		}
+#endif
+	}
+
+	return done;
+}
+#endif /* LIB_HAVE_VECTOR */
+
+#endif /* __LIB_LIBC_STRING_LIB_WORDOPS_H */
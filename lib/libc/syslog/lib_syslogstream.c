@@ -106,6 +106,31 @@ static void syslogstream_putc(FAR struct lib_outstream_s *this, int ch)
 	} while (errno == -EINTR);
 }
 
+/****************************************************************************
+ * Name: syslogstream_puts
+ ****************************************************************************/
+
+static void syslogstream_puts(FAR struct lib_outstream_s *this, FAR const void *buf, int len)
+{
+	FAR const char *ptr = (FAR const char *)buf;
+	int ret;
+
+	/* Hand the whole run to the logging device, continuing after a partial
+	 * write and retrying in the same way as syslogstream_putc().
+	 */
+
+	while (len > 0) {
+		ret = syslog_puts(ptr, len);
+		if (ret != EOF) {
+			this->nput += ret;
+			ptr += ret;
+			len -= ret;
+		} else if (errno != -EINTR) {
+			break;
+		}
+	}
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -128,6 +153,7 @@ static void syslogstream_putc(FAR struct lib_outstream_s *this, int ch)
 void lib_syslogstream(FAR struct lib_outstream_s *stream)
 {
 	stream->put = syslogstream_putc;
+	stream->puts = syslogstream_puts;
 #ifdef CONFIG_STDIO_LINEBUFFER
 	stream->flush = lib_noflush;
 #endif
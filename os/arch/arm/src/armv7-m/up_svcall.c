@@ -65,6 +65,9 @@
 #include <tinyara/arch.h>
 #include <tinyara/sched.h>
 #include <tinyara/userspace.h>
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SYSCALL
+#include <tinyara/sched_note.h>
+#endif
 
 #ifdef CONFIG_LIB_SYSCALL
 #include <syscall.h>
@@ -328,6 +331,9 @@ int up_svcall(int irq, FAR void *context, FAR void *arg)
 		 */
 
 		regs[REG_R0] = regs[REG_R2];
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SYSCALL
+		sched_note_syscall_leave(rtcb->xcp.syscall[index].cmd, regs[REG_R0]);
+#endif
 	}
 	break;
 #endif
@@ -523,6 +529,12 @@ int up_svcall(int irq, FAR void *context, FAR void *arg)
 #endif
 		rtcb->xcp.nsyscalls = index + 1;
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SYSCALL
+		/* Record the call with its arguments in R1-R6 */
+		rtcb->xcp.syscall[index].cmd = cmd - CONFIG_SYS_RESERVED;
+		sched_note_syscall_enter(cmd - CONFIG_SYS_RESERVED, g_funcnparms[cmd - CONFIG_SYS_RESERVED], regs[REG_R1], regs[REG_R2], regs[REG_R3], regs[REG_R4], regs[REG_R5], regs[REG_R6]);
+#endif
+
 		regs[REG_PC] = (uint32_t)dispatch_syscall;
 #if defined(CONFIG_BUILD_PROTECTED)
 		regs[REG_EXC_RETURN] = EXC_RETURN_PRIVTHR;
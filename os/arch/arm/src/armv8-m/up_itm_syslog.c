@@ -165,4 +165,18 @@ int syslog_putc(int ch)
 	return ch;
 }
 
+/****************************************************************************
+ * Name: syslog_puts
+ *
+ * Description:
+ *   Write a run of characters to the ITM port.  The stimulus port takes one
+ *   byte at a time, so the run goes out one syslog_putc() per character.
+ *
+ ****************************************************************************/
+
+int syslog_puts(FAR const char *buf, size_t buflen)
+{
+	return syslog_putc_run(buf, buflen);
+}
+
 #endif							/* CONFIG_SYSLOG && CONFIG_ARMV8M_ITMSYSLOG */
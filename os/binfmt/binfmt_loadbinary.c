@@ -114,6 +114,9 @@ int load_binary(int binary_idx, FAR const char *filename, load_attr_t *load_attr
 		memcpy((void *)bin->sections[BIN_DATA], (const void *)bin->data_backup, bin->sizes[BIN_DATA]);
 		memset((void *)bin->sections[BIN_BSS], 0, bin->sizes[BIN_BSS]);
 		bin->reload = false;
+#ifdef CONFIG_BINMGR_LOAD_TIME
+		memset(&bin->loadtime, 0, sizeof(bin->loadtime));
+#endif
 	} else {
 #endif
 
@@ -59,6 +59,7 @@
 #include <sys/types.h>
 #include <stdint.h>
 #include <string.h>
+#include <time.h>
 #include <debug.h>
 #include <errno.h>
 
@@ -191,6 +192,20 @@ static void elf_dumpentrypt(FAR struct binary_s *binp, FAR struct elf_loadinfo_s
 #define elf_dumpentrypt(b, l)
 #endif
 
+/****************************************************************************
+ * Name: elf_gettime_us
+ ****************************************************************************/
+
+#ifdef CONFIG_BINMGR_LOAD_TIME
+static uint32_t elf_gettime_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+#endif
+
 /****************************************************************************
  * Name: elf_loadbinary
  *
@@ -204,6 +219,9 @@ static int elf_loadbinary(FAR struct binary_s *binp)
 {
 	struct elf_loadinfo_s loadinfo;	/* Contains globals for libelf */
 	int ret;
+#ifdef CONFIG_BINMGR_LOAD_TIME
+	uint32_t start;
+#endif
 
 	binfo("Loading file: %s\n", binp->filename);
 
@@ -216,6 +234,9 @@ static int elf_loadbinary(FAR struct binary_s *binp)
 	loadinfo.filelen = binp->filelen;
 	loadinfo.binp = binp;
 
+#ifdef CONFIG_BINMGR_LOAD_TIME
+	start = elf_gettime_us();
+#endif
 	ret = elf_init(binp->filename, &loadinfo);
 	if (ret != 0) {
 		elf_dumploadinfo(&loadinfo);
@@ -225,6 +246,10 @@ static int elf_loadbinary(FAR struct binary_s *binp)
 
 	/* Load the program binary */
 
+#ifdef CONFIG_BINMGR_LOAD_TIME
+	binp->loadtime.init_us = elf_gettime_us() - start;
+	start += binp->loadtime.init_us;
+#endif
 	ret = elf_load(&loadinfo);
 	elf_dumploadinfo(&loadinfo);
 	if (ret != 0) {
@@ -234,11 +259,20 @@ static int elf_loadbinary(FAR struct binary_s *binp)
 
 	/* Bind the program to the exported symbol table */
 
+#ifdef CONFIG_BINMGR_LOAD_TIME
+	binp->loadtime.load_us = elf_gettime_us() - start;
+	start += binp->loadtime.load_us;
+#endif
 	ret = elf_bind(&loadinfo, binp->exports, binp->nexports);
 	if (ret != 0) {
 		berr("Failed to bind symbols program binary: %d\n", ret);
 		goto errout_with_load;
 	}
+#ifdef CONFIG_BINMGR_LOAD_TIME
+	binp->loadtime.bind_us = elf_gettime_us() - start;
+	binp->loadtime.nrelocs = loadinfo.nrelocs;
+	binp->loadtime.nlookups = loadinfo.nlookups;
+#endif
 
 
 	binp->entrypt = (main_t)((uint32_t)loadinfo.binp->sections[BIN_TEXT] + loadinfo.ehdr.e_entry);
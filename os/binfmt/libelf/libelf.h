@@ -224,6 +224,37 @@ int elf_readsym(FAR struct elf_loadinfo_s *loadinfo, int index, FAR Elf32_Sym *s
 
 int elf_symvalue(FAR struct elf_loadinfo_s *loadinfo, FAR Elf32_Sym *sym, FAR const struct symtab_s *exports, int nexports);
 
+#ifndef CONFIG_SUPPORT_COMMON_BINARY
+/****************************************************************************
+ * Name: elf_exporthash_init
+ *
+ * Description:
+ *   Build hash buckets over the exported symbols for elf_symvalue().
+ *
+ * Input Parameters:
+ *   loadinfo - Load state information
+ *   exports  - The symbol table to use for resolving undefined symbols.
+ *   nexports - Number of symbols in the symbol table.
+ *
+ * Returned Value:
+ *   0 (OK) is returned on success and a negated errno is returned on
+ *   failure.  Without the buckets, elf_symvalue() searches the table.
+ *
+ ****************************************************************************/
+
+int elf_exporthash_init(FAR struct elf_loadinfo_s *loadinfo, FAR const struct symtab_s *exports, int nexports);
+
+/****************************************************************************
+ * Name: elf_exporthash_free
+ *
+ * Description:
+ *   Free the hash buckets built by elf_exporthash_init().
+ *
+ ****************************************************************************/
+
+void elf_exporthash_free(FAR struct elf_loadinfo_s *loadinfo);
+#endif
+
 /****************************************************************************
  * Name: elf_symname
  *
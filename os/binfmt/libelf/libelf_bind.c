@@ -56,6 +56,7 @@
 
 #include <tinyara/config.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 #include <errno.h>
@@ -97,24 +98,58 @@ static int g_num_lib_syms;
  ****************************************************************************/
 
 /****************************************************************************
- * Name: elf_readreltab
+ * Name: elf_allocreltab
  *
  * Description:
- *   Read the relocation table into memory.
+ *   Allocate one buffer for the largest relocation section, which is
+ *   reused to read each relocation section at once.
  *
  ****************************************************************************/
-static inline void elf_readreltab(FAR struct elf_loadinfo_s *loadinfo, FAR const Elf32_Shdr *relsec)
+static void elf_allocreltab(FAR struct elf_loadinfo_s *loadinfo)
 {
-	loadinfo->reltab = (uintptr_t)kmm_malloc(relsec->sh_size);
+	int i;
 
-	if (!loadinfo->reltab) {
-		berr("ERROR: Failed to allocate space for relocation table. Size = %u\n", relsec->sh_size);
+	loadinfo->rellen = 0;
+	for (i = 1; i < loadinfo->ehdr.e_shnum; i++) {
+		if (loadinfo->shdr[i].sh_type == SHT_REL && loadinfo->shdr[i].sh_size > loadinfo->rellen) {
+			loadinfo->rellen = loadinfo->shdr[i].sh_size;
+		}
+	}
+
+	if (loadinfo->rellen == 0) {
 		return;
 	}
 
+	loadinfo->reltab = (uintptr_t)kmm_malloc(loadinfo->rellen);
+	if (!loadinfo->reltab) {
+		berr("ERROR: Failed to allocate space for relocation table. Size = %u\n", loadinfo->rellen);
+		loadinfo->rellen = 0;
+	}
+}
+
+/****************************************************************************
+ * Name: elf_readreltab
+ *
+ * Description:
+ *   Read a relocation section into the buffer of elf_allocreltab().
+ *
+ * Returned Value:
+ *   true if the section is in memory.  Otherwise, each relocation is read
+ *   with elf_readrel().
+ *
+ ****************************************************************************/
+static inline bool elf_readreltab(FAR struct elf_loadinfo_s *loadinfo, FAR const Elf32_Shdr *relsec)
+{
+	if (!loadinfo->reltab || relsec->sh_size > loadinfo->rellen) {
+		return false;
+	}
+
 	if (elf_read(loadinfo, (FAR uint8_t *)loadinfo->reltab, relsec->sh_size, relsec->sh_offset) < 0) {
 		berr("ERROR: Failed to read relocation table into memory\n");
+		return false;
 	}
+
+	return true;
 }
 
 
@@ -132,7 +167,7 @@ static inline int elf_readrel(FAR struct elf_loadinfo_s *loadinfo, FAR const Elf
 
 	/* Verify that the symbol table index lies within symbol table */
 
-	if (index < 0 || index > (relsec->sh_size / sizeof(Elf32_Rel))) {
+	if (index < 0 || index >= (relsec->sh_size / sizeof(Elf32_Rel))) {
 		berr("Bad relocation symbol index: %d\n", index);
 		return -EINVAL;
 	}
@@ -165,12 +200,13 @@ static int elf_relocate(FAR struct elf_loadinfo_s *loadinfo, int relidx, FAR con
 	FAR Elf32_Sym *psym;
 	Elf32_Rel *prel;
 	uintptr_t addr;
+	bool inmem;
 	int symidx;
 	int ret = OK;
 	int i;
 
 	/* Read the relocation table into memory */
-	elf_readreltab(loadinfo, relsec);
+	inmem = elf_readreltab(loadinfo, relsec);
 
 	/* Examine each relocation in the section.  'relsec' is the section
 	 * containing the relations.  'dstsec' is the section containing the data
@@ -181,21 +217,14 @@ static int elf_relocate(FAR struct elf_loadinfo_s *loadinfo, int relidx, FAR con
 		psym = &sym;
 		prel = &rel;
 
-
 		/* Read the relocation entry into memory */
-		if (loadinfo->reltab) {
-			/* Verify that the relocation table index lies within relocation table */
-			if (i < 0 || i > (relsec->sh_size / sizeof(Elf32_Rel))) {
-				berr("Bad relocation symbol index: %d\n", i);
-				ret = -EINVAL;
-				goto ret_err;
-			}
+		if (inmem) {
 			prel = (Elf32_Rel *)(loadinfo->reltab + sizeof(Elf32_Rel) * i);
 		} else {
 			ret = elf_readrel(loadinfo, relsec, i, &rel);
 			if (ret < 0) {
 				berr("Section %d reloc %d: Failed to read relocation entry: %d\n", relidx, i, ret);
-				goto ret_err;
+				return ret;
 			}
 		}
 
@@ -208,20 +237,23 @@ static int elf_relocate(FAR struct elf_loadinfo_s *loadinfo, int relidx, FAR con
 		/* Read the symbol table entry into memory */
 		if (loadinfo->symtab) {
 			/* Verify that the symbol table index lies within symbol table */
-			if (symidx < 0 || symidx > (loadinfo->shdr[loadinfo->symtabidx].sh_size / sizeof(Elf32_Sym))) {
+			if (symidx < 0 || symidx >= (loadinfo->shdr[loadinfo->symtabidx].sh_size / sizeof(Elf32_Sym))) {
 				berr("Bad relocation symbol index: %d\n", symidx);
-				ret = -EINVAL;
-				goto ret_err;
+				return -EINVAL;
 			}
 			psym = (FAR Elf32_Sym *)(loadinfo->symtab + sizeof(Elf32_Sym) * symidx);
 		} else {
 			ret = elf_readsym(loadinfo, symidx, &sym);
 			if (ret < 0) {
 				berr("Section %d reloc %d: Failed to read symbol[%d]: %d\n", relidx, i, symidx, ret);
-				goto ret_err;
+				return ret;
 			}
 		}
-		/* Get the value of the symbol (in sym.st_value) */
+
+		/* Get the value of the symbol (in sym.st_value).  A symbol of the
+		 * symbol table in memory is updated in place to SHN_ABS, so the
+		 * next relocations against it do not resolve it again.
+		 */
 
 		ret = elf_symvalue(loadinfo, psym, exports, nexports);
 		if (ret < 0) {
@@ -240,7 +272,7 @@ static int elf_relocate(FAR struct elf_loadinfo_s *loadinfo, int relidx, FAR con
 				psym = NULL;
 			} else {
 				berr("Section %d reloc %d: Failed to get value of symbol[%d]: %d\n", relidx, i, symidx, ret);
-				goto ret_err;
+				return ret;
 			}
 		}
 
@@ -248,7 +280,7 @@ static int elf_relocate(FAR struct elf_loadinfo_s *loadinfo, int relidx, FAR con
 
 		if (prel->r_offset > dstsec->sh_size - sizeof(uint32_t)) {
 			berr("Section %d reloc %d: Relocation address out of range, offset %d size %d\n", relidx, i, prel->r_offset, dstsec->sh_size);
-			goto ret_err;
+			return -EINVAL;
 		}
 
 		addr = dstsec->sh_addr + prel->r_offset;
@@ -258,15 +290,13 @@ static int elf_relocate(FAR struct elf_loadinfo_s *loadinfo, int relidx, FAR con
 		ret = up_relocate(prel, psym, addr);
 		if (ret < 0) {
 			berr("ERROR: Section %d reloc %d: Relocation failed: %d\n", relidx, i, ret);
-			goto ret_err;
+			return ret;
 		}
+#ifdef CONFIG_BINMGR_LOAD_TIME
+		loadinfo->nrelocs++;
+#endif
 	}
 
-ret_err:
-	if (loadinfo->reltab) {
-		kmm_free((void *)loadinfo->reltab);
-		loadinfo->reltab = (uintptr_t)NULL;
-	}
 	return ret;
 }
 
@@ -392,8 +422,14 @@ int elf_bind(FAR struct elf_loadinfo_s *loadinfo, FAR const struct symtab_s *exp
 		exports = (struct symtab_s *)g_lib_symhash;
 		nexports = g_num_lib_syms;
 	}
+#else
+	/* Without the buckets, the exports are searched one by one */
+
+	(void)elf_exporthash_init(loadinfo, exports, nexports);
 #endif
 
+	elf_allocreltab(loadinfo);
+
 	/* Process relocations in every allocated section */
 
 	for (i = 1; i < loadinfo->ehdr.e_shnum; i++) {
@@ -438,7 +474,13 @@ int elf_bind(FAR struct elf_loadinfo_s *loadinfo, FAR const struct symtab_s *exp
 
 #ifdef CONFIG_SUPPORT_COMMON_BINARY
 ret_err:
+#else
+	elf_exporthash_free(loadinfo);
 #endif
+	if (loadinfo->reltab) {
+		kmm_free((void *)loadinfo->reltab);
+		loadinfo->reltab = (uintptr_t)NULL;
+	}
 	if (loadinfo->strtab) {
 		kmm_free((void *)loadinfo->strtab);
 		loadinfo->strtab = (uintptr_t)NULL;
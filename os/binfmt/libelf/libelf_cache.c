@@ -31,9 +31,6 @@
 #include <tinyara/fs/fs.h>
 #include "libelf.h"
 
-#ifdef CONFIG_COMPRESSED_BINARY
-#include <tinyara/binfmt/compression/compress_read.h>
-#endif
 /****************************************************************************
  * Private Declarations
  ****************************************************************************/
@@ -136,13 +133,8 @@ static off_t elf_cache_read_block(int filfd, uint16_t binary_header_size, FAR ui
 
 	binfo("filfd: %d block_number: %d binary_header_size: %d\n", filfd, block_number, binary_header_size);
 
-	/* Seek to location of 'block_number' block in elf file for uncompressed elf */
-#ifdef CONFIG_COMPRESSED_BINARY
-	rpos = binary_header_size + (block_number * cache_blocks_size);
-#else
+	/* Seek to location of 'block_number' block in elf file */
 	rpos = elf_cache_lseek_block(filfd, binary_header_size, block_number);
-#endif
-
 
 	if (rpos < 0) {
 		berr("Failed to seek to offset of block number %d\n", block_number);
@@ -156,13 +148,8 @@ static off_t elf_cache_read_block(int filfd, uint16_t binary_header_size, FAR ui
 		readsize = cache_blocks_size;
 	}
 
-#ifdef CONFIG_COMPRESSED_BINARY
-	/* Read readsize bytes from offset from uncompressed file into user buffer */
-	nbytes = compress_read(filfd, binary_header_size, buf, readsize, rpos - binary_header_size);
-#else
 	/* Read actual data to 'block_number's buf */
 	nbytes = read(filfd, buf, readsize);
-#endif
 
 	binfo("readsize: %d nbytes: %d rpos: %d\n", readsize, nbytes, rpos);
 
@@ -56,6 +56,7 @@
 
 #include <tinyara/config.h>
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
@@ -82,10 +83,132 @@
  * Private Functions
  ****************************************************************************/
 
+#ifndef CONFIG_SUPPORT_COMMON_BINARY
+/****************************************************************************
+ * Name: elf_hashname
+ *
+ * Description:
+ *   The hash function of the SysV ELF .hash section.
+ *
+ ****************************************************************************/
+
+static uint32_t elf_hashname(FAR const char *name)
+{
+	FAR const uint8_t *ptr = (FAR const uint8_t *)name;
+	uint32_t hash = 0;
+	uint32_t high;
+
+	while (*ptr != '\0') {
+		hash = (hash << 4) + *ptr++;
+		high = hash & 0xf0000000;
+		if (high != 0) {
+			hash ^= high >> 24;
+		}
+		hash &= ~high;
+	}
+
+	return hash;
+}
+
+/****************************************************************************
+ * Name: elf_findexport
+ *
+ * Description:
+ *   Find an exported symbol by name with the hash buckets built by
+ *   elf_exporthash_init().  Symbols of the same name are found in the
+ *   order of the table, as by symtab_findbyname().
+ *
+ ****************************************************************************/
+
+static FAR const struct symtab_s *elf_findexport(FAR struct elf_loadinfo_s *loadinfo, FAR const char *name, FAR const struct symtab_s *exports)
+{
+	FAR uint16_t *chain = loadinfo->exporthash + loadinfo->nbuckets;
+	uint16_t i;
+
+	for (i = loadinfo->exporthash[elf_hashname(name) & (loadinfo->nbuckets - 1)]; i != 0; i = chain[i - 1]) {
+		if (strcmp(exports[i - 1].sym_name, name) == 0) {
+			return &exports[i - 1];
+		}
+	}
+
+	return NULL;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
+#ifndef CONFIG_SUPPORT_COMMON_BINARY
+/****************************************************************************
+ * Name: elf_exporthash_init
+ *
+ * Description:
+ *   Build hash buckets over the exported symbols, so that each undefined
+ *   symbol of the module is found without searching the whole table.
+ *   A bucket holds the index + 1 of its first symbol, and the chain entry
+ *   of a symbol the index + 1 of the next one in its bucket, 0 ends both.
+ *
+ * Returned Value:
+ *   0 (OK) is returned on success and a negated errno is returned on
+ *   failure.  On failure, symbols are searched in the table itself.
+ *
+ ****************************************************************************/
+
+int elf_exporthash_init(FAR struct elf_loadinfo_s *loadinfo, FAR const struct symtab_s *exports, int nexports)
+{
+	FAR uint16_t *chain;
+	uint32_t bucket;
+	uint16_t nbuckets;
+	int i;
+
+	loadinfo->exporthash = NULL;
+	if (exports == NULL || nexports <= 0 || nexports >= UINT16_MAX) {
+		return -EINVAL;
+	}
+
+	/* About two symbols per bucket */
+
+	for (nbuckets = 1; nbuckets < nexports / 2; nbuckets <<= 1) {
+	}
+
+	loadinfo->exporthash = (FAR uint16_t *)kmm_zalloc((nbuckets + nexports) * sizeof(uint16_t));
+	if (!loadinfo->exporthash) {
+		berr("ERROR: Failed to allocate the hash of %d exported symbols\n", nexports);
+		return -ENOMEM;
+	}
+	loadinfo->nbuckets = nbuckets;
+	chain = loadinfo->exporthash + nbuckets;
+
+	/* Insert from the end, so that a chain is in the order of the table */
+
+	for (i = nexports - 1; i >= 0; i--) {
+		bucket = elf_hashname(exports[i].sym_name) & (nbuckets - 1);
+		chain[i] = loadinfo->exporthash[bucket];
+		loadinfo->exporthash[bucket] = i + 1;
+	}
+
+	binfo("Hashed %d exported symbols in %u buckets\n", nexports, nbuckets);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: elf_exporthash_free
+ *
+ * Description:
+ *   Free the hash buckets built by elf_exporthash_init().
+ *
+ ****************************************************************************/
+
+void elf_exporthash_free(FAR struct elf_loadinfo_s *loadinfo)
+{
+	if (loadinfo->exporthash) {
+		kmm_free(loadinfo->exporthash);
+		loadinfo->exporthash = NULL;
+	}
+}
+#endif
+
 /****************************************************************************
  * Name: elf_readstrtab
  *
@@ -226,6 +349,11 @@ void elf_readsymtab(FAR struct elf_loadinfo_s *loadinfo)
 
 	if (elf_read(loadinfo, (FAR uint8_t *)loadinfo->symtab, symtab->sh_size, symtab->sh_offset) < 0) {
 		berr("ERROR: Failed to load symbol table into memory\n");
+
+		/* Each symbol is read with elf_readsym() instead */
+
+		kmm_free((void *)loadinfo->symtab);
+		loadinfo->symtab = (uintptr_t)NULL;
 	}
 }
 
@@ -253,7 +381,7 @@ int elf_readsym(FAR struct elf_loadinfo_s *loadinfo, int index, FAR Elf32_Sym *s
 
 	/* Verify that the symbol table index lies within symbol table */
 
-	if (index < 0 || index > (symtab->sh_size / sizeof(Elf32_Sym))) {
+	if (index < 0 || index >= (symtab->sh_size / sizeof(Elf32_Sym))) {
 		berr("Bad relocation symbol index: %d\n", index);
 		return -EINVAL;
 	}
@@ -326,6 +454,10 @@ int elf_symvalue(FAR struct elf_loadinfo_s *loadinfo, FAR Elf32_Sym *sym, FAR co
 			return ret;
 		}
 
+#ifdef CONFIG_BINMGR_LOAD_TIME
+		loadinfo->nlookups++;
+#endif
+
 		/* Check if the base code exports a symbol of this name */
 #ifdef CONFIG_SUPPORT_COMMON_BINARY
 		if (!exports) {
@@ -342,11 +474,15 @@ int elf_symvalue(FAR struct elf_loadinfo_s *loadinfo, FAR Elf32_Sym *sym, FAR co
 
 #else
 
+		if (loadinfo->exporthash) {
+			symbol = elf_findexport(loadinfo, (FAR const char *)loadinfo->iobuffer, exports);
+		} else {
 #ifdef CONFIG_SYMTAB_ORDEREDBYNAME
-		symbol = symtab_findorderedbyname(exports, (FAR char *)loadinfo->iobuffer, nexports);
+			symbol = symtab_findorderedbyname(exports, (FAR char *)loadinfo->iobuffer, nexports);
 #else
-		symbol = symtab_findbyname(exports, (FAR char *)loadinfo->iobuffer, nexports);
+			symbol = symtab_findbyname(exports, (FAR char *)loadinfo->iobuffer, nexports);
 #endif
+		}
 		if (!symbol) {
 			berr("SHN_UNDEF: Exported symbol \"%s\" not found\n", loadinfo->iobuffer);
 			return -ENOENT;
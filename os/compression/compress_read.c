@@ -23,10 +23,17 @@
 #include <tinyara/kmalloc.h>
 #include <sys/types.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <unistd.h>
 #include <string.h>
 #include <debug.h>
 #include <errno.h>
+#ifdef CONFIG_COMPRESSION_PREFETCH
+#include <sched.h>
+#include <semaphore.h>
+#include <assert.h>
+#include <tinyara/kthread.h>
+#endif
 
 #include <tinyara/fs/fs.h>
 #include <tinyara/binfmt/compression/compress_read.h>
@@ -37,6 +44,69 @@
 #include <miniz/miniz.h>
 #endif
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+/* Size of the buffer holding one compressed block */
+#if CONFIG_COMPRESSION_TYPE == LZMA
+#define COMPRESS_READ_BUFFER_SIZE(blocksize)	((blocksize) + LZMA_PROPS_SIZE)
+#elif CONFIG_COMPRESSION_TYPE == MINIZ
+#define COMPRESS_READ_BUFFER_SIZE(blocksize)	compressBound(blocksize)
+#endif
+
+/* Number of compressed blocks held in read_buffer */
+#ifdef CONFIG_COMPRESSION_PREFETCH
+#define COMPRESS_READ_BUFFERS			CONFIG_COMPRESSION_PREFETCH_BUFFERS
+#else
+#define COMPRESS_READ_BUFFERS			1
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* A decompressed block kept in out_buffer */
+struct s_cache_block {
+	int block_number;		/* Block held by this entry, -1 if none */
+	unsigned int size;		/* Decompressed size of the block */
+	unsigned int last_used;		/* Value of cache_clock at the last access */
+};
+
+#ifdef CONFIG_COMPRESSION_PREFETCH
+/* A compressed block which is read, or was read, by the prefetch thread */
+struct s_prefetch_slot {
+	int block_number;		/* Block to read into this slot */
+	ssize_t nbytes;			/* Bytes read, or a negated errno */
+	sem_t done;			/* Posted when the read is complete */
+};
+
+/*
+ * Slots are issued and consumed in ring order. 'head' is the oldest slot
+ * issued but not yet waited for and 'tail' the next slot to issue. At most
+ * COMPRESS_READ_BUFFERS - 1 slots are in flight, so the slot just before
+ * 'head' can be decompressed while the thread reads the following ones.
+ */
+struct s_prefetch {
+	FAR struct file *filep;		/* File of the compressed binary */
+	pid_t pid;			/* Pid of the prefetch thread, -1 if none */
+	bool stop;			/* Asks the prefetch thread to exit */
+	sem_t request;			/* Posted once for each issued slot */
+	sem_t exited;			/* Posted by the prefetch thread on exit */
+	unsigned int head;
+	unsigned int tail;
+	unsigned int served;		/* Next slot for the prefetch thread to read */
+	struct s_prefetch_slot slots[COMPRESS_READ_BUFFERS];
+};
+#endif
+
 /****************************************************************************
  * Private Declarations
  ****************************************************************************/
@@ -44,6 +114,17 @@
 static struct s_header *compression_header;
 static struct s_buffer buffers;
 static int active_filefd = -1;
+static uint16_t active_header_size;
+
+/* Least recently used cache of decompressed blocks */
+static struct s_cache_block cache[CONFIG_COMPRESSION_CACHE_BLOCKS];
+static unsigned int cache_clock;
+static unsigned int cache_hits;
+static unsigned int blocks_decompressed;
+
+#ifdef CONFIG_COMPRESSION_PREFETCH
+static struct s_prefetch prefetch = { .pid = -1 };
+#endif
 
 /****************************************************************************
  * Private Functions
@@ -144,6 +225,7 @@ static off_t compress_offset_block(int filfd, uint16_t binary_header_size, int b
 	return position;
 }
 
+#ifndef CONFIG_COMPRESSION_PREFETCH
 /****************************************************************************
  * Name: compress_lseek_block
  *
@@ -231,6 +313,341 @@ static off_t compress_read_block(int filfd, uint16_t binary_header_size, FAR uin
 	return nbytes;
 }
 
+#endif
+
+#ifdef CONFIG_COMPRESSION_PREFETCH
+/****************************************************************************
+ * Name: compress_prefetch_wait
+ *
+ * Description:
+ *   Wait until the read into 'slot' is complete
+ *
+ * Returned Value:
+ *   None
+ ****************************************************************************/
+static void compress_prefetch_wait(FAR struct s_prefetch_slot *slot)
+{
+	while (sem_wait(&slot->done) != OK) {
+		ASSERT(get_errno() == EINTR);
+	}
+}
+
+/****************************************************************************
+ * Name: compress_prefetch_thread
+ *
+ * Description:
+ *   Read the issued compressed blocks into their slots, in issue order,
+ *   while the loading task decompresses the blocks read before them
+ *
+ * Returned Value:
+ *   OK (0) on exit
+ ****************************************************************************/
+static int compress_prefetch_thread(int argc, char *argv[])
+{
+	FAR struct s_prefetch_slot *slot;
+	off_t position;
+	ssize_t readsize;
+	unsigned int index;
+
+	while (true) {
+		while (sem_wait(&prefetch.request) != OK) {
+			ASSERT(get_errno() == EINTR);
+		}
+
+		if (prefetch.stop) {
+			break;
+		}
+
+		index = prefetch.served++ % COMPRESS_READ_BUFFERS;
+		slot = &prefetch.slots[index];
+
+		position = compress_offset_block(active_filefd, active_header_size, slot->block_number);
+		readsize = compress_offset_block(active_filefd, active_header_size, slot->block_number + 1) - position;
+		if (readsize < 0 || readsize > COMPRESS_READ_BUFFER_SIZE(compression_header->blocksize)) {
+			bcmpdbg("Incorrect readsize %d for block %d\n", (int)readsize, slot->block_number);
+			slot->nbytes = -EINVAL;
+		} else {
+			slot->nbytes = file_pread(prefetch.filep, &buffers.read_buffer[index * COMPRESS_READ_BUFFER_SIZE(compression_header->blocksize)], readsize, position);
+			if (slot->nbytes != readsize) {
+				bcmpdbg("Read for compressed block %d failed\n", slot->block_number);
+				slot->nbytes = -EIO;
+			}
+		}
+
+		sem_post(&slot->done);
+	}
+
+	sem_post(&prefetch.exited);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: compress_prefetch_issue
+ *
+ * Description:
+ *   Ask the prefetch thread to read 'block_number' block into the next slot
+ *
+ * Returned Value:
+ *   None
+ ****************************************************************************/
+static void compress_prefetch_issue(int block_number)
+{
+	prefetch.slots[prefetch.tail++ % COMPRESS_READ_BUFFERS].block_number = block_number;
+	sem_post(&prefetch.request);
+}
+
+/****************************************************************************
+ * Name: compress_prefetch_get
+ *
+ * Description:
+ *   Get the compressed 'block_number' block from the prefetch thread. Slots
+ *   issued before it are waited for and dropped; if it was not issued, it is
+ *   issued now. The blocks following it are then issued, so that they are
+ *   read while this one is decompressed.
+ *
+ * Returned Value:
+ *   Number of bytes of the compressed block on Success, with '*buf' set to
+ *   its slot buffer
+ *   Negative value on Failure
+ ****************************************************************************/
+static ssize_t compress_prefetch_get(int block_number, FAR uint8_t **buf)
+{
+	FAR struct s_prefetch_slot *slot;
+	unsigned int index;
+	int next;
+	int i;
+
+	do {
+		if (prefetch.head == prefetch.tail) {
+			compress_prefetch_issue(block_number);
+		}
+		index = prefetch.head++ % COMPRESS_READ_BUFFERS;
+		slot = &prefetch.slots[index];
+		compress_prefetch_wait(slot);
+	} while (slot->block_number != block_number);
+
+	/* Keep the thread busy with the blocks that follow, unless cached */
+	next = block_number + 1;
+	if (prefetch.head != prefetch.tail) {
+		next = MAX(next, prefetch.slots[(prefetch.tail - 1) % COMPRESS_READ_BUFFERS].block_number + 1);
+	}
+	for (; next < compression_header->sections && prefetch.tail - prefetch.head < COMPRESS_READ_BUFFERS - 1; next++) {
+		for (i = 0; i < CONFIG_COMPRESSION_CACHE_BLOCKS; i++) {
+			if (cache[i].block_number == next) {
+				break;
+			}
+		}
+		if (i == CONFIG_COMPRESSION_CACHE_BLOCKS) {
+			compress_prefetch_issue(next);
+		}
+	}
+
+	*buf = &buffers.read_buffer[index * COMPRESS_READ_BUFFER_SIZE(compression_header->blocksize)];
+	return slot->nbytes;
+}
+
+/****************************************************************************
+ * Name: compress_prefetch_start
+ *
+ * Description:
+ *   Start the prefetch thread for the compressed file 'filfd'
+ *
+ * Returned Value:
+ *   OK (0) on Success
+ *   Negative value on Failure
+ ****************************************************************************/
+static int compress_prefetch_start(int filfd)
+{
+	struct sched_param param;
+	int ret;
+	int i;
+
+	ret = fs_getfilep(filfd, &prefetch.filep);
+	if (ret != OK) {
+		bcmpdbg("Failed to get the file of fd %d: %d\n", filfd, ret);
+		return ret;
+	}
+
+	sem_init(&prefetch.request, 0, 0);
+	sem_setprotocol(&prefetch.request, SEM_PRIO_NONE);
+	sem_init(&prefetch.exited, 0, 0);
+	sem_setprotocol(&prefetch.exited, SEM_PRIO_NONE);
+	for (i = 0; i < COMPRESS_READ_BUFFERS; i++) {
+		sem_init(&prefetch.slots[i].done, 0, 0);
+		sem_setprotocol(&prefetch.slots[i].done, SEM_PRIO_NONE);
+	}
+	prefetch.head = 0;
+	prefetch.tail = 0;
+	prefetch.served = 0;
+	prefetch.stop = false;
+
+	/* Read at the priority of the loading task */
+	sched_getparam(0, &param);
+	prefetch.pid = kernel_thread("compress_prefetch", param.sched_priority, CONFIG_COMPRESSION_PREFETCH_STACKSIZE, compress_prefetch_thread, NULL);
+	if (prefetch.pid < 0) {
+		ret = -get_errno();
+		bcmpdbg("Failed to create the prefetch thread: %d\n", ret);
+		sem_destroy(&prefetch.request);
+		sem_destroy(&prefetch.exited);
+		for (i = 0; i < COMPRESS_READ_BUFFERS; i++) {
+			sem_destroy(&prefetch.slots[i].done);
+		}
+		prefetch.pid = -1;
+		return ret;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: compress_prefetch_stop
+ *
+ * Description:
+ *   Wait for the reads in flight and stop the prefetch thread
+ *
+ * Returned Value:
+ *   None
+ ****************************************************************************/
+static void compress_prefetch_stop(void)
+{
+	int i;
+
+	if (prefetch.pid < 0) {
+		return;
+	}
+
+	while (prefetch.head != prefetch.tail) {
+		compress_prefetch_wait(&prefetch.slots[prefetch.head++ % COMPRESS_READ_BUFFERS]);
+	}
+
+	prefetch.stop = true;
+	sem_post(&prefetch.request);
+	while (sem_wait(&prefetch.exited) != OK) {
+		ASSERT(get_errno() == EINTR);
+	}
+
+	sem_destroy(&prefetch.request);
+	sem_destroy(&prefetch.exited);
+	for (i = 0; i < COMPRESS_READ_BUFFERS; i++) {
+		sem_destroy(&prefetch.slots[i].done);
+	}
+	prefetch.pid = -1;
+}
+#endif
+
+/****************************************************************************
+ * Name: compress_decompress_block
+ *
+ * Description:
+ *   Read 'block_number' block from compressed file and decompress it into
+ *   'out', which has room for one block
+ *
+ * Returned Value:
+ *   Number of bytes decompressed into out on Success
+ *   Negative value on Failure
+ ****************************************************************************/
+static int compress_decompress_block(int filfd, uint16_t binary_header_size, FAR uint8_t *out, int block_number)
+{
+	FAR uint8_t *buf;
+	off_t block_readsize;
+	int ret;
+#if CONFIG_COMPRESSION_TYPE == LZMA
+	unsigned int writesize;
+	unsigned int size;
+#elif CONFIG_COMPRESSION_TYPE == MINIZ
+	long unsigned int writesize;
+	long unsigned int size;
+#endif
+
+	/* Read compressed 'block_number' block */
+#ifdef CONFIG_COMPRESSION_PREFETCH
+	block_readsize = compress_prefetch_get(block_number, &buf);
+#else
+	buf = buffers.read_buffer;
+	block_readsize = compress_read_block(filfd, binary_header_size, buf, block_number);
+#endif
+	if (block_readsize < 0) {
+		bcmpdbg("Read for compressed block %d failed\n", block_number);
+		return block_readsize;
+	}
+
+#if CONFIG_COMPRESSION_TYPE == LZMA
+	size = (unsigned int)block_readsize;
+#elif CONFIG_COMPRESSION_TYPE == MINIZ
+	size = (long unsigned int)block_readsize;
+#endif
+	writesize = compression_header->blocksize;
+	ret = decompress_block(out, &writesize, buf, &size);
+	if (ret < 0) {
+		bcmpdbg("Failed to decompress %d block of this binary\n", block_number);
+		return ret;
+	}
+	blocks_decompressed++;
+
+	return writesize;
+}
+
+/****************************************************************************
+ * Name: compress_cache_find
+ *
+ * Description:
+ *   Look up 'block_number' block in the cache of decompressed blocks
+ *
+ * Returned Value:
+ *   Cache entry holding the block, NULL if it is not cached
+ ****************************************************************************/
+static struct s_cache_block *compress_cache_find(int block_number)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_COMPRESSION_CACHE_BLOCKS; i++) {
+		if (cache[i].block_number == block_number) {
+			cache[i].last_used = ++cache_clock;
+			cache_hits++;
+			return &cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+/****************************************************************************
+ * Name: compress_cache_fill
+ *
+ * Description:
+ *   Decompress 'block_number' block into the least recently used cache entry
+ *
+ * Returned Value:
+ *   Cache entry holding the block on Success
+ *   NULL on Failure
+ ****************************************************************************/
+static struct s_cache_block *compress_cache_fill(int filfd, uint16_t binary_header_size, int block_number)
+{
+	struct s_cache_block *entry;
+	int ret;
+	int i;
+
+	entry = &cache[0];
+	for (i = 1; i < CONFIG_COMPRESSION_CACHE_BLOCKS; i++) {
+		if (cache[i].last_used < entry->last_used) {
+			entry = &cache[i];
+		}
+	}
+
+	ret = compress_decompress_block(filfd, binary_header_size, &buffers.out_buffer[(entry - cache) * compression_header->blocksize], block_number);
+	if (ret < 0) {
+		entry->block_number = -1;
+		entry->last_used = 0;
+		return NULL;
+	}
+
+	entry->block_number = block_number;
+	entry->size = ret;
+	entry->last_used = ++cache_clock;
+
+	return entry;
+}
+
 /****************************************************************************
  * Name: compress_read
  *
@@ -238,7 +655,8 @@ static off_t compress_read_block(int filfd, uint16_t binary_header_size, FAR uin
  *   Read bytes from the compressed file using 'offset' and 'readsize' info
  *   provided for uncompressed file.  The data is read into 'buffer'. Offset
  *   value here is offset from start of uncompressed binary (excluding binary
- *   header).
+ *   header). Partially read blocks go through the cache of decompressed
+ *   blocks, whole blocks are decompressed straight into 'buffer'.
  *
  * Returned Value:
  *   Number of bytes read into buffer on Success
@@ -251,87 +669,53 @@ int compress_read(int filfd, uint16_t binary_header_size, FAR uint8_t *buffer, s
 	int no_blocks;
 	int index;
 	int ret;
-	int actual_offset;			/* Offset from start of uncompressed file */
+	int block_offset;			/* Offset of the data to write in the decompressed block */
 	int block_size_to_write;	/* Size to write into buffer from decompressed block */
 	int buffer_index;
 	int blocksize;
-	int block_readsize;
-#if CONFIG_COMPRESSION_TYPE == LZMA
-	unsigned int writesize;
-	unsigned int size;
-#elif CONFIG_COMPRESSION_TYPE == MINIZ
-	long unsigned int writesize;
-	long unsigned int size;
-#endif
+	struct s_cache_block *entry;
 
 	/* Setting first block, end block and number of blocks to read and decompressed */
 	blocksize = compression_header->blocksize;
 	compress_blocks_to_read(&first_block, &last_block, &no_blocks, offset, readsize);
-	if (first_block < 0 || no_blocks < 0) {
+	if (first_block < 0 || no_blocks < 0 || last_block >= compression_header->sections) {
 		bcmpdbg("Incorrect first_block, no_blocks info\n");
-		buffer_index = ERROR;
-		goto error_compress_read;
+		return ERROR;
 	}
 
-	index = first_block;
 	buffer_index = 0;
-	/* Actual Offset in uncompressed file is same as Offset passed to this function */
-	actual_offset = offset;
+	block_offset = offset - first_block * blocksize;
 
 	/* Reading and decompressing blocks from first_block to last_block. Then writing to buffer. */
-	for (; index < first_block + no_blocks; index++) {
-		/* Read compressed 'index' block into read_buffer */
-		block_readsize = compress_read_block(filfd, binary_header_size, buffers.read_buffer, index);
-		if (block_readsize < 0) {
-			bcmpdbg("Read for compressed block %d failed\n", index);
-			buffer_index = block_readsize;
-			goto error_compress_read;
-		}
-
-#if CONFIG_COMPRESSION_TYPE == LZMA
-		size = (unsigned int)block_readsize;
-#elif CONFIG_COMPRESSION_TYPE == MINIZ
-		size = (long unsigned int)block_readsize;
-#endif
-		writesize = compression_header->blocksize; 
-		/* Decompress block in read_buffer to out_buffer */
-		ret = decompress_block(buffers.out_buffer, &writesize, buffers.read_buffer, &size);
-		if (ret == ERROR) {
-			bcmpdbg("Failed to decompress %d block of this binary\n", index);
-			buffer_index = ret;
-			goto error_compress_read;
-		}
-
-		if (index == first_block) {
-			/*
-			 * Read appropriate number of bytes to buffer from this block using readsize and offset info.
-			 * If start_offset + readsize < end_offset, write from start_offset to start_offset + readsize.
-			 * Otherwise, write from start_offset to end_offset into buffer.
-			 */
-			block_size_to_write = ((index + 1) * blocksize - 1 > actual_offset + readsize - 1 ? readsize : (index + 1) * blocksize - actual_offset);
-			memcpy(&buffer[buffer_index], &buffers.out_buffer[actual_offset - (index * blocksize)], block_size_to_write);
-			buffer_index += block_size_to_write;
-		} else if (index == last_block) {
-			/*
-			 * Read appropriate number of bytes to buffer from this block using readsize and offset info.
-			 * Calculate end_offset (Offset of last byte to write from this block).
-			 * Write from start_offset to end_offset from this block into buffer.
-			 */
-			block_size_to_write = actual_offset + readsize - (index * blocksize);
-			memcpy(&buffer[buffer_index], &buffers.out_buffer[0], block_size_to_write);
-			buffer_index += block_size_to_write;
+	for (index = first_block; index <= last_block; index++) {
+		block_size_to_write = MIN(blocksize - block_offset, (int)readsize - buffer_index);
+
+		entry = compress_cache_find(index);
+		if (entry == NULL && block_size_to_write == blocksize) {
+			/* The whole block is wanted, skip the copy through the cache */
+			ret = compress_decompress_block(filfd, binary_header_size, &buffer[buffer_index], index);
+			if (ret != blocksize) {
+				bcmpdbg("Failed to decompress block %d into buffer: %d\n", index, ret);
+				return ret < 0 ? ret : ERROR;
+			}
 		} else {
-			/*
-			 * This is not the first or last block. This is intermediary block.
-			 * So, write entire block into buffer.
-			 */
-			block_size_to_write = blocksize;
-			memcpy(&buffer[buffer_index], &buffers.out_buffer[0], block_size_to_write);
-			buffer_index += block_size_to_write;
+			if (entry == NULL) {
+				entry = compress_cache_fill(filfd, binary_header_size, index);
+				if (entry == NULL) {
+					return ERROR;
+				}
+			}
+			if (block_offset + block_size_to_write > entry->size) {
+				bcmpdbg("Read beyond the end of decompressed block %d\n", index);
+				return ERROR;
+			}
+			memcpy(&buffer[buffer_index], &buffers.out_buffer[(entry - cache) * blocksize + block_offset], block_size_to_write);
 		}
+
+		buffer_index += block_size_to_write;
+		block_offset = 0;
 	}
 
-error_compress_read:
 	return buffer_index;
 }
 
@@ -348,12 +732,14 @@ error_compress_read:
 int compress_init(int filfd, uint16_t offset, off_t *filelen)
 {
 	int ret;
+	int i;
 
 	if (active_filefd != -1 && active_filefd != filfd) {
 		bcmpdbg("Another file decompression is in process\n");
 		return -EBUSY;
 	}
 	active_filefd = filfd;
+	active_header_size = offset;
 	/* Parsing compression header for compressed file */
 	ret = compress_parse_header(filfd, offset);
 	if (ret != OK) {
@@ -365,34 +751,42 @@ int compress_init(int filfd, uint16_t offset, off_t *filelen)
 	*filelen = compression_header->binary_size;
 
 #if CONFIG_COMPRESSION_TYPE == LZMA
-	/* Allocating memory for read and out buffer to be used for LZMA decompression */
-	if (compression_header->compression_format == COMPRESSION_TYPE_LZMA) {
-		buffers.read_buffer = (unsigned char *)kmm_malloc(compression_header->blocksize + LZMA_PROPS_SIZE);
-		if (buffers.read_buffer == NULL) {
-			return -ENOMEM;
-		}
-		buffers.out_buffer = (unsigned char *)kmm_malloc(compression_header->blocksize);
-		if (buffers.out_buffer == NULL) {
-			kmm_free(buffers.read_buffer);
-			return -ENOMEM;
-		}
-	}
+	if (compression_header->compression_format != COMPRESSION_TYPE_LZMA) {
 #elif CONFIG_COMPRESSION_TYPE == MINIZ
-	/* Allocating memory for read and out buffer to be used for Miniz decompression */
-	if (compression_header->compression_format == COMPRESSION_TYPE_MINIZ) {
-		buffers.read_buffer = (unsigned char *)kmm_malloc(compressBound(compression_header->blocksize));
-		if (buffers.read_buffer == NULL) {
-			return -ENOMEM;
-		}
-		buffers.out_buffer = (unsigned char *)kmm_malloc(compression_header->blocksize);
-		if (buffers.out_buffer == NULL) {
-			kmm_free(buffers.read_buffer);
-			return -ENOMEM;
-		}
+	if (compression_header->compression_format != COMPRESSION_TYPE_MINIZ) {
+#endif
+		bcmpdbg("Compression format %d is not supported\n", compression_header->compression_format);
+		ret = -EINVAL;
+		goto error_compress_init;
+	}
+
+	/* Allocating memory for the compressed blocks read and for the cache of decompressed blocks */
+	buffers.read_buffer = (unsigned char *)kmm_malloc(COMPRESS_READ_BUFFERS * COMPRESS_READ_BUFFER_SIZE(compression_header->blocksize));
+	buffers.out_buffer = (unsigned char *)kmm_malloc(CONFIG_COMPRESSION_CACHE_BLOCKS * compression_header->blocksize);
+	if (buffers.read_buffer == NULL || buffers.out_buffer == NULL) {
+		ret = -ENOMEM;
+		goto error_compress_init;
+	}
+
+	for (i = 0; i < CONFIG_COMPRESSION_CACHE_BLOCKS; i++) {
+		cache[i].block_number = -1;
+		cache[i].last_used = 0;
+	}
+	cache_clock = 0;
+	cache_hits = 0;
+	blocks_decompressed = 0;
+
+#ifdef CONFIG_COMPRESSION_PREFETCH
+	ret = compress_prefetch_start(filfd);
+	if (ret != OK) {
+		goto error_compress_init;
 	}
 #endif
 
+	return OK;
+
 error_compress_init:
+	compress_uninit();
 	return ret;
 }
 
@@ -407,22 +801,28 @@ error_compress_init:
  ****************************************************************************/
 void compress_uninit(void)
 {
-#if CONFIG_COMPRESSION_TYPE == LZMA || CONFIG_COMPRESSION_TYPE == MINIZ
+#ifdef CONFIG_COMPRESSION_PREFETCH
+	compress_prefetch_stop();
+#endif
+
+	if (compression_header) {
+		bcmpvdbg("Decompressed %u blocks, %u reads served from the cache\n", blocks_decompressed, cache_hits);
+	}
+
 	/* Freeing memory allocated to read_buffer and out_buffer for file decompression */
-	if (compression_header->compression_format == COMPRESSION_TYPE_LZMA || compression_header->compression_format == COMPRESSION_TYPE_MINIZ) {
-		if (buffers.read_buffer) {
-			kmm_free(buffers.read_buffer);
-			buffers.read_buffer = NULL;
-		}
-		if (buffers.out_buffer) {
-			kmm_free(buffers.out_buffer);
-			buffers.out_buffer = NULL;
-		}
+	if (buffers.read_buffer) {
+		kmm_free(buffers.read_buffer);
+		buffers.read_buffer = NULL;
+	}
+	if (buffers.out_buffer) {
+		kmm_free(buffers.out_buffer);
+		buffers.out_buffer = NULL;
 	}
-#endif
 
-	kmm_free(compression_header);
-	compression_header = NULL;
+	if (compression_header) {
+		kmm_free(compression_header);
+		compression_header = NULL;
+	}
 
 	active_filefd = -1;
 }
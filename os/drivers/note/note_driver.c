@@ -0,0 +1,127 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <debug.h>
+#include <errno.h>
+
+#include <sys/types.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/ioctl.h>
+#include <tinyara/sched_note.h>
+#include <tinyara/note.h>
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+static ssize_t note_read(FAR struct file *filep, FAR char *buffer, size_t len);
+static int note_ioctl(FAR struct file *filep, int cmd, unsigned long arg);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+static const struct file_operations note_fops = {
+	0,                          /* open */
+	0,                          /* close */
+	note_read,                  /* read */
+	0,                          /* write */
+	0,                          /* seek */
+	note_ioctl                  /* ioctl */
+#ifndef CONFIG_DISABLE_POLL
+	, 0                         /* poll */
+#endif
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/************************************************************************************
+ * Name: note_read
+ *
+ * Description: Move whole notes to the buffer, oldest first. Returns 0 when all
+ *   recorded notes have been read.
+ *
+ ************************************************************************************/
+static ssize_t note_read(FAR struct file *filep, FAR char *buffer, size_t len)
+{
+	if (buffer == NULL) {
+		return -EINVAL;
+	}
+
+	return sched_note_read((FAR uint8_t *)buffer, len);
+}
+
+/************************************************************************************
+ * Name: note_ioctl
+ *
+ * Description: The ioctl method for the note driver.
+ *
+ ************************************************************************************/
+static int note_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
+{
+	int ret = -EINVAL;
+
+	switch (cmd) {
+	case NOTEIOC_CLEAR:
+		sched_note_clear();
+		ret = OK;
+		break;
+	case NOTEIOC_GETMODE:
+		if (arg != 0) {
+			*(FAR unsigned int *)arg = sched_note_getmode();
+			ret = OK;
+		}
+		break;
+	case NOTEIOC_SETMODE:
+		sched_note_setmode((unsigned int)arg);
+		ret = OK;
+		break;
+	case NOTEIOC_GETSTATUS:
+		if (arg != 0) {
+			sched_note_getstatus((FAR struct note_status_s *)arg);
+			ret = OK;
+		}
+		break;
+	default:
+		ret = -ENOTTY;
+		break;
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: note_initialize
+ *
+ * Description:
+ *   Register note driver path, NOTE_DRVPATH
+ *
+ ****************************************************************************/
+
+void note_initialize(void)
+{
+	(void)register_driver(NOTE_DRVPATH, &note_fops, 0666, NULL);
+}
@@ -799,6 +799,21 @@ errout:
 	set_errno(-ret);
 	return EOF;
 }
+
+/****************************************************************************
+ * Name: syslog_puts
+ *
+ * Description:
+ *   Add a run of characters to the RAMLOG.  Each character still takes the
+ *   critical section on its own, so that a long line does not keep the
+ *   interrupts disabled for its whole length.
+ *
+ ****************************************************************************/
+
+int syslog_puts(FAR const char *buf, size_t buflen)
+{
+	return syslog_putc_run(buf, buflen);
+}
 #endif
 
 #endif							/* CONFIG_RAMLOG */
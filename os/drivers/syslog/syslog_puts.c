@@ -0,0 +1,62 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * drivers/syslog/syslog_puts.c
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdio.h>
+
+#include <tinyara/syslog/syslog.h>
+
+#ifdef CONFIG_SYSLOG
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: syslog_putc_run
+ *
+ * Description:
+ *   Write a run of characters with one syslog_putc() per character.  This
+ *   is the syslog_puts() of the SYSLOG devices which take one character at
+ *   a time.
+ *
+ ****************************************************************************/
+
+int syslog_putc_run(FAR const char *buf, size_t buflen)
+{
+	size_t i;
+
+	for (i = 0; i < buflen; i++) {
+		if (syslog_putc(buf[i]) == EOF) {
+			return i > 0 ? (int)i : EOF;
+		}
+	}
+
+	return (int)buflen;
+}
+
+#endif							/* CONFIG_SYSLOG */
@@ -525,4 +525,76 @@ errout_with_errcode:
 	return EOF;
 }
 
+/****************************************************************************
+ * Name: syslog_puts
+ *
+ * Description:
+ *   Write a run of characters to the SYSLOG device.  The text between
+ *   newlines goes to the driver with one write under one hold of the
+ *   semaphore, instead of one write per character.
+ *
+ ****************************************************************************/
+
+int syslog_puts(FAR const char *buf, size_t buflen)
+{
+	FAR const char *start = buf;
+	FAR const char *end = buf + buflen;
+	FAR const char *run;
+	ssize_t nbytes = 0;
+	int ret;
+
+	/* Leave the cases that syslog_putc() refuses, or where it may have to
+	 * (re)open the device, to syslog_putc() itself.
+	 */
+
+	if (g_sysdev.sl_state != SYSLOG_OPENED || up_interrupt_context() || getpid() == 0) {
+		return syslog_putc_run(buf, buflen);
+	}
+
+	ret = syslog_takesem();
+	if (ret < 0) {
+		set_errno(-ret);
+		return EOF;
+	}
+
+	while (buf < end) {
+		/* Find the run of characters up to the next CR or LF */
+
+		for (run = buf; run < end && *run != '\r' && *run != '\n'; run++) ;
+
+		if (run > buf) {
+			nbytes = syslog_write(buf, run - buf);
+			if (nbytes <= 0) {
+				break;
+			}
+
+			buf += nbytes;
+		} else if (*buf == '\n') {
+			/* Write the CR-LF sequence and synchronize the file */
+
+			nbytes = syslog_write(g_syscrlf, 2);
+			if (nbytes <= 0) {
+				break;
+			}
+#ifndef CONFIG_DISABLE_MOUNTPOINT
+			syslog_flush();
+#endif
+			buf++;
+		} else {
+			/* Ignore carriage returns */
+
+			buf++;
+		}
+	}
+
+	syslog_givesem();
+
+	if (buf == start && buflen > 0) {
+		set_errno(nbytes < 0 ? -nbytes : EIO);
+		return EOF;
+	}
+
+	return buf - start;
+}
+
 #endif							/* CONFIG_SYSLOG && CONFIG_SYSLOG_CHAR */
@@ -66,6 +66,7 @@
 #include <stdlib.h>
 #include <stddef.h>
 #include <string.h>
+#include <semaphore.h>
 #include <debug.h>
 #include <errno.h>
 
@@ -74,6 +75,7 @@
 #include <crc32.h>
 #ifndef NXFUSE_HOST_BUILD
 #include <tinyara/irq.h>
+#include <tinyara/clock.h>
 #endif
 #include <tinyara/math.h>
 #include <tinyara/kmalloc.h>
@@ -82,6 +84,9 @@
 #include <tinyara/fs/mtd.h>
 #include <tinyara/fs/smart_procfs.h>
 #include <tinyara/fs/smart.h>
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+#include <tinyara/wqueue.h>
+#endif
 
 /****************************************************************************
  * Private Definitions
@@ -143,6 +148,15 @@
 #define SMART_FMT_NAMESIZE_POS    (SMART_FMT_POS1 + 6)
 #define SMART_FMT_ROOTDIRS_POS    (SMART_FMT_POS1 + 7)
 #define SMART_FMT_FORMAT_POS      (SMART_FMT_POS1 + 8)
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+#define SMART_FMT_CHECKPOINT_POS  (SMART_FMT_POS1 + 9)
+#define SMART_FMT_CHECKPOINT      'C'	/* Volume has a checkpoint area */
+
+#define SMART_CP_MAGIC            0x50434d53	/* "SMCP" */
+#define SMART_CP_VERSION          1
+#define SMART_CP_STATE_VALID      CONFIG_SMARTFS_ERASEDSTATE
+#define SMART_CP_STATE_INVALID    ((uint8_t)~CONFIG_SMARTFS_ERASEDSTATE)
+#endif
 
 #define SMARTFS_FMT_WEAR_POS      36
 #define SMART_WEAR_LEVEL_FORMAT_SIG 32
@@ -158,6 +172,22 @@
 
 #define SMART_GOOD_SECTOR_RETRY     8
 
+/* Free sectors kept for garbage collection, it needs a whole erase block to
+ * move the active sectors of the collected one.
+ */
+
+#define SMART_GC_RESERVE(d)         (((d)->sectorsPerBlk << 0) + 4)
+
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+#if CONFIG_MTD_SMART_GC_HIGH_WATERMARK < CONFIG_MTD_SMART_GC_LOW_WATERMARK
+#error "MTD_SMART_GC_HIGH_WATERMARK should not be lower than MTD_SMART_GC_LOW_WATERMARK"
+#endif
+
+#define SMART_GC_IDLE_TICKS         MSEC2TICK(CONFIG_MTD_SMART_GC_IDLE_MS)
+#define SMART_GC_LOW(d)             ((uint32_t)(d)->totalsectors * CONFIG_MTD_SMART_GC_LOW_WATERMARK / 100)
+#define SMART_GC_HIGH(d)            ((uint32_t)(d)->totalsectors * CONFIG_MTD_SMART_GC_HIGH_WATERMARK / 100)
+#endif
+
 #if defined(CONFIG_MTD_SMART_READAHEAD) || (defined(CONFIG_DRVR_WRITABLE) && \
 	defined(CONFIG_MTD_SMART_WRITEBUFFER))
 #define SMART_HAVE_RWBUFFER 1
@@ -262,12 +292,52 @@ struct smart_allocsector_s {
 };
 #endif
 
+/* Header of the sector map checkpoint.  It occupies the first sector of
+ * the checkpoint area and is followed by the sector map and the per erase
+ * block counts.  It is written last, so a checkpoint is only found if its
+ * data is complete.  The state byte is programmed from the erased state
+ * before the device is modified, which invalidates the checkpoint without
+ * an erase.
+ */
+
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+struct smart_checkpoint_s {
+	uint32_t magic;				/* SMART_CP_MAGIC */
+	uint8_t state;				/* SMART_CP_STATE_VALID or _INVALID */
+	uint8_t version;			/* SMART_CP_VERSION */
+	uint8_t formatversion;		/* Format version on the device */
+	uint8_t namesize;			/* Length of filenames on this device */
+	uint16_t totalsectors;		/* Geometry the map was taken with */
+	uint16_t neraseblocks;
+	uint16_t sectorsize;
+	uint16_t freesectors;		/* Total number of free sectors */
+	uint16_t releasesectors;	/* Total number of released sectors */
+	uint16_t lastallocblock;	/* Last block we allocated a sector from */
+	uint32_t datalen;			/* Number of bytes following the header */
+	uint32_t datacrc;			/* CRC-32 of the bytes following the header */
+	uint32_t hdrcrc;			/* CRC-32 of the fields above */
+};
+#endif
+
 struct smart_struct_s {
 	FAR struct mtd_dev_s *mtd;	/* Contained MTD interface */
 	struct mtd_geometry_s geo;	/* Device geometry */
 #if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
 	uint32_t unusedsectors;		/* Count of unused sectors (i.e. free when erased) */
 	uint32_t blockerases;		/* Count of unused sectors (i.e. free when erased) */
+	uint16_t nscans;		/* Number of full scans of the device */
+	uint32_t scantime;		/* Duration of the last full scan in msec */
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+	uint16_t nrestores;		/* Number of sector map checkpoint restores */
+	uint32_t restoretime;		/* Duration of the last restore in msec */
+#endif
+	uint32_t fggcblocks;		/* Blocks collected on the path of a request */
+	uint32_t fggcstalls;		/* Requests which waited for garbage collection */
+	uint32_t fggclaststall;		/* Duration of the last such wait in msec */
+	uint32_t fggcmaxstall;		/* Duration of the longest such wait in msec */
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+	uint32_t bggcblocks;		/* Blocks collected by the background worker */
+#endif
 #endif
 	uint16_t neraseblocks;		/* Number of erase blocks or sub-sectors */
 	uint16_t lastallocblock;	/* Last  block we allocated a sector from */
@@ -281,6 +351,9 @@ struct smart_struct_s {
 	FAR uint8_t *releasecount;	/* Count of released sectors per erase block */
 	FAR uint8_t *freecount;		/* Count of free sectors per erase block */
 	FAR char *rwbuffer;		/* Our sector read/write buffer */
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+	FAR uint8_t *runbuffer;		/* Image of a run of sectors to write at once */
+#endif
 	FAR uint8_t *bytebuffer;	/* Array of bytes to be used in smart_bytewrite */
 	char
 	partname[SMART_PARTNAME_SIZE];	/* Optional partition name */
@@ -327,6 +400,17 @@ struct smart_struct_s {
 	uint32_t njournalentries;		/* Total Number of Journal Entries */
 	FAR uint16_t *block_map;			/* Number of checkout journal in each of Journal block */
 #endif
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+	uint16_t cpblock;			/* First erase block of the checkpoint area */
+	uint16_t ncpblocks;			/* Number of erase blocks of the checkpoint area */
+	bool cpvalid;				/* Checkpoint on the device matches the RAM state */
+#endif
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+	sem_t exclsem;				/* Serializes requests and the GC worker */
+	struct work_s gcwork;		/* Background garbage collection */
+	clock_t lastio;				/* Time of the last request */
+	uint8_t crefs;				/* Number of opens, GC only runs while open */
+#endif
 };
 
 #define SMART_WEARFLAGS_FORCE_REORG    0x01
@@ -419,6 +503,13 @@ typedef uint32_t crc_t;
 #define SMART_JOURNAL_TYPE_COMMIT    1		/* Common Type, When write data on entire of sector */
 #define SMART_JOURNAL_TYPE_RELEASE   2		/* Release Sector */
 #define SMART_JOURNAL_TYPE_ERASE     3		/* MTD Erase (c.f smart_erase_block_if_empty..) */
+#define SMART_JOURNAL_TYPE_COMMIT_RUN 4		/* Write a run of new sectors at once */
+
+/* An entry of type COMMIT_RUN targets the first physical sector of the run
+ * and holds the header of that sector.  New sectors always have sequence
+ * number 0, so the seq field of that header holds the number of sectors in
+ * the run instead.
+ */
 
 /* MACRO For Journal Type */
 #define SET_JOURNAL_TYPE(t, v) ((t) = ((t) & 0x0f) | ((v) << 4))
@@ -479,6 +570,7 @@ static int smart_relocate_sector(FAR struct smart_struct_s *dev, uint16_t oldsec
 #ifdef CONFIG_MTD_SMART_ENABLE_CRC
 static int smart_validate_crc(FAR struct smart_struct_s *dev);
 static crc_t smart_calc_sector_crc(FAR struct smart_struct_s *dev);
+static void smart_commit_crc(FAR struct smart_struct_s *dev);
 #endif
 #ifdef CONFIG_MTD_SMART_JOURNALING
 static int smart_journal_init(FAR struct smart_struct_s *dev);
@@ -486,6 +578,9 @@ static int smart_journal_checkin(FAR struct smart_struct_s *dev, journal_log_t *
 static int smart_journal_checkout(FAR struct smart_struct_s *dev, journal_log_t *log, uint32_t address);
 static int smart_journal_process_transaction(FAR struct smart_struct_s *dev, journal_log_t *log);
 static int smart_journal_bwrite(FAR struct smart_struct_s *dev, uint16_t physsector);
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+static int smart_journal_bwrite_run(FAR struct smart_struct_s *dev, uint16_t physsector, uint16_t count);
+#endif
 static ssize_t smart_journal_bytewrite(FAR struct smart_struct_s *dev, size_t offset, int nbytes, FAR const uint8_t *buffer);
 static int smart_journal_read_journal_log(FAR struct smart_struct_s *dev, journal_log_t *log);
 static int smart_journal_erase(FAR struct smart_struct_s *dev, uint16_t block);
@@ -496,6 +591,15 @@ static int smart_journal_recovery(FAR struct smart_struct_s *dev, journal_log_t
 static int smart_validate_journal_crc(journal_log_t *log);
 static crc_t smart_calc_journal_crc(journal_log_t *log);
 
+#endif
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+static void smart_gc_worker(FAR void *arg);
+static void smart_gc_schedule(FAR struct smart_struct_s *dev);
+#endif
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+static int smart_checkpoint_write(FAR struct smart_struct_s *dev);
+static int smart_checkpoint_restore(FAR struct smart_struct_s *dev);
+static int smart_checkpoint_invalidate(FAR struct smart_struct_s *dev);
 #endif
 /****************************************************************************
  * Private Data
@@ -646,7 +750,25 @@ static void smart_free(FAR struct smart_struct_s *dev, FAR void *ptr)
 
 static int smart_open(FAR struct inode *inode)
 {
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+	FAR struct smart_struct_s *dev;
+#endif
+
 	fvdbg("Entry\n");
+
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+	DEBUGASSERT(inode && inode->i_private);
+	dev = (FAR struct smart_struct_s *)inode->i_private;
+
+	while (sem_wait(&dev->exclsem) != OK) {
+		DEBUGASSERT(get_errno() == EINTR);
+	}
+
+	dev->crefs++;
+	smart_gc_schedule(dev);
+	sem_post(&dev->exclsem);
+#endif
+
 	return OK;
 }
 
@@ -659,8 +781,43 @@ static int smart_open(FAR struct inode *inode)
 
 static int smart_close(FAR struct inode *inode)
 {
+#if defined(CONFIG_MTD_SMART_MAP_CHECKPOINT) || defined(CONFIG_MTD_SMART_BACKGROUND_GC)
+	FAR struct smart_struct_s *dev;
+#endif
+	int ret = OK;
+
 	fvdbg("Entry\n");
-	return OK;
+
+#if defined(CONFIG_MTD_SMART_MAP_CHECKPOINT) || defined(CONFIG_MTD_SMART_BACKGROUND_GC)
+	DEBUGASSERT(inode && inode->i_private);
+	dev = (FAR struct smart_struct_s *)inode->i_private;
+#endif
+
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+	while (sem_wait(&dev->exclsem) != OK) {
+		DEBUGASSERT(get_errno() == EINTR);
+	}
+
+	/* Stop the background garbage collection with the last close, it must
+	 * not touch the device after the checkpoint below.
+	 */
+
+	if (dev->crefs > 0 && --dev->crefs == 0) {
+		work_cancel(LPWORK, &dev->gcwork);
+	}
+#endif
+
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+	/* Save the sector map, so that the next mount does not need a scan. */
+
+	ret = smart_checkpoint_write(dev);
+#endif
+
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+	sem_post(&dev->exclsem);
+#endif
+
+	return ret;
 }
 
 /****************************************************************************
@@ -894,6 +1051,9 @@ static ssize_t smart_reload(struct smart_struct_s *dev, FAR uint8_t *buffer, off
 static ssize_t smart_read(FAR struct inode *inode, unsigned char *buffer, size_t start_sector, unsigned int nsectors)
 {
 	struct smart_struct_s *dev;
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+	ssize_t ret;
+#endif
 
 	fvdbg("SMART: sector: %d nsectors: %d\n", start_sector, nsectors);
 
@@ -903,18 +1063,33 @@ static ssize_t smart_read(FAR struct inode *inode, unsigned char *buffer, size_t
 #else
 	dev = (struct smart_struct_s *)inode->i_private;
 #endif
+
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+	/* The worker moves sectors, so the read is serialized with it. */
+
+	while (sem_wait(&dev->exclsem) != OK) {
+		DEBUGASSERT(get_errno() == EINTR);
+	}
+
+	ret = smart_reload(dev, buffer, start_sector, nsectors);
+	smart_gc_schedule(dev);
+
+	sem_post(&dev->exclsem);
+	return ret;
+#else
 	return smart_reload(dev, buffer, start_sector, nsectors);
+#endif
 }
 
 /****************************************************************************
- * Name: smart_write
+ * Name: smart_do_write
  *
  * Description: Write (or buffer) the specified number of sectors.
  *
  ****************************************************************************/
 
 #ifdef CONFIG_FS_WRITABLE
-static ssize_t smart_write(FAR struct inode *inode, FAR const unsigned char *buffer, size_t start_sector, unsigned int nsectors)
+static ssize_t smart_do_write(FAR struct inode *inode, FAR const unsigned char *buffer, size_t start_sector, unsigned int nsectors)
 {
 	FAR struct smart_struct_s *dev;
 	off_t alignedblock;
@@ -938,6 +1113,13 @@ static ssize_t smart_write(FAR struct inode *inode, FAR const unsigned char *buf
 	dev = (FAR struct smart_struct_s *)inode->i_private;
 #endif
 
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+	ret = smart_checkpoint_invalidate(dev);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
 	/* I think maybe we need to lock on a mutex here. */
 
 	/* Get the aligned block. Here it is assumed that:
@@ -1017,6 +1199,38 @@ static ssize_t smart_write(FAR struct inode *inode, FAR const unsigned char *buf
 
 	return nsectors;
 }
+
+/****************************************************************************
+ * Name: smart_write
+ *
+ * Description: Write the specified number of sectors.  With background
+ *              garbage collection the write is serialized with the worker,
+ *              which is scheduled again when it is done.
+ *
+ ****************************************************************************/
+
+static ssize_t smart_write(FAR struct inode *inode, FAR const unsigned char *buffer, size_t start_sector, unsigned int nsectors)
+{
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+	FAR struct smart_struct_s *dev;
+	ssize_t ret;
+
+	DEBUGASSERT(inode && inode->i_private);
+	dev = (FAR struct smart_struct_s *)inode->i_private;
+
+	while (sem_wait(&dev->exclsem) != OK) {
+		DEBUGASSERT(get_errno() == EINTR);
+	}
+
+	ret = smart_do_write(inode, buffer, start_sector, nsectors);
+	smart_gc_schedule(dev);
+
+	sem_post(&dev->exclsem);
+	return ret;
+#else
+	return smart_do_write(inode, buffer, start_sector, nsectors);
+#endif
+}
 #endif							/* CONFIG_FS_WRITABLE */
 
 /****************************************************************************
@@ -1109,7 +1323,26 @@ static int smart_setsectorsize(FAR struct smart_struct_s *dev, uint16_t size)
 			dev->availSectPerBlk = dev->sectorsPerBlk;
 		}
 	}
-	
+
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+	/* The checkpoint area takes the last erase blocks of the device.  It is
+	 * sized for a header sector plus the map and the counts of the whole
+	 * device, which is slightly more than what remains after the carve out.
+	 */
+
+	allocsize = size + dev->geo.neraseblocks * dev->sectorsPerBlk * sizeof(uint16_t) + (dev->geo.neraseblocks << 1);
+	dev->ncpblocks = (allocsize + erasesize - 1) / erasesize;
+	if (dev->ncpblocks >= dev->neraseblocks / 2) {
+		/* Not worth it on such a small device */
+
+		dev->ncpblocks = 0;
+	}
+
+	dev->neraseblocks -= dev->ncpblocks;
+	dev->cpblock = dev->neraseblocks;
+	dev->cpvalid = false;
+#endif
+
 #ifdef CONFIG_MTD_SMART_JOURNALING
 	/** Journal Sector is reserved at the last of smartfs partition, it doesn't use MTD Header.
 	  * We will use it as a contigous memory space...
@@ -1181,6 +1414,12 @@ static int smart_setsectorsize(FAR struct smart_struct_s *dev, uint16_t size)
 		smart_free(dev, dev->rwbuffer);
 		dev->rwbuffer = NULL;
 	}
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+	if (dev->runbuffer != NULL) {
+		smart_free(dev, dev->runbuffer);
+		dev->runbuffer = NULL;
+	}
+#endif
 	if (dev->bytebuffer != NULL) {
 		smart_free(dev, dev->bytebuffer);
 		dev->bytebuffer = NULL;
@@ -1323,6 +1562,14 @@ static int smart_setsectorsize(FAR struct smart_struct_s *dev, uint16_t size)
 		goto errexit;
 	}
 
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+	dev->runbuffer = (FAR uint8_t *)smart_malloc(dev, CONFIG_MTD_SMART_WRITE_BATCH_SECTORS * size, "Run Buffer");
+	if (!dev->runbuffer) {
+		fdbg("Error allocating SMART run buffer\n");
+		goto errexit;
+	}
+#endif
+
 	return OK;
 
 	/* On error for any allocation, we jump in here and free anything that is
@@ -1832,116 +2079,434 @@ static int smart_set_wear_level(FAR struct smart_struct_s *dev, uint16_t block,
 }
 #endif
 
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
 /****************************************************************************
- * Name: smart_scan
+ * Name: smart_checkpoint_segments
  *
- * Description: Perform a scan of the MTD device to search for format
- *              information and fill in logical sector mapping, freesector
- *              count, etc.
+ * Description: Return the RAM areas saved in the checkpoint: the logical
+ *              to physical sector map and the release/free counts.  The
+ *              freecount array directly follows releasecount and has the
+ *              same size.
  *
  ****************************************************************************/
 
-static int smart_scan(FAR struct smart_struct_s *dev)
+static void smart_checkpoint_segments(FAR struct smart_struct_s *dev, FAR uint8_t **data, FAR uint32_t *len)
 {
-	int sector;
-	int ret = OK;
-	uint16_t totalsectors;
-	uint16_t prerelease;
-	uint16_t logicalsector;
-	uint16_t loser;
-	uint16_t winner;
-	uint32_t readaddress;
-	uint32_t offset;
-	uint16_t seq1;
-	uint16_t seq2;
-	uint16_t seqwrap;
-	struct smart_sect_header_s header;
-	bool status_released, status_committed;
-#ifdef CONFIG_MTD_SMART_MINIMIZE_RAM
-	int dupsector;
-	uint16_t duplogsector;
+#ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
+	data[0] = (FAR uint8_t *)dev->sMap;
+	len[0] = dev->totalsectors * sizeof(uint16_t);
+#else
+	data[0] = dev->sBitMap;
+	len[0] = (dev->totalsectors + 7) >> 3;
 #endif
-#ifdef CONFIG_SMARTFS_MULTI_ROOT_DIRS
-	int x;
-	char devname[22];
-	FAR struct smart_multiroot_device_s *rootdirdev;
+	data[1] = dev->releasecount;
+	len[1] = (dev->freecount - dev->releasecount) << 1;
+}
+
+/****************************************************************************
+ * Name: smart_checkpoint_write
+ *
+ * Description: Save the sector map and the counts to the checkpoint area
+ *              if they changed since the last checkpoint.
+ *
+ ****************************************************************************/
+
+static int smart_checkpoint_write(FAR struct smart_struct_s *dev)
+{
+	FAR struct smart_checkpoint_s *cp;
+	FAR uint8_t *data[2];
+	uint32_t len[2];
+	uint32_t datacrc = 0;
+	uint32_t offset;
+	uint32_t chunk;
+	off_t mtdblock;
+	size_t pos;
+	int seg;
+	int ret;
+
+	if (dev->cpvalid || dev->ncpblocks == 0 || dev->formatstatus != SMART_FMT_STAT_FORMATTED) {
+		return OK;
+	}
+#ifdef CONFIG_MTD_SMART_ENABLE_CRC
+	/* Sectors allocated in RAM only are not on the device yet.  Leave the
+	 * checkpoint invalid, the next mount has to scan anyway.
+	 */
+
+	if (dev->allocsector != NULL) {
+		return OK;
+	}
 #endif
 
-	// ToDo: Revert to the flexible logic that searches sectors and
-	//       reads sector sizes stored in the sectors instead of
-	//		 using CONFIG_MTD_SMART_SECTOR_SIZE.
-	ret = smart_setsectorsize(dev, CONFIG_MTD_SMART_SECTOR_SIZE);
-	if (ret != OK) {
-		goto err_out;
+	ret = MTD_ERASE(dev->mtd, dev->cpblock, dev->ncpblocks);
+	if (ret < 0) {
+		fdbg("Error %d erasing the checkpoint area\n", -ret);
+		return ret;
 	}
 
-	/* Initialize the device variables. */
+	/* Write the data sector by sector after the header sector. */
 
-	totalsectors = dev->totalsectors;
+	mtdblock = ((off_t)dev->cpblock * dev->geo.erasesize) / dev->geo.blocksize;
+	mtdblock += dev->mtdBlksPerSector;
 
-	dev->formatstatus = SMART_FMT_STAT_NOFMT;
-	dev->freesectors = dev->availSectPerBlk * dev->neraseblocks;
-	dev->releasesectors = 0;
+	smart_checkpoint_segments(dev, data, len);
+	pos = 0;
+	for (seg = 0; seg < 2; seg++) {
+		for (offset = 0; offset < len[seg]; offset += chunk) {
+			chunk = dev->sectorsize - pos;
+			if (chunk > len[seg] - offset) {
+				chunk = len[seg] - offset;
+			}
 
-	/* Initialize the freecount and releasecount arrays. */
+			memcpy(&dev->rwbuffer[pos], &data[seg][offset], chunk);
+			datacrc = crc32part(&data[seg][offset], chunk, datacrc);
+			pos += chunk;
 
-	for (sector = 0; sector < dev->neraseblocks; sector++) {
-		if (sector == dev->neraseblocks - 1 && dev->totalsectors == 65534) {
-			prerelease = 2;
-		} else {
-			prerelease = 0;
+			if (pos == dev->sectorsize || (seg == 1 && offset + chunk == len[seg])) {
+				memset(&dev->rwbuffer[pos], CONFIG_SMARTFS_ERASEDSTATE, dev->sectorsize - pos);
+				ret = MTD_BWRITE(dev->mtd, mtdblock, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
+				if (ret != dev->mtdBlksPerSector) {
+					fdbg("Error %d writing the checkpoint\n", ret);
+					return -EIO;
+				}
+				mtdblock += dev->mtdBlksPerSector;
+				pos = 0;
+			}
 		}
+	}
 
-#ifdef CONFIG_MTD_SMART_PACK_COUNTS
-		smart_set_count(dev, dev->freecount, sector, dev->availSectPerBlk - prerelease);
-		smart_set_count(dev, dev->releasecount, sector, prerelease);
-#else
-		dev->freecount[sector] = dev->availSectPerBlk - prerelease;
-		dev->releasecount[sector] = prerelease;
+	/* Now the header, which makes the checkpoint valid. */
+
+	memset(dev->rwbuffer, CONFIG_SMARTFS_ERASEDSTATE, dev->sectorsize);
+	cp = (FAR struct smart_checkpoint_s *)dev->rwbuffer;
+	cp->magic = SMART_CP_MAGIC;
+	cp->state = SMART_CP_STATE_VALID;
+	cp->version = SMART_CP_VERSION;
+	cp->formatversion = dev->formatversion;
+	cp->namesize = dev->namesize;
+	cp->totalsectors = dev->totalsectors;
+	cp->neraseblocks = dev->neraseblocks;
+	cp->sectorsize = dev->sectorsize;
+	cp->freesectors = dev->freesectors;
+	cp->releasesectors = dev->releasesectors;
+	cp->lastallocblock = dev->lastallocblock;
+	cp->datalen = len[0] + len[1];
+	cp->datacrc = datacrc;
+	cp->hdrcrc = crc32((FAR const uint8_t *)cp, offsetof(struct smart_checkpoint_s, hdrcrc));
+
+	mtdblock = ((off_t)dev->cpblock * dev->geo.erasesize) / dev->geo.blocksize;
+	ret = MTD_BWRITE(dev->mtd, mtdblock, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
+	if (ret != dev->mtdBlksPerSector) {
+		fdbg("Error %d writing the checkpoint header\n", ret);
+		return -EIO;
+	}
+
+	dev->cpvalid = true;
+	fvdbg("Checkpoint written, %d bytes\n", len[0] + len[1]);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: smart_checkpoint_restore
+ *
+ * Description: Load the sector map and the counts from the checkpoint area
+ *              instead of scanning the device.  Any mismatch of the header
+ *              or the CRCs leaves the caller to do the full scan, which
+ *              initializes everything again.
+ *
+ ****************************************************************************/
+
+static int smart_checkpoint_restore(FAR struct smart_struct_s *dev)
+{
+	struct smart_checkpoint_s cp;
+	FAR uint8_t *data[2];
+	uint32_t len[2];
+	uint32_t datacrc = 0;
+	uint32_t offset;
+	uint32_t chunk;
+	off_t mtdblock;
+	size_t pos;
+	uint32_t freesectors;
+	uint32_t releasesectors;
+	uint16_t freecount;
+	uint16_t releasecount;
+	uint16_t block;
+#if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
+	clock_t start = clock_systimer();
 #endif
+	int seg;
+	int ret;
+
+	if (dev->ncpblocks == 0) {
+		return -ENOENT;
 	}
 
-	/* Initialize the sector map. */
+	mtdblock = ((off_t)dev->cpblock * dev->geo.erasesize) / dev->geo.blocksize;
+	ret = MTD_BREAD(dev->mtd, mtdblock, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
+	if (ret != dev->mtdBlksPerSector) {
+		return -EIO;
+	}
 
-#ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
-	for (sector = 0; sector < totalsectors; sector++) {
-		dev->sMap[sector] = -1;
+	memcpy(&cp, dev->rwbuffer, sizeof(struct smart_checkpoint_s));
+	if (cp.magic != SMART_CP_MAGIC || cp.state != SMART_CP_STATE_VALID || cp.version != SMART_CP_VERSION) {
+		fvdbg("No valid checkpoint\n");
+		return -ENOENT;
 	}
-#else
-	/* Clear all logical sector used bits. */
 
-	memset(dev->sBitMap, 0, (dev->totalsectors + 7) >> 3);
-#endif
+	if (cp.hdrcrc != crc32((FAR const uint8_t *)&cp, offsetof(struct smart_checkpoint_s, hdrcrc))) {
+		fdbg("Checkpoint header CRC error\n");
+		return -EINVAL;
+	}
 
-	/* Now scan the MTD device. */
+	smart_checkpoint_segments(dev, data, len);
+	if (cp.totalsectors != dev->totalsectors || cp.neraseblocks != dev->neraseblocks || cp.sectorsize != dev->sectorsize || cp.datalen != len[0] + len[1]) {
+		fdbg("Checkpoint geometry mismatch\n");
+		return -EINVAL;
+	}
 
-	for (sector = 0; sector < totalsectors; sector++) {
-		winner = sector;
-		fvdbg("Scan sector %d\n", sector);
+	/* Read the data back sector by sector. */
 
-		/* Calculate the read address for this sector. */
+	pos = dev->sectorsize;
+	for (seg = 0; seg < 2; seg++) {
+		for (offset = 0; offset < len[seg]; offset += chunk) {
+			if (pos == dev->sectorsize) {
+				mtdblock += dev->mtdBlksPerSector;
+				ret = MTD_BREAD(dev->mtd, mtdblock, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
+				if (ret != dev->mtdBlksPerSector) {
+					return -EIO;
+				}
+				pos = 0;
+			}
 
-		readaddress = sector * dev->mtdBlksPerSector * dev->geo.blocksize;
+			chunk = dev->sectorsize - pos;
+			if (chunk > len[seg] - offset) {
+				chunk = len[seg] - offset;
+			}
 
-		/* Read the header for this sector. */
-		ret = MTD_READ(dev->mtd, readaddress, sizeof(struct smart_sect_header_s), (uint8_t *)dev->rwbuffer);
-		if (ret != sizeof(struct smart_sect_header_s)) {
-			fdbg("Error reading physical sector %d.\n", sector);
-			goto err_out;
+			memcpy(&data[seg][offset], &dev->rwbuffer[pos], chunk);
+			datacrc = crc32part(&data[seg][offset], chunk, datacrc);
+			pos += chunk;
 		}
-		/* copy header data only, will be used below */
-		memcpy(&header, dev->rwbuffer, sizeof(struct smart_sect_header_s));
+	}
 
-		/* Get the logical sector number for this physical sector. */
-		logicalsector = UINT8TOUINT16(header.logicalsector);
-#if CONFIG_SMARTFS_ERASEDSTATE == 0x00
-		if (logicalsector == 0) {
-			logicalsector = -1;
-		}
-#endif
+	if (datacrc != cp.datacrc) {
+		fdbg("Checkpoint data CRC error\n");
+		return -EINVAL;
+	}
 
-		status_released = SECTOR_IS_RELEASED(header);
-		status_committed = SECTOR_IS_COMMITTED(header);
+	/* Total the restored counts of the erase blocks like the scan does,
+	 * they have to match the totals of the header.
+	 */
+
+	freesectors = 0;
+	releasesectors = 0;
+	for (block = 0; block < dev->neraseblocks; block++) {
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+		freecount = smart_get_count(dev, dev->freecount, block);
+		releasecount = smart_get_count(dev, dev->releasecount, block);
+#else
+		freecount = dev->freecount[block];
+		releasecount = dev->releasecount[block];
+#endif
+		if (freecount + releasecount > dev->availSectPerBlk) {
+			fdbg("Checkpoint counts of block %d are invalid\n", block);
+			return -EINVAL;
+		}
+
+		freesectors += freecount;
+		releasesectors += releasecount;
+	}
+
+	if (freesectors != cp.freesectors || releasesectors != cp.releasesectors) {
+		fdbg("Checkpoint totals mismatch, free %d/%d released %d/%d\n", freesectors, cp.freesectors, releasesectors, cp.releasesectors);
+		return -EINVAL;
+	}
+
+	dev->freesectors = freesectors;
+	dev->releasesectors = releasesectors;
+	dev->lastallocblock = cp.lastallocblock;
+	dev->namesize = cp.namesize;
+	dev->formatversion = cp.formatversion;
+	dev->formatstatus = SMART_FMT_STAT_FORMATTED;
+	dev->cpvalid = true;
+
+#if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
+	/* Start the statistics like the scan does, the erase count is read
+	 * back with the wear leveling status.
+	 */
+
+	dev->unusedsectors = 0;
+	dev->blockerases = 0;
+#endif
+
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+	/* Read the wear leveling status bits. */
+
+	smart_read_wearstatus(dev);
+#endif
+
+#if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
+	dev->nrestores++;
+	dev->restoretime = TICK2MSEC(clock_systimer() - start);
+#endif
+
+	fvdbg("SMART sector map restored from checkpoint\n");
+	return OK;
+}
+
+/****************************************************************************
+ * Name: smart_checkpoint_invalidate
+ *
+ * Description: Mark the checkpoint on the device stale before the device
+ *              is modified.  Only one byte is programmed, the area is
+ *              erased when the next checkpoint is written.  This bypasses
+ *              the journal on purpose: a lost invalidation only leaves
+ *              the checkpoint valid if nothing was modified yet.
+ *
+ ****************************************************************************/
+
+static int smart_checkpoint_invalidate(FAR struct smart_struct_s *dev)
+{
+	uint8_t state = SMART_CP_STATE_INVALID;
+	size_t offset;
+	ssize_t ret;
+
+	if (!dev->cpvalid) {
+		return OK;
+	}
+
+	offset = (size_t)dev->cpblock * dev->geo.erasesize + offsetof(struct smart_checkpoint_s, state);
+#ifdef CONFIG_MTD_BYTE_WRITE
+	if (dev->mtd->write != NULL) {
+		ret = MTD_WRITE(dev->mtd, offset, 1, &state);
+	} else
+#endif
+	{
+		ret = smart_byte_to_block_write(dev, offset, 1, &state);
+	}
+
+	if (ret != 1) {
+		fdbg("Error %d invalidating the checkpoint\n", ret);
+		return ret < 0 ? ret : -EIO;
+	}
+
+	dev->cpvalid = false;
+	return OK;
+}
+#endif							/* CONFIG_MTD_SMART_MAP_CHECKPOINT */
+
+/****************************************************************************
+ * Name: smart_scan
+ *
+ * Description: Perform a scan of the MTD device to search for format
+ *              information and fill in logical sector mapping, freesector
+ *              count, etc.
+ *
+ ****************************************************************************/
+
+static int smart_scan(FAR struct smart_struct_s *dev)
+{
+	int sector;
+	int ret = OK;
+	uint16_t totalsectors;
+	uint16_t prerelease;
+	uint16_t logicalsector;
+	uint16_t loser;
+	uint16_t winner;
+	uint32_t readaddress;
+	uint32_t offset;
+	uint16_t seq1;
+	uint16_t seq2;
+	uint16_t seqwrap;
+	struct smart_sect_header_s header;
+	bool status_released, status_committed;
+#if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
+	clock_t start = clock_systimer();
+#endif
+#ifdef CONFIG_MTD_SMART_MINIMIZE_RAM
+	int dupsector;
+	uint16_t duplogsector;
+#endif
+#ifdef CONFIG_SMARTFS_MULTI_ROOT_DIRS
+	int x;
+	char devname[22];
+	FAR struct smart_multiroot_device_s *rootdirdev;
+#endif
+
+	// ToDo: Revert to the flexible logic that searches sectors and
+	//       reads sector sizes stored in the sectors instead of
+	//		 using CONFIG_MTD_SMART_SECTOR_SIZE.
+	ret = smart_setsectorsize(dev, CONFIG_MTD_SMART_SECTOR_SIZE);
+	if (ret != OK) {
+		goto err_out;
+	}
+
+	/* Initialize the device variables. */
+
+	totalsectors = dev->totalsectors;
+
+	dev->formatstatus = SMART_FMT_STAT_NOFMT;
+	dev->freesectors = dev->availSectPerBlk * dev->neraseblocks;
+	dev->releasesectors = 0;
+
+	/* Initialize the freecount and releasecount arrays. */
+
+	for (sector = 0; sector < dev->neraseblocks; sector++) {
+		if (sector == dev->neraseblocks - 1 && dev->totalsectors == 65534) {
+			prerelease = 2;
+		} else {
+			prerelease = 0;
+		}
+
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+		smart_set_count(dev, dev->freecount, sector, dev->availSectPerBlk - prerelease);
+		smart_set_count(dev, dev->releasecount, sector, prerelease);
+#else
+		dev->freecount[sector] = dev->availSectPerBlk - prerelease;
+		dev->releasecount[sector] = prerelease;
+#endif
+	}
+
+	/* Initialize the sector map. */
+
+#ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
+	for (sector = 0; sector < totalsectors; sector++) {
+		dev->sMap[sector] = -1;
+	}
+#else
+	/* Clear all logical sector used bits. */
+
+	memset(dev->sBitMap, 0, (dev->totalsectors + 7) >> 3);
+#endif
+
+	/* Now scan the MTD device. */
+
+	for (sector = 0; sector < totalsectors; sector++) {
+		winner = sector;
+		fvdbg("Scan sector %d\n", sector);
+
+		/* Calculate the read address for this sector. */
+
+		readaddress = sector * dev->mtdBlksPerSector * dev->geo.blocksize;
+
+		/* Read the header for this sector. */
+		ret = MTD_READ(dev->mtd, readaddress, sizeof(struct smart_sect_header_s), (uint8_t *)dev->rwbuffer);
+		if (ret != sizeof(struct smart_sect_header_s)) {
+			fdbg("Error reading physical sector %d.\n", sector);
+			goto err_out;
+		}
+		/* copy header data only, will be used below */
+		memcpy(&header, dev->rwbuffer, sizeof(struct smart_sect_header_s));
+
+		/* Get the logical sector number for this physical sector. */
+		logicalsector = UINT8TOUINT16(header.logicalsector);
+#if CONFIG_SMARTFS_ERASEDSTATE == 0x00
+		if (logicalsector == 0) {
+			logicalsector = -1;
+		}
+#endif
+
+		status_released = SECTOR_IS_RELEASED(header);
+		status_committed = SECTOR_IS_COMMITTED(header);
 #ifdef CONFIG_MTD_SMART_JOURNALING
 		fvdbg("released : %d committed : %d logical : %d physical : %d crc : %d sta :%d seq :%d\n", status_released, status_committed, logicalsector, sector, UINT8TOUINT16(header.crc16), header.status, header.seq);
 #endif
@@ -2020,6 +2585,15 @@ static int smart_scan(FAR struct smart_struct_s *dev)
 			if (dev->rwbuffer[SMART_FMT_JOURNAL_POS] != SMART_FMT_JOURNAL) {
 				continue;
 			}
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+			/* A volume formatted without the checkpoint area may have
+			 * data where the area is now.
+			 */
+
+			if (dev->rwbuffer[SMART_FMT_CHECKPOINT_POS] != SMART_FMT_CHECKPOINT) {
+				continue;
+			}
+#endif
 			if (dev->rwbuffer[SMART_FMT_FORMAT_POS] == SMART_FORMAT_ENABLE) {
 				dev->formatstatus = SMART_FMT_STAT_NOFMT;
 				fdbg("format requested, Flash will be erased!!\n");
@@ -2347,6 +2921,10 @@ static int smart_scan(FAR struct smart_struct_s *dev)
 			fdbg("       %s: %d\n", dev->alloc[sector].name, dev->alloc[sector].size);
 		}
 	}
+#endif
+#if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
+	dev->nscans++;
+	dev->scantime = TICK2MSEC(clock_systimer() - start);
 #endif
 	ret = OK;
 
@@ -2910,6 +3488,9 @@ static inline int smart_llformat(FAR struct smart_struct_s *dev, unsigned long a
 
 	dev->rwbuffer[SMART_FMT_ROOTDIRS_POS] = (uint8_t) (arg & 0xff);
 	dev->rwbuffer[SMART_FMT_FORMAT_POS] = SMART_FORMAT_DISABLE;
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+	dev->rwbuffer[SMART_FMT_CHECKPOINT_POS] = SMART_FMT_CHECKPOINT;
+#endif
 
 #ifdef CONFIG_MTD_SMART_ENABLE_CRC
 #ifdef CONFIG_SMART_CRC_8
@@ -3579,30 +4160,84 @@ retry:
 	return physicalsector;
 }
 
+#ifdef CONFIG_FS_WRITABLE
+/****************************************************************************
+ * Name: smart_gc_victim
+ *
+ * Description:  Find the erase block with the most released sectors, which
+ *               is the cheapest one to collect.
+ *
+ * Returned Value:
+ *   The block number or 0xFFFF if no block has released sectors.  The count
+ *   of released sectors of the block is returned in 'released'.
+ *
+ ****************************************************************************/
+
+static uint16_t smart_gc_victim(FAR struct smart_struct_s *dev, FAR uint16_t *released)
+{
+	uint16_t collectblock;
+	uint16_t releasemax;
+	int x;
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+	uint8_t count;
+#endif
+
+	collectblock = 0xFFFF;
+	releasemax = 0;
+	for (x = 0; x < dev->neraseblocks; x++) {
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+		/* Don't collect blocks that have been worn completely. */
+
+		if (smart_get_wear_level(dev, x) >= SMART_WEAR_REORG_THRESHOLD) {
+			continue;
+		}
+#endif
+
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+		count = smart_get_count(dev, dev->releasecount, x);
+		if (count > releasemax) {
+			releasemax = count;
+			collectblock = x;
+		}
+#else
+		if (dev->releasecount[x] > releasemax) {
+			releasemax = dev->releasecount[x];
+			collectblock = x;
+		}
+#endif
+	}
+
+	*released = releasemax;
+	return collectblock;
+}
+
 /****************************************************************************
  * Name: smart_garbagecollect
  *
  * Description:  Perform garbage collection if needed.  This is determined
  *               by the count of released sectors relative to free and
- *               total sectors.
+ *               total sectors.  With CONFIG_MTD_SMART_BACKGROUND_GC this
+ *               only collects when the reserved free sectors are reached,
+ *               everything else is left to the background worker.
  *
  ****************************************************************************/
 
-#ifdef CONFIG_FS_WRITABLE
 static int smart_garbagecollect(FAR struct smart_struct_s *dev)
 {
 	uint16_t collectblock;
 	uint16_t releasemax;
 	bool collect = TRUE;
-	int x;
-	int ret;
-#ifdef CONFIG_MTD_SMART_PACK_COUNTS
-	uint8_t count;
+	int ret = OK;
+#if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
+	clock_t start = clock_systimer();
+	uint32_t nblocks = 0;
+	uint32_t stall;
 #endif
 
 	while (collect) {
 		collect = FALSE;
 
+#ifndef CONFIG_MTD_SMART_BACKGROUND_GC
 		/* Test if the released sectors count is greater than the
 		 * free sectors.  If it is, then we will do garbage collection.
 		 */
@@ -3610,10 +4245,11 @@ static int smart_garbagecollect(FAR struct smart_struct_s *dev)
 		if (dev->releasesectors > dev->freesectors && dev->freesectors < (dev->totalsectors >> 5)) {
 			collect = TRUE;
 		}
+#endif
 
 		/* Test if we have more reached our reserved free sector limit. */
 
-		if (dev->freesectors <= (dev->sectorsPerBlk << 0) + 4) {
+		if (dev->freesectors <= SMART_GC_RESERVE(dev)) {
 			collect = TRUE;
 		}
 
@@ -3622,37 +4258,12 @@ static int smart_garbagecollect(FAR struct smart_struct_s *dev)
 		if (collect) {
 			/* Find the block with the most released sectors. */
 
-			collectblock = 0xFFFF;
-			releasemax = 0;
-			for (x = 0; x < dev->neraseblocks; x++) {
-#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
-				/* Don't collect blocks that have been worn completely. */
-
-				if (smart_get_wear_level(dev, x) >= SMART_WEAR_REORG_THRESHOLD) {
-					continue;
-				}
-#endif
-
-#ifdef CONFIG_MTD_SMART_PACK_COUNTS
-				count = smart_get_count(dev, dev->releasecount, x);
-				if (count > releasemax) {
-					releasemax = count;
-					collectblock = x;
-				}
-#else
-				if (dev->releasecount[x] > releasemax) {
-					releasemax = dev->releasecount[x];
-					collectblock = x;
-				}
-#endif
-			}
-			//releasemax = smart_get_count(dev, dev->releasecount, collectblock);
-
+			collectblock = smart_gc_victim(dev, &releasemax);
 			if (collectblock == 0xFFFF) {
 				/* Need to collect, but no sectors with released blocks! */
 
 				ret = -ENOSPC;
-				return ret;
+				break;
 			}
 #ifdef CONFIG_SMART_LOCAL_CHECKFREE
 			if (smart_checkfree(dev, __LINE__) != OK) {
@@ -3677,30 +4288,132 @@ static int smart_garbagecollect(FAR struct smart_struct_s *dev)
 #endif
 
 			if (ret != OK) {
-				return ret;
+				break;
 			}
+
+#if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
+			nblocks++;
+#endif
 		}
 	}
 
-	return OK;
+#if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
+	/* Account the time the request waited for the collection. */
+
+	if (nblocks > 0) {
+		stall = TICK2MSEC(clock_systimer() - start);
+		dev->fggcblocks += nblocks;
+		dev->fggcstalls++;
+		dev->fggclaststall = stall;
+		if (stall > dev->fggcmaxstall) {
+			dev->fggcmaxstall = stall;
+		}
+	}
+#endif
+
+	return ret;
 }
-#endif							/* CONFIG_FS_WRITABLE */
 
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
 /****************************************************************************
- * Name: smart_write_wearstatus
+ * Name: smart_gc_schedule
  *
- * Description:  Write the wear leveling status bits to sector zero (and
- *               possibly others if it doesn't fit) such that is is persisted
- *               across OS reboots.
+ * Description:  Note a request to the device and schedule the background
+ *               garbage collection if the free sectors dropped below the
+ *               low watermark.  Called with exclsem held.
  *
  ****************************************************************************/
 
-#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
-static int smart_write_wearstatus(struct smart_struct_s *dev)
+static void smart_gc_schedule(FAR struct smart_struct_s *dev)
 {
-	uint16_t sector;
-	uint16_t remaining, towrite;
-	struct smart_read_write_s req;
+	dev->lastio = clock_systimer();
+
+	if (dev->crefs > 0 && dev->releasesectors > 0 && dev->freesectors < SMART_GC_LOW(dev) && work_available(&dev->gcwork)) {
+		work_queue(LPWORK, &dev->gcwork, smart_gc_worker, dev, SMART_GC_IDLE_TICKS);
+	}
+}
+
+/****************************************************************************
+ * Name: smart_gc_worker
+ *
+ * Description:  Collect one erase block on the low priority work queue and
+ *               queue itself again until the free sectors reach the high
+ *               watermark.  Only blocks with at least a quarter of their
+ *               sectors released are worth the erase.  A request in
+ *               progress or a recent one defers the work, the request
+ *               schedules it again when it is done.
+ *
+ ****************************************************************************/
+
+static void smart_gc_worker(FAR void *arg)
+{
+	FAR struct smart_struct_s *dev = (FAR struct smart_struct_s *)arg;
+	uint16_t collectblock;
+	uint16_t released;
+	clock_t idle;
+	int ret;
+
+	if (sem_trywait(&dev->exclsem) != OK) {
+		return;
+	}
+
+	if (dev->crefs == 0 || dev->freesectors >= SMART_GC_HIGH(dev)) {
+		goto out;
+	}
+
+	idle = clock_systimer() - dev->lastio;
+	if (idle < SMART_GC_IDLE_TICKS) {
+		work_queue(LPWORK, &dev->gcwork, smart_gc_worker, dev, SMART_GC_IDLE_TICKS - idle);
+		goto out;
+	}
+
+	collectblock = smart_gc_victim(dev, &released);
+	if (collectblock == 0xFFFF || released < ((dev->availSectPerBlk + 3) >> 2)) {
+		goto out;
+	}
+
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+	if (smart_checkpoint_invalidate(dev) < 0) {
+		goto out;
+	}
+#endif
+
+	fvdbg("Background collecting block %d, released=%d\n", collectblock, released);
+	ret = smart_relocate_block(dev, collectblock);
+	if (ret != OK) {
+		fdbg("Error %d collecting block %d\n", ret, collectblock);
+		goto out;
+	}
+
+#if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
+	dev->bggcblocks++;
+#endif
+
+	/* One block per run, let other work and requests in between. */
+
+	work_queue(LPWORK, &dev->gcwork, smart_gc_worker, dev, 1);
+
+out:
+	sem_post(&dev->exclsem);
+}
+#endif							/* CONFIG_MTD_SMART_BACKGROUND_GC */
+#endif							/* CONFIG_FS_WRITABLE */
+
+/****************************************************************************
+ * Name: smart_write_wearstatus
+ *
+ * Description:  Write the wear leveling status bits to sector zero (and
+ *               possibly others if it doesn't fit) such that is is persisted
+ *               across OS reboots.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+static int smart_write_wearstatus(struct smart_struct_s *dev)
+{
+	uint16_t sector;
+	uint16_t remaining, towrite;
+	struct smart_read_write_s req;
 	int ret;
 	uint8_t buffer[8], write_buffer = 0;
 
@@ -4034,6 +4747,39 @@ static int smart_validate_crc(FAR struct smart_struct_s *dev)
 }
 #endif
 
+/****************************************************************************
+ * Name: smart_commit_crc
+ *
+ * Description:  Commit the sector in the RW buffer ahead of time and
+ *               calculate its CRC.  The CRC will protect us.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_SMART_ENABLE_CRC
+static void smart_commit_crc(FAR struct smart_struct_s *dev)
+{
+	FAR struct smart_sect_header_s *header;
+
+	header = (FAR struct smart_sect_header_s *)dev->rwbuffer;
+
+#if CONFIG_SMARTFS_ERASEDSTATE == 0xFF
+	header->status &= ~(SMART_STATUS_COMMITTED | SMART_STATUS_CRC);
+#else
+	header->status |= SMART_STATUS_COMMITTED | SMART_STATUS_CRC;
+#endif
+
+	/* Now calculate the CRC value for the sector. */
+
+#ifdef CONFIG_SMART_CRC_8
+	header->crc8 = smart_calc_sector_crc(dev);
+#elif defined(CONFIG_SMART_CRC_16)
+	*((uint16_t *)header->crc16) = smart_calc_sector_crc(dev);
+#elif defined(CONFIG_SMART_CRC_32)
+	*((uint32_t *)header->crc32) = smart_calc_sector_crc(dev);
+#endif
+}
+#endif
+
 /****************************************************************************
  * Name: smart_writesector
  *
@@ -4251,23 +4997,7 @@ static int smart_writesector(FAR struct smart_struct_s *dev, unsigned long arg)
 
 	memcpy(&dev->rwbuffer[sizeof(struct smart_sect_header_s) + req->offset], req->buffer, req->count);
 
-	/* Commit the sector ahead of time.  The CRC will protect us. */
-
-#if CONFIG_SMARTFS_ERASEDSTATE == 0xFF
-	header->status &= ~(SMART_STATUS_COMMITTED | SMART_STATUS_CRC);
-#else
-	header->status |= SMART_STATUS_COMMITTED | SMART_STATUS_CRC;
-#endif
-
-	/* Now calculate the CRC value for the sector. */
-
-#ifdef CONFIG_SMART_CRC_8
-	header->crc8 = smart_calc_sector_crc(dev);
-#elif defined(CONFIG_SMART_CRC_16)
-	*((uint16_t *)header->crc16) = smart_calc_sector_crc(dev);
-#elif defined(CONFIG_SMART_CRC_32)
-	*((uint32_t *)header->crc32) = smart_calc_sector_crc(dev);
-#endif
+	smart_commit_crc(dev);
 
 #else							/* CONFIG_MTD_SMART_ENABLE_CRC */
 
@@ -4325,81 +5055,395 @@ static int smart_writesector(FAR struct smart_struct_s *dev, unsigned long arg)
 		 * newly allocated physical sector. */
 		block = oldphyssector / dev->sectorsPerBlk;
 
-#ifdef CONFIG_MTD_SMART_PACK_COUNTS
-		smart_add_count(dev, dev->releasecount, block, 1);
-		smart_add_count(dev, dev->freecount, physsector / dev->sectorsPerBlk, -1);
-#else
-		dev->releasecount[block]++;
-		dev->freecount[physsector / dev->sectorsPerBlk]--;
-#endif
-		dev->freesectors--;
-		dev->releasesectors++;
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+		smart_add_count(dev, dev->releasecount, block, 1);
+		smart_add_count(dev, dev->freecount, physsector / dev->sectorsPerBlk, -1);
+#else
+		dev->releasecount[block]++;
+		dev->freecount[physsector / dev->sectorsPerBlk]--;
+#endif
+		dev->freesectors--;
+		dev->releasesectors++;
+
+#ifdef CONFIG_SMART_LOCAL_CHECKFREE
+		/* Perform debug free count checking enabled. */
+
+		smart_checkfree(dev, __LINE__);
+#endif
+
+		/* Update the sector map. */
+
+#ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
+		dev->sMap[req->logsector] = physsector;
+#else
+		smart_update_cache(dev, req->logsector, physsector);
+#endif
+
+		/* Test if releasing the sector created an empty erase block. */
+
+		smart_erase_block_if_empty(dev, block, FALSE);
+
+		/* Since we performed a relocation, do garbage collection to
+		 * ensure we don't fill up our flash with released blocks.
+		 */
+		smart_garbagecollect(dev);
+	} else {				/* needsrelocate */
+
+#ifdef CONFIG_MTD_SMART_ENABLE_CRC
+		/* Write the entire sector to FLASH when CRC enabled. */
+#ifdef CONFIG_MTD_SMART_JOURNALING
+		ret = smart_journal_bwrite(dev, physsector);
+#else
+		ret = MTD_BWRITE(dev->mtd, physsector * dev->mtdBlksPerSector, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
+#endif
+		if (ret != dev->mtdBlksPerSector) {
+			fdbg("Error writing to physical sector %d ret : %d\n", physsector, ret);
+			return -EIO;
+		}
+
+		/* Read the sector back and validate the CRC. */
+
+		ret = MTD_BREAD(dev->mtd, physsector * dev->mtdBlksPerSector, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
+		if (ret == dev->mtdBlksPerSector) {
+			/* Validate the CRC of the read-back data. */
+
+			ret = smart_validate_crc(dev);
+		}
+
+		if (ret != OK) {
+			fdbg("Error validating physical sector %d\n", physsector);
+			return -EIO;
+		}
+#else
+		/* Not relocated.  Just write the portion of the sector that needs
+		 * to be written. */
+
+		offset = mtdblock * dev->geo.blocksize + sizeof(struct smart_sect_header_s) + req->offset;
+		ret = smart_bytewrite(dev, offset, req->count, req->buffer);
+		if (ret != req->count) {
+			fdbg("Error committing physical sector %d\n", physsector);
+			return -EIO;
+		}
+#endif
+	}
+
+	return OK;
+}
+#endif							/* CONFIG_FS_WRITABLE */
+
+/****************************************************************************
+ * Name: smart_findfreerun
+ *
+ * Description:  Find 'count' contiguous free physical sectors within one
+ *               erase block, starting the search after the block we last
+ *               allocated from.
+ *
+ * Returned Value:
+ *   The first physical sector of the run or 0xFFFF if there is none.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+static uint16_t smart_findfreerun(FAR struct smart_struct_s *dev, uint16_t count)
+{
+	struct smart_sect_header_s header;
+	FAR struct smart_allocsector_s *allocsect;
+	uint16_t block;
+	uint16_t start = 0xFFFF;
+	uint16_t run;
+	uint16_t x;
+	int i;
+	int ret;
+
+	for (i = 1; i <= dev->neraseblocks; i++) {
+		block = (dev->lastallocblock + i) % dev->neraseblocks;
+
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+		if (smart_get_count(dev, dev->freecount, block) < count) {
+#else
+		if (dev->freecount[block] < count) {
+#endif
+			continue;
+		}
+
+		run = 0;
+		for (x = block * dev->sectorsPerBlk; x < block * dev->sectorsPerBlk + dev->availSectPerBlk; x++) {
+			/* Skip the sectors which have a temporary alloc in place. */
+
+			allocsect = dev->allocsector;
+			while (allocsect && allocsect->physical != x) {
+				allocsect = allocsect->next;
+			}
+
+			if (allocsect) {
+				run = 0;
+				continue;
+			}
+
+			ret = MTD_READ(dev->mtd, x * dev->mtdBlksPerSector * dev->geo.blocksize, sizeof(struct smart_sect_header_s), (FAR uint8_t *)&header);
+			if (ret != sizeof(struct smart_sect_header_s)) {
+				fdbg("Error reading phys sector %d\n", x);
+				return 0xFFFF;
+			}
+
+			if ((UINT8TOUINT16(header.logicalsector) != 0xFFFF) ||
+#if SMART_STATUS_VERSION == 1
+				(header.seq != 0xFF) || (header.crc8 != 0xFF) ||
+#else
+				(header.seq != CONFIG_SMARTFS_ERASEDSTATE) ||
+#endif
+				SECTOR_IS_COMMITTED(header)) {
+				run = 0;
+				continue;
+			}
+
+			if (run++ == 0) {
+				start = x;
+			}
+
+			if (run == count) {
+				dev->lastallocblock = block;
+				return start;
+			}
+		}
+	}
+
+	return 0xFFFF;
+}
+
+/****************************************************************************
+ * Name: smart_allocchain
+ *
+ * Description:  Allocate a run of new logical sectors which are backed by
+ *               contiguous physical sectors, so they can be written with a
+ *               single block write.  Like all allocations with CRC enabled,
+ *               they are kept in the temporary allocsector list until they
+ *               are written.
+ *
+ ****************************************************************************/
+
+static int smart_allocchain(FAR struct smart_struct_s *dev, FAR struct smart_write_chain_s *chain)
+{
+	FAR struct smart_allocsector_s *allocsect[CONFIG_MTD_SMART_WRITE_BATCH_SECTORS];
+	FAR struct smart_allocsector_s *tmp;
+	uint16_t physicalsector;
+	uint16_t logsector;
+	int ret;
+	int i;
+
+	if (chain->count < 2 || chain->count > CONFIG_MTD_SMART_WRITE_BATCH_SECTORS || chain->count > dev->availSectPerBlk) {
+		return -EINVAL;
+	}
+
+	/* The run must not eat into the sectors reserved for garbage collection.
+	 * The caller falls back to single sector allocations, which collect
+	 * garbage in the foreground when needed.
+	 */
+
+	ret = smart_garbagecollect(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (dev->freesectors <= SMART_GC_RESERVE(dev) + chain->count) {
+		return -ENOSPC;
+	}
+
+	/* Pick the logical sectors first so nothing has to be undone. */
+
+	logsector = SMART_FIRST_ALLOC_SECTOR;
+	for (i = 0; i < chain->count; i++) {
+		for (; logsector < dev->totalsectors; logsector++) {
+#ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
+			if (dev->sMap[logsector] != (uint16_t)-1)
+#else
+			if (dev->sBitMap[logsector >> 3] & (1 << (logsector & 0x07)))
+#endif
+			{
+				continue;
+			}
+
+			tmp = dev->allocsector;
+			while (tmp && tmp->logical != logsector) {
+				tmp = tmp->next;
+			}
+
+			if (tmp == NULL) {
+				break;
+			}
+		}
+
+		if (logsector >= dev->totalsectors) {
+			fdbg("No free logical sector numbers!  Free sectors = %d\n", dev->freesectors);
+			return -EIO;
+		}
+
+		chain->logsectors[i] = logsector++;
+	}
+
+	physicalsector = smart_findfreerun(dev, chain->count);
+	if (physicalsector == 0xFFFF) {
+		return -ENOSPC;
+	}
+
+	for (i = 0; i < chain->count; i++) {
+		allocsect[i] = (FAR struct smart_allocsector_s *)kmm_malloc(sizeof(struct smart_allocsector_s));
+		if (allocsect[i] == NULL) {
+			fdbg("Out of memory allocting sector\n");
+			while (--i >= 0) {
+				kmm_free(allocsect[i]);
+			}
+
+			return -ENOMEM;
+		}
+	}
+
+	/* Add the temporary allocs and map the sectors. */
+
+	for (i = 0; i < chain->count; i++) {
+		allocsect[i]->logical = chain->logsectors[i];
+		allocsect[i]->physical = physicalsector + i;
+		allocsect[i]->next = dev->allocsector;
+		dev->allocsector = allocsect[i];
+
+#ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
+		dev->sMap[chain->logsectors[i]] = physicalsector + i;
+#else
+		dev->sBitMap[chain->logsectors[i] >> 3] |= (1 << (chain->logsectors[i] & 0x07));
+		smart_add_sector_to_cache(dev, chain->logsectors[i], physicalsector + i, __LINE__);
+#endif
+	}
+
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+	smart_add_count(dev, dev->freecount, physicalsector / dev->sectorsPerBlk, -chain->count);
+#else
+	dev->freecount[physicalsector / dev->sectorsPerBlk] -= chain->count;
+#endif
+	dev->freesectors -= chain->count;
+
+	fvdbg("allocchain, physicalsector : %d count : %d\n", physicalsector, chain->count);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: smart_writechain
+ *
+ * Description:  Write a run of sectors allocated with smart_allocchain.
+ *               The headers and the CRCs of all sectors are built in the
+ *               run buffer, which is then programmed with one block write.
+ *
+ ****************************************************************************/
+
+static int smart_writechain(FAR struct smart_struct_s *dev, FAR struct smart_write_chain_s *chain)
+{
+	FAR struct smart_allocsector_s *allocsect[CONFIG_MTD_SMART_WRITE_BATCH_SECTORS];
+	FAR struct smart_allocsector_s **link;
+	struct smart_read_write_s req;
+	uint16_t physsector;
+	size_t hdroffset;
+	int ret;
+	int i;
+
+	hdroffset = sizeof(struct smart_sect_header_s);
+	if (chain->count < 2 || chain->count > CONFIG_MTD_SMART_WRITE_BATCH_SECTORS || hdroffset + chain->hdrsize + chain->datasize > dev->sectorsize) {
+		return -EINVAL;
+	}
+
+	/* Find the temporary allocs of the run.  Garbage collection may have
+	 * moved some of them since the run was allocated.
+	 */
+
+	for (i = 0; i < chain->count; i++) {
+		allocsect[i] = dev->allocsector;
+		while (allocsect[i] && allocsect[i]->logical != chain->logsectors[i]) {
+			allocsect[i] = allocsect[i]->next;
+		}
+
+		if (allocsect[i] == NULL) {
+			fdbg("Logical sector %d is not a new allocation\n", chain->logsectors[i]);
+			return -EINVAL;
+		}
+	}
+
+	physsector = allocsect[0]->physical;
+	for (i = 1; i < chain->count; i++) {
+		if (allocsect[i]->physical != physsector + i) {
+			break;
+		}
+	}
+
+	if (i < chain->count) {
+		/* Not contiguous anymore, write the sectors one by one. */
 
-#ifdef CONFIG_SMART_LOCAL_CHECKFREE
-		/* Perform debug free count checking enabled. */
+		fvdbg("Run of logical sector %d was moved, writing it by sector\n", chain->logsectors[0]);
+		for (i = 0; i < chain->count; i++) {
+			memcpy(dev->runbuffer, &chain->headers[i * chain->hdrsize], chain->hdrsize);
+			memcpy(&dev->runbuffer[chain->hdrsize], &chain->buffer[i * chain->datasize], chain->datasize);
 
-		smart_checkfree(dev, __LINE__);
-#endif
+			req.logsector = chain->logsectors[i];
+			req.offset = 0;
+			req.count = chain->hdrsize + chain->datasize;
+			req.buffer = dev->runbuffer;
+			ret = smart_writesector(dev, (unsigned long)&req);
+			if (ret < 0) {
+				return ret;
+			}
+		}
 
-		/* Update the sector map. */
+		return OK;
+	}
 
-#ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
-		dev->sMap[req->logsector] = physsector;
-#else
-		smart_update_cache(dev, req->logsector, physsector);
-#endif
+	/* Build the image of each sector in the RW buffer, which is where the
+	 * CRC is calculated, and collect them in the run buffer.
+	 */
 
-		/* Test if releasing the sector created an empty erase block. */
+	for (i = 0; i < chain->count; i++) {
+		smart_write_alloc_sector(dev, allocsect[i]->logical, allocsect[i]->physical);
+		memcpy(&dev->rwbuffer[hdroffset], &chain->headers[i * chain->hdrsize], chain->hdrsize);
+		memcpy(&dev->rwbuffer[hdroffset + chain->hdrsize], &chain->buffer[i * chain->datasize], chain->datasize);
+		smart_commit_crc(dev);
+		memcpy(&dev->runbuffer[i * dev->sectorsize], dev->rwbuffer, dev->sectorsize);
 
-		smart_erase_block_if_empty(dev, block, FALSE);
+		/* Remove the temporary alloc from the list. */
 
-		/* Since we performed a relocation, do garbage collection to
-		 * ensure we don't fill up our flash with released blocks.
-		 */
-		smart_garbagecollect(dev);
-	} else {				/* needsrelocate */
+		link = &dev->allocsector;
+		while (*link != allocsect[i]) {
+			link = &(*link)->next;
+		}
+
+		*link = allocsect[i]->next;
+		kmm_free(allocsect[i]);
+	}
 
-#ifdef CONFIG_MTD_SMART_ENABLE_CRC
-		/* Write the entire sector to FLASH when CRC enabled. */
 #ifdef CONFIG_MTD_SMART_JOURNALING
-		ret = smart_journal_bwrite(dev, physsector);
+	ret = smart_journal_bwrite_run(dev, physsector, chain->count);
 #else
-		ret = MTD_BWRITE(dev->mtd, physsector * dev->mtdBlksPerSector, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
+	ret = MTD_BWRITE(dev->mtd, physsector * dev->mtdBlksPerSector, chain->count * dev->mtdBlksPerSector, (FAR uint8_t *)dev->runbuffer);
 #endif
-		if (ret != dev->mtdBlksPerSector) {
-			fdbg("Error writing to physical sector %d ret : %d\n", physsector, ret);
-			return -EIO;
-		}
+	if (ret != chain->count * dev->mtdBlksPerSector) {
+		fdbg("Error writing run to physical sector %d ret : %d count : %d\n", physsector, ret, chain->count);
+		return -EIO;
+	}
 
-		/* Read the sector back and validate the CRC. */
+#ifndef CONFIG_MTD_SMART_JOURNALING
+	/* Read the sectors back and validate the CRCs. */
 
-		ret = MTD_BREAD(dev->mtd, physsector * dev->mtdBlksPerSector, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
+	for (i = 0; i < chain->count; i++) {
+		ret = MTD_BREAD(dev->mtd, (physsector + i) * dev->mtdBlksPerSector, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
 		if (ret == dev->mtdBlksPerSector) {
-			/* Validate the CRC of the read-back data. */
-
 			ret = smart_validate_crc(dev);
 		}
 
 		if (ret != OK) {
-			fdbg("Error validating physical sector %d\n", physsector);
-			return -EIO;
-		}
-#else
-		/* Not relocated.  Just write the portion of the sector that needs
-		 * to be written. */
-
-		offset = mtdblock * dev->geo.blocksize + sizeof(struct smart_sect_header_s) + req->offset;
-		ret = smart_bytewrite(dev, offset, req->count, req->buffer);
-		if (ret != req->count) {
-			fdbg("Error committing physical sector %d\n", physsector);
+			fdbg("Error validating physical sector %d\n", physsector + i);
 			return -EIO;
 		}
-#endif
 	}
+#endif
 
 	return OK;
 }
-#endif							/* CONFIG_FS_WRITABLE */
+#endif							/* CONFIG_MTD_SMART_WRITE_BATCH */
 
 /****************************************************************************
  * Name: smart_readsector
@@ -4540,7 +5584,7 @@ static int smart_allocsector(FAR struct smart_struct_s *dev, unsigned long reque
 	 * allocation.  We have to ensure we keep enough reserved sectors
 	 * on hand to do released sector garbage collection. */
 
-	if (dev->freesectors <= (dev->sectorsPerBlk << 0) + 4) {
+	if (dev->freesectors <= SMART_GC_RESERVE(dev)) {
 		/* Do a garbage collect and then test freesectors again. */
 
 		if (dev->releasesectors + dev->freesectors > dev->availSectPerBlk + 4) {
@@ -4726,6 +5770,59 @@ static int smart_allocsector(FAR struct smart_struct_s *dev, unsigned long reque
 }
 #endif							/* CONFIG_FS_WRITABLE */
 
+/****************************************************************************
+ * Name: smart_freealloc
+ *
+ * Description:  Free a logical sector which was allocated but never
+ *               written, like the sectors of a run whose write failed.  It
+ *               is only in the temporary allocsector list and its physical
+ *               sector is still erased, so that sector is free again.
+ *
+ * Returned Value:
+ *   true if the sector was a temporary alloc and is freed.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_FS_WRITABLE) && defined(CONFIG_MTD_SMART_ENABLE_CRC)
+static bool smart_freealloc(FAR struct smart_struct_s *dev, uint16_t logicalsector)
+{
+	FAR struct smart_allocsector_s **link;
+	FAR struct smart_allocsector_s *allocsect;
+	uint16_t physsector;
+
+	link = &dev->allocsector;
+	while (*link != NULL && (*link)->logical != logicalsector) {
+		link = &(*link)->next;
+	}
+
+	if (*link == NULL) {
+		return false;
+	}
+
+	allocsect = *link;
+	*link = allocsect->next;
+	physsector = allocsect->physical;
+	kmm_free(allocsect);
+
+#ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
+	dev->sMap[logicalsector] = (uint16_t)-1;
+#else
+	dev->sBitMap[logicalsector >> 3] &= ~(1 << (logicalsector & 0x07));
+	smart_update_cache(dev, logicalsector, 0xFFFF);
+#endif
+
+#ifdef CONFIG_MTD_SMART_PACK_COUNTS
+	smart_add_count(dev, dev->freecount, physsector / dev->sectorsPerBlk, 1);
+#else
+	dev->freecount[physsector / dev->sectorsPerBlk]++;
+#endif
+	dev->freesectors++;
+
+	fvdbg("freealloc, physicalsector : %d logicalsector : %d\n", physsector, logicalsector);
+	return true;
+}
+#endif
+
 /****************************************************************************
  * Name: smart_freesector
  *
@@ -4761,6 +5858,12 @@ static inline int smart_freesector(FAR struct smart_struct_s *dev, unsigned long
 		}
 	}
 
+#ifdef CONFIG_MTD_SMART_ENABLE_CRC
+	if (smart_freealloc(dev, (uint16_t)logicalsector)) {
+		return OK;
+	}
+#endif
+
 	/* Okay to release the sector.  Read the sector header info. */
 
 #ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
@@ -4828,13 +5931,13 @@ static inline int smart_freesector(FAR struct smart_struct_s *dev, unsigned long
 #endif							/* CONFIG_FS_WRITABLE */
 
 /****************************************************************************
- * Name: smart_ioctl
+ * Name: smart_do_ioctl
  *
- * Description: Return device geometry.
+ * Description: Process one ioctl command.
  *
  ****************************************************************************/
 
-static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
+static int smart_do_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 {
 	FAR struct smart_struct_s *dev;
 	int ret = OK;
@@ -4855,11 +5958,43 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 	dev = (FAR struct smart_struct_s *)inode->i_private;
 #endif
 
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+	/* Every command which may modify the device invalidates the checkpoint
+	 * before touching the flash.
+	 */
+
+	switch (cmd) {
+	case BIOC_LLFORMAT:
+	case BIOC_ALLOCSECT:
+	case BIOC_FREESECT:
+	case BIOC_WRITESECT:
+	case BIOC_BULKERASE:
+	case BIOC_CORRUPTION:
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+	case BIOC_ALLOCCHAIN:
+	case BIOC_WRITECHAIN:
+#endif
+		ret = smart_checkpoint_invalidate(dev);
+		if (ret < 0) {
+			return ret;
+		}
+		break;
+	}
+#endif
+
 	/* Process the ioctl's we care about first, pass any we don't respond
 	 * to directly to the underlying MTD device.
 	 */
 
 	switch (cmd) {
+	case BIOC_FLUSH:
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+		ret = smart_checkpoint_write(dev);
+#else
+		ret = OK;
+#endif
+		goto ok_out;
+
 	case BIOC_XIPBASE:
 		/* The argument accompanying the BIOC_XIPBASE should be non-NULL.  If
 		 * DEBUG is enabled, we will catch it here instead of in the MTD
@@ -4937,6 +6072,22 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 #endif
 
 		goto ok_out;
+
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+	case BIOC_ALLOCCHAIN:
+
+		/* Allocate a run of logical sectors for one write. */
+
+		ret = smart_allocchain(dev, (FAR struct smart_write_chain_s *)arg);
+		goto ok_out;
+
+	case BIOC_WRITECHAIN:
+
+		/* Write the run allocated above. */
+
+		ret = smart_writechain(dev, (FAR struct smart_write_chain_s *)arg);
+		goto ok_out;
+#endif
 #endif							/* CONFIG_FS_WRITABLE */
 
 	case BIOC_BULKERASE:
@@ -5031,6 +6182,19 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 		procfs_data->unusedsectors = dev->unusedsectors;
 		procfs_data->blockerases = dev->blockerases;
 		procfs_data->sectorsperblk = dev->sectorsPerBlk;
+		procfs_data->nscans = dev->nscans;
+		procfs_data->scantime = dev->scantime;
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+		procfs_data->nrestores = dev->nrestores;
+		procfs_data->restoretime = dev->restoretime;
+#endif
+		procfs_data->fggcblocks = dev->fggcblocks;
+		procfs_data->fggcstalls = dev->fggcstalls;
+		procfs_data->fggclaststall = dev->fggclaststall;
+		procfs_data->fggcmaxstall = dev->fggcmaxstall;
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+		procfs_data->bggcblocks = dev->bggcblocks;
+#endif
 
 #ifndef CONFIG_MTD_SMART_MINIMIZE_RAM
 		procfs_data->formatsector = dev->sMap[0];
@@ -5094,6 +6258,38 @@ ok_out:
 	return ret;
 }
 
+/****************************************************************************
+ * Name: smart_ioctl
+ *
+ * Description: Process an ioctl command.  With background garbage
+ *              collection the command is serialized with the worker, which
+ *              is scheduled again when it is done.
+ *
+ ****************************************************************************/
+
+static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
+{
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+	FAR struct smart_struct_s *dev;
+	int ret;
+
+	DEBUGASSERT(inode && inode->i_private);
+	dev = (FAR struct smart_struct_s *)inode->i_private;
+
+	while (sem_wait(&dev->exclsem) != OK) {
+		DEBUGASSERT(get_errno() == EINTR);
+	}
+
+	ret = smart_do_ioctl(inode, cmd, arg);
+	smart_gc_schedule(dev);
+
+	sem_post(&dev->exclsem);
+	return ret;
+#else
+	return smart_do_ioctl(inode, cmd, arg);
+#endif
+}
+
 #ifdef CONFIG_MTD_SMART_JOURNALING
 /****************************************************************************
  * Name: smart_journal_init
@@ -5393,6 +6589,36 @@ static int smart_journal_process_transaction(FAR struct smart_struct_s *dev, jou
 		break;
 	}
 
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+	case SMART_JOURNAL_TYPE_COMMIT_RUN: {
+		int count = log->mtd_header.seq;
+		int x;
+
+		/* Sectors of a run are new, so the whole run with headers is written at once */
+		ret = MTD_BWRITE(dev->mtd, psector * dev->mtdBlksPerSector, count * dev->mtdBlksPerSector, (FAR uint8_t *)dev->runbuffer);
+		if (ret != count * dev->mtdBlksPerSector) {
+			fdbg("write run failed ret : %d\n", ret);
+			return -EIO;
+		}
+
+		/* Validate each sector of the run */
+		for (x = 0; x < count; x++) {
+			ret = MTD_BREAD(dev->mtd, (psector + x) * dev->mtdBlksPerSector, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
+			if (ret != dev->mtdBlksPerSector) {
+				fdbg("Check Error validating physical sector %d\n", psector + x);
+				return -EIO;
+			}
+
+			ret = smart_validate_crc(dev);
+			if (ret != OK) {
+				fdbg("crc error : psector : %d\n", psector + x);
+				return -EIO;
+			}
+		}
+		break;
+	}
+#endif
+
 	/* For erase, mtd driver will verify erase block is cleaned or Not */			
 	case SMART_JOURNAL_TYPE_ERASE: {
 		/* Instead of copy header from journal, Erase block(psector) */
@@ -5486,6 +6712,69 @@ errout_with_journal:
 	return result;
 }
 
+/****************************************************************************
+ * Name: smart_journal_bwrite_run
+ *
+ * Description:
+ *   Block Write function for a run of new sectors in the run buffer.  One
+ *   journal entry covers the whole run, returns size of written pages.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+static int smart_journal_bwrite_run(FAR struct smart_struct_s *dev, uint16_t physsector, uint16_t count)
+{
+	int ret = OK;
+	int result = OK;
+	journal_log_t log;
+	uint32_t address = 0;
+	uint16_t x;
+
+	/* Initialize Journal log with the header of the first sector and the length of the run */
+	memcpy(&log.mtd_header, dev->runbuffer, sizeof(FAR struct smart_sect_header_s));
+	log.mtd_header.seq = (uint8_t)count;
+
+	address = smart_journal_get_writeaddress(dev);
+
+	ret = smart_journal_checkin(dev, &log, address, physsector, SMART_JOURNAL_TYPE_COMMIT_RUN);
+	if (ret != OK) {
+		result = ret;
+		goto errout_with_journal;
+	}
+
+	/* If block write transaction failed, release the whole run to undo it */
+	ret = smart_journal_process_transaction(dev, &log);
+	if (ret != OK) {
+		result = ret;
+		for (x = 0; x < count; x++) {
+			ret = smart_journal_release_sector(dev, physsector + x);
+			if (ret != OK) {
+				fdbg("release committed sector : %d failed\n", physsector + x);
+				return ret;
+			}
+		}
+	}
+
+errout_with_journal:
+
+	ret = smart_journal_checkout(dev, &log, address);
+	if (ret != OK) {
+		return ret;
+	}
+
+	ret = smart_journal_move_to_next(dev);
+	if (ret != OK) {
+		return ret;
+	}
+
+	if (result == OK) {
+		return count * dev->mtdBlksPerSector;
+	}
+
+	return result;
+}
+#endif
+
 /****************************************************************************
  * Name: smart_journal_bytewrite
  *
@@ -5722,6 +7011,12 @@ static int smart_journal_scan(FAR struct smart_struct_s *dev, bool print_dump)
 				if (!print_dump) {
 					smart_journal_print_log(dev, &log);
 				}
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+				ret = smart_checkpoint_invalidate(dev);
+				if (ret < 0) {
+					return ret;
+				}
+#endif
 				ret = smart_journal_recovery(dev, &log);
 				/* -EINVAL means journal log is not written properly, we skip it. */
 				if ((ret != OK) && (ret != -EINVAL)) {
@@ -5803,7 +7098,7 @@ static int smart_journal_recovery(FAR struct smart_struct_s *dev, journal_log_t
 
 	/* Validate the type of the journal entry */
 	type = GET_JOURNAL_TYPE(log->status);
-	if ((type == 0) || (type > SMART_JOURNAL_TYPE_ERASE)) {
+	if ((type == 0) || (type > SMART_JOURNAL_TYPE_COMMIT_RUN)) {
 		fdbg("invalid type : %d\n", type);
 		goto error_with_checkin;
 
@@ -5905,6 +7200,35 @@ static int smart_journal_recovery(FAR struct smart_struct_s *dev, journal_log_t
 		}
 		break;
 
+	/* Sectors of a run are new, keep the ones which were written completely
+	 * and release the rest, like a single sector whose data is invalid.
+	 */
+	case SMART_JOURNAL_TYPE_COMMIT_RUN: {
+		uint16_t x;
+
+		if (log->mtd_header.seq == 0 || psector + log->mtd_header.seq > dev->geo.neraseblocks * dev->sectorsPerBlk) {
+			fdbg("invalid run psector : %d count : %d\n", psector, log->mtd_header.seq);
+			goto error_with_checkin;
+		}
+
+		for (x = 0; x < log->mtd_header.seq; x++) {
+			ret = MTD_BREAD(dev->mtd, (psector + x) * dev->mtdBlksPerSector, dev->mtdBlksPerSector, (FAR uint8_t *)dev->rwbuffer);
+			if (ret != dev->mtdBlksPerSector) {
+				fdbg("Read from data sector error : %d\n", ret);
+				return -EIO;
+			}
+
+			if (smart_validate_crc(dev) != OK) {
+				fdbg("Invalid data in run, release sector %d\n", psector + x);
+				ret = smart_journal_release_sector(dev, psector + x);
+				if (ret != OK) {
+					return ret;
+				}
+			}
+		}
+		break;
+	}
+
 	/* For Release & Erase, Retry Transaction & Checkout to undo it */
 	case SMART_JOURNAL_TYPE_RELEASE:
 		ret = smart_journal_process_transaction(dev, log);
@@ -6044,6 +7368,9 @@ int smart_initialize(int minor, FAR struct mtd_dev_s *mtd, FAR const char *partn
 #endif
 		dev->rwbuffer = NULL;
 		dev->bytebuffer = NULL;
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+		dev->runbuffer = NULL;
+#endif
 #ifdef CONFIG_MTD_SMART_SECTOR_ERASE_DEBUG
 		dev->erasecounts = NULL;
 #endif
@@ -6058,6 +7385,13 @@ int smart_initialize(int minor, FAR struct mtd_dev_s *mtd, FAR const char *partn
 		dev->journal_seq = 0;
 #endif
 
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+		sem_init(&dev->exclsem, 0, 1);
+		memset(&dev->gcwork, 0, sizeof(struct work_s));
+		dev->lastio = 0;
+		dev->crefs = 0;
+#endif
+
 		dev->sectorsize = 0;
 		ret = smart_setsectorsize(dev, CONFIG_MTD_SMART_SECTOR_SIZE);
 		if (ret == -ENOMEM) {
@@ -6096,8 +7430,32 @@ int smart_initialize(int minor, FAR struct mtd_dev_s *mtd, FAR const char *partn
 #ifdef CONFIG_SMARTFS_MULTI_ROOT_DIRS
 		dev->minor = minor;
 #endif
-		/* Do a scan of the device. */
-		smart_scan(dev);
+#if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
+		dev->nscans = 0;
+		dev->scantime = 0;
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+		dev->nrestores = 0;
+		dev->restoretime = 0;
+#endif
+		dev->fggcblocks = 0;
+		dev->fggcstalls = 0;
+		dev->fggclaststall = 0;
+		dev->fggcmaxstall = 0;
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+		dev->bggcblocks = 0;
+#endif
+#endif
+
+		/* Restore the sector map from the checkpoint if the device was
+		 * closed cleanly, otherwise do a scan of the device.
+		 */
+
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+		if (smart_checkpoint_restore(dev) != OK)
+#endif
+		{
+			smart_scan(dev);
+		}
 
 		/* Create a MTD block device name. */
 
@@ -6170,6 +7528,11 @@ errout:
 	if (dev->bytebuffer != NULL) {
 		smart_free(dev, dev->bytebuffer);
 	}
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+	if (dev->runbuffer != NULL) {
+		smart_free(dev, dev->runbuffer);
+	}
+#endif
 
 #ifdef CONFIG_MTD_SMART_WEAR_LEVEL
 	if (dev->wearstatus != NULL) {
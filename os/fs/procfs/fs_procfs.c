@@ -96,9 +96,18 @@ extern const struct procfs_operations proc_operations;
 extern const struct procfs_operations cpuload_operations;
 extern const struct procfs_operations uptime_operations;
 extern const struct procfs_operations version_operations;
+#if defined(CONFIG_MM_SMALL_CACHE)
+extern const struct procfs_operations mmcache_operations;
+#endif
 #if defined(CONFIG_LOG_DUMP)
 extern const struct procfs_operations logsave_operations;
 #endif
+#if defined(CONFIG_SCHED_INSTRUMENTATION_BUFFER)
+extern const struct procfs_operations note_operations;
+#endif
+#if defined(CONFIG_SCHED_CPU_RUNQUEUE)
+extern const struct procfs_operations runqueue_operations;
+#endif
 
 /* This is not good.  These are implemented in drivers/mtd.  Having to
  * deal with them here is not a good coupling.
@@ -136,6 +145,14 @@ static const struct procfs_entry_s g_procfsentries[] = {
 	{"logsave", &logsave_operations},
 #endif
 
+#if defined(CONFIG_SCHED_INSTRUMENTATION_BUFFER) && !defined(CONFIG_FS_PROCFS_EXCLUDE_NOTE)
+	{"note", &note_operations},
+#endif
+
+#if defined(CONFIG_SCHED_CPU_RUNQUEUE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_RUNQUEUE)
+	{"runqueue", &runqueue_operations},
+#endif
+
 #if defined(CONFIG_FS_SMARTFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
 	{"fs/smartfs**", &smartfs_procfsoperations},
 #endif
@@ -144,6 +161,10 @@ static const struct procfs_entry_s g_procfsentries[] = {
 	{"irqs", &irqs_operations},
 #endif
 
+#if defined(CONFIG_MM_SMALL_CACHE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_MMCACHE)
+	{"mmcache", &mmcache_operations},
+#endif
+
 #if defined(CONFIG_MTD) && !defined(CONFIG_FS_PROCFS_EXCLUDE_MTD)
 	{"mtd", &mtd_procfsoperations},
 #endif
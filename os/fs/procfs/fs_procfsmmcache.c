@@ -0,0 +1,291 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/statfs.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/mm/mm.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_MM_SMALL_CACHE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_MMCACHE)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* Determines the size of an intermediate buffer that must be large enough
+ * to handle the header and one line per CPU.
+ */
+
+#define MMCACHE_LINELEN 80
+#define MMCACHE_BUFLEN  (MMCACHE_LINELEN * (CONFIG_SMP_NCPUS + 1))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes one open "file" */
+
+struct mmcache_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	unsigned int linesize;		/* Number of valid characters in line[] */
+	char line[MMCACHE_BUFLEN];	/* Pre-allocated buffer for formatted lines */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int mmcache_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int mmcache_close(FAR struct file *filep);
+static ssize_t mmcache_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+
+static int mmcache_dup(FAR const struct file *oldp, FAR struct file *newp);
+
+static int mmcache_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+const struct procfs_operations mmcache_operations = {
+	mmcache_open,				/* open */
+	mmcache_close,				/* close */
+	mmcache_read,				/* read */
+	NULL,						/* write */
+
+	mmcache_dup,				/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	mmcache_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mmcache_open
+ ****************************************************************************/
+
+static int mmcache_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct mmcache_file_s *attr;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* PROCFS is read-only.  Any attempt to open with any kind of write
+	 * access is not permitted.
+	 */
+
+	if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0) {
+		fdbg("ERROR: Only O_RDONLY supported\n");
+		return -EACCES;
+	}
+
+	/* "mmcache" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "mmcache") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* Allocate a container to hold the file attributes */
+
+	attr = (FAR struct mmcache_file_s *)kmm_zalloc(sizeof(struct mmcache_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* Save the attributes as the open-specific state in filep->f_priv */
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: mmcache_close
+ ****************************************************************************/
+
+static int mmcache_close(FAR struct file *filep)
+{
+	FAR struct mmcache_file_s *attr;
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct mmcache_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Release the file attributes structure */
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: mmcache_read
+ ****************************************************************************/
+
+static ssize_t mmcache_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct mmcache_file_s *attr;
+	struct mm_cache_stat_s stat;
+	unsigned int percent;
+	size_t linesize;
+	off_t offset;
+	ssize_t ret;
+	int cpu;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct mmcache_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Take a snapshot of the statistics on the first read only, so that
+	 * the content stays stable while the user reads it in pieces.
+	 */
+
+	if (filep->f_pos == 0) {
+		linesize = snprintf(attr->line, MMCACHE_LINELEN, "%3s %10s %10s %4s %8s %8s %8s %6s\n",
+							"CPU", "HITS", "MISSES", "HIT%", "REFILLS", "DRAINS", "FLUSHES", "CACHED");
+
+		for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+			umm_cache_getstat(cpu, &stat);
+			if (stat.hits + stat.misses > 0) {
+				percent = (unsigned int)((uint64_t)stat.hits * 100 / (stat.hits + stat.misses));
+			} else {
+				percent = 0;
+			}
+
+			linesize += snprintf(&attr->line[linesize], MMCACHE_BUFLEN - linesize, "%3d %10u %10u %3u%% %8u %8u %8u %6u\n",
+								 cpu, stat.hits, stat.misses, percent, stat.refills, stat.drains, stat.flushes, stat.cached);
+		}
+
+		/* Save the linesize in case we are re-entered with f_pos > 0 */
+
+		attr->linesize = linesize;
+	}
+
+	/* Transfer the statistics to user receive buffer */
+
+	offset = filep->f_pos;
+	ret = procfs_memcpy(attr->line, attr->linesize, buffer, buflen, &offset);
+
+	/* Update the file offset */
+
+	if (ret > 0) {
+		filep->f_pos += ret;
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: mmcache_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int mmcache_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct mmcache_file_s *oldattr;
+	FAR struct mmcache_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	/* Recover our private data from the old struct file instance */
+
+	oldattr = (FAR struct mmcache_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	/* Allocate a new container to hold the task and attribute selection */
+
+	newattr = (FAR struct mmcache_file_s *)kmm_malloc(sizeof(struct mmcache_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* The copy the file attributes from the old attributes to the new */
+
+	memcpy(newattr, oldattr, sizeof(struct mmcache_file_s));
+
+	/* Save the new attributes in the new file structure */
+
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: mmcache_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int mmcache_stat(const char *relpath, struct stat *buf)
+{
+	/* "mmcache" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "mmcache") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* "mmcache" is the name for a read-only file */
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+#endif							/* CONFIG_MM_SMALL_CACHE && !CONFIG_FS_PROCFS_EXCLUDE_MMCACHE */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
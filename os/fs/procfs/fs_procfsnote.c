@@ -0,0 +1,395 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/statfs.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+#include <tinyara/sched_note.h>
+#include <tinyara/note.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_SCHED_INSTRUMENTATION_BUFFER) && !defined(CONFIG_FS_PROCFS_EXCLUDE_NOTE)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* Determines the size of an intermediate buffer that must be large enough
+ * to handle the mode line and one line per CPU.
+ */
+
+#define NOTE_LINELEN    64
+#define NOTE_BUFLEN     (NOTE_LINELEN * (CONFIG_SMP_NCPUS + 1))
+
+/* Longest command accepted by a write */
+
+#define NOTE_CMDLEN     32
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes one open "file" */
+
+struct note_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	unsigned int linesize;		/* Number of valid characters in line[] */
+	char line[NOTE_BUFLEN];		/* Pre-allocated buffer for formatted lines */
+};
+
+/* Name of a kind of notes in the commands and in the mode line */
+
+struct note_flag_s {
+	FAR const char *name;
+	unsigned int flag;
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int note_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int note_close(FAR struct file *filep);
+static ssize_t note_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static ssize_t note_write(FAR struct file *filep, FAR const char *buffer, size_t buflen);
+
+static int note_dup(FAR const struct file *oldp, FAR struct file *newp);
+
+static int note_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Private Variables
+ ****************************************************************************/
+
+static const struct note_flag_s g_note_flags[] = {
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SWITCH
+	{"switch", NOTE_FILTER_MODE_FLAG_SWITCH},
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_IRQHANDLER
+	{"irq", NOTE_FILTER_MODE_FLAG_IRQ},
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SYSCALL
+	{"syscall", NOTE_FILTER_MODE_FLAG_SYSCALL},
+	{"args", NOTE_FILTER_MODE_FLAG_SYSCALL_ARGS},
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+	{"sem", NOTE_FILTER_MODE_FLAG_SEMAPHORE},
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_DUMP
+	{"dump", NOTE_FILTER_MODE_FLAG_DUMP},
+#endif
+};
+
+#define NOTE_NFLAGS (sizeof(g_note_flags) / sizeof(g_note_flags[0]))
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+const struct procfs_operations note_operations = {
+	note_open,					/* open */
+	note_close,					/* close */
+	note_read,					/* read */
+	note_write,					/* write */
+
+	note_dup,					/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	note_stat					/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: note_open
+ ****************************************************************************/
+
+static int note_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct note_file_s *attr;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* "note" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "note") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* Allocate a container to hold the file attributes */
+
+	attr = (FAR struct note_file_s *)kmm_zalloc(sizeof(struct note_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* Save the attributes as the open-specific state in filep->f_priv */
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: note_close
+ ****************************************************************************/
+
+static int note_close(FAR struct file *filep)
+{
+	FAR struct note_file_s *attr;
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct note_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Release the file attributes structure */
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: note_read
+ *
+ * Description:
+ *   Show the mode and the usage of the note buffer of each CPU, like
+ *
+ *     mode: on switch irq sem
+ *     cpu0: 1024/4096 bytes, 0 dropped
+ *
+ ****************************************************************************/
+
+static ssize_t note_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct note_file_s *attr;
+	struct note_status_s status;
+	size_t linesize;
+	off_t offset;
+	ssize_t ret;
+	int i;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct note_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Take a snapshot of the status on the first read only, so that the
+	 * content stays stable while the user reads it in pieces.
+	 */
+
+	if (filep->f_pos == 0) {
+		sched_note_getstatus(&status);
+
+		linesize = snprintf(attr->line, NOTE_LINELEN, "mode: %s", (status.mode & NOTE_FILTER_MODE_FLAG_ENABLE) ? "on" : "off");
+		for (i = 0; i < NOTE_NFLAGS; i++) {
+			if ((status.mode & g_note_flags[i].flag) != 0) {
+				linesize += snprintf(&attr->line[linesize], NOTE_LINELEN - linesize, " %s", g_note_flags[i].name);
+			}
+		}
+		attr->line[linesize++] = '\n';
+
+		for (i = 0; i < CONFIG_SMP_NCPUS; i++) {
+			linesize += snprintf(&attr->line[linesize], NOTE_BUFLEN - linesize, "cpu%d: %u/%u bytes, %u dropped\n",
+								 i, status.used[i], status.bufsize, status.dropped[i]);
+		}
+
+		/* Save the linesize in case we are re-entered with f_pos > 0 */
+
+		attr->linesize = linesize;
+	}
+
+	/* Transfer the status to user receive buffer */
+
+	offset = filep->f_pos;
+	ret = procfs_memcpy(attr->line, attr->linesize, buffer, buflen, &offset);
+
+	/* Update the file offset */
+
+	if (ret > 0) {
+		filep->f_pos += ret;
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: note_write
+ *
+ * Description:
+ *   Take space separated commands:
+ *
+ *     on, off    - Start or stop recording
+ *     clear      - Discard the recorded notes
+ *     +kind      - Record the notes of a kind, one of the names shown in the
+ *                  mode line
+ *     -kind      - Do not record the notes of a kind
+ *
+ ****************************************************************************/
+
+static ssize_t note_write(FAR struct file *filep, FAR const char *buffer, size_t buflen)
+{
+	char cmd[NOTE_CMDLEN];
+	FAR char *word;
+	FAR char *saveptr;
+	unsigned int mode;
+	bool clear = false;
+	int i;
+
+	if (buflen >= NOTE_CMDLEN) {
+		return -EINVAL;
+	}
+
+	memcpy(cmd, buffer, buflen);
+	cmd[buflen] = '\0';
+
+	mode = sched_note_getmode();
+	for (word = strtok_r(cmd, " \t\r\n", &saveptr); word != NULL; word = strtok_r(NULL, " \t\r\n", &saveptr)) {
+		if (strcmp(word, "on") == 0) {
+			mode |= NOTE_FILTER_MODE_FLAG_ENABLE;
+		} else if (strcmp(word, "off") == 0) {
+			mode &= ~NOTE_FILTER_MODE_FLAG_ENABLE;
+		} else if (strcmp(word, "clear") == 0) {
+			clear = true;
+		} else if (word[0] == '+' || word[0] == '-') {
+			for (i = 0; i < NOTE_NFLAGS; i++) {
+				if (strcmp(&word[1], g_note_flags[i].name) == 0) {
+					break;
+				}
+			}
+
+			if (i == NOTE_NFLAGS) {
+				fdbg("ERROR: unknown kind '%s'\n", &word[1]);
+				return -EINVAL;
+			}
+
+			if (word[0] == '+') {
+				mode |= g_note_flags[i].flag;
+			} else {
+				mode &= ~g_note_flags[i].flag;
+			}
+		} else {
+			fdbg("ERROR: unknown command '%s'\n", word);
+			return -EINVAL;
+		}
+	}
+
+	if (clear) {
+		sched_note_clear();
+	}
+
+	sched_note_setmode(mode);
+	return buflen;
+}
+
+/****************************************************************************
+ * Name: note_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int note_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct note_file_s *oldattr;
+	FAR struct note_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	/* Recover our private data from the old struct file instance */
+
+	oldattr = (FAR struct note_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	/* Allocate a new container to hold the task and attribute selection */
+
+	newattr = (FAR struct note_file_s *)kmm_malloc(sizeof(struct note_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* The copy the file attributes from the old attributes to the new */
+
+	memcpy(newattr, oldattr, sizeof(struct note_file_s));
+
+	/* Save the new attributes in the new file structure */
+
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: note_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int note_stat(const char *relpath, struct stat *buf)
+{
+	/* "note" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "note") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* "note" is the name for a read-write file */
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR | S_IWUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+#endif							/* CONFIG_SCHED_INSTRUMENTATION_BUFFER && !CONFIG_FS_PROCFS_EXCLUDE_NOTE */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
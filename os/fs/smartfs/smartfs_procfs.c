@@ -761,6 +761,14 @@ static size_t smartfs_status_read(FAR struct file *filep, FAR char *buffer, size
 		if (ret == OK) {
 			/* Format and return data in the buffer */
 			len = snprintf(buffer, buflen, "Total Sectors    %d\nFree Sectors     %d\n" "Released Sectors %d\n", procfs_data.totalsectors, procfs_data.freesectors, procfs_data.releasesectors);
+			len += snprintf(&buffer[len], buflen - len, "Mount Scans      %d (last %d ms)\n", procfs_data.nscans, procfs_data.scantime);
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+			len += snprintf(&buffer[len], buflen - len, "Mount Restores   %d (last %d ms)\n", procfs_data.nrestores, procfs_data.restoretime);
+#endif
+			len += snprintf(&buffer[len], buflen - len, "GC Blocks        %d\nGC Stalls        %d (last %d ms, max %d ms)\n", procfs_data.fggcblocks, procfs_data.fggcstalls, procfs_data.fggclaststall, procfs_data.fggcmaxstall);
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+			len += snprintf(&buffer[len], buflen - len, "GC Background    %d\n", procfs_data.bggcblocks);
+#endif
 #ifdef CONFIG_DEBUG_FS
 			/* Calculate the sector utilization percentage */
 			if (procfs_data.blockerases == 0) {
@@ -864,6 +864,13 @@ static int smartfs_sync(FAR struct file *filep)
 	smartfs_semtake(fs);
 
 	ret = smartfs_sync_internal(fs, sf);
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT_SYNC
+	if (ret == OK) {
+		/* Save the sector map too, so that the next mount needs no scan */
+
+		ret = FS_IOCTL(fs, BIOC_FLUSH, 0);
+	}
+#endif
 
 	smartfs_semgive(fs);
 	return ret;
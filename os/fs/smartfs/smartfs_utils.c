@@ -2118,6 +2118,90 @@ error_with_buf:
 	return ret;
 }
 
+/****************************************************************************
+ * Name: smartfs_append_chain
+ *
+ * Description:
+ *   Write full sectors of the data to append as one run of new sectors,
+ *   chained in front of 'follower', the sector which is allocated next for
+ *   the file.  At least one byte is left for the follower, so the file still
+ *   continues in sf->buffer.  On success, 'first' is set to the first sector
+ *   of the run, which the current sector has to be chained to.
+ *
+ * Returned Value:
+ *   The number of bytes written in the run, 0 if there is no run to write
+ *   or no contiguous free sectors for it, or a negated errno.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_SMARTFS_USE_SECTOR_BUFFER) && defined(CONFIG_MTD_SMART_WRITE_BATCH)
+static ssize_t smartfs_append_chain(FAR struct smartfs_mountpt_s *fs, const char *buffer, size_t buflen, uint16_t follower, uint16_t *first)
+{
+	struct smart_write_chain_s chain;
+	struct smartfs_chain_header_s headers[CONFIG_MTD_SMART_WRITE_BATCH_SECTORS];
+	uint16_t logsectors[CONFIG_MTD_SMART_WRITE_BATCH_SECTORS];
+	uint16_t datasize;
+	uint16_t next;
+	size_t nsectors;
+	int ret;
+	int i;
+
+	datasize = SMARTFS_AVAIL_DATABYTES(fs);
+	nsectors = (buflen - 1) / datasize;
+	if (nsectors < 2) {
+		return 0;
+	}
+
+	if (nsectors > CONFIG_MTD_SMART_WRITE_BATCH_SECTORS) {
+		nsectors = CONFIG_MTD_SMART_WRITE_BATCH_SECTORS;
+	}
+
+	chain.count = nsectors;
+	chain.hdrsize = sizeof(struct smartfs_chain_header_s);
+	chain.datasize = datasize;
+	chain.logsectors = logsectors;
+	chain.headers = (const uint8_t *)headers;
+	chain.buffer = (const uint8_t *)buffer;
+
+	ret = FS_IOCTL(fs, BIOC_ALLOCCHAIN, (unsigned long)&chain);
+	if (ret < 0) {
+		/* Write the sectors one by one instead */
+
+		fvdbg("No run of %d sectors, ret : %d\n", nsectors, ret);
+		return 0;
+	}
+
+	/* Every sector of the run is full and chained to the next one */
+
+	for (i = 0; i < nsectors; i++) {
+		next = (i + 1 < nsectors) ? logsectors[i + 1] : follower;
+		headers[i].type = SMARTFS_SECTOR_TYPE_FILE;
+		headers[i].nextsector[0] = (uint8_t)(next & 0x00FF);
+		headers[i].nextsector[1] = (uint8_t)(next >> 8);
+		headers[i].used[0] = (uint8_t)(datasize & 0x00FF);
+		headers[i].used[1] = (uint8_t)(datasize >> 8);
+	}
+
+	ret = FS_IOCTL(fs, BIOC_WRITECHAIN, (unsigned long)&chain);
+	if (ret < 0) {
+		fdbg("Error writing run from sector %d, ret : %d\n", logsectors[0], ret);
+
+		/* The run is not chained to the file yet, release all its sectors */
+
+		for (i = 0; i < nsectors; i++) {
+			if (FS_IOCTL(fs, BIOC_FREESECT, (unsigned long)logsectors[i]) < 0) {
+				fdbg("Error freeing sector %d of the run\n", logsectors[i]);
+			}
+		}
+
+		return ret;
+	}
+
+	*first = logsectors[0];
+	return nsectors * datasize;
+}
+#endif
+
 /****************************************************************************
  * Name: smartfs_append_data
  *
@@ -2131,6 +2215,11 @@ ssize_t smartfs_append_data(FAR struct smartfs_mountpt_s *fs, FAR struct smartfs
 	int ret;
 	struct smart_read_write_s readwrite;
 	struct smartfs_chain_header_s *chainheader;
+#ifdef CONFIG_SMARTFS_USE_SECTOR_BUFFER
+	uint16_t nextsector;
+	uint16_t chainsector;
+	ssize_t runbytes;
+#endif
 
 	while (buflen > 0) {
 		/* We will fill up the current sector. Write data to
@@ -2183,9 +2272,23 @@ ssize_t smartfs_append_data(FAR struct smartfs_mountpt_s *fs, FAR struct smartfs
 				return ret;
 			}
 
+			nextsector = (uint16_t)ret;
+			chainsector = nextsector;
+			runbytes = 0;
+
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+			/* Write the full sectors of the remaining data at once, between
+			 * this sector and the new one.
+			 */
+			runbytes = smartfs_append_chain(fs, &buffer[byteswritten], buflen, nextsector, &chainsector);
+			if (runbytes < 0) {
+				return runbytes;
+			}
+#endif
+
 			/* Copy the new sector to the old one and chain it */
 			chainheader = (struct smartfs_chain_header_s *)sf->buffer;
-			*((uint16_t *)chainheader->nextsector) = (uint16_t)ret;
+			*((uint16_t *)chainheader->nextsector) = chainsector;
 
 			/* Now sync the file to write this sector out */
 			ret = smartfs_sync_internal(fs, sf);
@@ -2196,16 +2299,22 @@ ssize_t smartfs_append_data(FAR struct smartfs_mountpt_s *fs, FAR struct smartfs
 			/* Record the new sector in our tracking variables and
 			 * reset the offset to "zero".
 			 */
-			if (sf->currsector == SMARTFS_NEXTSECTOR(chainheader)) {
+			if (sf->currsector == nextsector) {
 				/* Error allocating logical sector! */
 				fdbg("Error - duplicate logical sector %d\n", sf->currsector);
 			}
 
 			sf->bflags = SMARTFS_BFLAG_DIRTY;
-			sf->currsector = SMARTFS_NEXTSECTOR(chainheader);
+			sf->currsector = nextsector;
 			sf->curroffset = sizeof(struct smartfs_chain_header_s);
 			memset(sf->buffer, CONFIG_SMARTFS_ERASEDSTATE, fs->fs_llformat.availbytes);
 			chainheader->type = SMARTFS_SECTOR_TYPE_FILE;
+
+			/* Account for the data written in the run */
+			sf->entry.datalen += runbytes;
+			sf->filepos += runbytes;
+			buflen -= runbytes;
+			byteswritten += runbytes;
 		}
 #else                                                   /* CONFIG_SMARTFS_USE_SECTOR_BUFFER */
 		if (sf->curroffset == fs->fs_llformat.availbytes) {
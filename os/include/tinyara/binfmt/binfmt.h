@@ -93,6 +93,18 @@ enum {
 typedef FAR void (*binfmt_ctor_t)(void);
 typedef FAR void (*binfmt_dtor_t)(void);
 
+#ifdef CONFIG_BINMGR_LOAD_TIME
+/* The time spent in each step of loading a binary, in microseconds */
+
+struct binfmt_loadtime_s {
+	uint32_t init_us;			/* Read and verify the headers */
+	uint32_t load_us;			/* Allocate and read the sections */
+	uint32_t bind_us;			/* Relocate the sections */
+	uint32_t nrelocs;			/* Number of relocations */
+	uint32_t nlookups;			/* Number of undefined symbols looked up */
+};
+#endif
+
 /* This describes the file to be loaded.
  *
  * NOTE 1: The 'filename' must be the full, absolute path to the file to be
@@ -170,6 +182,9 @@ struct binary_s {
 #ifdef CONFIG_BINARY_MANAGER
 	uint8_t binary_idx;             /* Index of binary in binary table */
 	uint32_t bin_ver;               /* version of binary */
+#ifdef CONFIG_BINMGR_LOAD_TIME
+	struct binfmt_loadtime_s loadtime; /* Time of the last load, 0 for a reload */
+#endif
 #ifdef CONFIG_OPTIMIZE_APP_RELOAD_TIME
 	char bin_name[BIN_NAME_MAX];    /* Name of binary */
 #else
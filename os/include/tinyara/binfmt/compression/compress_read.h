@@ -34,8 +34,8 @@
 
 /* Struct for buffers to be used for read/decompression */
 struct s_buffer {
-	unsigned char *read_buffer;
-	unsigned char *out_buffer;
+	unsigned char *read_buffer;		/* Compressed blocks read from the file */
+	unsigned char *out_buffer;		/* Cache of decompressed blocks */
 };
 
 /****************************************************************************
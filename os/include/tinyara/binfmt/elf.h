@@ -126,10 +126,20 @@ struct elf_loadinfo_s {
 	uintptr_t symtab;			/* Copy of symbol table */
 	uintptr_t reltab;			/* Copy of relocation table */
 	uintptr_t strtab;			/* Copy of string table */
+	size_t rellen;				/* Size of reltab[], the largest relocation section */
 	uint16_t symtabidx;			/* Symbol table section index */
 	uint16_t strtabidx;			/* String table section index */
 	uint16_t buflen;			/* size of iobuffer[] */
 
+#ifndef CONFIG_SUPPORT_COMMON_BINARY
+	FAR uint16_t *exporthash;		/* Hash buckets, then chains, of the exported symbols */
+	uint16_t nbuckets;			/* Number of hash buckets, a power of two */
+#endif
+#ifdef CONFIG_BINMGR_LOAD_TIME
+	uint32_t nrelocs;			/* Number of relocations performed */
+	uint32_t nlookups;			/* Number of undefined symbols looked up in the exports */
+#endif
+
 	struct binary_s *binp;			/* Back pointer to binary object */
 };
 
@@ -952,6 +952,21 @@ off_t file_seek(FAR struct file *filep, off_t offset, int whence);
 int file_fsync(FAR struct file *filep);
 #endif
 
+/* fs/fs_truncate.c *********************************************************/
+/****************************************************************************
+ * Name: file_truncate
+ *
+ * Description:
+ *   Equivalent to the standard ftruncate() function except that is accepts
+ *   a struct file instance instead of a file descriptor and it does not set
+ *   the errno variable.
+ *
+ ****************************************************************************/
+
+#if CONFIG_NFILE_DESCRIPTORS > 0 && !defined(CONFIG_DISABLE_MOUNTPOINT)
+int file_truncate(FAR struct file *filep, off_t length);
+#endif
+
 /****************************************************************************
  * Name: file_ioctl
  *
@@ -108,6 +108,7 @@
 #define _MIPIDSIBASE    (0x3900) 	/* Mipidsi device ioctl commands */
 #define _CSIIOCBASE     (0x3a00) 	/* Wifi CSI ioctl commands */
 #define _SILENTRBCBASE  (0x3b00) 	/* Silent reboot ioctl commands */
+#define _NOTEIOCBASE    (0x3c00) 	/* Scheduler note driver ioctl commands */
 
 
 /* boardctl() commands share the same number space */
@@ -261,6 +262,24 @@
 										 *		to reveal physical sector.
 										 * OUT: Physical sector number align with
 										 *		logical sector number */
+#define BIOC_FLUSH      _BIOC(0x000E)	/* Write any state the block driver
+										 * keeps in RAM back to the media.
+										 * IN:	None
+										 * OUT: None (ioctl return value provides
+										 *		success/failure indication). */
+#define BIOC_ALLOCCHAIN _BIOC(0x000F)	/* Allocate a run of logical sectors backed
+										 * by contiguous physical sectors.
+										 * IN:	Pointer to the chain write data
+										 *		with the number of sectors.
+										 * OUT: Logical sector numbers allocated,
+										 *		in the chain write data. */
+#define BIOC_WRITECHAIN _BIOC(0x0010)	/* Write a run of sectors allocated with
+										 * BIOC_ALLOCCHAIN at once.
+										 * IN:	Pointer to the chain write data
+										 *		(the logical sectors, the header
+										 *		and data buffer addresses)
+										 * OUT: None (ioctl return value provides
+										 *		success/failure indication). */
 #define BIOC_DEBUGCMD   _BIOC(0x00FF)	/* Send driver specific debug command /
 										 * data to the block device.
 										 * IN:  Pointer to a struct defined for
@@ -508,6 +527,17 @@
 #define CPULOADIOC_STOP               _CPULOADIOC(0x0002)
 #define CPULOADIOC_GETVALUE           _CPULOADIOC(0x0003)
 
+/* Scheduler note driver ioctl definitions ************************/
+/* (see tinyara/note.h) */
+
+#define _NOTEIOCVALID(c)      (_IOC_TYPE(c) == _NOTEIOCBASE)
+#define _NOTEIOC(nr)          _IOC(_NOTEIOCBASE, nr)
+
+#define NOTEIOC_CLEAR                 _NOTEIOC(0x0001)
+#define NOTEIOC_GETMODE               _NOTEIOC(0x0002)
+#define NOTEIOC_SETMODE               _NOTEIOC(0x0003)
+#define NOTEIOC_GETSTATUS             _NOTEIOC(0x0004)
+
 /* Audio driver ioctl definitions *************************************/
 /* (see tinyara/audio/audio.h) */
 
@@ -102,6 +102,23 @@ struct smart_read_write_s {
 	const uint8_t *buffer;		/* Pointer to the data to write */
 };
 
+/* The following defines the information for allocating and writing a run
+ * of new logical sectors with BIOC_ALLOCCHAIN and BIOC_WRITECHAIN.  Sector
+ * 'n' of the run gets 'hdrsize' bytes from headers[n * hdrsize] followed by
+ * 'datasize' bytes from buffer[n * datasize].
+ */
+
+#ifdef CONFIG_MTD_SMART_WRITE_BATCH
+struct smart_write_chain_s {
+	uint16_t count;				/* Number of sectors in the run */
+	uint16_t hdrsize;			/* Number of header bytes per sector */
+	uint16_t datasize;			/* Number of data bytes per sector */
+	uint16_t *logsectors;		/* Logical sector numbers of the run */
+	const uint8_t *headers;		/* Pointer to the headers to write */
+	const uint8_t *buffer;		/* Pointer to the data to write */
+};
+#endif
+
 /* The following defines the procfs data exchange interface between the
  * SMART MTD and FS layers.
  */
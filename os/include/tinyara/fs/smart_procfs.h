@@ -101,6 +101,19 @@ struct mtd_smart_procfs_data_s {
 	uint8_t formatversion;		/* Version of the volume format */
 	uint32_t unusedsectors;	/* Number of unused sectors (free when erased) */
 	uint32_t blockerases;		/* Number block erase operations */
+	uint16_t nscans;			/* Number of full scans of the device */
+	uint32_t scantime;			/* Duration of the last full scan in msec */
+#ifdef CONFIG_MTD_SMART_MAP_CHECKPOINT
+	uint16_t nrestores;			/* Number of sector map checkpoint restores */
+	uint32_t restoretime;		/* Duration of the last restore in msec */
+#endif
+	uint32_t fggcblocks;		/* Blocks collected on the path of a request */
+	uint32_t fggcstalls;		/* Requests which waited for garbage collection */
+	uint32_t fggclaststall;		/* Duration of the last such wait in msec */
+	uint32_t fggcmaxstall;		/* Duration of the longest such wait in msec */
+#ifdef CONFIG_MTD_SMART_BACKGROUND_GC
+	uint32_t bggcblocks;		/* Blocks collected by the background worker */
+#endif
 
 #ifdef CONFIG_MTD_SMART_SECTOR_ERASE_DEBUG
 	FAR const uint8_t *erasecounts;	/* Array of erase counts per erase block */
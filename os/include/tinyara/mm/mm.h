@@ -158,6 +158,26 @@
 #define MM_MAX_CHUNK     (1 << MM_MAX_SHIFT)
 #define MM_NNODES        (MM_MAX_SHIFT - MM_MIN_SHIFT + 1)
 
+/* Free node list layout.
+ *
+ * By default there is one list per power of two (MM_NNODES), each kept in a
+ * descending order of size.  With CONFIG_MM_TLSF, each power of two range
+ * starting from MM_TLSF_FLI_OFFSET is split again into MM_TLSF_SLI_COUNT
+ * lists, and sizes below (1 << MM_TLSF_FLI_OFFSET) are spread linearly over
+ * the lists of the first level index 0.  The lists are not sorted; the
+ * mm_fl_bitmap/mm_sl_bitmap fields of the heap track the non-empty ones.
+ */
+
+#ifdef CONFIG_MM_TLSF
+#define MM_TLSF_SLI_SHIFT  CONFIG_MM_TLSF_SLI_SHIFT
+#define MM_TLSF_SLI_COUNT  (1 << MM_TLSF_SLI_SHIFT)
+#define MM_TLSF_FLI_OFFSET (MM_MIN_SHIFT + MM_TLSF_SLI_SHIFT)
+#define MM_TLSF_FLI_COUNT  (MM_MAX_SHIFT - MM_TLSF_FLI_OFFSET + 2)
+#define MM_NLISTS          (MM_TLSF_FLI_COUNT * MM_TLSF_SLI_COUNT)
+#else
+#define MM_NLISTS          MM_NNODES
+#endif
+
 #define MM_GRAN_MASK     (MM_MIN_CHUNK-1)
 #define MM_ALIGN_UP(a)   (((a) + MM_GRAN_MASK) & ~MM_GRAN_MASK)
 #define MM_ALIGN_DOWN(a) ((a) & ~MM_GRAN_MASK)
@@ -336,6 +356,19 @@ extern struct heapinfo_group_info_s group_info[HEAPINFO_THREAD_NUM];
 
 #endif
 
+#ifdef CONFIG_MM_SMALL_CACHE
+/* Statistics of the small block magazines of one CPU */
+
+struct mm_cache_stat_s {
+	uint32_t hits;		/* malloc() served from the magazine */
+	uint32_t misses;	/* malloc() which found the magazine empty */
+	uint32_t refills;	/* Batches taken from the heap */
+	uint32_t drains;	/* Batches returned because a magazine was full */
+	uint32_t flushes;	/* Magazines emptied by the garbage collection */
+	uint32_t cached;	/* Blocks currently held in the magazines */
+};
+#endif
+
 struct mm_alloc_fail_s {
 	uint32_t size;
 	uint32_t align;
@@ -380,7 +413,17 @@ struct mm_heap_s {
 	 * speed searches for free nodes.
 	 */
 
-	struct mm_freenode_s mm_nodelist[MM_NNODES + 1];
+	struct mm_freenode_s mm_nodelist[MM_NLISTS + 1];
+
+#ifdef CONFIG_MM_TLSF
+	/* Bit n of mm_fl_bitmap is set if any list of the first level index n
+	 * is non-empty, and bit m of mm_sl_bitmap[n] is set if the list
+	 * (n * MM_TLSF_SLI_COUNT + m) of mm_nodelist is non-empty.
+	 */
+
+	uint32_t mm_fl_bitmap;
+	uint32_t mm_sl_bitmap[MM_TLSF_FLI_COUNT];
+#endif
 	
 	/* Free delay list, for some situations where we can't do free
 	* immdiately.
@@ -645,6 +688,23 @@ void mm_addfreechunk(FAR struct mm_heap_s *heap, FAR struct mm_freenode_s *node)
 
 int mm_size2ndx(size_t size);
 
+#ifdef CONFIG_MM_SMALL_CACHE
+/* Functions contained in umm_cache.c ***************************************/
+
+FAR void *umm_cache_alloc(size_t size);
+bool umm_cache_free(FAR void *mem);
+void umm_cache_flush(void);
+void umm_cache_reclaim(void);
+void umm_cache_getstat(int cpu, FAR struct mm_cache_stat_s *stat);
+#endif
+
+#ifdef CONFIG_MM_TLSF
+/* Functions contained in mm_tlsf.c *****************************************/
+
+FAR struct mm_freenode_s *mm_tlsf_findfreechunk(FAR struct mm_heap_s *heap, size_t size);
+void mm_tlsf_removefreechunk(FAR struct mm_heap_s *heap, FAR struct mm_freenode_s *node);
+#endif
+
 void mm_dump_node(struct mm_allocnode_s *node, char *node_type);
 void mm_dump_heap_region(uint32_t start, uint32_t end);
 void mm_dump_heap_free_node_list(struct mm_heap_s *heap);
@@ -0,0 +1,109 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_NOTE_H
+#define __INCLUDE_TINYARA_NOTE_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+
+#include <tinyara/fs/ioctl.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+#define NOTE_DRVPATH        "/dev/note"
+
+/* Reading NOTE_DRVPATH returns whole notes, oldest first across all CPUs.
+ * Each note starts with struct note_common_s of tinyara/sched_note.h and
+ * its nc_length gives the size of the note in bytes.
+ *
+ * NOTEIOC_CLEAR     - Discard all recorded notes.            arg: none
+ * NOTEIOC_GETMODE   - Get the NOTE_FILTER_MODE_FLAG_* mask.  arg: unsigned int *
+ * NOTEIOC_SETMODE   - Set the NOTE_FILTER_MODE_FLAG_* mask.  arg: unsigned int
+ * NOTEIOC_GETSTATUS - Get the buffer usage.                  arg: struct note_status_s *
+ */
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Usage of the note buffer of each CPU */
+
+struct note_status_s {
+	unsigned int mode;                          /* NOTE_FILTER_MODE_FLAG_* mask */
+	uint32_t bufsize;                           /* Buffer size of a CPU in bytes */
+	uint32_t used[CONFIG_SMP_NCPUS];            /* Bytes of notes not yet read */
+	uint32_t dropped[CONFIG_SMP_NCPUS];         /* Notes dropped on a full buffer */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+#if defined(__KERNEL__) || defined(CONFIG_BUILD_FLAT)
+
+/****************************************************************************
+ * Name: sched_note_read
+ *
+ * Description:
+ *   Move as many whole notes as fit in buffer out of the note buffers.
+ *   Only one reader may run at a time.
+ *
+ * Returned Value:
+ *   The number of bytes read, zero if there is no note to read.
+ *
+ ****************************************************************************/
+
+ssize_t sched_note_read(FAR uint8_t *buffer, size_t buflen);
+
+void sched_note_clear(void);
+unsigned int sched_note_getmode(void);
+void sched_note_setmode(unsigned int mode);
+void sched_note_getstatus(FAR struct note_status_s *status);
+
+/****************************************************************************
+ * Name: note_initialize
+ *
+ * Description:
+ *   Register the note driver at NOTE_DRVPATH
+ *
+ ****************************************************************************/
+
+void note_initialize(void);
+
+#endif /* __KERNEL__ || CONFIG_BUILD_FLAT */
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __INCLUDE_TINYARA_NOTE_H */
@@ -38,6 +38,8 @@
 #define PREF_PATH MOUNT_PATH"/pref"
 #define PREF_PRIVATE_PATH PREF_PATH"/private"
 #define PREF_SHARED_PATH PREF_PATH"/shared"
+#define PREF_LOG_PATH PREF_PATH"/pref.log"
+#define PREF_LOG_TMP_PATH PREF_PATH"/pref.tmp"
 
 /* Error Type of Result Value returned from Preference */
 enum preference_result_error_e {
@@ -578,6 +578,9 @@ struct tcb_s {
 #ifdef CONFIG_SMP
 	uint8_t  cpu;				/* CPU index if running/assigned       */
 	cpu_set_t affinity;			/* Bit set of permitted CPUs           */
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+	clock_t lastrun;			/* Time the task last left its CPU     */
+#endif
 #endif
 #ifdef CONFIG_IRQCOUNT
 	int16_t irqcount;			/* 0=NOT in critical section           */
@@ -769,6 +772,17 @@ struct pthread_tcb_s {
 
 typedef void (*sched_foreach_t)(FAR struct tcb_s *tcb, FAR void *arg);
 
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+/* Run queues of the CPUs, see sched_runqueue_getstatus() */
+
+struct runqueue_status_s {
+	uint16_t nshared;                           /* Tasks in the shared g_readytorun list */
+	uint16_t nqueued[CONFIG_SMP_NCPUS];         /* Tasks queued behind the running task */
+	uint32_t nmigrations[CONFIG_SMP_NCPUS];     /* Tasks started after running on another CPU */
+	uint32_t nsteals[CONFIG_SMP_NCPUS];         /* Tasks taken from the queue of another CPU */
+};
+#endif
+
 #endif							/* __ASSEMBLY__ */
 
 /* 
@@ -894,6 +908,17 @@ void sched_clear_cpuload_snapshot(void);
 void sched_get_cpuload_snapshot(pid_t *result_addr);
 #endif
 
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+/**
+ * @cond
+ * @internal
+ */
+void sched_runqueue_getstatus(FAR struct runqueue_status_s *status);
+/**
+ * @endcond
+ */
+#endif
+
 /********************************************************************************
  * Name: task_starthook
  *
@@ -79,6 +79,9 @@
 #ifdef CONFIG_SCHED_INSTRUMENTATION_SYSCALL
 #define NOTE_FILTER_MODE_FLAG_SYSCALL_ARGS (1 << 5) /* Enable collecting syscall arguments */
 #endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+#define NOTE_FILTER_MODE_FLAG_SEMAPHORE    (1 << 6) /* Enable semaphore instrumentation */
+#endif
 
 /* Helper macros for syscall instrumentation filter */
 
@@ -132,7 +135,7 @@
           sched_note_dump_ip(tag, SCHED_NOTE_IP, event, buf, len)
 #  define sched_note_vprintf(tag, fmt, va) \
           sched_note_vprintf_ip(tag, SCHED_NOTE_IP, fmt, va)
-#  define sched_note_vbprintf(event, fmt, va) \
+#  define sched_note_vbprintf(tag, event, fmt, va) \
           sched_note_vbprintf_ip(tag, SCHED_NOTE_IP, event, fmt, va)
 #  define sched_note_printf(tag, fmt, ...) \
           sched_note_printf_ip(tag, SCHED_NOTE_IP, fmt, ##__VA_ARGS__)
@@ -143,9 +146,9 @@
           sched_note_printf_ip(tag, SCHED_NOTE_IP, "B|%d|%s", gettid(), str)
 #  define sched_note_endex(tag, str) \
           sched_note_printf_ip(tag, SCHED_NOTE_IP, "E|%d|%s", gettid(), str)
-#  define sched_note_begin(tag, ip) \
+#  define sched_note_begin(tag) \
           sched_note_string_ip(tag, SCHED_NOTE_IP, "B")
-#  define sched_note_end(tag, ip) \
+#  define sched_note_end(tag) \
           sched_note_string_ip(tag, SCHED_NOTE_IP, "E")
 #else
 #  define sched_note_string(tag, buf)
@@ -154,6 +157,8 @@
 #  define sched_note_vbprintf(tag, event, fmt, va)
 #  define sched_note_printf(tag, fmt, ...)
 #  define sched_note_bprintf(tag, event, fmt, ...)
+#  define sched_note_beginex(tag, str)
+#  define sched_note_endex(tag, str)
 #  define sched_note_begin(tag)
 #  define sched_note_end(tag)
 #endif
@@ -217,6 +222,12 @@ enum note_type_e
   NOTE_DUMP_STRING     = 22,
   NOTE_DUMP_BINARY     = 23
 #endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+  ,
+  NOTE_SEM_ACQUIRE     = 24,
+  NOTE_SEM_WAITING     = 25,
+  NOTE_SEM_RELEASE     = 26
+#endif
 };
 
 enum note_tag_e
@@ -441,6 +452,17 @@ struct note_binary_s
 
 #endif /* CONFIG_SCHED_INSTRUMENTATION_DUMP */
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+/* This is the specific form of the NOTE_SEM_ACQUIRE/WAITING/RELEASE notes */
+
+struct note_sem_s
+{
+  struct note_common_s nsm_cmn;         /* Common note parameters */
+  uint8_t nsm_sem[sizeof(uintptr_t)];   /* Address of the semaphore */
+  uint8_t nsm_count[sizeof(int16_t)];   /* Count after the operation */
+};
+#endif /* CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE */
+
 #ifdef CONFIG_SCHED_INSTRUMENTATION_FILTER
 
 /* This is the type of the argument passed to the NOTECTL_GETMODE and
@@ -583,20 +605,26 @@ void sched_note_irqhandler(int irq, FAR void *handler, bool enter);
 #  define sched_note_irqhandler(i,h,e)
 #endif
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+void sched_note_semaphore(FAR struct tcb_s *tcb, FAR sem_t *sem, int type);
+#else
+#  define sched_note_semaphore(t,s,y)
+#endif
+
 #ifdef CONFIG_SCHED_INSTRUMENTATION_DUMP
 
 void sched_note_string_ip(uint32_t tag, uintptr_t ip, FAR const char *buf);
 void sched_note_dump_ip(uint32_t tag, uintptr_t ip, uint8_t event,
                         FAR const void *buf, size_t len);
 void sched_note_vprintf_ip(uint32_t tag, uintptr_t ip, FAR const char *fmt,
-                           va_list va) printf_like(3, 0);
+                           va_list va);
 void sched_note_vbprintf_ip(uint32_t tag, uintptr_t ip, uint8_t event,
                             FAR const char *fmt,
-                            va_list va) printf_like(4, 0);
+                            va_list va);
 void sched_note_printf_ip(uint32_t tag, uintptr_t ip,
-                          FAR const char *fmt, ...) printf_like(3, 4);
+                          FAR const char *fmt, ...);
 void sched_note_bprintf_ip(uint32_t tag, uintptr_t ip, uint8_t event,
-                           FAR const char *fmt, ...) printf_like(4, 5);
+                           FAR const char *fmt, ...);
 #else
 #  define sched_note_string_ip(t,ip,b)
 #  define sched_note_dump_ip(t,ip,e,b,l)
@@ -686,7 +714,7 @@ void sched_note_filter_irq(FAR struct note_filter_irq_s *oldf,
 #endif
 
 #if defined(CONFIG_SCHED_INSTRUMENTATION_FILTER) && \
-    defined(CONFIG_SCHED_INSTRUMENTATION_IRQHANDLER)
+    defined(CONFIG_SCHED_INSTRUMENTATION_DUMP)
 void sched_note_filter_tag(FAR struct note_filter_tag_s *oldf,
                            FAR struct note_filter_tag_s *newf);
 #endif
@@ -700,14 +728,16 @@ void sched_note_filter_tag(FAR struct note_filter_tag_s *oldf,
 
 #else /* CONFIG_SCHED_INSTRUMENTATION */
 
-#  define sched_note_string(buf)
-#  define sched_note_dump(event, buf, len)
-#  define sched_note_vprintf(fmt, va)
-#  define sched_note_vbprintf(event, fmt, va)
-#  define sched_note_printf(fmt, ...)
-#  define sched_note_bprintf(event, fmt, ...)
-#  define sched_note_begin()
-#  define sched_note_end()
+#  define sched_note_string(tag, buf)
+#  define sched_note_dump(tag, event, buf, len)
+#  define sched_note_vprintf(tag, fmt, va)
+#  define sched_note_vbprintf(tag, event, fmt, va)
+#  define sched_note_printf(tag, fmt, ...)
+#  define sched_note_bprintf(tag, event, fmt, ...)
+#  define sched_note_beginex(tag, str)
+#  define sched_note_endex(tag, str)
+#  define sched_note_begin(tag)
+#  define sched_note_end(tag)
 
 #  define sched_note_start(t)
 #  define sched_note_stop(t)
@@ -725,6 +755,7 @@ void sched_note_filter_tag(FAR struct note_filter_tag_s *oldf,
 #  define sched_note_syscall_enter(n,a,...)
 #  define sched_note_syscall_leave(n,r)
 #  define sched_note_irqhandler(i,h,e)
+#  define sched_note_semaphore(t,s,y)
 #  define sched_note_string_ip(t,ip,b)
 #  define sched_note_dump_ip(t,ip,e,b,l)
 #  define sched_note_vprintf_ip(t,ip,f,v)
@@ -143,6 +143,34 @@ EXTERN int syslog_initialize(void);
 EXTERN int syslog_putc(int ch);
 #endif
 
+/****************************************************************************
+ * Name: syslog_puts
+ *
+ * Description:
+ *   Write a run of buflen characters to the SYSLOG device, with the same
+ *   newline handling as syslog_putc().  Returns the number of characters
+ *   consumed, or EOF with the errno value set if nothing could be written.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSLOG
+EXTERN int syslog_puts(FAR const char *buf, size_t buflen);
+#endif
+
+/****************************************************************************
+ * Name: syslog_putc_run
+ *
+ * Description:
+ *   Write a run of buflen characters with one syslog_putc() per character,
+ *   with the same return value as syslog_puts().  A SYSLOG device which
+ *   takes one character at a time implements syslog_puts() with it.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSLOG
+EXTERN int syslog_putc_run(FAR const char *buf, size_t buflen);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -160,6 +160,11 @@ struct wdog_s {
 	uint8_t flags;				/* See WDOGF_* definitions above */
 	uint8_t argc;				/* The number of parameters to pass */
 	uint32_t parm[CONFIG_MAX_WDOGPARMS];
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+	FAR struct wdog_s **pprev;	/* The link which points to this watchdog */
+	uint32_t expire;			/* The tick at which the watchdog expires */
+	uint16_t slot;				/* The wheel slot (level << 6 | index) */
+#endif
 };
 
 /* Watchdog 'handle' */
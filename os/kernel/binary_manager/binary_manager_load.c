@@ -104,6 +104,28 @@ static uint8_t binary_manager_get_loader_priority(uint8_t load_priority)
 	return loader_priority;
 }
 
+#ifdef CONFIG_BINMGR_LOAD_TIME
+/****************************************************************************
+ * Name: binary_manager_print_loadtime
+ *
+ * Description:
+ *	 This function prints the time spent in each step of the last load.
+ *	 All of them are 0 when the binary is reloaded from its sections in RAM.
+ *
+ ****************************************************************************/
+static void binary_manager_print_loadtime(int bin_idx)
+{
+	struct binary_s *binp = BIN_LOADINFO(bin_idx);
+
+	if (!binp) {
+		return;
+	}
+
+	bmdbg("Load time of %s: headers %u us, sections %u us, relocation %u us (%u relocations, %u symbol lookups)\n", BIN_NAME(bin_idx),
+			binp->loadtime.init_us, binp->loadtime.load_us, binp->loadtime.bind_us, binp->loadtime.nrelocs, binp->loadtime.nlookups);
+}
+#endif
+
 /****************************************************************************
  * Name: binary_manager_load_binary
  *
@@ -125,6 +147,9 @@ static int binary_manager_load_binary(int bin_idx, char *path, load_attr_t *load
 			strncpy(BIN_NAME(bin_idx), load_attr->bin_name, BIN_NAME_MAX);
 			bmdbg("Load success! [Name: %s] [Version: %d] [Partition: %s] [Text start : 0x%08x] %s\n", BIN_NAME(bin_idx), 
 					BIN_LOADVER(bin_idx), GET_PARTNAME(BIN_USEIDX(bin_idx)), elf_find_text_section_addr(bin_idx), BINARY_COMP_TYPE);
+#ifdef CONFIG_BINMGR_LOAD_TIME
+			binary_manager_print_loadtime(bin_idx);
+#endif
 			return OK;
 		} else if (errno == ENOMEM) {
 			/* Sleep for a moment to get available memory */
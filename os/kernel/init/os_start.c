@@ -552,6 +552,9 @@ void os_start(void)
 		tasklist = TLIST_HEAD(TSTATE_TASK_RUNNING);
 #endif
 		dq_addfirst((FAR dq_entry_t *)&g_idletcb[i], tasklist);
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+		sched_prioritymap_rebuild();
+#endif
 
 		/* Mark the idle task as the running task */
 
@@ -65,6 +65,9 @@
 #ifdef CONFIG_IRQ_SCHED_HISTORY
 #include <tinyara/debug/sysdbg.h>
 #endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_IRQHANDLER
+#include <tinyara/sched_note.h>
+#endif
 
 /****************************************************************************
  * Definitions
@@ -128,5 +131,13 @@ void irq_dispatch(int irq, FAR void *context)
 
 	/* Then dispatch to the interrupt handler */
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_IRQHANDLER
+	sched_note_irqhandler(irq, (FAR void *)vector, true);
+#endif
+
 	vector(irq, context, arg);
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_IRQHANDLER
+	sched_note_irqhandler(irq, (FAR void *)vector, false);
+#endif
 }
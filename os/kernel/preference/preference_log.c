@@ -0,0 +1,777 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/* Log-structured storage of preference keys.
+ *
+ * Every set or remove appends one record to PREF_LOG_PATH. A record is a
+ * header, the key name and the value, and carries a CRC of all of them. An
+ * index in RAM maps each key to its newest record, so a get reads a single
+ * record and a check does not touch the file system at all. Keys are named
+ * by the path they have with the file backend without PREF_PATH, e.g.
+ * "shared/a/b" or "private/<task group name>/c".
+ *
+ * Removed and overwritten records stay in the log as stale bytes. Once they
+ * reach CONFIG_PREFERENCE_LOG_COMPACT_SIZE, the live records are copied to
+ * PREF_LOG_TMP_PATH which then replaces the log.
+ *
+ * The log is loaded at the first operation. Records are scanned up to the
+ * first one which is short or fails its CRC, i.e. torn by a power loss, and
+ * the log is truncated there.
+ */
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <debug.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <queue.h>
+#include <semaphore.h>
+#include <crc32.h>
+#include <sys/stat.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/preference.h>
+
+#include "preference/preference.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+#define PREF_LOG_MAGIC          0x5046	/* "PF" */
+
+/* Length of a record which removes its key, or of an entry not indexed yet */
+#define PREF_LOG_REMOVED        (-1)
+
+#define PREF_LOG_RECSIZE(keylen, len) \
+	(sizeof(struct pref_log_hdr_s) + (keylen) + ((len) > 0 ? (len) : 0))
+
+/* Name of a key from its path, sizeof() counts the '/' after PREF_PATH */
+#define PREF_LOG_NAME(path)     ((path) + sizeof(PREF_PATH))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+struct pref_log_hdr_s {
+	uint32_t crc;			/* Of the fields below, the name and the value */
+	uint16_t magic;
+	uint16_t keylen;		/* Name length without the terminating null */
+	int32_t type;			/* value_attr_t type of the value */
+	int32_t len;			/* Value length or PREF_LOG_REMOVED */
+};
+
+struct pref_log_entry_s {
+	struct pref_log_entry_s *flink;
+	uint32_t hash;
+	off_t offset;			/* Offset of the newest record of the key */
+	int type;
+	int len;
+	uint16_t keylen;
+	char name[1];
+};
+
+struct pref_log_s {
+	bool loaded;
+	struct file file;
+	off_t size;			/* End of the last valid record */
+	off_t stale;			/* Bytes of overwritten and removal records */
+	sq_queue_t buckets[CONFIG_PREFERENCE_LOG_BUCKETS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+static struct pref_log_s g_pref_log;
+static sem_t g_pref_log_sem = SEM_INITIALIZER(1);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+static void preference_log_lock(void)
+{
+	while (sem_wait(&g_pref_log_sem) != OK) {
+		ASSERT(get_errno() == EINTR);
+	}
+}
+
+static void preference_log_unlock(void)
+{
+	sem_post(&g_pref_log_sem);
+}
+
+static uint32_t preference_log_hash(const char *name, uint16_t keylen)
+{
+	uint32_t hash = 2166136261u;
+
+	/* FNV-1a */
+	while (keylen-- > 0) {
+		hash ^= (uint8_t)*name++;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+static sq_queue_t *preference_log_bucket(uint32_t hash)
+{
+	return &g_pref_log.buckets[hash % CONFIG_PREFERENCE_LOG_BUCKETS];
+}
+
+static struct pref_log_entry_s *preference_log_find(const char *name, uint16_t keylen, uint32_t hash)
+{
+	struct pref_log_entry_s *entry;
+
+	entry = (struct pref_log_entry_s *)sq_peek(preference_log_bucket(hash));
+	while (entry != NULL) {
+		if (entry->hash == hash && entry->keylen == keylen && !memcmp(entry->name, name, keylen)) {
+			return entry;
+		}
+		entry = (struct pref_log_entry_s *)sq_next(entry);
+	}
+
+	return NULL;
+}
+
+/* Allocate an entry which is not in the index until preference_log_update() */
+static struct pref_log_entry_s *preference_log_new_entry(const char *name, uint16_t keylen, uint32_t hash)
+{
+	struct pref_log_entry_s *entry;
+
+	entry = (struct pref_log_entry_s *)PREFERENCE_ALLOC(sizeof(struct pref_log_entry_s) + keylen);
+	if (entry == NULL) {
+		return NULL;
+	}
+	entry->hash = hash;
+	entry->len = PREF_LOG_REMOVED;
+	entry->keylen = keylen;
+	memcpy(entry->name, name, keylen);
+	entry->name[keylen] = '\0';
+
+	return entry;
+}
+
+/* Point the entry to its new record at offset, indexing it if needed */
+static void preference_log_update(struct pref_log_entry_s *entry, int type, int len, off_t offset)
+{
+	if (entry->len == PREF_LOG_REMOVED) {
+		sq_addlast((FAR sq_entry_t *)entry, preference_log_bucket(entry->hash));
+	} else {
+		g_pref_log.stale += PREF_LOG_RECSIZE(entry->keylen, entry->len);
+	}
+	entry->offset = offset;
+	entry->type = type;
+	entry->len = len;
+}
+
+static void preference_log_unindex(struct pref_log_entry_s *entry)
+{
+	sq_rem((FAR sq_entry_t *)entry, preference_log_bucket(entry->hash));
+	g_pref_log.stale += PREF_LOG_RECSIZE(entry->keylen, entry->len);
+	PREFERENCE_FREE(entry);
+}
+
+static void preference_log_unload(void)
+{
+	struct pref_log_entry_s *entry;
+	int i;
+
+	for (i = 0; i < CONFIG_PREFERENCE_LOG_BUCKETS; i++) {
+		while ((entry = (struct pref_log_entry_s *)sq_remfirst(&g_pref_log.buckets[i])) != NULL) {
+			PREFERENCE_FREE(entry);
+		}
+	}
+	g_pref_log.size = 0;
+	g_pref_log.stale = 0;
+	g_pref_log.loaded = false;
+}
+
+/* Read the record at offset and verify it. rec is allocated for its name
+ * and value, and should be freed by the caller on success.
+ */
+static int preference_log_read_record(off_t offset, off_t end, struct pref_log_hdr_s *hdr, char **rec)
+{
+	size_t size;
+	uint32_t crc;
+
+	if (end - offset < (off_t)sizeof(struct pref_log_hdr_s)) {
+		return PREFERENCE_INVALID_DATA;
+	}
+	if (file_pread(&g_pref_log.file, hdr, sizeof(struct pref_log_hdr_s), offset) != (ssize_t)sizeof(struct pref_log_hdr_s)) {
+		return PREFERENCE_IO_ERROR;
+	}
+	if (hdr->magic != PREF_LOG_MAGIC || hdr->keylen == 0 || hdr->len < PREF_LOG_REMOVED || end - offset < (off_t)PREF_LOG_RECSIZE(hdr->keylen, hdr->len)) {
+		return PREFERENCE_INVALID_DATA;
+	}
+
+	size = PREF_LOG_RECSIZE(hdr->keylen, hdr->len) - sizeof(struct pref_log_hdr_s);
+	*rec = (char *)PREFERENCE_ALLOC(size);
+	if (*rec == NULL) {
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+	if (file_pread(&g_pref_log.file, *rec, size, offset + sizeof(struct pref_log_hdr_s)) != (ssize_t)size) {
+		PREFERENCE_FREE(*rec);
+		return PREFERENCE_IO_ERROR;
+	}
+
+	crc = crc32((uint8_t *)&hdr->magic, sizeof(struct pref_log_hdr_s) - sizeof(uint32_t));
+	crc = crc32part((uint8_t *)*rec, size, crc);
+	if (crc != hdr->crc) {
+		prefdbg("Invalid checksum at %d, read crc : %u, calculated crc : %u\n", (int)offset, hdr->crc, crc);
+		PREFERENCE_FREE(*rec);
+		return PREFERENCE_INVALID_DATA;
+	}
+
+	return OK;
+}
+
+static int preference_log_load(void)
+{
+	struct pref_log_entry_s *entry;
+	struct pref_log_hdr_s hdr;
+	struct stat st;
+	uint32_t hash;
+	off_t offset;
+	off_t end;
+	char *rec;
+	int ret;
+
+	if (g_pref_log.loaded) {
+		return OK;
+	}
+
+	/* A compaction removes the old log only once the new one is complete.
+	 * If it was interrupted before, the new one is partial and dropped.
+	 */
+	if (stat(PREF_LOG_PATH, &st) < 0 && errno == ENOENT && stat(PREF_LOG_TMP_PATH, &st) == OK) {
+		prefdbg("Recover log from interrupted compaction\n");
+		if (rename(PREF_LOG_TMP_PATH, PREF_LOG_PATH) < 0) {
+			prefdbg("rename fail, %d\n", errno);
+			return PREFERENCE_IO_ERROR;
+		}
+	} else {
+		(void)unlink(PREF_LOG_TMP_PATH);
+	}
+
+	ret = file_open(&g_pref_log.file, PREF_LOG_PATH, O_RDWR | O_CREAT, 0666);
+	if (ret < 0) {
+		prefdbg("open fail %d\n", ret);
+		return PREFERENCE_IO_ERROR;
+	}
+
+	end = file_seek(&g_pref_log.file, 0, SEEK_END);
+	if (end < 0) {
+		file_close(&g_pref_log.file);
+		return PREFERENCE_IO_ERROR;
+	}
+
+	offset = 0;
+	while (offset < end) {
+		ret = preference_log_read_record(offset, end, &hdr, &rec);
+		if (ret == PREFERENCE_INVALID_DATA) {
+			break;
+		} else if (ret < 0) {
+			goto errout;
+		}
+
+		hash = preference_log_hash(rec, hdr.keylen);
+		entry = preference_log_find(rec, hdr.keylen, hash);
+		if (hdr.len == PREF_LOG_REMOVED) {
+			if (entry != NULL) {
+				preference_log_unindex(entry);
+			}
+			g_pref_log.stale += PREF_LOG_RECSIZE(hdr.keylen, hdr.len);
+		} else {
+			if (entry == NULL) {
+				entry = preference_log_new_entry(rec, hdr.keylen, hash);
+				if (entry == NULL) {
+					PREFERENCE_FREE(rec);
+					ret = PREFERENCE_OUT_OF_MEMORY;
+					goto errout;
+				}
+			}
+			preference_log_update(entry, hdr.type, hdr.len, offset);
+		}
+		PREFERENCE_FREE(rec);
+		offset += PREF_LOG_RECSIZE(hdr.keylen, hdr.len);
+	}
+
+	if (offset < end) {
+		prefdbg("Truncate torn log at %d of %d\n", (int)offset, (int)end);
+		ret = file_truncate(&g_pref_log.file, offset);
+		if (ret < 0) {
+			prefdbg("Failed to truncate log, %d\n", ret);
+			goto errout;
+		}
+	}
+
+	g_pref_log.size = offset;
+	g_pref_log.loaded = true;
+	prefvdbg("Loaded log of %d bytes, %d stale\n", (int)g_pref_log.size, (int)g_pref_log.stale);
+
+	return OK;
+errout:
+	preference_log_unload();
+	file_close(&g_pref_log.file);
+
+	return ret == PREFERENCE_OUT_OF_MEMORY ? ret : PREFERENCE_IO_ERROR;
+}
+
+/* Append a record and return its offset. It is synced before it is indexed,
+ * a failed append is cut off the log again.
+ */
+static int preference_log_append(const char *name, uint16_t keylen, int type, const void *value, int len, off_t *offset)
+{
+	struct pref_log_hdr_s *hdr;
+	size_t size;
+	char *rec;
+	int ret;
+
+	size = PREF_LOG_RECSIZE(keylen, len);
+	rec = (char *)PREFERENCE_ALLOC(size);
+	if (rec == NULL) {
+		return PREFERENCE_OUT_OF_MEMORY;
+	}
+
+	hdr = (struct pref_log_hdr_s *)rec;
+	hdr->magic = PREF_LOG_MAGIC;
+	hdr->keylen = keylen;
+	hdr->type = type;
+	hdr->len = len;
+	memcpy(rec + sizeof(struct pref_log_hdr_s), name, keylen);
+	if (len > 0) {
+		memcpy(rec + sizeof(struct pref_log_hdr_s) + keylen, value, len);
+	}
+	hdr->crc = crc32((uint8_t *)&hdr->magic, size - sizeof(uint32_t));
+
+	ret = OK;
+	if (file_pwrite(&g_pref_log.file, rec, size, g_pref_log.size) != (ssize_t)size || file_fsync(&g_pref_log.file) < 0) {
+		prefdbg("Failed to append record of %s\n", name);
+		(void)file_truncate(&g_pref_log.file, g_pref_log.size);
+		ret = PREFERENCE_IO_ERROR;
+	}
+	PREFERENCE_FREE(rec);
+
+	if (ret == OK) {
+		*offset = g_pref_log.size;
+		g_pref_log.size += size;
+	}
+
+	return ret;
+}
+
+static int preference_log_compact(void)
+{
+	struct pref_log_entry_s *entry;
+	struct file tmp;
+	off_t offset;
+	size_t size;
+	char *rec;
+	int ret;
+	int i;
+
+	prefvdbg("Compact log of %d bytes, %d stale\n", (int)g_pref_log.size, (int)g_pref_log.stale);
+
+	ret = file_open(&tmp, PREF_LOG_TMP_PATH, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	if (ret < 0) {
+		prefdbg("open fail %d\n", ret);
+		return PREFERENCE_IO_ERROR;
+	}
+
+	/* Copy the newest records, in index order */
+	for (i = 0; i < CONFIG_PREFERENCE_LOG_BUCKETS; i++) {
+		entry = (struct pref_log_entry_s *)sq_peek(&g_pref_log.buckets[i]);
+		while (entry != NULL) {
+			size = PREF_LOG_RECSIZE(entry->keylen, entry->len);
+			rec = (char *)PREFERENCE_ALLOC(size);
+			if (rec == NULL) {
+				ret = PREFERENCE_OUT_OF_MEMORY;
+				goto errout_with_tmp;
+			}
+			ret = OK;
+			if (file_pread(&g_pref_log.file, rec, size, entry->offset) != (ssize_t)size || file_write(&tmp, rec, size) != (ssize_t)size) {
+				ret = PREFERENCE_IO_ERROR;
+			}
+			PREFERENCE_FREE(rec);
+			if (ret < 0) {
+				goto errout_with_tmp;
+			}
+			entry = (struct pref_log_entry_s *)sq_next(entry);
+		}
+	}
+	if (file_fsync(&tmp) < 0) {
+		ret = PREFERENCE_IO_ERROR;
+		goto errout_with_tmp;
+	}
+	file_close(&tmp);
+
+	/* From here the new log is complete, see preference_log_load() */
+	file_close(&g_pref_log.file);
+	if (unlink(PREF_LOG_PATH) < 0 || rename(PREF_LOG_TMP_PATH, PREF_LOG_PATH) < 0) {
+		prefdbg("Failed to replace log, %d\n", errno);
+		preference_log_unload();
+		return PREFERENCE_IO_ERROR;
+	}
+	ret = file_open(&g_pref_log.file, PREF_LOG_PATH, O_RDWR, 0666);
+	if (ret < 0) {
+		prefdbg("open fail %d\n", ret);
+		preference_log_unload();
+		return PREFERENCE_IO_ERROR;
+	}
+
+	offset = 0;
+	for (i = 0; i < CONFIG_PREFERENCE_LOG_BUCKETS; i++) {
+		entry = (struct pref_log_entry_s *)sq_peek(&g_pref_log.buckets[i]);
+		while (entry != NULL) {
+			entry->offset = offset;
+			offset += PREF_LOG_RECSIZE(entry->keylen, entry->len);
+			entry = (struct pref_log_entry_s *)sq_next(entry);
+		}
+	}
+	g_pref_log.size = offset;
+	g_pref_log.stale = 0;
+
+	return OK;
+errout_with_tmp:
+	file_close(&tmp);
+	unlink(PREF_LOG_TMP_PATH);
+
+	return ret;
+}
+
+/* A record is persisted already when this is called, so a failed compaction
+ * is not an error of the operation, it is tried again at the next one.
+ */
+static void preference_log_try_compact(void)
+{
+	if (g_pref_log.stale >= CONFIG_PREFERENCE_LOG_COMPACT_SIZE) {
+		if (preference_log_compact() < 0) {
+			prefdbg("Failed to compact log\n");
+		}
+	}
+}
+
+static int preference_log_get_path(int type, const char *key, char **path)
+{
+	int ret;
+
+	if (type == PRIVATE_PREFERENCE) {
+		ret = preference_get_private_keypath(key, path);
+		if (ret < 0) {
+			prefdbg("Failed to get preference path\n");
+			return ret;
+		}
+	} else {
+		ret = PREFERENCE_ASPRINTF(path, "%s/%s", PREF_SHARED_PATH, key);
+		if (ret < 0) {
+			prefdbg("Failed to allocate path\n");
+			return PREFERENCE_OUT_OF_MEMORY;
+		}
+	}
+
+	if (strlen(PREF_LOG_NAME(*path)) > UINT16_MAX) {
+		prefdbg("Too long key %s\n", key);
+		PREFERENCE_FREE(*path);
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+int preference_write_key(preference_data_t *data)
+{
+	struct pref_log_entry_s *entry;
+	const char *name;
+	uint16_t keylen;
+	uint32_t hash;
+	off_t offset;
+	char *path;
+	int ret;
+
+	if (data == NULL || data->key == NULL || (data->type != PRIVATE_PREFERENCE && data->type != SHARED_PREFERENCE) || data->attr.len < 0 || (data->attr.len > 0 && data->value == NULL)) {
+		prefdbg("Invalid parameter\n");
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	ret = preference_log_get_path(data->type, data->key, &path);
+	if (ret < 0) {
+		return ret;
+	}
+	name = PREF_LOG_NAME(path);
+	keylen = strlen(name);
+	hash = preference_log_hash(name, keylen);
+
+	preference_log_lock();
+	ret = preference_log_load();
+	if (ret < 0) {
+		goto errout_with_lock;
+	}
+
+	/* Allocate a new entry before appending, so that a persisted record is
+	 * always indexed.
+	 */
+	entry = preference_log_find(name, keylen, hash);
+	if (entry == NULL) {
+		entry = preference_log_new_entry(name, keylen, hash);
+		if (entry == NULL) {
+			ret = PREFERENCE_OUT_OF_MEMORY;
+			goto errout_with_lock;
+		}
+	}
+
+	ret = preference_log_append(name, keylen, data->attr.type, data->value, data->attr.len, &offset);
+	if (ret < 0) {
+		if (entry->len == PREF_LOG_REMOVED) {
+			PREFERENCE_FREE(entry);
+		}
+		goto errout_with_lock;
+	}
+	preference_log_update(entry, data->attr.type, data->attr.len, offset);
+	prefvdbg("Write Key Success : %s, len = %d\n", name, data->attr.len);
+
+	preference_log_try_compact();
+
+errout_with_lock:
+	preference_log_unlock();
+	PREFERENCE_FREE(path);
+
+#if !defined(CONFIG_DISABLE_MQUEUE) && !defined(CONFIG_DISABLE_SIGNAL)
+	if (ret == OK) {
+		/* Execute callback if registered cb is existing */
+		preference_send_cb_msg(data->type, data->key);
+	}
+#endif
+
+	return ret;
+}
+
+int preference_read_key(preference_data_t *data)
+{
+	struct pref_log_entry_s *entry;
+	struct pref_log_hdr_s hdr;
+	const char *name;
+	uint16_t keylen;
+	char *path;
+	char *rec;
+	int ret;
+
+	if (data == NULL || data->key == NULL || (data->type != PRIVATE_PREFERENCE && data->type != SHARED_PREFERENCE)) {
+		prefdbg("Invalid parameter\n");
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	ret = preference_log_get_path(data->type, data->key, &path);
+	if (ret < 0) {
+		return ret;
+	}
+	name = PREF_LOG_NAME(path);
+	keylen = strlen(name);
+
+	preference_log_lock();
+	ret = preference_log_load();
+	if (ret < 0) {
+		goto errout_with_lock;
+	}
+
+	entry = preference_log_find(name, keylen, preference_log_hash(name, keylen));
+	if (entry == NULL) {
+		ret = PREFERENCE_KEY_NOT_EXIST;
+		goto errout_with_lock;
+	} else if (entry->type != data->attr.type) {
+		prefdbg("Invalid type. request type:%d, read type:%d\n", data->attr.type, entry->type);
+		ret = PREFERENCE_INVALID_PARAMETER;
+		goto errout_with_lock;
+	}
+
+	ret = preference_log_read_record(entry->offset, g_pref_log.size, &hdr, &rec);
+	if (ret < 0) {
+		goto errout_with_lock;
+	}
+
+	data->attr.len = hdr.len;
+	data->value = PREFERENCE_ALLOC(hdr.len);
+	if (data->value == NULL) {
+		ret = PREFERENCE_OUT_OF_MEMORY;
+	} else {
+		memcpy(data->value, rec + hdr.keylen, hdr.len);
+		prefvdbg("Read key Success!\n");
+	}
+	PREFERENCE_FREE(rec);
+
+errout_with_lock:
+	preference_log_unlock();
+	PREFERENCE_FREE(path);
+
+	return ret;
+}
+
+int preference_check_key(int type, const char *key, bool *result)
+{
+	const char *name;
+	uint16_t keylen;
+	char *path;
+	int ret;
+
+	if (key == NULL || result == NULL || (type != PRIVATE_PREFERENCE && type != SHARED_PREFERENCE)) {
+		prefdbg("Invalid parameter\n");
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	ret = preference_log_get_path(type, key, &path);
+	if (ret < 0) {
+		return ret;
+	}
+	name = PREF_LOG_NAME(path);
+	keylen = strlen(name);
+
+	preference_log_lock();
+	ret = preference_log_load();
+	if (ret == OK) {
+		*result = preference_log_find(name, keylen, preference_log_hash(name, keylen)) != NULL;
+	}
+	preference_log_unlock();
+	PREFERENCE_FREE(path);
+
+	return ret;
+}
+
+int preference_remove_key(int type, const char *key)
+{
+	struct pref_log_entry_s *entry;
+	const char *name;
+	uint16_t keylen;
+	off_t offset;
+	char *path;
+	int ret;
+
+	if (key == NULL || (type != PRIVATE_PREFERENCE && type != SHARED_PREFERENCE)) {
+		prefdbg("Invalid parameter\n");
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	ret = preference_log_get_path(type, key, &path);
+	if (ret < 0) {
+		return ret;
+	}
+	name = PREF_LOG_NAME(path);
+	keylen = strlen(name);
+
+	preference_log_lock();
+	ret = preference_log_load();
+	if (ret < 0) {
+		goto errout_with_lock;
+	}
+
+	entry = preference_log_find(name, keylen, preference_log_hash(name, keylen));
+	if (entry == NULL) {
+		prefdbg("key is not exist : %s\n", name);
+		ret = PREFERENCE_KEY_NOT_EXIST;
+		goto errout_with_lock;
+	}
+
+	ret = preference_log_append(name, keylen, entry->type, NULL, PREF_LOG_REMOVED, &offset);
+	if (ret == OK) {
+		preference_log_unindex(entry);
+		g_pref_log.stale += PREF_LOG_RECSIZE(keylen, PREF_LOG_REMOVED);
+		prefvdbg("Removed key %s\n", name);
+		preference_log_try_compact();
+	}
+
+errout_with_lock:
+	preference_log_unlock();
+	PREFERENCE_FREE(path);
+
+	return ret;
+}
+
+/* Directories are not kept in the log, so removing all keys of a path which
+ * has none succeeds.
+ */
+int preference_remove_all_key(int type, const char *path)
+{
+	struct pref_log_entry_s *entry;
+	struct pref_log_entry_s *next;
+	const char *prefix;
+	size_t prefix_len;
+	char *dir_path;
+	off_t offset;
+	int ret;
+	int i;
+
+	if ((type != PRIVATE_PREFERENCE && type != SHARED_PREFERENCE) || (type == SHARED_PREFERENCE && path == NULL)) {
+		prefdbg("Invalid parameter\n");
+		return PREFERENCE_INVALID_PARAMETER;
+	}
+
+	/* Keys of the task group or of the shared path, without their subpaths */
+	if (type == PRIVATE_PREFERENCE) {
+		ret = preference_get_private_keypath("", &dir_path);
+		if (ret < 0) {
+			prefdbg("Failed to get preference path\n");
+			return ret;
+		}
+	} else {
+		ret = PREFERENCE_ASPRINTF(&dir_path, "%s/%s/", PREF_SHARED_PATH, path);
+		if (ret < 0) {
+			prefdbg("Failed to allocate path\n");
+			return PREFERENCE_OUT_OF_MEMORY;
+		}
+	}
+	prefix = PREF_LOG_NAME(dir_path);
+	prefix_len = strlen(prefix);
+	prefvdbg("preference dir = %s\n", prefix);
+
+	preference_log_lock();
+	ret = preference_log_load();
+	if (ret < 0) {
+		goto errout_with_lock;
+	}
+
+	for (i = 0; i < CONFIG_PREFERENCE_LOG_BUCKETS && ret == OK; i++) {
+		entry = (struct pref_log_entry_s *)sq_peek(&g_pref_log.buckets[i]);
+		while (entry != NULL) {
+			next = (struct pref_log_entry_s *)sq_next(entry);
+			if (entry->keylen > prefix_len && !strncmp(entry->name, prefix, prefix_len) && strchr(entry->name + prefix_len, '/') == NULL) {
+				ret = preference_log_append(entry->name, entry->keylen, entry->type, NULL, PREF_LOG_REMOVED, &offset);
+				if (ret < 0) {
+					prefdbg("Failed to remove key %s, %d\n", entry->name, ret);
+					break;
+				}
+				prefvdbg("Remove key : %s\n", entry->name);
+				g_pref_log.stale += PREF_LOG_RECSIZE(entry->keylen, PREF_LOG_REMOVED);
+				preference_log_unindex(entry);
+			}
+			entry = next;
+		}
+	}
+	preference_log_try_compact();
+
+errout_with_lock:
+	preference_log_unlock();
+	PREFERENCE_FREE(dir_path);
+
+	return ret;
+}
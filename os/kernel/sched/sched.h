@@ -366,10 +366,21 @@ bool sched_addreadytorun(FAR struct tcb_s *rtrtcb);
 bool sched_removereadytorun(FAR struct tcb_s *rtrtcb);
 bool sched_addprioritized(FAR struct tcb_s *newTcb, DSEG dq_queue_t *list);
 bool sched_mergepending(void);
+void sched_merge_prioritized(FAR dq_queue_t *list1, FAR dq_queue_t *list2, uint8_t task_state);
 void sched_addblocked(FAR struct tcb_s *btcb, tstate_t task_state);
 void sched_removeblocked(FAR struct tcb_s *btcb);
 int sched_setpriority(FAR struct tcb_s *tcb, int sched_priority);
 
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+bool sched_prioritymap_add(FAR struct tcb_s *tcb);
+void sched_prioritymap_setpriority(FAR struct tcb_s *tcb, uint8_t sched_priority);
+void sched_prioritymap_rebuild(void);
+void sched_removeprioritized(FAR struct tcb_s *tcb, DSEG dq_queue_t *list);
+#else
+#define sched_removeprioritized(tcb, list) \
+		dq_rem((FAR dq_entry_t *)(tcb), (list))
+#endif
+
 #ifdef CONFIG_SW_STACK_OVERFLOW_DETECTION
 void sched_checkstackoverflow(FAR struct tcb_s *rtcb);
 #endif
@@ -407,6 +418,18 @@ int  sched_pause_cpu(FAR struct tcb_s *tcb);
 #  define sched_islocked_global() spin_islocked(&g_cpu_schedlock)
 #  define sched_islocked_tcb(tcb) sched_islocked_global()
 
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+int  sched_runqueue_selectcpu(FAR struct tcb_s *tcb);
+void sched_runqueue_setcpu(FAR struct tcb_s *tcb, int cpu);
+void sched_runqueue_leave(FAR struct tcb_s *tcb);
+bool sched_runqueue_addhot(FAR struct tcb_s *tcb);
+FAR struct tcb_s *sched_runqueue_steal(int cpu, FAR struct tcb_s *ntcb);
+void sched_runqueue_take(FAR struct tcb_s *tcb, int cpu);
+bool sched_runqueue_pushidle(FAR struct tcb_s *tcb);
+#else
+#  define sched_runqueue_setcpu(tcb, c) ((tcb)->cpu = (c))
+#endif
+
 #else
 #  define sched_select_cpu(a)     (0)
 #  define sched_pause_cpu(t)      (-38)  /* -ENOSYS */
@@ -119,6 +119,14 @@ bool sched_addprioritized(FAR struct tcb_s *tcb, DSEG dq_queue_t *list)
 	uint8_t sched_priority = tcb->sched_priority;
 	bool ret = false;
 
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+	/* The ready-to-run list is found through its priority map */
+
+	if (list == (FAR dq_queue_t *)&g_readytorun) {
+		return sched_prioritymap_add(tcb);
+	}
+#endif
+
 	/* Lets do a sanity check before we get started. */
 
 	ASSERT(sched_priority >= SCHED_PRIORITY_MIN);
@@ -169,6 +169,9 @@ bool sched_addreadytorun(FAR struct tcb_s *btcb)
 {
 	FAR struct tcb_s *rtcb = this_task();
 	FAR dq_queue_t *tasklist;
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+	FAR struct tcb_s *preempted = NULL;
+#endif
 	bool switched;
 	bool doswitch;
 	int task_state;
@@ -188,7 +191,11 @@ bool sched_addreadytorun(FAR struct tcb_s *btcb)
 		 * (possibly its IDLE task).
 		 */
 
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+		cpu = sched_runqueue_selectcpu(btcb);
+#else
 		cpu = sched_select_cpu(btcb->affinity);
+#endif
 	}
 
 	/* Get the task currently running on the CPU (may be the IDLE task) */
@@ -247,9 +254,16 @@ bool sched_addreadytorun(FAR struct tcb_s *btcb)
 		 *
 		 * Add the task to the ready-to-run (but not running) task list
 		 */
-		sched_addprioritized(btcb, (FAR dq_queue_t *)&g_readytorun);
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+		/* Unless it is still cache hot on this CPU, then it is queued here */
+
+		if (!sched_runqueue_addhot(btcb))
+#endif
+		{
+			sched_addprioritized(btcb, (FAR dq_queue_t *)&g_readytorun);
+			btcb->task_state = TSTATE_TASK_READYTORUN;
+		}
 
-		btcb->task_state = TSTATE_TASK_READYTORUN;
 		doswitch = false;
 	} else {
 		/* (task_state == TSTATE_TASK_ASSIGNED || task_state == TSTATE_TASK_RUNNING) */
@@ -282,7 +296,7 @@ bool sched_addreadytorun(FAR struct tcb_s *btcb)
 
 			DEBUGASSERT(task_state == TSTATE_TASK_RUNNING);
 
-			btcb->cpu = cpu;
+			sched_runqueue_setcpu(btcb, cpu);
 			btcb->task_state = TSTATE_TASK_RUNNING;
 
 			/* Adjust global pre-emption controls.  If the lockcount is
@@ -314,7 +328,19 @@ bool sched_addreadytorun(FAR struct tcb_s *btcb)
 			if ((next->flags & TCB_FLAG_CPU_LOCKED) != 0) {
 				DEBUGASSERT(next->cpu == cpu);
 				next->task_state = TSTATE_TASK_ASSIGNED;
-			} else {
+			}
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+			else if (!sched_islocked_global()) {
+				/* Keep the preempted task queued on the CPU which has its
+				 * data in cache.  Another CPU may steal it.
+				 */
+
+				sched_runqueue_leave(next);
+				next->task_state = TSTATE_TASK_ASSIGNED;
+				preempted = next;
+			}
+#endif
+			else {
 				/* Remove the task from the assigned task list */
 
 				dq_rem((FAR dq_entry_t *)next, tasklist);
@@ -349,7 +375,7 @@ bool sched_addreadytorun(FAR struct tcb_s *btcb)
 
 			DEBUGASSERT(task_state == TSTATE_TASK_ASSIGNED);
 
-			btcb->cpu = cpu;
+			sched_runqueue_setcpu(btcb, cpu);
 			btcb->task_state = TSTATE_TASK_ASSIGNED;
 	        }
 
@@ -359,6 +385,16 @@ bool sched_addreadytorun(FAR struct tcb_s *btcb)
 			DEBUGVERIFY(up_cpu_resume(cpu));
 			doswitch = false;
 		}
+
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+		/* The preempted task may rather run at once on an idle CPU, which
+		 * may be this one.
+		 */
+
+		if (preempted != NULL && sched_runqueue_pushidle(preempted)) {
+			doswitch = true;
+		}
+#endif
 	}
 
 	return doswitch;
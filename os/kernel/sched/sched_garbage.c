@@ -206,4 +206,10 @@ void sched_garbagecollection(void)
 	/* Handle deferred dealloctions for the user heap */
 
 	sched_kucleanup();
+
+#ifdef CONFIG_MM_SMALL_CACHE
+	/* Give the cached small blocks back if memory runs low */
+
+	umm_cache_reclaim();
+#endif
 }
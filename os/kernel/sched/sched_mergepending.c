@@ -115,7 +115,32 @@
  *
  ************************************************************************/
 
-#ifndef CONFIG_SMP
+#if !defined(CONFIG_SMP) && defined(CONFIG_SCHED_READYTORUN_BITMAP)
+bool sched_mergepending(void)
+{
+	FAR struct tcb_s *pndtcb;
+	bool ret = false;
+
+	/* Each pending TCB finds its place through the priority map, so the
+	 * g_readytorun list is not walked.
+	 */
+
+	while ((pndtcb = (FAR struct tcb_s *)dq_remfirst((FAR dq_queue_t *)&g_pendingtasks)) != NULL) {
+		if (sched_prioritymap_add(pndtcb)) {
+			/* Special case: pndtcb was inserted at the head of the list */
+
+			pndtcb->flink->task_state = TSTATE_TASK_READYTORUN;
+			pndtcb->task_state = TSTATE_TASK_RUNNING;
+			ret = true;
+		} else {
+			pndtcb->task_state = TSTATE_TASK_READYTORUN;
+		}
+	}
+
+	return ret;
+}
+
+#elif !defined(CONFIG_SMP)
 bool sched_mergepending(void)
 {
 	FAR struct tcb_s *pndtcb;
@@ -145,5 +145,10 @@ void sched_merge_prioritized(FAR dq_queue_t *list1, FAR dq_queue_t *list2,
 	while (tcb1 != NULL);
 
 out:
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+	if (list1 == (FAR dq_queue_t *)&g_readytorun || list2 == (FAR dq_queue_t *)&g_readytorun) {
+		sched_prioritymap_rebuild();
+	}
+#endif
 	return;
 }
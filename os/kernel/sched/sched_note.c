@@ -0,0 +1,776 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <semaphore.h>
+#include <errno.h>
+#include <assert.h>
+
+#include <arch/irq.h>
+#include <tinyara/arch.h>
+#include <tinyara/clock.h>
+#include <tinyara/sched.h>
+#include <tinyara/sched_note.h>
+#include <tinyara/note.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_BUFFER
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#if (CONFIG_SCHED_NOTE_BUFSIZE & (CONFIG_SCHED_NOTE_BUFSIZE - 1)) != 0
+#error "CONFIG_SCHED_NOTE_BUFSIZE must be a power of two"
+#endif
+
+#define NOTE_BUFMASK            (CONFIG_SCHED_NOTE_BUFSIZE - 1)
+
+/* The reader on one CPU must see the bytes of a note before the head index
+ * which publishes them, and the writer must not reuse bytes before the tail
+ * index which frees them.
+ */
+
+#define NOTE_BARRIER()          __sync_synchronize()
+
+/* Longest text of a dump note.  The whole note must fit in nc_length. */
+
+#define NOTE_STRING_MAX         64
+
+/* Kinds of notes which can be switched on and off */
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SWITCH
+#define NOTE_MODE_SWITCH        NOTE_FILTER_MODE_FLAG_SWITCH
+#else
+#define NOTE_MODE_SWITCH        0
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SYSCALL
+#define NOTE_MODE_SYSCALL       NOTE_FILTER_MODE_FLAG_SYSCALL
+#else
+#define NOTE_MODE_SYSCALL       0
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_IRQHANDLER
+#define NOTE_MODE_IRQ           NOTE_FILTER_MODE_FLAG_IRQ
+#else
+#define NOTE_MODE_IRQ           0
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_DUMP
+#define NOTE_MODE_DUMP          NOTE_FILTER_MODE_FLAG_DUMP
+#else
+#define NOTE_MODE_DUMP          0
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+#define NOTE_MODE_SEMAPHORE     NOTE_FILTER_MODE_FLAG_SEMAPHORE
+#else
+#define NOTE_MODE_SEMAPHORE     0
+#endif
+
+#define NOTE_MODE_EVENTS        (NOTE_MODE_SWITCH | NOTE_MODE_SYSCALL | NOTE_MODE_IRQ | \
+				 NOTE_MODE_DUMP | NOTE_MODE_SEMAPHORE)
+
+#ifdef CONFIG_SCHED_NOTE_AUTOSTART
+#define NOTE_MODE_INITIAL       (NOTE_FILTER_MODE_FLAG_ENABLE | NOTE_MODE_EVENTS)
+#else
+#define NOTE_MODE_INITIAL       NOTE_MODE_EVENTS
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The note buffer of one CPU.  head and tail run freely and are reduced to
+ * an offset in buffer[] on use, so head - tail is the number of bytes held.
+ * Only the owning CPU moves head, with its interrupts disabled, and only the
+ * reader moves tail, so neither needs a lock.
+ */
+
+struct note_ring_s {
+	volatile uint32_t head;		/* Index where the next note is written */
+	volatile uint32_t tail;		/* Index of the oldest note not yet read */
+	volatile uint32_t dropped;	/* Count of notes which did not fit */
+	uint8_t buffer[CONFIG_SCHED_NOTE_BUFSIZE];
+};
+
+/* A NOTE_START note with room for the whole task name */
+
+struct note_startalloc_s {
+	struct note_common_s nsa_cmn;
+#if CONFIG_TASK_NAME_SIZE > 0
+	char nsa_name[CONFIG_TASK_NAME_SIZE + 1];
+#endif
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct note_ring_s g_note_ring[CONFIG_SMP_NCPUS];
+
+/* Value of dropped at the last sched_note_clear() */
+
+static uint32_t g_note_dropbase[CONFIG_SMP_NCPUS];
+
+static volatile unsigned int g_note_mode = NOTE_MODE_INITIAL;
+
+/* Serializes the readers of the note buffers */
+
+static sem_t g_note_readsem = SEM_INITIALIZER(1);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Notes hold multi-byte values as little-endian byte arrays */
+
+static void note_flatten(FAR uint8_t *dst, FAR const void *src, size_t len)
+{
+#ifdef CONFIG_ENDIAN_BIG
+	FAR const uint8_t *end = (FAR const uint8_t *)src + len - 1;
+
+	while (len-- > 0) {
+		*dst++ = *end--;
+	}
+#else
+	memcpy(dst, src, len);
+#endif
+}
+
+/* Up to 64 bits, so that a 64-bit time_t keeps its upper bytes */
+
+static uint64_t note_unflatten(FAR const uint8_t *src, size_t len)
+{
+	uint64_t value = 0;
+
+	while (len-- > 0) {
+		value = (value << 8) | src[len];
+	}
+
+	return value;
+}
+
+static inline bool note_isenabled(unsigned int flag)
+{
+	unsigned int mode = g_note_mode;
+
+	return (mode & NOTE_FILTER_MODE_FLAG_ENABLE) != 0 && (mode & flag) == flag;
+}
+
+/* Fill the parts of the common header which describe the task.  The CPU
+ * and the time are filled by note_add().
+ */
+
+static void note_common(FAR struct tcb_s *tcb, FAR struct note_common_s *note, size_t length, uint8_t type)
+{
+	pid_t pid = 0;
+
+	DEBUGASSERT(length <= UINT8_MAX);
+
+	note->nc_length = (uint8_t)length;
+	note->nc_type = type;
+	note->nc_priority = 0;
+	if (tcb != NULL) {
+		note->nc_priority = tcb->sched_priority;
+		pid = tcb->pid;
+	}
+
+	note_flatten(note->nc_pid, &pid, sizeof(pid_t));
+}
+
+static void note_copyin(FAR struct note_ring_s *ring, uint32_t index, FAR const uint8_t *src, size_t len)
+{
+	size_t offset = index & NOTE_BUFMASK;
+	size_t part = CONFIG_SCHED_NOTE_BUFSIZE - offset;
+
+	if (part > len) {
+		part = len;
+	}
+
+	memcpy(&ring->buffer[offset], src, part);
+	memcpy(ring->buffer, src + part, len - part);
+}
+
+static void note_copyout(FAR struct note_ring_s *ring, uint32_t index, FAR uint8_t *dst, size_t len)
+{
+	size_t offset = index & NOTE_BUFMASK;
+	size_t part = CONFIG_SCHED_NOTE_BUFSIZE - offset;
+
+	if (part > len) {
+		part = len;
+	}
+
+	memcpy(dst, &ring->buffer[offset], part);
+	memcpy(dst + part, ring->buffer, len - part);
+}
+
+/* Stamp the note and append it to the buffer of this CPU.  Interrupts stay
+ * disabled from the time stamp to the publication of the note, so the notes
+ * of one buffer are always in time order.
+ */
+
+static void note_add(FAR struct note_common_s *note)
+{
+	FAR struct note_ring_s *ring;
+	struct timespec ts;
+	irqstate_t flags;
+	uint32_t head;
+	int cpu;
+
+	flags = irqsave();
+
+	cpu = this_cpu();
+#ifdef CONFIG_SMP
+	note->nc_cpu = (uint8_t)cpu;
+#endif
+	(void)clock_systimespec(&ts);
+	note_flatten(note->nc_systime_sec, &ts.tv_sec, sizeof(time_t));
+	note_flatten(note->nc_systime_nsec, &ts.tv_nsec, sizeof(long));
+
+	ring = &g_note_ring[cpu];
+	head = ring->head;
+	if (CONFIG_SCHED_NOTE_BUFSIZE - (head - ring->tail) < note->nc_length) {
+		ring->dropped++;
+	} else {
+		note_copyin(ring, head, (FAR const uint8_t *)note, note->nc_length);
+		NOTE_BARRIER();
+		ring->head = head + note->nc_length;
+	}
+
+	irqrestore(flags);
+}
+
+static void note_start(FAR struct tcb_s *tcb, FAR void *arg)
+{
+	sched_note_start(tcb);
+}
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_DUMP
+static void note_string(uintptr_t ip, FAR const char *buf, size_t len)
+{
+	uint8_t data[SIZEOF_NOTE_STRING(NOTE_STRING_MAX)];
+	FAR struct note_string_s *note = (FAR struct note_string_s *)data;
+
+	if (len > NOTE_STRING_MAX) {
+		len = NOTE_STRING_MAX;
+	}
+
+	note_common(this_task(), &note->nst_cmn, SIZEOF_NOTE_STRING(len), NOTE_DUMP_STRING);
+	note_flatten(note->nst_ip, &ip, sizeof(uintptr_t));
+	memcpy(note->nst_data, buf, len);
+	note->nst_data[len] = '\0';
+	note_add(&note->nst_cmn);
+}
+
+static void note_binary(uintptr_t ip, uint8_t event, FAR const void *buf, size_t len)
+{
+	uint8_t data[SIZEOF_NOTE_BINARY(NOTE_STRING_MAX)];
+	FAR struct note_binary_s *note = (FAR struct note_binary_s *)data;
+
+	if (len > NOTE_STRING_MAX) {
+		len = NOTE_STRING_MAX;
+	}
+
+	note_common(this_task(), &note->nbi_cmn, SIZEOF_NOTE_BINARY(len), NOTE_DUMP_BINARY);
+	note_flatten(note->nbi_ip, &ip, sizeof(uintptr_t));
+	note->nbi_event = event;
+	memcpy(note->nbi_data, buf, len);
+	note_add(&note->nbi_cmn);
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sched_note_*
+ *
+ * Description:
+ *   Record one note in the buffer of this CPU, if recording is enabled and
+ *   the kind of the note is selected in the mode.
+ *
+ ****************************************************************************/
+
+void sched_note_start(FAR struct tcb_s *tcb)
+{
+	struct note_startalloc_s note;
+	size_t length = sizeof(struct note_common_s);
+
+	if (!note_isenabled(0)) {
+		return;
+	}
+
+#if CONFIG_TASK_NAME_SIZE > 0
+	strncpy(note.nsa_name, tcb->name, CONFIG_TASK_NAME_SIZE);
+	note.nsa_name[CONFIG_TASK_NAME_SIZE] = '\0';
+	length += strlen(note.nsa_name) + 1;
+#endif
+
+	note_common(tcb, &note.nsa_cmn, length, NOTE_START);
+	note_add(&note.nsa_cmn);
+}
+
+void sched_note_stop(FAR struct tcb_s *tcb)
+{
+	struct note_stop_s note;
+
+	if (!note_isenabled(0)) {
+		return;
+	}
+
+	note_common(tcb, &note.nsp_cmn, sizeof(struct note_stop_s), NOTE_STOP);
+	note_add(&note.nsp_cmn);
+}
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SWITCH
+void sched_note_suspend(FAR struct tcb_s *tcb)
+{
+	struct note_suspend_s note;
+
+	if (!note_isenabled(NOTE_MODE_SWITCH)) {
+		return;
+	}
+
+	note_common(tcb, &note.nsu_cmn, sizeof(struct note_suspend_s), NOTE_SUSPEND);
+	note.nsu_state = tcb->task_state;
+	note_add(&note.nsu_cmn);
+}
+
+void sched_note_resume(FAR struct tcb_s *tcb)
+{
+	struct note_resume_s note;
+
+	if (!note_isenabled(NOTE_MODE_SWITCH)) {
+		return;
+	}
+
+	note_common(tcb, &note.nre_cmn, sizeof(struct note_resume_s), NOTE_RESUME);
+	note_add(&note.nre_cmn);
+}
+#endif
+
+#ifdef CONFIG_SMP
+void sched_note_cpu_start(FAR struct tcb_s *tcb, int cpu)
+{
+	struct note_cpu_start_s note;
+
+	if (!note_isenabled(0)) {
+		return;
+	}
+
+	note_common(tcb, &note.ncs_cmn, sizeof(struct note_cpu_start_s), NOTE_CPU_START);
+	note.ncs_target = (uint8_t)cpu;
+	note_add(&note.ncs_cmn);
+}
+
+void sched_note_cpu_started(FAR struct tcb_s *tcb)
+{
+	struct note_cpu_started_s note;
+
+	if (!note_isenabled(0)) {
+		return;
+	}
+
+	note_common(tcb, &note.ncs_cmn, sizeof(struct note_cpu_started_s), NOTE_CPU_STARTED);
+	note_add(&note.ncs_cmn);
+}
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SWITCH
+void sched_note_cpu_pause(FAR struct tcb_s *tcb, int cpu)
+{
+	struct note_cpu_pause_s note;
+
+	if (!note_isenabled(NOTE_MODE_SWITCH)) {
+		return;
+	}
+
+	note_common(tcb, &note.ncp_cmn, sizeof(struct note_cpu_pause_s), NOTE_CPU_PAUSE);
+	note.ncp_target = (uint8_t)cpu;
+	note_add(&note.ncp_cmn);
+}
+
+void sched_note_cpu_paused(FAR struct tcb_s *tcb)
+{
+	struct note_cpu_paused_s note;
+
+	if (!note_isenabled(NOTE_MODE_SWITCH)) {
+		return;
+	}
+
+	note_common(tcb, &note.ncp_cmn, sizeof(struct note_cpu_paused_s), NOTE_CPU_PAUSED);
+	note_add(&note.ncp_cmn);
+}
+
+void sched_note_cpu_resume(FAR struct tcb_s *tcb, int cpu)
+{
+	struct note_cpu_resume_s note;
+
+	if (!note_isenabled(NOTE_MODE_SWITCH)) {
+		return;
+	}
+
+	note_common(tcb, &note.ncr_cmn, sizeof(struct note_cpu_resume_s), NOTE_CPU_RESUME);
+	note.ncr_target = (uint8_t)cpu;
+	note_add(&note.ncr_cmn);
+}
+
+void sched_note_cpu_resumed(FAR struct tcb_s *tcb)
+{
+	struct note_cpu_resumed_s note;
+
+	if (!note_isenabled(NOTE_MODE_SWITCH)) {
+		return;
+	}
+
+	note_common(tcb, &note.ncr_cmn, sizeof(struct note_cpu_resumed_s), NOTE_CPU_RESUMED);
+	note_add(&note.ncr_cmn);
+}
+#endif /* CONFIG_SCHED_INSTRUMENTATION_SWITCH */
+#endif /* CONFIG_SMP */
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_CSECTION
+void sched_note_csection(FAR struct tcb_s *tcb, bool enter)
+{
+	struct note_csection_s note;
+
+	if (!note_isenabled(0)) {
+		return;
+	}
+
+	note_common(tcb, &note.ncs_cmn, sizeof(struct note_csection_s), enter ? NOTE_CSECTION_ENTER : NOTE_CSECTION_LEAVE);
+#ifdef CONFIG_SMP
+	note_flatten(note.ncs_count, &tcb->irqcount, sizeof(note.ncs_count));
+#endif
+	note_add(&note.ncs_cmn);
+}
+#endif
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SPINLOCKS
+void sched_note_spinlock(FAR struct tcb_s *tcb, FAR volatile spinlock_t *spinlock, int type)
+{
+	struct note_spinlock_s note;
+	uintptr_t address = (uintptr_t)spinlock;
+
+	if (!note_isenabled(0)) {
+		return;
+	}
+
+	note_common(tcb, &note.nsp_cmn, sizeof(struct note_spinlock_s), (uint8_t)type);
+	note_flatten(note.nsp_spinlock, &address, sizeof(uintptr_t));
+	note.nsp_value = (uint8_t)*spinlock;
+	note_add(&note.nsp_cmn);
+}
+#endif
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SYSCALL
+void sched_note_syscall_enter(int nr, int argc, ...)
+{
+	struct note_syscall_enter_s note;
+	uintptr_t arg;
+	va_list ap;
+	int i;
+
+	if (!note_isenabled(NOTE_MODE_SYSCALL)) {
+		return;
+	}
+
+	if ((g_note_mode & NOTE_FILTER_MODE_FLAG_SYSCALL_ARGS) == 0) {
+		argc = 0;
+	} else if (argc > MAX_SYSCALL_ARGS) {
+		argc = MAX_SYSCALL_ARGS;
+	}
+
+	note_common(this_task(), &note.nsc_cmn, SIZEOF_NOTE_SYSCALL_ENTER(argc), NOTE_SYSCALL_ENTER);
+	note.nsc_nr = (uint8_t)nr;
+	note.nsc_argc = (uint8_t)argc;
+
+	va_start(ap, argc);
+	for (i = 0; i < argc; i++) {
+		arg = va_arg(ap, uintptr_t);
+		note_flatten(&note.nsc_args[i * sizeof(uintptr_t)], &arg, sizeof(uintptr_t));
+	}
+	va_end(ap);
+
+	note_add(&note.nsc_cmn);
+}
+
+void sched_note_syscall_leave(int nr, uintptr_t result)
+{
+	struct note_syscall_leave_s note;
+
+	if (!note_isenabled(NOTE_MODE_SYSCALL)) {
+		return;
+	}
+
+	note_common(this_task(), &note.nsc_cmn, sizeof(struct note_syscall_leave_s), NOTE_SYSCALL_LEAVE);
+	note.nsc_nr = (uint8_t)nr;
+	note_flatten(note.nsc_result, &result, sizeof(uintptr_t));
+	note_add(&note.nsc_cmn);
+}
+#endif
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_IRQHANDLER
+void sched_note_irqhandler(int irq, FAR void *handler, bool enter)
+{
+	struct note_irqhandler_s note;
+
+	if (!note_isenabled(NOTE_MODE_IRQ)) {
+		return;
+	}
+
+	note_common(this_task(), &note.nih_cmn, sizeof(struct note_irqhandler_s), enter ? NOTE_IRQ_ENTER : NOTE_IRQ_LEAVE);
+	note.nih_irq = (uint8_t)irq;
+	note_add(&note.nih_cmn);
+}
+#endif
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+void sched_note_semaphore(FAR struct tcb_s *tcb, FAR sem_t *sem, int type)
+{
+	struct note_sem_s note;
+	uintptr_t address = (uintptr_t)sem;
+	int16_t count = sem->semcount;
+
+	if (!note_isenabled(NOTE_MODE_SEMAPHORE)) {
+		return;
+	}
+
+	note_common(tcb, &note.nsm_cmn, sizeof(struct note_sem_s), (uint8_t)type);
+	note_flatten(note.nsm_sem, &address, sizeof(uintptr_t));
+	note_flatten(note.nsm_count, &count, sizeof(int16_t));
+	note_add(&note.nsm_cmn);
+}
+#endif
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_DUMP
+void sched_note_string_ip(uint32_t tag, uintptr_t ip, FAR const char *buf)
+{
+	if (!note_isenabled(NOTE_MODE_DUMP)) {
+		return;
+	}
+
+	note_string(ip, buf, strlen(buf));
+}
+
+void sched_note_dump_ip(uint32_t tag, uintptr_t ip, uint8_t event, FAR const void *buf, size_t len)
+{
+	if (!note_isenabled(NOTE_MODE_DUMP)) {
+		return;
+	}
+
+	note_binary(ip, event, buf, len);
+}
+
+void sched_note_vprintf_ip(uint32_t tag, uintptr_t ip, FAR const char *fmt, va_list va)
+{
+	char buf[NOTE_STRING_MAX + 1];
+	int len;
+
+	if (!note_isenabled(NOTE_MODE_DUMP)) {
+		return;
+	}
+
+	len = vsnprintf(buf, sizeof(buf), fmt, va);
+	if (len >= 0) {
+		note_string(ip, buf, len);
+	}
+}
+
+/* The arguments are not kept in binary form, the event carries the text */
+
+void sched_note_vbprintf_ip(uint32_t tag, uintptr_t ip, uint8_t event, FAR const char *fmt, va_list va)
+{
+	char buf[NOTE_STRING_MAX + 1];
+	int len;
+
+	if (!note_isenabled(NOTE_MODE_DUMP)) {
+		return;
+	}
+
+	len = vsnprintf(buf, sizeof(buf), fmt, va);
+	if (len >= 0) {
+		note_binary(ip, event, buf, len);
+	}
+}
+
+void sched_note_printf_ip(uint32_t tag, uintptr_t ip, FAR const char *fmt, ...)
+{
+	va_list va;
+
+	va_start(va, fmt);
+	sched_note_vprintf_ip(tag, ip, fmt, va);
+	va_end(va);
+}
+
+void sched_note_bprintf_ip(uint32_t tag, uintptr_t ip, uint8_t event, FAR const char *fmt, ...)
+{
+	va_list va;
+
+	va_start(va, fmt);
+	sched_note_vbprintf_ip(tag, ip, event, fmt, va);
+	va_end(va);
+}
+#endif /* CONFIG_SCHED_INSTRUMENTATION_DUMP */
+
+/****************************************************************************
+ * Name: sched_note_read
+ *
+ * Description:
+ *   Move as many whole notes as fit in buffer out of the note buffers.  Of
+ *   the oldest notes of all CPUs, the earliest one is taken each time, so
+ *   the notes come out in time order.
+ *
+ * Returned Value:
+ *   The number of bytes read, zero if there is no note to read, or -EINVAL
+ *   if buffer cannot hold the next note.
+ *
+ ****************************************************************************/
+
+ssize_t sched_note_read(FAR uint8_t *buffer, size_t buflen)
+{
+	struct note_common_s note;
+	FAR struct note_ring_s *ring;
+	FAR struct note_ring_s *oldest;
+	uint64_t oldest_time = 0;
+	uint64_t time;
+	uint32_t tail;
+	size_t length = 0;
+	ssize_t nread = 0;
+	int cpu;
+
+	while (sem_wait(&g_note_readsem) != OK) {
+		ASSERT(get_errno() == EINTR);
+	}
+
+	for (;;) {
+		oldest = NULL;
+		for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+			ring = &g_note_ring[cpu];
+			tail = ring->tail;
+			if (ring->head == tail) {
+				continue;
+			}
+
+			NOTE_BARRIER();
+			note_copyout(ring, tail, (FAR uint8_t *)&note, sizeof(struct note_common_s));
+			time = note_unflatten(note.nc_systime_sec, sizeof(time_t)) * NSEC_PER_SEC + note_unflatten(note.nc_systime_nsec, sizeof(long));
+			if (oldest == NULL || time < oldest_time) {
+				oldest = ring;
+				oldest_time = time;
+				length = note.nc_length;
+			}
+		}
+
+		if (oldest == NULL) {
+			break;
+		}
+
+		if (length > buflen - nread) {
+			if (nread == 0) {
+				nread = -EINVAL;
+			}
+			break;
+		}
+
+		note_copyout(oldest, oldest->tail, buffer + nread, length);
+		NOTE_BARRIER();
+		oldest->tail += length;
+		nread += length;
+	}
+
+	sem_post(&g_note_readsem);
+	return nread;
+}
+
+/****************************************************************************
+ * Name: sched_note_clear
+ *
+ * Description:
+ *   Discard all recorded notes and reset the dropped counts.
+ *
+ ****************************************************************************/
+
+void sched_note_clear(void)
+{
+	int cpu;
+
+	while (sem_wait(&g_note_readsem) != OK) {
+		ASSERT(get_errno() == EINTR);
+	}
+
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		g_note_ring[cpu].tail = g_note_ring[cpu].head;
+		g_note_dropbase[cpu] = g_note_ring[cpu].dropped;
+	}
+
+	sem_post(&g_note_readsem);
+}
+
+unsigned int sched_note_getmode(void)
+{
+	return g_note_mode;
+}
+
+/****************************************************************************
+ * Name: sched_note_setmode
+ *
+ * Description:
+ *   Set the NOTE_FILTER_MODE_FLAG_* mask.  When recording is switched on,
+ *   a NOTE_START note is recorded for each existing task, so that the trace
+ *   names the tasks which were created before.
+ *
+ ****************************************************************************/
+
+void sched_note_setmode(unsigned int mode)
+{
+	bool starting = (g_note_mode & NOTE_FILTER_MODE_FLAG_ENABLE) == 0 && (mode & NOTE_FILTER_MODE_FLAG_ENABLE) != 0;
+
+	g_note_mode = mode & (NOTE_FILTER_MODE_FLAG_ENABLE | NOTE_MODE_EVENTS
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SYSCALL
+			| NOTE_FILTER_MODE_FLAG_SYSCALL_ARGS
+#endif
+			);
+
+	if (starting) {
+		sched_foreach(note_start, NULL);
+	}
+}
+
+void sched_note_getstatus(FAR struct note_status_s *status)
+{
+	int cpu;
+
+	status->mode = g_note_mode;
+	status->bufsize = CONFIG_SCHED_NOTE_BUFSIZE;
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		status->used[cpu] = g_note_ring[cpu].head - g_note_ring[cpu].tail;
+		status->dropped[cpu] = g_note_ring[cpu].dropped - g_note_dropbase[cpu];
+	}
+}
+
+#endif /* CONFIG_SCHED_INSTRUMENTATION_BUFFER */
@@ -0,0 +1,252 @@
+/****************************************************************************
+ * kernel/sched/sched_prioritymap.c
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sched.h>
+#include <queue.h>
+#include <assert.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The g_readytorun list stays the one list that the rest of the OS walks,
+ * but it is kept as a run of FIFO queues, one per priority, from the
+ * highest priority to the lowest.  g_prio_tail[] gives the last TCB of each
+ * queue and g_prio_map[] has a bit for each non-empty queue.
+ *
+ * The bit of a priority is ordered so that CLZ on a word, masked to the
+ * priorities from a given one upward, gives the lowest non-empty priority
+ * which is not lower than the given one.
+ */
+
+#define PRIOMAP_NPRIO       (SCHED_PRIORITY_MAX + 1)
+#define PRIOMAP_NWORDS      ((PRIOMAP_NPRIO + 31) >> 5)
+#define PRIOMAP_WORD(p)     ((p) >> 5)
+#define PRIOMAP_BIT(p)      (0x80000000u >> ((p) & 31))
+
+/****************************************************************************
+ * Private Variables
+ ****************************************************************************/
+
+static FAR struct tcb_s *g_prio_tail[PRIOMAP_NPRIO];
+static uint32_t g_prio_map[PRIOMAP_NWORDS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: prioritymap_settail
+ *
+ * Description:
+ *   Make tcb the last TCB of the queue of its priority.
+ *
+ ****************************************************************************/
+
+static inline void prioritymap_settail(FAR struct tcb_s *tcb)
+{
+	uint8_t prio = tcb->sched_priority;
+
+	g_prio_tail[prio] = tcb;
+	g_prio_map[PRIOMAP_WORD(prio)] |= PRIOMAP_BIT(prio);
+}
+
+/****************************************************************************
+ * Name: prioritymap_unlink
+ *
+ * Description:
+ *   Drop tcb from the queue of its priority, before it leaves its place in
+ *   the g_readytorun list or changes its priority.
+ *
+ ****************************************************************************/
+
+static inline void prioritymap_unlink(FAR struct tcb_s *tcb)
+{
+	FAR struct tcb_s *prev;
+	uint8_t prio = tcb->sched_priority;
+
+	if (g_prio_tail[prio] == tcb) {
+		prev = (FAR struct tcb_s *)tcb->blink;
+		if (prev != NULL && prev->sched_priority == prio) {
+			g_prio_tail[prio] = prev;
+		} else {
+			g_prio_tail[prio] = NULL;
+			g_prio_map[PRIOMAP_WORD(prio)] &= ~PRIOMAP_BIT(prio);
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: prioritymap_after
+ *
+ * Description:
+ *   Find the TCB after which a TCB of priority prio goes: the last TCB of
+ *   the lowest non-empty queue with a priority not lower than prio.
+ *
+ * Return Value:
+ *   The TCB, or NULL if the new TCB goes at the head of the list.
+ *
+ ****************************************************************************/
+
+static inline FAR struct tcb_s *prioritymap_after(uint8_t prio)
+{
+	int word = PRIOMAP_WORD(prio);
+	uint32_t bits;
+
+	/* Keep the bits of prio and of the higher priorities in its word */
+
+	bits = g_prio_map[word] & (0xffffffffu >> (prio & 31));
+	while (bits == 0) {
+		if (++word >= PRIOMAP_NWORDS) {
+			return NULL;
+		}
+
+		bits = g_prio_map[word];
+	}
+
+	return g_prio_tail[(word << 5) + __builtin_clz(bits)];
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sched_prioritymap_add
+ *
+ * Description:
+ *   Add a TCB to the g_readytorun list, behind all TCBs of the same or a
+ *   higher priority, in constant time.
+ *
+ * Inputs:
+ *   tcb - Points to the TCB to add
+ *
+ * Return Value:
+ *   true if the head of the list has changed.
+ *
+ * Assumptions:
+ *   Same as sched_addprioritized().
+ *
+ ****************************************************************************/
+
+bool sched_prioritymap_add(FAR struct tcb_s *tcb)
+{
+	FAR struct tcb_s *prev;
+	bool ret = false;
+
+	ASSERT(tcb->sched_priority >= SCHED_PRIORITY_MIN);
+
+	prev = prioritymap_after(tcb->sched_priority);
+	if (prev == NULL) {
+		dq_addfirst((FAR dq_entry_t *)tcb, (FAR dq_queue_t *)&g_readytorun);
+		ret = true;
+	} else {
+		dq_addafter((FAR dq_entry_t *)prev, (FAR dq_entry_t *)tcb, (FAR dq_queue_t *)&g_readytorun);
+	}
+
+	prioritymap_settail(tcb);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: sched_prioritymap_setpriority
+ *
+ * Description:
+ *   Change the priority of a TCB of the g_readytorun list which keeps its
+ *   place, like the running task raised above the next task.
+ *
+ ****************************************************************************/
+
+void sched_prioritymap_setpriority(FAR struct tcb_s *tcb, uint8_t sched_priority)
+{
+	FAR struct tcb_s *next;
+
+	prioritymap_unlink(tcb);
+	tcb->sched_priority = sched_priority;
+
+	next = (FAR struct tcb_s *)tcb->flink;
+	if (next == NULL || next->sched_priority != sched_priority) {
+		prioritymap_settail(tcb);
+	}
+}
+
+/****************************************************************************
+ * Name: sched_prioritymap_rebuild
+ *
+ * Description:
+ *   Rebuild the queues from the g_readytorun list after it was changed as a
+ *   whole, like by sched_merge_prioritized().
+ *
+ ****************************************************************************/
+
+void sched_prioritymap_rebuild(void)
+{
+	FAR struct tcb_s *tcb;
+	int i;
+
+	for (i = 0; i < PRIOMAP_NWORDS; i++) {
+		g_prio_map[i] = 0;
+	}
+
+	for (i = 0; i < PRIOMAP_NPRIO; i++) {
+		g_prio_tail[i] = NULL;
+	}
+
+	/* The last TCB of each priority is left as the tail */
+
+	for (tcb = (FAR struct tcb_s *)g_readytorun.head; tcb != NULL; tcb = (FAR struct tcb_s *)tcb->flink) {
+		prioritymap_settail(tcb);
+	}
+}
+
+/****************************************************************************
+ * Name: sched_removeprioritized
+ *
+ * Description:
+ *   Remove a TCB from a task list.  Removing from the g_readytorun list
+ *   keeps its queues.
+ *
+ * Inputs:
+ *   tcb - Points to the TCB to remove
+ *   list - Points to the task list holding tcb
+ *
+ ****************************************************************************/
+
+void sched_removeprioritized(FAR struct tcb_s *tcb, DSEG dq_queue_t *list)
+{
+	if (list == (FAR dq_queue_t *)&g_readytorun) {
+		prioritymap_unlink(tcb);
+	}
+
+	dq_rem((FAR dq_entry_t *)tcb, list);
+}
+
+#endif /* CONFIG_SCHED_READYTORUN_BITMAP */
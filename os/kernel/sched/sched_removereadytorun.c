@@ -138,7 +138,7 @@ bool sched_removereadytorun(FAR struct tcb_s *rtcb)
 
 	/* Remove the TCB from the ready-to-run list */
 
-	dq_rem((FAR dq_entry_t *)rtcb, tasklist);
+	sched_removeprioritized(rtcb, tasklist);
 
 	/* Since the TCB is not in any list, it is now invalid */
 
@@ -191,6 +191,10 @@ bool sched_removereadytorun(FAR struct tcb_s *rtcb)
 		ntcb = (FAR struct tcb_s *)rtcb->flink;
 		DEBUGASSERT(ntcb != NULL);
 
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+		sched_runqueue_leave(rtcb);
+#endif
+
 		/* If we are modifying the head of some assigned task list other
 		 * than our own, we will need to stop that CPU.
 		 */
@@ -206,7 +210,7 @@ bool sched_removereadytorun(FAR struct tcb_s *rtcb)
 		 * or the g_assignedtasks[cpu] list.
 		 */
 
-		dq_rem((FAR dq_entry_t *)rtcb, tasklist);
+		sched_removeprioritized(rtcb, tasklist);
 
 		/* Which task will go at the head of the list? It will either be
 		 * the next tcb in the assigned task list (ntcb) or a TCB in the
@@ -228,6 +232,25 @@ bool sched_removereadytorun(FAR struct tcb_s *rtcb)
 					rtrtcb = (FAR struct tcb_s *)rtrtcb->flink);
 		}
 
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+		/* A task queued on another CPU may have to run here instead of both,
+		 * like when this CPU would go idle.
+		 */
+
+		if (!sched_islocked_global() && !irq_cpu_locked(current_cpu)) {
+			FAR struct tcb_s *stcb;
+
+			stcb = sched_runqueue_steal(cpu, (rtrtcb != NULL && rtrtcb->sched_priority >= ntcb->sched_priority) ? rtrtcb : ntcb);
+			if (stcb != NULL) {
+				sched_runqueue_take(stcb, cpu);
+				dq_addfirst((FAR dq_entry_t *)stcb, tasklist);
+				sched_runqueue_setcpu(stcb, cpu);
+				ntcb = stcb;
+				rtrtcb = NULL;
+			}
+		}
+
+#endif
 		/* Did we find a task in the g_readytorun list?  Which task should
 		 * we use?  We decide strictly by the priority of the two tasks:
 		 * Either (1) the task currently at the head of the
@@ -242,9 +265,9 @@ bool sched_removereadytorun(FAR struct tcb_s *rtcb)
 			 * g_assignedtasks[cpu] list.
 			 */
 
-			dq_rem((FAR dq_entry_t *)rtrtcb, (FAR dq_queue_t *)&g_readytorun);
+			sched_removeprioritized(rtrtcb, (FAR dq_queue_t *)&g_readytorun);
 			dq_addfirst((FAR dq_entry_t *)rtrtcb, tasklist);
-			rtrtcb->cpu = cpu;
+			sched_runqueue_setcpu(rtrtcb, cpu);
 			ntcb = rtrtcb;
 		}
 
@@ -286,7 +309,7 @@ bool sched_removereadytorun(FAR struct tcb_s *rtcb)
 		 * g_assignedtasks[cpu] list.
 		 */
 
-		dq_rem((FAR dq_entry_t *)rtcb, tasklist);
+		sched_removeprioritized(rtcb, tasklist);
 	}
 
 	/* Since the TCB is no longer in any list, it is now invalid */
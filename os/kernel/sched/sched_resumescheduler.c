@@ -28,7 +28,6 @@
 
 #include <tinyara/sched.h>
 #include <tinyara/clock.h>
-#include <tinyara/sched_note.h>
 
 #include "irq/irq.h"
 #include "sched/sched.h"
@@ -70,9 +69,10 @@ void sched_resume_scheduler(FAR struct tcb_s *tcb)
 #ifdef CONFIG_SCHED_CRITMONITOR
 	sched_resume_critmon(tcb);
 #endif
-#ifdef CONFIG_SCHED_INSTRUMENTATION
-	sched_note_resume(tcb);
-#endif
+
+	/* The switch note is recorded by up_restoretask(), which every
+	 * context switch goes through.
+	 */
 }
 
 #endif							/* CONFIG_RR_INTERVAL > 0 || CONFIG_SCHED_RESUMESCHEDULER */
@@ -0,0 +1,344 @@
+/****************************************************************************
+ * kernel/sched/sched_runqueue.c
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sched.h>
+#include <queue.h>
+#include <assert.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/clock.h>
+#include <tinyara/irq.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The g_assignedtasks[] list of a CPU is its run queue.  Besides the tasks
+ * locked to the CPU, it holds the tasks which last ran on the CPU and are
+ * likely to still have their data in its cache: the task preempted there
+ * and the task woken on the CPU shortly after it ran there.  The shared
+ * g_readytorun list holds the other ready-to-run tasks.
+ *
+ * This only changes where the tasks are placed.  All the lists are changed
+ * in the critical section, like without the run queues, so there is no
+ * lock of a run queue and no lock order: the steal and the push to an idle
+ * CPU rely on the critical section held by their callers.
+ */
+
+#define IMPOSSIBLE_CPU           0xff
+
+/* The idle task is the only task at the end of a run queue */
+
+#define RUNQUEUE_ISIDLE(tcb)     ((tcb)->flink == NULL)
+
+/****************************************************************************
+ * Private Variables
+ ****************************************************************************/
+
+static uint32_t g_runqueue_migrations[CONFIG_SMP_NCPUS];
+static uint32_t g_runqueue_steals[CONFIG_SMP_NCPUS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static inline bool runqueue_canrun(FAR struct tcb_s *tcb, int cpu)
+{
+	return CPU_ISSET(cpu, &tcb->affinity) && CPU_ISSET(cpu, &g_active_cpus_mask);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sched_runqueue_selectcpu
+ *
+ * Description:
+ *   Like sched_select_cpu(), find the CPU running the lowest priority task
+ *   among the CPUs tcb may run on.  When several CPUs run tasks of that
+ *   priority, like several idle CPUs, the last CPU of tcb is taken so that
+ *   the task keeps its cache.
+ *
+ ****************************************************************************/
+
+int sched_runqueue_selectcpu(FAR struct tcb_s *tcb)
+{
+	FAR struct tcb_s *rtcb;
+	cpu_set_t eligible;
+	int minprio = SCHED_PRIORITY_MAX + 1;
+	int cpu = IMPOSSIBLE_CPU;
+	int prio;
+	int i;
+
+	CPU_AND(&eligible, &tcb->affinity, &g_active_cpus_mask);
+	if (eligible == 0) {
+		eligible = g_active_cpus_mask;
+	}
+
+	for (i = 0; i < CONFIG_SMP_NCPUS; i++) {
+		if ((eligible & (1 << i)) == 0) {
+			continue;
+		}
+
+		rtcb = (FAR struct tcb_s *)g_assignedtasks[i].head;
+		prio = RUNQUEUE_ISIDLE(rtcb) ? 0 : rtcb->sched_priority;
+		if (prio < minprio || (prio == minprio && i == tcb->cpu)) {
+			minprio = prio;
+			cpu = i;
+		}
+	}
+
+	DEBUGASSERT(cpu != IMPOSSIBLE_CPU);
+	return cpu;
+}
+
+/****************************************************************************
+ * Name: sched_runqueue_setcpu
+ *
+ * Description:
+ *   Assign tcb to a CPU, counting a migration if it last ran on another.
+ *
+ ****************************************************************************/
+
+void sched_runqueue_setcpu(FAR struct tcb_s *tcb, int cpu)
+{
+	if (tcb->cpu != cpu) {
+		g_runqueue_migrations[cpu]++;
+		tcb->cpu = cpu;
+	}
+}
+
+/****************************************************************************
+ * Name: sched_runqueue_leave
+ *
+ * Description:
+ *   Record that tcb stops running on its CPU, from which time its data
+ *   is left to age in the cache of that CPU.
+ *
+ ****************************************************************************/
+
+void sched_runqueue_leave(FAR struct tcb_s *tcb)
+{
+	tcb->lastrun = clock_systimer();
+}
+
+/****************************************************************************
+ * Name: sched_runqueue_addhot
+ *
+ * Description:
+ *   Queue a woken task which cannot run at once on the run queue of this
+ *   CPU, if it left this CPU within CONFIG_SCHED_CACHEHOT_TICKS.  Queuing on
+ *   the CPU doing the wakeup needs no pause of another CPU.
+ *
+ * Return Value:
+ *   true if tcb was queued, false if it is left to the caller.
+ *
+ ****************************************************************************/
+
+bool sched_runqueue_addhot(FAR struct tcb_s *tcb)
+{
+	int me = this_cpu();
+
+	if (tcb->cpu != me || !runqueue_canrun(tcb, me)) {
+		return false;
+	}
+
+	if ((clock_t)(clock_systimer() - tcb->lastrun) > CONFIG_SCHED_CACHEHOT_TICKS) {
+		return false;
+	}
+
+	/* The caller found no CPU running a lower priority task, so that tcb
+	 * goes behind the running task of this CPU.
+	 */
+
+	ASSERT(!sched_addprioritized(tcb, (FAR dq_queue_t *)&g_assignedtasks[me]));
+	tcb->task_state = TSTATE_TASK_ASSIGNED;
+	return true;
+}
+
+/****************************************************************************
+ * Name: sched_runqueue_steal
+ *
+ * Description:
+ *   Find a task queued on another CPU which should run on cpu instead of
+ *   ntcb: one of a higher priority, or one of the same priority which waits
+ *   behind a higher priority task on its own CPU.  A task of the same
+ *   priority as the running task of its CPU is left there to keep its
+ *   cache.  Among the candidates of the highest priority, the one of the
+ *   busiest CPU is taken.
+ *
+ * Inputs:
+ *   cpu - The CPU picking its next task
+ *   ntcb - The task the CPU would run otherwise
+ *
+ * Return Value:
+ *   The TCB to steal, still in its run queue, or NULL.
+ *
+ * Assumptions:
+ *   The caller is in the critical section, which keeps the queues of the
+ *   other CPUs stable during the walk and until sched_runqueue_take().
+ *
+ ****************************************************************************/
+
+FAR struct tcb_s *sched_runqueue_steal(int cpu, FAR struct tcb_s *ntcb)
+{
+	FAR struct tcb_s *rtcb;
+	FAR struct tcb_s *tcb;
+	FAR struct tcb_s *cand;
+	FAR struct tcb_s *best = NULL;
+	int bestlen = 0;
+	int len;
+	int i;
+
+	for (i = 0; i < CONFIG_SMP_NCPUS; i++) {
+		if (i == cpu || !CPU_ISSET(i, &g_active_cpus_mask)) {
+			continue;
+		}
+
+		/* The queue is sorted by priority, so the first task which may run
+		 * on cpu is the candidate of this CPU.  The walk goes on only to
+		 * count the queued tasks, the idle task left out.
+		 */
+
+		rtcb = (FAR struct tcb_s *)g_assignedtasks[i].head;
+		cand = NULL;
+		len = 0;
+		for (tcb = rtcb->flink; tcb != NULL && !RUNQUEUE_ISIDLE(tcb); tcb = tcb->flink) {
+			if (cand == NULL && (tcb->flags & TCB_FLAG_CPU_LOCKED) == 0 && CPU_ISSET(cpu, &tcb->affinity)) {
+				cand = tcb;
+			}
+			len++;
+		}
+
+		if (cand == NULL || cand->sched_priority < ntcb->sched_priority) {
+			continue;
+		}
+
+		if (cand->sched_priority == ntcb->sched_priority && rtcb->sched_priority <= cand->sched_priority) {
+			continue;
+		}
+
+		if (best == NULL || cand->sched_priority > best->sched_priority || (cand->sched_priority == best->sched_priority && len > bestlen)) {
+			best = cand;
+			bestlen = len;
+		}
+	}
+
+	return best;
+}
+
+/****************************************************************************
+ * Name: sched_runqueue_take
+ *
+ * Description:
+ *   Remove a TCB found by sched_runqueue_steal() from its run queue.  The
+ *   caller adds it to the list of cpu.
+ *
+ ****************************************************************************/
+
+void sched_runqueue_take(FAR struct tcb_s *tcb, int cpu)
+{
+	dq_rem((FAR dq_entry_t *)tcb, (FAR dq_queue_t *)&g_assignedtasks[tcb->cpu]);
+	g_runqueue_steals[cpu]++;
+}
+
+/****************************************************************************
+ * Name: sched_runqueue_pushidle
+ *
+ * Description:
+ *   Start a task just preempted on its CPU on an idle CPU, if one may run
+ *   it.  Otherwise the task waits in its run queue for its CPU or for a
+ *   CPU to steal it.
+ *
+ * Return Value:
+ *   true if the task runs on this CPU now, a context switch is needed.
+ *
+ ****************************************************************************/
+
+bool sched_runqueue_pushidle(FAR struct tcb_s *tcb)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_SMP_NCPUS; i++) {
+		if (i != tcb->cpu && runqueue_canrun(tcb, i) && RUNQUEUE_ISIDLE((FAR struct tcb_s *)g_assignedtasks[i].head)) {
+			break;
+		}
+	}
+
+	if (i == CONFIG_SMP_NCPUS) {
+		return false;
+	}
+
+	/* sched_addreadytorun() selects the idle CPU found, or another one gone
+	 * idle meanwhile.
+	 */
+
+	ASSERT(!sched_removereadytorun(tcb));
+	return sched_addreadytorun(tcb);
+}
+
+/****************************************************************************
+ * Name: sched_runqueue_getstatus
+ *
+ * Description:
+ *   Get the length of the run queues and the migration counters.
+ *
+ ****************************************************************************/
+
+void sched_runqueue_getstatus(FAR struct runqueue_status_s *status)
+{
+	FAR struct tcb_s *tcb;
+	irqstate_t flags;
+	int i;
+
+	flags = enter_critical_section();
+
+	status->nshared = 0;
+	for (tcb = (FAR struct tcb_s *)g_readytorun.head; tcb != NULL; tcb = tcb->flink) {
+		status->nshared++;
+	}
+
+	for (i = 0; i < CONFIG_SMP_NCPUS; i++) {
+		status->nqueued[i] = 0;
+		tcb = (FAR struct tcb_s *)g_assignedtasks[i].head;
+		for (tcb = tcb->flink; tcb != NULL && !RUNQUEUE_ISIDLE(tcb); tcb = tcb->flink) {
+			status->nqueued[i]++;
+		}
+
+		status->nmigrations[i] = g_runqueue_migrations[i];
+		status->nsteals[i] = g_runqueue_steals[i];
+	}
+
+	leave_critical_section(flags);
+}
+
+#endif /* CONFIG_SCHED_CPU_RUNQUEUE */
@@ -87,6 +87,26 @@
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: sched_setrunningpriority
+ *
+ * Description:
+ *   Change the priority of the running task, which keeps its place at the
+ *   head of its task list.
+ *
+ ****************************************************************************/
+
+static inline void sched_setrunningpriority(FAR struct tcb_s *tcb, uint8_t sched_priority)
+{
+#if defined(CONFIG_SCHED_READYTORUN_BITMAP) && !defined(CONFIG_SMP)
+	/* The running task is in the g_readytorun list */
+
+	sched_prioritymap_setpriority(tcb, sched_priority);
+#else
+	tcb->sched_priority = sched_priority;
+#endif
+}
+
 /****************************************************************************
  * Name: sched_nexttcb
  *
@@ -127,12 +147,23 @@ static FAR struct tcb_s *sched_nexttcb(FAR struct tcb_s *tcb)
 		 */
 
 		if (rtrtcb != NULL && rtrtcb->sched_priority >= ntcb->sched_priority) {
-			return rtrtcb;
+			ntcb = rtrtcb;
+		}
+
+#ifdef CONFIG_SCHED_CPU_RUNQUEUE
+		/* Or a task queued on another CPU, as sched_removereadytorun()
+		 * would steal it.
+		 */
+
+		rtrtcb = sched_runqueue_steal(tcb->cpu, ntcb);
+		if (rtrtcb != NULL) {
+			ntcb = rtrtcb;
 		}
+#endif
 	}
 
 	/* Otherwise, return the next TCB in g_assignedtasks[] list... which is
-	 * probably the TCB of the IDLE thread.
+	 * probably the TCB of the IDLE thread, or a task queued on this CPU.
 	 * REVISIT: What if it is not the IDLE thread?
 	 */
 
@@ -236,7 +267,7 @@ int sched_setpriority(FAR struct tcb_s *tcb, int sched_priority)
 				} while (sched_priority < ntcb->sched_priority);
 
 				/* Change the task priority */
-				tcb->sched_priority = (uint8_t)sched_priority;
+				sched_setrunningpriority(tcb, (uint8_t)sched_priority);
 
 			} else {
 				up_reprioritize_rtr(tcb, (uint8_t)sched_priority);
@@ -248,7 +279,7 @@ int sched_setpriority(FAR struct tcb_s *tcb, int sched_priority)
 		else {
 			/* Change the task priority */
 
-			tcb->sched_priority = (uint8_t)sched_priority;
+			sched_setrunningpriority(tcb, (uint8_t)sched_priority);
 		}
 		break;
 
@@ -268,7 +299,11 @@ int sched_setpriority(FAR struct tcb_s *tcb, int sched_priority)
 		 * scheduled to run on any CPU
 		 */
 
-		if (tcb->task_state == TSTATE_TASK_READYTORUN) {
+		if (tcb->task_state == TSTATE_TASK_READYTORUN || (tcb->flags & TCB_FLAG_CPU_LOCKED) == 0) {
+			/* Tasks queued on a CPU by CONFIG_SCHED_CPU_RUNQUEUE are not
+			 * locked to it either.
+			 */
+
 			cpu = sched_select_cpu(tcb->affinity);
 		} else {
 			/* CASE 2b. The task is ready to run, and assigned to a 
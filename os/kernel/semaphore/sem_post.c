@@ -67,6 +67,9 @@
 #include "sched/sched.h"
 #include "semaphore/semaphore.h"
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+#include <tinyara/sched_note.h>
+#endif
 #ifdef CONFIG_SEMAPHORE_HISTORY
 #include <tinyara/debug/sysdbg.h>
 #endif
@@ -215,6 +218,9 @@ int sem_post(FAR sem_t *sem)
 		ASSERT_INFO(sem->semcount < SEM_VALUE_MAX, "sem = 0x%x, semcount = %d, flags = 0x%x, caller address = 0x%x\n", sem, sem->semcount, sem->flags, caller_retaddr);
 		sem_releaseholder(sem, this_task());
 		sem->semcount++;
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+		sched_note_semaphore(this_task(), sem, NOTE_SEM_RELEASE);
+#endif
 
 		if ((sem->flags & FLAGS_SEM_MUTEX) != 0) {
 			ASSERT_INFO(sem->semcount < 2, "sem = 0x%x, semcount = %d, flags = 0x%x, caller address = 0x%x\n", sem, sem->semcount, sem->flags, caller_retaddr);
@@ -66,6 +66,9 @@
 #include "sched/sched.h"
 #include "semaphore/semaphore.h"
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+#include <tinyara/sched_note.h>
+#endif
 #ifdef CONFIG_SEMAPHORE_HISTORY
 #include <tinyara/debug/sysdbg.h>
 #endif
@@ -170,6 +173,9 @@ int sem_wait(FAR sem_t *sem)
 			rtcb->waitsem = NULL;
 #ifdef CONFIG_SEMAPHORE_HISTORY
 			save_semaphore_history(sem, (void *)rtcb, SEM_ACQUIRE);
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+			sched_note_semaphore(rtcb, sem, NOTE_SEM_ACQUIRE);
 #endif
 			ret = OK;
 		}
@@ -196,6 +202,9 @@ int sem_wait(FAR sem_t *sem)
 #ifdef CONFIG_SEMAPHORE_HISTORY
 			save_semaphore_history(sem, (void *)rtcb, SEM_WAITING);
 #endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+			sched_note_semaphore(rtcb, sem, NOTE_SEM_WAITING);
+#endif
 
 			/* If priority inheritance is enabled, then check the priority of
 			 * the holder of the semaphore.
@@ -242,6 +251,9 @@ int sem_wait(FAR sem_t *sem)
 			if (get_errno() != EINTR && get_errno() != ETIMEDOUT) {
 				/* Not awakened by a signal or a timeout... We hold the semaphore */
 				ret = OK;
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+				sched_note_semaphore(rtcb, sem, NOTE_SEM_ACQUIRE);
+#endif
 			}
 #ifdef CONFIG_PRIORITY_INHERITANCE
 			sched_unlock();
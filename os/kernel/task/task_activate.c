@@ -61,6 +61,9 @@
 
 #include <tinyara/arch.h>
 #include <tinyara/sched.h>
+#ifdef CONFIG_SCHED_INSTRUMENTATION
+#include <tinyara/sched_note.h>
+#endif
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 #include <tinyara/mm/mm.h>
 #endif
@@ -140,6 +143,9 @@ int task_activate(FAR struct tcb_s *tcb)
 		heap->alloc_list[hash_pid].peak_alloc_size = 0;
 		heap->alloc_list[hash_pid].num_alloc_free = 0;
 	}
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION
+	sched_note_start(tcb);
 #endif
 	up_unblock_task(tcb);
 	leave_critical_section(flags);
@@ -64,6 +64,9 @@
 
 #include <tinyara/sched.h>
 #include <tinyara/fs/fs.h>
+#ifdef CONFIG_SCHED_INSTRUMENTATION
+#include <tinyara/sched_note.h>
+#endif
 
 #include "sched/sched.h"
 #include "group/group.h"
@@ -557,6 +560,10 @@ void task_exithook(FAR struct tcb_s *tcb, int status, bool nonblocking)
 		return;
 	}
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION
+	sched_note_stop(tcb);
+#endif
+
 #ifdef CONFIG_DEBUG
 	/* Save the terminated task/pthread's information for stack monitor and heapinfo. */
 	dbg_save_termination_info(tcb);
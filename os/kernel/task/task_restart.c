@@ -212,9 +212,9 @@ int task_restart(pid_t pid)
 
 #ifdef CONFIG_SMP
 		FAR dq_queue_t *tasklist = TLIST_HEAD(tcb->cmn.task_state, tcb->cmn.cpu);
-		dq_rem((FAR dq_entry_t *)tcb, tasklist);
+		sched_removeprioritized((FAR struct tcb_s *)tcb, tasklist);
 #else
-		dq_rem((FAR dq_entry_t *)tcb, (dq_queue_t *)g_tasklisttable[tcb->cmn.task_state].list);
+		sched_removeprioritized((FAR struct tcb_s *)tcb, (dq_queue_t *)g_tasklisttable[tcb->cmn.task_state].list);
 #endif
 		tcb->cmn.task_state = TSTATE_TASK_INVALID;
 
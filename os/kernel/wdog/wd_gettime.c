@@ -110,6 +110,14 @@ int wd_gettime(WDOG_ID wdog)
 
 	flags = enter_critical_section();
 	if (wdog && WDOG_ISACTIVE(wdog)) {
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+		/* The expiration is kept as an absolute tick, no need to traverse */
+
+		int delay = (int32_t)(wdog->expire - g_wdwheel.base) + 1;
+
+		leave_critical_section(flags);
+		return delay > 0 ? delay : 0;
+#else
 		/* Traverse the watchdog list accumulating lag times until we find the wdog
 		 * that we are looking for
 		 */
@@ -124,6 +132,7 @@ int wd_gettime(WDOG_ID wdog)
 				return delay;
 			}
 		}
+#endif
 	}
 
 	leave_critical_section(flags);
@@ -150,6 +159,14 @@ int wd_gettime(WDOG_ID wdog)
 
 int wd_getdelay(void)
 {
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+	/* This may be earlier than the first expiration if the wheel has to
+	 * cascade a slot before, which only costs an early wakeup.
+	 */
+
+	return g_wdwheel.due ? 0 : (int)wd_wheel_nextdelay();
+#else
 	return (g_wdactivelist.head) ? ((FAR struct wdog_s *)g_wdactivelist.head)->lag : 0;
+#endif
 }
 #endif
@@ -65,6 +65,45 @@
  *
  ********************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+clock_t wd_getwakeupdelay(void)
+{
+	clock_t delay = 0;
+	clock_t remain;
+	struct wdog_s *curr;
+	irqstate_t flags;
+	int level;
+	int index;
+
+	/* The wheel is not sorted, so look at every wakeup source.  The due
+	 * watchdogs expired already and the delay stays zero for them.
+	 */
+
+	flags = enter_critical_section();
+	for (curr = g_wdwheel.due; curr; curr = curr->next) {
+		if (WDOG_ISWAKEUP(curr)) {
+			leave_critical_section(flags);
+			return 0;
+		}
+	}
+
+	for (level = 0; level < WDOG_WHEEL_LEVELS; level++) {
+		for (index = 0; index < WDOG_WHEEL_SLOTS; index++) {
+			for (curr = g_wdwheel.slot[level][index]; curr; curr = curr->next) {
+				if (WDOG_ISWAKEUP(curr)) {
+					remain = (clock_t)(curr->expire - g_wdwheel.base) + 1;
+					if (delay == 0 || remain < delay) {
+						delay = remain;
+					}
+				}
+			}
+		}
+	}
+
+	leave_critical_section(flags);
+	return delay;
+}
+#else
 clock_t wd_getwakeupdelay(void)
 {
 	clock_t delay = 0;
@@ -83,3 +122,4 @@ clock_t wd_getwakeupdelay(void)
 	leave_critical_section(flags);
 	return 0;
 }
+#endif
@@ -57,6 +57,7 @@
 #include <tinyara/config.h>
 
 #include <queue.h>
+#include <string.h>
 
 #include "wdog/wdog.h"
 
@@ -78,12 +79,21 @@
 
 sq_queue_t g_wdfreelist;
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+/* The g_wdwheel holds the active watchdogs in slots by expiration tick.
+ * When watchdog timers expire, they are moved to its due list, removed and
+ * the function is called.
+ */
+
+struct wd_wheel_s g_wdwheel;
+#else
 /* The g_wdactivelist data structure is a singly linked list ordered by
  * watchdog expiration time. When watchdog timers expire,the functions on
  * this linked list are removed and the function is called.
  */
 
 sq_queue_t g_wdactivelist;
+#endif
 
 /* This is the number of free, pre-allocated watchdog structures in the
  * g_wdfreelist.  This value is used to enforce a reserve for interrupt
@@ -167,7 +177,12 @@ void wd_initialize(void)
 	/* Initialize watchdog lists */
 
 	sq_init(&g_wdfreelist);
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+	memset(&g_wdwheel, 0, sizeof(struct wd_wheel_s));
+	g_wdwheel.duetail = &g_wdwheel.due;
+#else
 	sq_init(&g_wdactivelist);
+#endif
 
 	/* The g_wdfreelist must be loaded at initialization time to hold the
 	 * configured number of watchdogs.
@@ -111,6 +111,60 @@ typedef void (*wdentry4_t)(int argc, uint32_t arg1, uint32_t arg2, uint32_t arg3
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
+/****************************************************************************
+ * Name: wd_dispatch
+ *
+ * Description:
+ *   Execute the function of an expired watchdog.
+ *
+ * Parameters:
+ *   wdog - The watchdog which was removed from the active watchdogs
+ *
+ * Return Value:
+ *   None
+ *
+ * Assumptions:
+ *
+ ****************************************************************************/
+
+static inline void wd_dispatch(FAR struct wdog_s *wdog)
+{
+	/* Execute the watchdog function */
+
+	up_setpicbase(wdog->picbase);
+	switch (wdog->argc) {
+	default:
+		wd_corruption_dbg(wdog);
+		DEBUGPANIC();
+		break;
+
+	case 0:
+		(*((wdentry0_t)(wdog->func)))(0);
+		break;
+
+#if CONFIG_MAX_WDOGPARMS > 0
+	case 1:
+		(*((wdentry1_t)(wdog->func)))(1, wdog->parm[0]);
+		break;
+#endif
+#if CONFIG_MAX_WDOGPARMS > 1
+	case 2:
+		(*((wdentry2_t)(wdog->func)))(2, wdog->parm[0], wdog->parm[1]);
+		break;
+#endif
+#if CONFIG_MAX_WDOGPARMS > 2
+	case 3:
+		(*((wdentry3_t)(wdog->func)))(3, wdog->parm[0], wdog->parm[1], wdog->parm[2]);
+		break;
+#endif
+#if CONFIG_MAX_WDOGPARMS > 3
+	case 4:
+		(*((wdentry4_t)(wdog->func)))(4, wdog->parm[0], wdog->parm[1], wdog->parm[2], wdog->parm[3]);
+		break;
+#endif
+	}
+}
+
 /****************************************************************************
  * Name: wd_expiration
  *
@@ -128,6 +182,27 @@ typedef void (*wdentry4_t)(int argc, uint32_t arg1, uint32_t arg2, uint32_t arg3
  *
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+static inline void wd_expiration(void)
+{
+	FAR struct wdog_s *wdog;
+
+	/* Run the watchdogs which the timing wheel found expired, one at a time
+	 * because a watchdog function may cancel one of the others.
+	 */
+
+	while ((wdog = g_wdwheel.due) != NULL) {
+		(void)wd_wheel_remove(wdog);
+		wdog->next = NULL;
+
+		/* Indicate that the watchdog is no longer active. */
+
+		WDOG_CLRACTIVE(wdog);
+
+		wd_dispatch(wdog);
+	}
+}
+#else
 static inline void wd_expiration(void)
 {
 	FAR struct wdog_s *wdog;
@@ -156,43 +231,11 @@ static inline void wd_expiration(void)
 
 			WDOG_CLRACTIVE(wdog);
 
-			/* Execute the watchdog function */
-
-			up_setpicbase(wdog->picbase);
-			switch (wdog->argc) {
-			default:
-				wd_corruption_dbg(wdog);
-				DEBUGPANIC();
-				break;
-
-			case 0:
-				(*((wdentry0_t)(wdog->func)))(0);
-				break;
-
-#if CONFIG_MAX_WDOGPARMS > 0
-			case 1:
-				(*((wdentry1_t)(wdog->func)))(1, wdog->parm[0]);
-				break;
-#endif
-#if CONFIG_MAX_WDOGPARMS > 1
-			case 2:
-				(*((wdentry2_t)(wdog->func)))(2, wdog->parm[0], wdog->parm[1]);
-				break;
-#endif
-#if CONFIG_MAX_WDOGPARMS > 2
-			case 3:
-				(*((wdentry3_t)(wdog->func)))(3, wdog->parm[0], wdog->parm[1], wdog->parm[2]);
-				break;
-#endif
-#if CONFIG_MAX_WDOGPARMS > 3
-			case 4:
-				(*((wdentry4_t)(wdog->func)))(4, wdog->parm[0], wdog->parm[1], wdog->parm[2], wdog->parm[3]);
-				break;
-#endif
-			}
+			wd_dispatch(wdog);
 		}
 	}
 }
+#endif
 
 /****************************************************************************
  * Public Functions
@@ -234,10 +277,12 @@ static inline void wd_expiration(void)
 int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...)
 {
 	va_list ap;
+#ifndef CONFIG_WDOG_TIMING_WHEEL
 	FAR struct wdog_s *curr;
 	FAR struct wdog_s *prev;
 	FAR struct wdog_s *next;
 	int32_t now;
+#endif
 	irqstate_t state;
 	int i;
 
@@ -298,6 +343,14 @@ int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...)
 	(void)sched_timer_cancel();
 #endif
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+	/* The tick at which the watchdog runs is processed after delay ticks
+	 * elapsed, the same as a lag of delay in the active list.
+	 */
+
+	wdog->expire = g_wdwheel.base + delay - 1;
+	wd_wheel_insert(wdog);
+#else
 	/* Do the easy case first -- when the watchdog timer queue is empty. */
 
 	if (g_wdactivelist.head == NULL) {
@@ -369,9 +422,13 @@ int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...)
 		}
 	}
 
-	/* Put the lag into the watchdog structure and mark it as active. */
+	/* Put the lag into the watchdog structure. */
 
 	wdog->lag = delay;
+#endif
+
+	/* Mark the watchdog as active. */
+
 	WDOG_SETACTIVE(wdog);
 
 #ifdef CONFIG_SCHED_TICKLESS
@@ -412,6 +469,43 @@ int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...)
  *
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+#ifdef CONFIG_SCHED_TICKLESS
+unsigned int wd_timer(int ticks)
+{
+	/* Process the elapsed ticks and run the watchdogs which expired */
+
+	if (ticks > 0) {
+		wd_wheel_advance(ticks);
+	}
+
+	wd_expiration();
+
+	/* Return the delay until the timing wheel has work to do next */
+
+	return wd_wheel_nextdelay();
+}
+
+#else
+void wd_timer(void)
+{
+	wd_wheel_advance(1);
+	wd_expiration();
+}
+#endif							/* CONFIG_SCHED_TICKLESS */
+
+#ifdef CONFIG_SCHED_TICKSUPPRESS
+void wd_timer_nohz(clock_t ticks)
+{
+	/* Account for the suppressed ticks.  The watchdogs which expired in
+	 * the meantime stay in the due list and run on the next wd_timer.
+	 */
+
+	wd_wheel_advance(ticks);
+}
+#endif
+
+#else							/* CONFIG_WDOG_TIMING_WHEEL */
 #ifdef CONFIG_SCHED_TICKLESS
 unsigned int wd_timer(int ticks)
 {
@@ -491,3 +585,4 @@ void wd_timer_nohz(clock_t ticks)
 	}
 }
 #endif
+#endif							/* CONFIG_WDOG_TIMING_WHEEL */
@@ -0,0 +1,360 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <tinyara/wdog.h>
+
+#include "wdog/wdog.h"
+
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define WDOG_WHEEL_SHIFT(l)      ((l) * WDOG_WHEEL_BITS)
+#define WDOG_WHEEL_RANGE         ((uint32_t)1 << WDOG_WHEEL_SHIFT(WDOG_WHEEL_LEVELS))
+
+#define WDOG_WHEEL_LEVEL(s)      ((s) >> WDOG_WHEEL_BITS)
+#define WDOG_WHEEL_INDEX(s)      ((s) & WDOG_WHEEL_MASK)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wd_wheel_link
+ *
+ * Description:
+ *   Add a watchdog at the head of an unsorted list.
+ *
+ ****************************************************************************/
+
+static inline void wd_wheel_link(FAR struct wdog_s **head, FAR struct wdog_s *wdog)
+{
+	wdog->next = *head;
+	if (wdog->next) {
+		wdog->next->pprev = &wdog->next;
+	}
+
+	*head = wdog;
+	wdog->pprev = head;
+}
+
+/****************************************************************************
+ * Name: wd_wheel_cascade
+ *
+ * Description:
+ *   Move all watchdogs of one slot of an upper level down to the level
+ *   which matches their remaining delay now.
+ *
+ * Return Value:
+ *   The index of the slot.  Zero means the next level has to be cascaded
+ *   too.
+ *
+ ****************************************************************************/
+
+static int wd_wheel_cascade(int level)
+{
+	FAR struct wdog_s *wdog;
+	FAR struct wdog_s *next;
+	int index;
+
+	index = (g_wdwheel.base >> WDOG_WHEEL_SHIFT(level)) & WDOG_WHEEL_MASK;
+
+	wdog = g_wdwheel.slot[level][index];
+	g_wdwheel.slot[level][index] = NULL;
+	g_wdwheel.map[level] &= ~((uint64_t)1 << index);
+
+	while (wdog) {
+		next = wdog->next;
+		wd_wheel_insert(wdog);
+		wdog = next;
+	}
+
+	return index;
+}
+
+/****************************************************************************
+ * Name: wd_wheel_tick
+ *
+ * Description:
+ *   Process the tick g_wdwheel.base: cascade the upper levels on their
+ *   boundaries and move the slot of level 0 to the due list.
+ *
+ ****************************************************************************/
+
+static void wd_wheel_tick(void)
+{
+	FAR struct wdog_s *wdog;
+	int index;
+	int level;
+
+	index = g_wdwheel.base & WDOG_WHEEL_MASK;
+	if (index == 0) {
+		for (level = 1; level < WDOG_WHEEL_LEVELS; level++) {
+			if (wd_wheel_cascade(level) != 0) {
+				break;
+			}
+		}
+	}
+
+	/* Every watchdog in this slot expires at this tick */
+
+	wdog = g_wdwheel.slot[0][index];
+	if (wdog) {
+		g_wdwheel.slot[0][index] = NULL;
+		g_wdwheel.map[0] &= ~((uint64_t)1 << index);
+
+		*g_wdwheel.duetail = wdog;
+		wdog->pprev = g_wdwheel.duetail;
+		for (;;) {
+			wdog->slot = WDOG_WHEEL_DUE;
+			if (!wdog->next) {
+				break;
+			}
+			wdog->next->pprev = &wdog->next;
+			wdog = wdog->next;
+		}
+		g_wdwheel.duetail = &wdog->next;
+	}
+
+	g_wdwheel.base++;
+}
+
+/****************************************************************************
+ * Name: wd_wheel_nextwork
+ *
+ * Description:
+ *   Return the number of ticks from g_wdwheel.base to the first tick which
+ *   has a non-empty slot to run or to cascade.  A slot of level n is
+ *   cascaded on the tick whose lower 6n bits are zero and whose next 6 bits
+ *   are the slot index.
+ *
+ ****************************************************************************/
+
+static bool wd_wheel_nextwork(FAR uint32_t *delta)
+{
+	uint32_t base = g_wdwheel.base;
+	uint32_t start;
+	uint32_t tick;
+	uint64_t map;
+	bool found = false;
+	int shift;
+	int level;
+	int rot;
+
+	for (level = 0; level < WDOG_WHEEL_LEVELS; level++) {
+		map = g_wdwheel.map[level];
+		if (!map) {
+			continue;
+		}
+
+		/* The first boundary of this level at or after the base */
+
+		shift = WDOG_WHEEL_SHIFT(level);
+		start = base >> shift;
+		if (base & (((uint32_t)1 << shift) - 1)) {
+			start++;
+		}
+
+		/* The first non-empty slot in wheel order from that boundary */
+
+		rot = start & WDOG_WHEEL_MASK;
+		if (rot) {
+			map = (map >> rot) | (map << (WDOG_WHEEL_SLOTS - rot));
+		}
+
+		tick = (start + __builtin_ctzll(map)) << shift;
+		if (!found || tick - base < *delta) {
+			*delta = tick - base;
+			found = true;
+		}
+	}
+
+	return found;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wd_wheel_insert
+ *
+ * Description:
+ *   Put an active watchdog into the slot of the timing wheel which matches
+ *   wdog->expire.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+void wd_wheel_insert(FAR struct wdog_s *wdog)
+{
+	uint32_t expire = wdog->expire;
+	uint32_t delta = expire - g_wdwheel.base;
+	int index;
+	int level;
+
+	if ((int32_t)delta < 0) {
+		/* Already late, run it on the next tick */
+
+		expire = g_wdwheel.base;
+		delta = 0;
+	} else if (delta >= WDOG_WHEEL_RANGE) {
+		/* Out of range, park it at the far end of the top level.  It is
+		 * inserted again with its real expiration when cascaded.
+		 */
+
+		expire = g_wdwheel.base + WDOG_WHEEL_RANGE - 1;
+		delta = WDOG_WHEEL_RANGE - 1;
+	}
+
+	for (level = 0; level < WDOG_WHEEL_LEVELS - 1; level++) {
+		if (delta < ((uint32_t)1 << WDOG_WHEEL_SHIFT(level + 1))) {
+			break;
+		}
+	}
+
+	index = (expire >> WDOG_WHEEL_SHIFT(level)) & WDOG_WHEEL_MASK;
+
+	wd_wheel_link(&g_wdwheel.slot[level][index], wdog);
+	g_wdwheel.map[level] |= (uint64_t)1 << index;
+	wdog->slot = (level << WDOG_WHEEL_BITS) | index;
+}
+
+/****************************************************************************
+ * Name: wd_wheel_remove
+ *
+ * Description:
+ *   Take a watchdog out of the timing wheel or out of the due list.
+ *
+ * Return Value:
+ *   true if a slot became empty, which means that the next expiration
+ *   may have moved later.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+bool wd_wheel_remove(FAR struct wdog_s *wdog)
+{
+	int level;
+	int index;
+
+	*wdog->pprev = wdog->next;
+	if (wdog->next) {
+		wdog->next->pprev = wdog->pprev;
+	}
+
+	if (wdog->slot == WDOG_WHEEL_DUE) {
+		if (g_wdwheel.duetail == &wdog->next) {
+			g_wdwheel.duetail = wdog->pprev;
+		}
+
+		return false;
+	}
+
+	level = WDOG_WHEEL_LEVEL(wdog->slot);
+	index = WDOG_WHEEL_INDEX(wdog->slot);
+	if (!g_wdwheel.slot[level][index]) {
+		g_wdwheel.map[level] &= ~((uint64_t)1 << index);
+		return true;
+	}
+
+	return false;
+}
+
+/****************************************************************************
+ * Name: wd_wheel_advance
+ *
+ * Description:
+ *   Process 'ticks' ticks of the timing wheel and move the watchdogs which
+ *   expired to the due list.  Ticks without any work are skipped at once.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+void wd_wheel_advance(unsigned int ticks)
+{
+	uint32_t delta;
+
+	/* The common case of the periodic tick, no need to look ahead */
+
+	if (ticks == 1) {
+		wd_wheel_tick();
+		return;
+	}
+
+	while (ticks > 0) {
+		if (!wd_wheel_nextwork(&delta) || delta >= ticks) {
+			g_wdwheel.base += ticks;
+			break;
+		}
+
+		g_wdwheel.base += delta;
+		ticks -= delta;
+
+		wd_wheel_tick();
+		ticks--;
+	}
+}
+
+/****************************************************************************
+ * Name: wd_wheel_nextdelay
+ *
+ * Description:
+ *   Return the number of ticks which have to elapse until the timing wheel
+ *   has work to do, either running watchdogs or moving them down a level.
+ *   This is never later than the next expiration.
+ *
+ * Return Value:
+ *   The number of ticks, or zero if no watchdog is active.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+unsigned int wd_wheel_nextdelay(void)
+{
+	uint32_t delta;
+
+	if (!wd_wheel_nextwork(&delta)) {
+		return 0;
+	}
+
+	/* The tick at 'delta' is processed once delta + 1 ticks elapsed */
+
+	return delta + 1;
+}
+
+#endif							/* CONFIG_WDOG_TIMING_WHEEL */
@@ -69,10 +69,38 @@
  * Pre-processor Definitions
  ************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+#define WDOG_WHEEL_BITS     6
+#define WDOG_WHEEL_SLOTS    (1 << WDOG_WHEEL_BITS)
+#define WDOG_WHEEL_MASK     (WDOG_WHEEL_SLOTS - 1)
+#define WDOG_WHEEL_LEVELS   CONFIG_WDOG_TIMING_WHEEL_LEVELS
+
+/* wdog->slot of a watchdog which expired but has not been run yet */
+
+#define WDOG_WHEEL_DUE      0xffff
+#endif
+
 /************************************************************************
  * Public Type Declarations
  ************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+/* The timing wheel.  Level 0 holds the watchdogs which expire within the
+ * next 64 ticks, one slot per tick.  Each slot of level n covers 64^n
+ * ticks and is moved down to the lower levels when the wheel reaches it.
+ * The slots are unsorted lists, so inserting and removing a watchdog does
+ * not depend on the number of active watchdogs.
+ */
+
+struct wd_wheel_s {
+	uint32_t base;				/* The next tick to be processed */
+	uint64_t map[WDOG_WHEEL_LEVELS];	/* Bit n set if slot n is not empty */
+	FAR struct wdog_s *slot[WDOG_WHEEL_LEVELS][WDOG_WHEEL_SLOTS];
+	FAR struct wdog_s *due;		/* Expired watchdogs, in expiration order */
+	FAR struct wdog_s **duetail;	/* The link field of the last due watchdog */
+};
+#endif
+
 /************************************************************************
  * Public Variables
  ************************************************************************/
@@ -90,12 +118,21 @@ extern "C" {
 
 extern sq_queue_t g_wdfreelist;
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+/* The g_wdwheel holds the active watchdogs in slots by expiration tick.
+ * When watchdog timers expire, they are moved to its due list, removed and
+ * the function is called.
+ */
+
+extern struct wd_wheel_s g_wdwheel;
+#else
 /* The g_wdactivelist data structure is a singly linked list ordered by
  * watchdog expiration time. When watchdog timers expire,the functions on
  * this linked list are removed and the function is called.
  */
 
 extern sq_queue_t g_wdactivelist;
+#endif
 
 /* This is the number of free, pre-allocated watchdog structures in the
  * g_wdfreelist.  This value is used to enforce a reserve for interrupt
@@ -206,6 +243,71 @@ void wd_corruption_dbg(struct wdog_s *wdog);
 struct tcb_s;
 void wd_recover(FAR struct tcb_s *tcb);
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+/****************************************************************************
+ * Name: wd_wheel_insert
+ *
+ * Description:
+ *   Put an active watchdog into the slot of the timing wheel which matches
+ *   wdog->expire.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+void wd_wheel_insert(FAR struct wdog_s *wdog);
+
+/****************************************************************************
+ * Name: wd_wheel_remove
+ *
+ * Description:
+ *   Take a watchdog out of the timing wheel or out of the due list.
+ *
+ * Return Value:
+ *   true if a slot became empty, which means that the next expiration
+ *   may have moved later.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+bool wd_wheel_remove(FAR struct wdog_s *wdog);
+
+/****************************************************************************
+ * Name: wd_wheel_advance
+ *
+ * Description:
+ *   Process 'ticks' ticks of the timing wheel and move the watchdogs which
+ *   expired to the due list.  Ticks without any work are skipped at once.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+void wd_wheel_advance(unsigned int ticks);
+
+/****************************************************************************
+ * Name: wd_wheel_nextdelay
+ *
+ * Description:
+ *   Return the number of ticks which have to elapse until the timing wheel
+ *   has work to do, either running watchdogs or moving them down a level.
+ *   This is never later than the next expiration.
+ *
+ * Return Value:
+ *   The number of ticks, or zero if no watchdog is active.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+unsigned int wd_wheel_nextdelay(void);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -19,6 +19,7 @@
 #include <tinyara/config.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <string.h>
 #include <unistd.h>
 #ifdef CONFIG_ARCH_LOWPUTC
 #include <sched.h>
@@ -44,9 +45,37 @@ static void logm_putc(FAR struct lib_outstream_s *this, int ch)
 	}
 }
 
+/* Copy a run into the ring with at most two memcpy, keeping what fits */
+
+static void logm_puts(FAR struct lib_outstream_s *this, FAR const void *buf, int len)
+{
+	FAR const char *ptr = (FAR const char *)buf;
+	int pos = (g_logm_tail + this->nput) % logm_bufsize;
+	int space = (g_logm_head - pos - 1 + logm_bufsize) % logm_bufsize;
+	int chunk;
+
+	if (len > space) {
+		len = space;
+	}
+
+	while (len > 0) {
+		chunk = logm_bufsize - pos;
+		if (chunk > len) {
+			chunk = len;
+		}
+
+		memcpy(&g_logm_rsvbuf[pos], ptr, chunk);
+		this->nput += chunk;
+		ptr += chunk;
+		len -= chunk;
+		pos = 0;
+	}
+}
+
 static void logm_outstream(FAR struct lib_outstream_s *outstream)
 {
 	outstream->put = logm_putc;
+	outstream->puts = logm_puts;
 #ifdef CONFIG_STDIO_LINEBUFFER
 	outstream->flush = lib_noflush;
 #endif
@@ -106,7 +135,9 @@ int logm_internal(int flag, int indx, int priority, const char *fmt, va_list ap)
 #endif
 		ret = lib_vsprintf(&strm, fmt, ap);
 
-		g_logm_tail = (g_logm_tail + ret) % logm_bufsize;
+		/* Advance by what was stored, timestamp included */
+
+		g_logm_tail = (g_logm_tail + strm.nput) % logm_bufsize;
 
 		if ((g_logm_tail + 1) % logm_bufsize == g_logm_head) {
 			LOGM_STATUS_SET(LOGM_BUFFER_OVERFLOW);
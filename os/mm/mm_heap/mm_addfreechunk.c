@@ -58,6 +58,8 @@
 
 #include <tinyara/mm/mm.h>
 
+#include "mm_node.h"
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -88,9 +90,21 @@ void mm_addfreechunk(FAR struct mm_heap_s *heap, FAR struct mm_freenode_s *node)
 
 	int ndx = mm_size2ndx(node->size);
 
+#ifdef CONFIG_MM_TLSF
+	/* TLSF lists are not sorted, so just push the node at the head and mark
+	 * the list as non-empty.
+	 */
+
+	prev = &heap->mm_nodelist[ndx];
+	next = prev->flink;
+
+	heap->mm_sl_bitmap[MM_TLSF_FL(ndx)] |= 1U << MM_TLSF_SL(ndx);
+	heap->mm_fl_bitmap |= 1U << MM_TLSF_FL(ndx);
+#else
 	/* Now put the new free node in a descending order */
 
 	for (prev = &heap->mm_nodelist[ndx], next = prev->flink; next && next->size > node->size; prev = next, next = next->flink) ;
+#endif
 
 	/* Does it go in mid next or at the end? */
 
@@ -195,7 +195,7 @@ static void mm_free_internal(FAR struct mm_heap_s *heap, FAR void *mem, mmaddres
 		 * but there may not be a successor node.
 		 */
 		DEBUGASSERT_MM_FREE_NODE(heap, next);
-		REMOVE_NODE_FROM_LIST(next);
+		REMOVE_NODE_FROM_LIST(heap, next);
 
 		/* Then merge the two chunks */
 
@@ -214,7 +214,7 @@ static void mm_free_internal(FAR struct mm_heap_s *heap, FAR void *mem, mmaddres
 		 * not be a successor node.
 		 */
 		DEBUGASSERT_MM_FREE_NODE(heap, prev);
-		REMOVE_NODE_FROM_LIST(prev);
+		REMOVE_NODE_FROM_LIST(heap, prev);
 
 		/* Then merge the two chunks */
 
@@ -38,6 +38,22 @@ static size_t mm_get_largest_freesize_from_specific_heap(struct mm_heap_s *heap)
 	struct mm_freenode_s *fnode;
 	int nodelist_idx = 0;
 
+#ifdef CONFIG_MM_TLSF
+	int fl;
+
+	/* The highest non-empty list holds the largest node, but TLSF lists are
+	 * not sorted, so walk that list to find it.
+	 */
+	if (heap->mm_fl_bitmap) {
+		fl = 31 - __builtin_clz(heap->mm_fl_bitmap);
+		nodelist_idx = (fl << MM_TLSF_SLI_SHIFT) + 31 - __builtin_clz(heap->mm_sl_bitmap[fl]);
+		for (fnode = heap->mm_nodelist[nodelist_idx].flink; fnode; fnode = fnode->flink) {
+			if (largest_size < fnode->size) {
+				largest_size = fnode->size;
+			}
+		}
+	}
+#else
 	/* Free nodes are sorted in a descending order,
 	 * so the first node in each nodelist is the largest within its nodelist.
 	 */
@@ -49,6 +65,7 @@ static size_t mm_get_largest_freesize_from_specific_heap(struct mm_heap_s *heap)
 			break;
 		}
 	}
+#endif
 	return largest_size;
 }
 
@@ -130,8 +130,8 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 
 #ifdef CONFIG_DEBUG_CHECK_FRAGMENTATION
 	int ndx;
-	int nodelist_cnt[MM_NNODES] = {0, };
-	size_t nodelist_size[MM_NNODES] = {0, };
+	int nodelist_cnt[MM_NLISTS] = {0, };
+	size_t nodelist_size[MM_NLISTS] = {0, };
 	FAR struct mm_freenode_s *fnode;
 #endif
 
@@ -289,7 +289,7 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 
 	DEBUGVERIFY(mm_takesemaphore(heap));
 
-	for (ndx = 0; ndx < MM_NNODES; ++ndx) {
+	for (ndx = 0; ndx < MM_NLISTS; ++ndx) {
 		for (fnode = heap->mm_nodelist[ndx].flink; fnode && fnode->size; fnode = fnode->flink) {
 			++nodelist_cnt[ndx];
 			nodelist_size[ndx] += fnode->size;
@@ -298,8 +298,15 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 
 	mm_givesemaphore(heap);
 
-	for (ndx = 0; ndx < MM_NNODES; ++ndx) {
+	for (ndx = 0; ndx < MM_NLISTS; ++ndx) {
+#ifdef CONFIG_MM_TLSF
+		if (nodelist_cnt[ndx] == 0) {
+			continue;
+		}
+		heap_dbg("Nodelist[%d] (fl %d, sl %d) : num %d, size %u [Bytes]\n", ndx, ndx >> MM_TLSF_SLI_SHIFT, ndx & (MM_TLSF_SLI_COUNT - 1), nodelist_cnt[ndx], nodelist_size[ndx]);
+#else
 		heap_dbg("Nodelist[%d] ranging [%u, %u] : num %d, size %u [Bytes]\n", ndx, ((ndx > 0 ? (1 << (ndx + MM_MIN_SHIFT)) : 0) + 1), 1 << (ndx + MM_MIN_SHIFT + 1), nodelist_cnt[ndx], nodelist_size[ndx]);
+#endif
 	}
 #endif
 
@@ -246,7 +246,11 @@ int mm_initialize(FAR struct mm_heap_s *heap, FAR void *heapstart, size_t heapsi
 
 	/* Initialize the node array */
 
-	memset(heap->mm_nodelist, 0, sizeof(struct mm_freenode_s) * (MM_NNODES + 1));
+	memset(heap->mm_nodelist, 0, sizeof(struct mm_freenode_s) * (MM_NLISTS + 1));
+#ifdef CONFIG_MM_TLSF
+	heap->mm_fl_bitmap = 0;
+	memset(heap->mm_sl_bitmap, 0, sizeof(heap->mm_sl_bitmap));
+#endif
 
 	/* Initialize delay list to NULL for all cpus */
 
@@ -147,7 +147,9 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size, mmaddress_t caller_
 {
 	FAR struct mm_freenode_s *node;
 	void *ret = NULL;
+#ifndef CONFIG_MM_TLSF
 	int ndx;
+#endif
 	bool gc_done = false;
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 	size_t gc_before_size;
@@ -176,6 +178,11 @@ retry_after_gc:
 
 	mm_takesemaphore(heap);
 
+#ifdef CONFIG_MM_TLSF
+	/* Find a large enough chunk with the first and second level bitmaps */
+
+	node = mm_tlsf_findfreechunk(heap, size);
+#else
 	/* Get the location in the node list to start the search
 	 * by converting the request size into a nodelist index.
 	 */
@@ -199,12 +206,17 @@ retry_after_gc:
 		node = prev;
 	}
 
-	/* If we found a node with non-zero size, then this is one to use. Since
-	 * the list is ordered, we know that is must be best fitting chunk
-	 * available.
+	/* If we stopped at a list head (zero size), there is no fitting node.
+	 * Otherwise, since the list is ordered, we know that is must be best
+	 * fitting chunk available.
 	 */
 
-	if (node->size) {
+	if (!node->size) {
+		node = NULL;
+	}
+#endif
+
+	if (node) {
 		FAR struct mm_freenode_s *remainder;
 		FAR struct mm_freenode_s *next;
 		size_t remaining;
@@ -213,7 +225,7 @@ retry_after_gc:
 		 * a successor node.
 		 */
 		DEBUGASSERT_MM_FREE_NODE(heap, node);
-		REMOVE_NODE_FROM_LIST(node);
+		REMOVE_NODE_FROM_LIST(heap, node);
 
 		/* Check if we have to split the free node into one of the allocated
 		 * size and another smaller freenode.  In some cases, the remaining
@@ -273,6 +285,11 @@ retry_after_gc:
 		gc_before_size = heap->total_alloc_size;
 #endif
 		sched_garbagecollection();
+#ifdef CONFIG_MM_SMALL_CACHE
+		/* Cached small blocks may be what is missing to satisfy this */
+
+		umm_cache_flush();
+#endif
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 		if (gc_before_size > heap->total_alloc_size) {
 			mdbg("GC freed %u bytes\n", gc_before_size - heap->total_alloc_size);
@@ -159,7 +159,39 @@ retry_after_gc:
 	 * If this list does not have free nodes whose size is large enough
 	 * to accommodate the requested size, it will fail due to no more space.
 	 */
-	for (; ndx < MM_NNODES; ndx++) {
+	for (; ndx < MM_NLISTS; ndx++) {
+#ifdef CONFIG_MM_TLSF
+		/* TLSF lists are not sorted, so every node of each candidate list
+		 * has to be checked.  memalign is rare enough to afford it.
+		 */
+
+		for (node = heap->mm_nodelist[ndx].flink; node; node = node->flink) {
+			if (node->size < newsize) {
+				continue;
+			}
+
+			for (alignchunk = (FAR struct mm_allocnode_s *)(((size_t)node + SIZEOF_MM_ALLOCNODE + mask) & ~mask);
+				(uintptr_t)(alignchunk + alignment) < (uintptr_t)(node + node->size);
+				alignchunk = alignchunk + alignment) {
+
+				size_t alignsize = (size_t)alignchunk - (size_t)node + size;
+				size_t remainsize = (size_t)alignchunk - SIZEOF_MM_ALLOCNODE - (size_t)node;
+
+				if (node->size >= alignsize && (remainsize == 0 || remainsize >= SIZEOF_MM_FREENODE)) {
+					found_align = true;
+					break;
+				}
+			}
+
+			if (found_align) {
+				break;
+			}
+		}
+
+		if (found_align) {
+			break;
+		}
+#else
 		node = heap->mm_nodelist[ndx].flink;
 		if (!(node && node->size >= newsize)) {
 			/* If the list at this index is empty or if the size of first node
@@ -205,6 +237,7 @@ retry_after_gc:
 		if (found_align) {
 			break;
 		}
+#endif
 	}
 
 	if (found_align) {
@@ -218,7 +251,7 @@ retry_after_gc:
 		 * a successor node.
 		 */
 		DEBUGASSERT_MM_FREE_NODE(heap, node);
-		REMOVE_NODE_FROM_LIST(node);
+		REMOVE_NODE_FROM_LIST(heap, node);
 
 		/* Check if there is free space at the beginning of the aligned chunk */
 		if ((size_t)newnode - (size_t)node >= SIZEOF_MM_FREENODE) {
@@ -279,6 +312,11 @@ retry_after_gc:
 		gc_before_size = heap->total_alloc_size;
 #endif
 		sched_garbagecollection();
+#ifdef CONFIG_MM_SMALL_CACHE
+		/* Cached small blocks may be what is missing to satisfy this */
+
+		umm_cache_flush();
+#endif
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 		if (gc_before_size > heap->total_alloc_size) {
 			mdbg("GC freed %u bytes\n", gc_before_size - heap->total_alloc_size);
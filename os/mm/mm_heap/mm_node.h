@@ -32,6 +32,21 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* Index of the most significant set bit of a non-zero size */
+
+#define MM_FLS(x)	((int)(sizeof(unsigned long) * 8) - 1 - __builtin_clzl((unsigned long)(x)))
+
+/* Index of the least significant set bit of a non-zero bitmap */
+
+#define MM_FFS(x)	__builtin_ctz(x)
+
+#ifdef CONFIG_MM_TLSF
+/* First and second level indexes of a TLSF nodelist index */
+
+#define MM_TLSF_FL(ndx)	((ndx) >> MM_TLSF_SLI_SHIFT)
+#define MM_TLSF_SL(ndx)	((ndx) & (MM_TLSF_SLI_COUNT - 1))
+#endif
+
 #define DEBUGASSERT_MM_FREE_NODE(heap, node)		\
 	do {		\
 		DEBUGASSERT(node);		\
@@ -45,13 +60,18 @@
 		}		\
 	} while (0)
 
-#define REMOVE_NODE_FROM_LIST(node)				\
+#ifdef CONFIG_MM_TLSF
+#define REMOVE_NODE_FROM_LIST(heap, node)			\
+	mm_tlsf_removefreechunk(heap, node)
+#else
+#define REMOVE_NODE_FROM_LIST(heap, node)			\
 	do {							\
 		(node)->blink->flink = (node)->flink;		\
 		if ((node)->flink) {				\
 			(node)->flink->blink = (node)->blink;	\
 		}						\
 	} while (0)
+#endif
 
 /****************************************************************************
  * Public Functions
@@ -58,6 +58,8 @@
 
 #include <tinyara/mm/mm.h>
 
+#include "mm_node.h"
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -74,6 +76,30 @@
  *
  ****************************************************************************/
 
+#ifdef CONFIG_MM_TLSF
+int mm_size2ndx(size_t size)
+{
+	int fl;
+	int sl;
+
+	/* Small sizes are spread linearly, one list per MM_MIN_CHUNK step */
+
+	if (size < (1 << MM_TLSF_FLI_OFFSET)) {
+		return (int)(size >> MM_MIN_SHIFT);
+	}
+
+	/* Everything beyond MM_MAX_SHIFT shares the very last list */
+
+	fl = MM_FLS(size);
+	if (fl > MM_MAX_SHIFT) {
+		return MM_NLISTS - 1;
+	}
+
+	sl = (int)(size >> (fl - MM_TLSF_SLI_SHIFT)) - MM_TLSF_SLI_COUNT;
+
+	return ((fl - MM_TLSF_FLI_OFFSET + 1) << MM_TLSF_SLI_SHIFT) + sl;
+}
+#else
 int mm_size2ndx(size_t size)
 {
 	int ndx = 0;
@@ -104,3 +130,4 @@ int mm_size2ndx(size_t size)
 		return ndx;
 	}
 }
+#endif
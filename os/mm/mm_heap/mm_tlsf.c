@@ -0,0 +1,163 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <tinyara/mm/mm.h>
+
+#include "mm_node.h"
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_tlsf_searchndx
+ *
+ * Description:
+ *   Convert the size to the index of the first list whose every node is
+ *   large enough for it, by rounding the size up to the start of the next
+ *   second level range.
+ *
+ ****************************************************************************/
+
+static int mm_tlsf_searchndx(size_t size)
+{
+	int fl;
+
+	if (size >= (1 << MM_TLSF_FLI_OFFSET)) {
+		fl = MM_FLS(size);
+		if (fl > MM_MAX_SHIFT) {
+			return MM_NLISTS - 1;
+		}
+
+		size += ((size_t)1 << (fl - MM_TLSF_SLI_SHIFT)) - 1;
+	}
+
+	return mm_size2ndx(size);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_tlsf_findfreechunk
+ *
+ * Description:
+ *   Find a free node of at least 'size' bytes in constant time.  It is
+ *   assumed that the caller holds the mm semaphore.  The node is not
+ *   removed from its list.
+ *
+ * Return Value:
+ *   The free node, or NULL if no node is large enough.
+ *
+ ****************************************************************************/
+
+FAR struct mm_freenode_s *mm_tlsf_findfreechunk(FAR struct mm_heap_s *heap, size_t size)
+{
+	FAR struct mm_freenode_s *node;
+	uint32_t map;
+	int ndx;
+	int fl;
+
+	/* Try the head of the list which the size itself belongs to first.
+	 * It is a cheap check that often hits the exact size and leaves the
+	 * larger lists untouched.
+	 */
+
+	ndx = mm_size2ndx(size);
+	node = heap->mm_nodelist[ndx].flink;
+	if (node && node->size >= size) {
+		return node;
+	}
+
+	/* Otherwise take the first non-empty list at or above the rounded up
+	 * index.  Any node there is large enough.
+	 */
+
+	ndx = mm_tlsf_searchndx(size);
+	fl = MM_TLSF_FL(ndx);
+
+	map = heap->mm_sl_bitmap[fl] & (~0U << MM_TLSF_SL(ndx));
+	if (!map) {
+		map = heap->mm_fl_bitmap & (~0U << (fl + 1));
+		if (!map) {
+			/* Nothing above, but a fitting node may still sit behind the
+			 * head of the list the size belongs to.  Search it rather than
+			 * failing the allocation while memory is available.
+			 */
+
+			while (node && node->size < size) {
+				node = node->flink;
+			}
+
+			return node;
+		}
+
+		fl = MM_FFS(map);
+		map = heap->mm_sl_bitmap[fl];
+	}
+
+	ndx = (fl << MM_TLSF_SLI_SHIFT) + MM_FFS(map);
+	node = heap->mm_nodelist[ndx].flink;
+
+	/* The last list also collects all nodes beyond MM_MAX_CHUNK, so its
+	 * nodes are not guaranteed to fit.  This is the only list searched.
+	 */
+
+	if (ndx == MM_NLISTS - 1) {
+		while (node && node->size < size) {
+			node = node->flink;
+		}
+	}
+
+	return node;
+}
+
+/****************************************************************************
+ * Name: mm_tlsf_removefreechunk
+ *
+ * Description:
+ *   Remove a free node from its list and clear the bitmap bits if the list
+ *   became empty.  It is assumed that the caller holds the mm semaphore and
+ *   that node->size has not changed since the node was added.
+ *
+ ****************************************************************************/
+
+void mm_tlsf_removefreechunk(FAR struct mm_heap_s *heap, FAR struct mm_freenode_s *node)
+{
+	int ndx;
+
+	node->blink->flink = node->flink;
+	if (node->flink) {
+		node->flink->blink = node->blink;
+	}
+
+	ndx = mm_size2ndx(node->size);
+	if (!heap->mm_nodelist[ndx].flink) {
+		heap->mm_sl_bitmap[MM_TLSF_FL(ndx)] &= ~(1U << MM_TLSF_SL(ndx));
+		if (!heap->mm_sl_bitmap[MM_TLSF_FL(ndx)]) {
+			heap->mm_fl_bitmap &= ~(1U << MM_TLSF_FL(ndx));
+		}
+	}
+}
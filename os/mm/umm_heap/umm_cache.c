@@ -0,0 +1,335 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/spinlock.h>
+#include <tinyara/mm/mm.h>
+
+#ifdef CONFIG_MM_SMALL_CACHE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Blocks are cached by their chunk size (including the allocation node), so
+ * every block of a class has exactly the same size.
+ */
+
+#define MM_CACHE_MAXCHUNK	MM_ALIGN_UP(CONFIG_MM_SMALL_CACHE_MAXSIZE + SIZEOF_MM_ALLOCNODE)
+#define MM_CACHE_NCLASSES	(MM_CACHE_MAXCHUNK >> MM_MIN_SHIFT)
+#define MM_CACHE_CLASS(c)	(((c) >> MM_MIN_SHIFT) - 1)
+
+#define MM_CACHE_DEPTH		CONFIG_MM_SMALL_CACHE_DEPTH
+#define MM_CACHE_BATCH		(MM_CACHE_DEPTH / 2)
+
+#ifdef CONFIG_RAM_MALLOC_PRIOR_INDEX
+#define MM_CACHE_HEAP		(&BASE_HEAP[CONFIG_RAM_MALLOC_PRIOR_INDEX])
+#else
+#define MM_CACHE_HEAP		(&BASE_HEAP[HEAP_START_IDX])
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One magazine set per CPU.  The lock is only contended by the garbage
+ * collection or by a task which migrated in the middle of an operation, so
+ * taking it is almost as cheap as disabling interrupts.
+ */
+
+struct mm_cache_s {
+	spinlock_t lock;
+	uint8_t count[MM_CACHE_NCLASSES];
+	FAR void *slot[MM_CACHE_NCLASSES][MM_CACHE_DEPTH];
+	struct mm_cache_stat_s stat;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct mm_cache_s g_mm_cache[CONFIG_SMP_NCPUS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: umm_cache_release
+ *
+ * Description:
+ *   Return a batch of cached blocks to the heap with one heap lock.
+ *
+ ****************************************************************************/
+
+static void umm_cache_release(FAR void **batch, int nblocks)
+{
+	FAR struct mm_heap_s *heap = MM_CACHE_HEAP;
+	int i;
+
+	mm_takesemaphore(heap);
+	for (i = 0; i < nblocks; i++) {
+		mm_free(heap, batch[i]);
+	}
+	mm_givesemaphore(heap);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: umm_cache_alloc
+ *
+ * Description:
+ *   Take a block for 'size' bytes from the magazine of the current CPU.
+ *   An empty magazine is refilled with MM_CACHE_BATCH blocks under one
+ *   heap lock.
+ *
+ * Return Value:
+ *   The address of the block, or NULL if the size is not cached or the
+ *   refill failed.  The caller then falls back to the regular heap.
+ *
+ ****************************************************************************/
+
+FAR void *umm_cache_alloc(size_t size)
+{
+	FAR struct mm_heap_s *heap = MM_CACHE_HEAP;
+	FAR struct mm_cache_s *cache;
+	FAR void *batch[MM_CACHE_BATCH];
+	FAR void *mem = NULL;
+	irqstate_t flags;
+	int nblocks;
+	int class;
+
+	if (size > CONFIG_MM_SMALL_CACHE_MAXSIZE) {
+		return NULL;
+	}
+
+	class = MM_CACHE_CLASS(MM_ALIGN_UP(size + SIZEOF_MM_ALLOCNODE));
+
+	/* Fast path, pop from the magazine of this CPU */
+
+	cache = &g_mm_cache[up_cpu_index()];
+	flags = spin_lock_irqsave(&cache->lock);
+	if (cache->count[class] > 0) {
+		mem = cache->slot[class][--cache->count[class]];
+		cache->stat.hits++;
+	} else {
+		cache->stat.misses++;
+	}
+	spin_unlock_irqrestore(&cache->lock, flags);
+
+	if (mem) {
+		return mem;
+	}
+
+	/* Slow path, allocate one block for the caller and a batch for the
+	 * magazine while holding the heap lock only once.  The magazine lock is
+	 * not held here because mm_malloc() may run the garbage collection.
+	 */
+
+	mm_takesemaphore(heap);
+	mem = mm_malloc(heap, size, NULL);
+	for (nblocks = 0; mem && nblocks < MM_CACHE_BATCH; nblocks++) {
+		batch[nblocks] = mm_malloc(heap, size, NULL);
+		if (!batch[nblocks]) {
+			break;
+		}
+	}
+	mm_givesemaphore(heap);
+
+	/* The task may have migrated meanwhile, so look the magazine up again.
+	 * Blocks which carried a split remainder have a larger chunk and must
+	 * not be cached in this class.
+	 */
+
+	cache = &g_mm_cache[up_cpu_index()];
+	flags = spin_lock_irqsave(&cache->lock);
+	cache->stat.refills++;
+	while (nblocks > 0 && cache->count[class] < MM_CACHE_DEPTH) {
+		FAR struct mm_allocnode_s *node = (FAR struct mm_allocnode_s *)((FAR char *)batch[nblocks - 1] - SIZEOF_MM_ALLOCNODE);
+		if (MM_CACHE_CLASS(node->size) != class) {
+			break;
+		}
+		cache->slot[class][cache->count[class]++] = batch[--nblocks];
+		cache->stat.cached++;
+	}
+	spin_unlock_irqrestore(&cache->lock, flags);
+
+	if (nblocks > 0) {
+		umm_cache_release(batch, nblocks);
+	}
+
+	return mem;
+}
+
+/****************************************************************************
+ * Name: umm_cache_free
+ *
+ * Description:
+ *   Put a freed block into the magazine of the current CPU.  A full
+ *   magazine is drained by MM_CACHE_BATCH blocks under one heap lock.
+ *
+ * Return Value:
+ *   true if the block was taken by the cache, false if the caller has to
+ *   free it to the heap.
+ *
+ ****************************************************************************/
+
+bool umm_cache_free(FAR void *mem)
+{
+	FAR struct mm_heap_s *heap = MM_CACHE_HEAP;
+	FAR struct mm_allocnode_s *node;
+	FAR struct mm_cache_s *cache;
+	FAR void *batch[MM_CACHE_BATCH];
+	irqstate_t flags;
+	int nblocks = 0;
+	int class;
+
+	if (!mem || mm_get_heap(mem) != heap) {
+		return false;
+	}
+
+	node = (FAR struct mm_allocnode_s *)((FAR char *)mem - SIZEOF_MM_ALLOCNODE);
+	if (node->size > MM_CACHE_MAXCHUNK) {
+		return false;
+	}
+
+	class = MM_CACHE_CLASS(node->size);
+
+	cache = &g_mm_cache[up_cpu_index()];
+	flags = spin_lock_irqsave(&cache->lock);
+	if (cache->count[class] == MM_CACHE_DEPTH) {
+		/* Draining needs the heap lock, which cannot be taken from an
+		 * interrupt handler.  Let mm_free() defer it instead.
+		 */
+
+		if (up_interrupt_context()) {
+			spin_unlock_irqrestore(&cache->lock, flags);
+			return false;
+		}
+
+		nblocks = MM_CACHE_BATCH;
+		cache->count[class] -= nblocks;
+		memcpy(batch, &cache->slot[class][cache->count[class]], nblocks * sizeof(FAR void *));
+		cache->stat.drains++;
+		cache->stat.cached -= nblocks;
+	}
+	cache->slot[class][cache->count[class]++] = mem;
+	cache->stat.cached++;
+	spin_unlock_irqrestore(&cache->lock, flags);
+
+	if (nblocks > 0) {
+		umm_cache_release(batch, nblocks);
+	}
+
+	return true;
+}
+
+/****************************************************************************
+ * Name: umm_cache_flush
+ *
+ * Description:
+ *   Return every cached block of every CPU to the heap.
+ *
+ ****************************************************************************/
+
+void umm_cache_flush(void)
+{
+	FAR struct mm_cache_s *cache;
+	FAR void *batch[MM_CACHE_DEPTH];
+	irqstate_t flags;
+	int nblocks;
+	int class;
+	int cpu;
+
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		cache = &g_mm_cache[cpu];
+		for (class = 0; class < MM_CACHE_NCLASSES; class++) {
+			flags = spin_lock_irqsave(&cache->lock);
+			nblocks = cache->count[class];
+			memcpy(batch, cache->slot[class], nblocks * sizeof(FAR void *));
+			cache->count[class] = 0;
+			cache->stat.cached -= nblocks;
+			if (nblocks > 0) {
+				cache->stat.flushes++;
+			}
+			spin_unlock_irqrestore(&cache->lock, flags);
+
+			if (nblocks > 0) {
+				umm_cache_release(batch, nblocks);
+			}
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: umm_cache_reclaim
+ *
+ * Description:
+ *   Called by sched_garbagecollection().  Flush the magazines only when the
+ *   largest free node of the heap drops below CONFIG_MM_SMALL_CACHE_LOWMEM,
+ *   so that the periodic garbage collection does not defeat the cache.
+ *   The IDLE thread may run the garbage collection and cannot wait for the
+ *   heap semaphore, so nothing is done if the heap is busy.
+ *
+ ****************************************************************************/
+
+void umm_cache_reclaim(void)
+{
+	FAR struct mm_heap_s *heap = MM_CACHE_HEAP;
+
+	if (mm_get_largest_freenode_size() >= CONFIG_MM_SMALL_CACHE_LOWMEM) {
+		return;
+	}
+
+	if (mm_trysemaphore(heap) != OK) {
+		return;
+	}
+
+	umm_cache_flush();
+	mm_givesemaphore(heap);
+}
+
+/****************************************************************************
+ * Name: umm_cache_getstat
+ *
+ * Description:
+ *   Copy the statistics of the magazines of one CPU.
+ *
+ ****************************************************************************/
+
+void umm_cache_getstat(int cpu, FAR struct mm_cache_stat_s *stat)
+{
+	DEBUGASSERT(cpu >= 0 && cpu < CONFIG_SMP_NCPUS && stat);
+	memcpy(stat, &g_mm_cache[cpu].stat, sizeof(struct mm_cache_stat_s));
+}
+
+#endif /* CONFIG_MM_SMALL_CACHE */
@@ -82,6 +82,13 @@
 void free(FAR void *mem)
 {
 	struct mm_heap_s *heap;
+
+#ifdef CONFIG_MM_SMALL_CACHE
+	if (umm_cache_free(mem)) {
+		return;
+	}
+#endif
+
 	heap = mm_get_heap(mem);
 	if (heap) {
 		mm_free(heap, mem);
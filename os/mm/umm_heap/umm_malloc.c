@@ -229,6 +229,15 @@ FAR void *malloc(size_t size)
 	heap_idx = CONFIG_RAM_MALLOC_PRIOR_INDEX;
 #endif
 
+#ifdef CONFIG_MM_SMALL_CACHE
+	/* Small blocks come from the per-CPU magazines first */
+
+	ret = umm_cache_alloc(size);
+	if (ret != NULL) {
+		return ret;
+	}
+#endif
+
 	ret = heap_malloc(size, heap_idx, HEAP_END_IDX, caller_retaddr);
 	if (ret != NULL) {
 		return ret;
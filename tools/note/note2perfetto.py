@@ -0,0 +1,308 @@
+#!/usr/bin/env python
+############################################################################
+#
+# Copyright 2026 Samsung Electronics All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+# either express or implied. See the License for the specific
+# language governing permissions and limitations under the License.
+#
+############################################################################
+
+import argparse
+import json
+import os
+import re
+import sys
+
+# enum note_type_e of os/include/tinyara/sched_note.h
+
+NOTE_START = 0
+NOTE_STOP = 1
+NOTE_SUSPEND = 2
+NOTE_RESUME = 3
+NOTE_CPU_START = 4
+NOTE_CPU_STARTED = 5
+NOTE_CPU_PAUSE = 6
+NOTE_CPU_PAUSED = 7
+NOTE_CPU_RESUME = 8
+NOTE_CPU_RESUMED = 9
+NOTE_PREEMPT_LOCK = 10
+NOTE_PREEMPT_UNLOCK = 11
+NOTE_CSECTION_ENTER = 12
+NOTE_CSECTION_LEAVE = 13
+NOTE_SPINLOCK_LOCK = 14
+NOTE_SPINLOCK_LOCKED = 15
+NOTE_SPINLOCK_UNLOCK = 16
+NOTE_SPINLOCK_ABORT = 17
+NOTE_SYSCALL_ENTER = 18
+NOTE_SYSCALL_LEAVE = 19
+NOTE_IRQ_ENTER = 20
+NOTE_IRQ_LEAVE = 21
+NOTE_DUMP_STRING = 22
+NOTE_DUMP_BINARY = 23
+NOTE_SEM_ACQUIRE = 24
+NOTE_SEM_WAITING = 25
+NOTE_SEM_RELEASE = 26
+
+CPU_EVENTS = {
+    NOTE_CPU_START: "cpu start",
+    NOTE_CPU_STARTED: "cpu started",
+    NOTE_CPU_PAUSE: "cpu pause",
+    NOTE_CPU_PAUSED: "cpu paused",
+    NOTE_CPU_RESUME: "cpu resume",
+    NOTE_CPU_RESUMED: "cpu resumed",
+}
+
+SPINLOCK_EVENTS = {
+    NOTE_SPINLOCK_LOCK: "spin lock",
+    NOTE_SPINLOCK_LOCKED: "spin locked",
+    NOTE_SPINLOCK_UNLOCK: "spin unlock",
+    NOTE_SPINLOCK_ABORT: "spin abort",
+}
+
+SEM_EVENTS = {
+    NOTE_SEM_ACQUIRE: "sem acquire",
+    NOTE_SEM_WAITING: "sem waiting",
+    NOTE_SEM_RELEASE: "sem release",
+}
+
+# Perfetto groups the tracks by process: the CPUs show which task runs and
+# which IRQ is handled, the tasks show their syscalls and other events.
+
+CPUS_PID = 0
+TASKS_PID = 1
+IRQ_TID_BASE = 1000
+
+
+def le_int(data, signed=False):
+    value = 0
+    for i, byte in enumerate(bytearray(data)):
+        value |= byte << (8 * i)
+    if signed and data and value >= 1 << (8 * len(data) - 1):
+        value -= 1 << (8 * len(data))
+    return value
+
+
+class NoteParser(object):
+    def __init__(self, smp, pid_size, time_size, long_size, ptr_size):
+        self.smp = smp
+        self.pid_size = pid_size
+        self.time_size = time_size
+        self.long_size = long_size
+        self.ptr_size = ptr_size
+        self.hdr_size = 3 + (1 if smp else 0) + pid_size + time_size + long_size
+
+    def parse(self, data):
+        offset = 0
+        while offset < len(data):
+            length = bytearray(data[offset:offset + 1])[0]
+            if length < self.hdr_size or offset + length > len(data):
+                sys.stderr.write("Broken note at offset %d, length %d\n" % (offset, length))
+                break
+            yield self.parse_note(data[offset:offset + length])
+            offset += length
+
+    def parse_note(self, note):
+        pos = 3
+        cpu = 0
+        if self.smp:
+            cpu = bytearray(note[pos:pos + 1])[0]
+            pos += 1
+        pid = le_int(note[pos:pos + self.pid_size], True)
+        pos += self.pid_size
+        sec = le_int(note[pos:pos + self.time_size])
+        pos += self.time_size
+        nsec = le_int(note[pos:pos + self.long_size])
+        pos += self.long_size
+
+        return {
+            "type": bytearray(note[1:2])[0],
+            "priority": bytearray(note[2:3])[0],
+            "cpu": cpu,
+            "pid": pid,
+            "ts": sec * 1000000.0 + nsec / 1000.0,
+            "payload": note[pos:],
+        }
+
+
+class TraceBuilder(object):
+    def __init__(self, parser):
+        self.parser = parser
+        self.events = []
+        self.names = {}
+        self.cpus = set()
+        self.running = {}
+        self.syscalls = {}
+        self.irqs = {}
+
+    def task_name(self, pid):
+        return self.names.get(pid, "pid %d" % pid)
+
+    def add(self, ph, name, ts, pid, tid, args=None, **extra):
+        event = {"ph": ph, "name": name, "ts": ts, "pid": pid, "tid": tid}
+        if args:
+            event["args"] = args
+        event.update(extra)
+        self.events.append(event)
+
+    def task_event(self, note, name, args=None):
+        self.add("i", name, note["ts"], TASKS_PID, note["pid"], args, s="t")
+
+    def close_running(self, cpu, ts):
+        if cpu in self.running:
+            pid, start, priority = self.running.pop(cpu)
+            self.add("X", self.task_name(pid), start, CPUS_PID, cpu,
+                     {"pid": pid, "priority": priority}, dur=max(ts - start, 0))
+
+    def feed(self, note):
+        ntype = note["type"]
+        payload = note["payload"]
+        ts = note["ts"]
+        cpu = note["cpu"]
+        pid = note["pid"]
+        ptr = self.parser.ptr_size
+
+        self.cpus.add(cpu)
+
+        if ntype == NOTE_START:
+            name = payload.split(b"\0")[0].decode("utf-8", "replace")
+            if name:
+                self.names[pid] = name
+            self.task_event(note, "start", {"priority": note["priority"]})
+        elif ntype == NOTE_STOP:
+            self.task_event(note, "stop")
+        elif ntype == NOTE_SUSPEND:
+            self.task_event(note, "suspend", {"state": le_int(payload[:1])})
+        elif ntype == NOTE_RESUME:
+            self.close_running(cpu, ts)
+            self.running[cpu] = (pid, ts, note["priority"])
+        elif ntype in CPU_EVENTS:
+            args = {"target": le_int(payload[:1])} if payload else None
+            self.add("i", CPU_EVENTS[ntype], ts, CPUS_PID, cpu, args, s="t")
+        elif ntype in (NOTE_PREEMPT_LOCK, NOTE_PREEMPT_UNLOCK):
+            name = "preempt lock" if ntype == NOTE_PREEMPT_LOCK else "preempt unlock"
+            self.task_event(note, name, {"count": le_int(payload[:2])})
+        elif ntype in (NOTE_CSECTION_ENTER, NOTE_CSECTION_LEAVE):
+            self.add("B" if ntype == NOTE_CSECTION_ENTER else "E", "csection", ts, TASKS_PID, pid)
+        elif ntype in SPINLOCK_EVENTS:
+            self.task_event(note, SPINLOCK_EVENTS[ntype],
+                            {"lock": "0x%x" % le_int(payload[:ptr]),
+                             "value": le_int(payload[ptr:ptr + 1])})
+        elif ntype == NOTE_SYSCALL_ENTER:
+            nr = le_int(payload[:1])
+            argc = le_int(payload[1:2])
+            args = {"nr": nr}
+            for i in range(argc):
+                arg = payload[2 + i * ptr:2 + (i + 1) * ptr]
+                if len(arg) == ptr:
+                    args["arg%d" % i] = "0x%x" % le_int(arg)
+            self.syscalls[pid] = self.syscalls.get(pid, 0) + 1
+            self.add("B", "syscall %d" % nr, ts, TASKS_PID, pid, args)
+        elif ntype == NOTE_SYSCALL_LEAVE:
+            # A syscall entered before the recording started has no begin
+            if self.syscalls.get(pid, 0) > 0:
+                self.syscalls[pid] -= 1
+                self.add("E", "syscall %d" % le_int(payload[:1]), ts, TASKS_PID, pid,
+                         {"result": le_int(payload[1:1 + ptr], True)})
+        elif ntype == NOTE_IRQ_ENTER:
+            self.irqs[cpu] = self.irqs.get(cpu, 0) + 1
+            self.add("B", "irq %d" % le_int(payload[:1]), ts, CPUS_PID, IRQ_TID_BASE + cpu)
+        elif ntype == NOTE_IRQ_LEAVE:
+            if self.irqs.get(cpu, 0) > 0:
+                self.irqs[cpu] -= 1
+                self.add("E", "irq %d" % le_int(payload[:1]), ts, CPUS_PID, IRQ_TID_BASE + cpu)
+        elif ntype == NOTE_DUMP_STRING:
+            text = payload[ptr:].split(b"\0")[0].decode("utf-8", "replace")
+            self.task_event(note, text, {"ip": "0x%x" % le_int(payload[:ptr])})
+        elif ntype == NOTE_DUMP_BINARY:
+            event = le_int(payload[ptr:ptr + 1])
+            data = bytearray(payload[ptr + 1:])
+            self.task_event(note, "dump %d" % event,
+                            {"ip": "0x%x" % le_int(payload[:ptr]),
+                             "data": " ".join("%02x" % b for b in data)})
+        elif ntype in SEM_EVENTS:
+            self.task_event(note, SEM_EVENTS[ntype],
+                            {"sem": "0x%x" % le_int(payload[:ptr]),
+                             "count": le_int(payload[ptr:ptr + 2], True)})
+        else:
+            sys.stderr.write("Unknown note type %d\n" % ntype)
+
+    def finish(self):
+        last = max([e["ts"] for e in self.events] + [r[1] for r in self.running.values()] + [0])
+        for cpu in list(self.running.keys()):
+            self.close_running(cpu, last)
+
+        meta = [
+            {"ph": "M", "name": "process_name", "pid": CPUS_PID, "args": {"name": "CPUs"}},
+            {"ph": "M", "name": "process_name", "pid": TASKS_PID, "args": {"name": "Tasks"}},
+        ]
+        for cpu in sorted(self.cpus):
+            meta.append({"ph": "M", "name": "thread_name", "pid": CPUS_PID, "tid": cpu,
+                         "args": {"name": "CPU %d" % cpu}})
+            meta.append({"ph": "M", "name": "thread_name", "pid": CPUS_PID, "tid": IRQ_TID_BASE + cpu,
+                         "args": {"name": "CPU %d IRQ" % cpu}})
+        pids = set(e["tid"] for e in self.events if e["pid"] == TASKS_PID)
+        for pid in sorted(pids):
+            meta.append({"ph": "M", "name": "thread_name", "pid": TASKS_PID, "tid": pid,
+                         "args": {"name": "%s (%d)" % (self.task_name(pid), pid)}})
+
+        return {"traceEvents": meta + self.events, "displayTimeUnit": "ns"}
+
+
+def read_hex(path):
+    # Take the hex bytes of the "noteperf dump" output, skipping the lines
+    # which are not hex dump like the shell prompt.
+    data = bytearray()
+    with open(path, "r") as fp:
+        for line in fp:
+            words = line.split()
+            if words and all(re.match(r"^[0-9a-fA-F]{2}$", w) for w in words):
+                data.extend(int(w, 16) for w in words)
+    return bytes(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert the scheduler notes of /dev/note to a Chrome / Perfetto trace")
+    parser.add_argument("input", help="notes read from /dev/note, raw or in hex with --hex")
+    parser.add_argument("output", nargs="?", help="trace file, {input}.json by default")
+    parser.add_argument("--hex", action="store_true", help="input is the hex dump of 'noteperf dump'")
+    parser.add_argument("--smp", action="store_true", help="notes have a CPU field (CONFIG_SMP)")
+    parser.add_argument("--pid-size", type=int, default=2, help="sizeof(pid_t), 2 by default")
+    parser.add_argument("--time-size", type=int, default=4, help="sizeof(time_t), 4 by default")
+    parser.add_argument("--long-size", type=int, default=4, help="sizeof(long), 4 by default")
+    parser.add_argument("--ptr-size", type=int, default=4, help="sizeof(uintptr_t), 4 by default")
+    args = parser.parse_args()
+
+    if args.hex:
+        data = read_hex(args.input)
+    else:
+        with open(args.input, "rb") as fp:
+            data = fp.read()
+
+    output = args.output or os.path.splitext(args.input)[0] + ".json"
+
+    notes = NoteParser(args.smp, args.pid_size, args.time_size, args.long_size, args.ptr_size)
+    trace = TraceBuilder(notes)
+    count = 0
+    for note in notes.parse(data):
+        trace.feed(note)
+        count += 1
+
+    with open(output, "w") as fp:
+        json.dump(trace.finish(), fp, indent=1)
+
+    print("%d notes converted to %s" % (count, output))
+
+
+if __name__ == "__main__":
+    main()